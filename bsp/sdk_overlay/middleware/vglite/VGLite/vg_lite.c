@@ -25,8 +25,10 @@
 *    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
 *    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *
-*    Copyright 2020-2023 MicroEJ Corp. This file has been modified by MicroEJ Corp.
+*    Copyright 2020-2025 MicroEJ Corp. This file has been modified by MicroEJ Corp.
 *    1. Add "vg_lite_get_scissor()"
+*    2. Single thread: submit a full command buffer without waiting for its completion
+*    3. Add "vg_lite_wait_submitted()"
 *
 *****************************************************************************/
 
@@ -4255,6 +4257,21 @@ static vg_lite_error_t update_context_buffer()
 #endif /* not defined(VG_DRIVER_SINGLE_THREAD) */
 
 #if defined(VG_DRIVER_SINGLE_THREAD)
+/* Submit the full command buffer without waiting for its completion and continue in the other command
+ * buffer (modified by MicroEJ): the GPU executes the submitted commands while the CPU fills the other
+ * command buffer. submit() waits for the completion of the previously submitted command buffer (the
+ * fence of the other command buffer, see submit_flag) before reusing it. */
+static vg_lite_error_t swap_command_buffer(vg_lite_context_t * context)
+{
+    vg_lite_error_t error;
+
+    VG_LITE_RETURN_ERROR(submit(context));
+    CMDBUF_SWAP(*context);
+    CMDBUF_OFFSET(*context) = 0;
+
+    return VG_LITE_SUCCESS;
+}
+
 /* Push a state array into current command buffer. */
 static vg_lite_error_t push_states(vg_lite_context_t * context, uint32_t address, uint32_t count, uint32_t *data)
 {
@@ -4264,8 +4281,7 @@ static vg_lite_error_t push_states(vg_lite_context_t * context, uint32_t address
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 8 + VG_LITE_ALIGN(count + 1, 2) * 4 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_STATES(count, address);
@@ -4290,8 +4306,7 @@ static vg_lite_error_t push_state(vg_lite_context_t * context, uint32_t address,
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_STATE(address);
@@ -4311,8 +4326,7 @@ static vg_lite_error_t push_state_ptr(vg_lite_context_t * context, uint32_t addr
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_STATE(address);
@@ -4331,8 +4345,7 @@ static vg_lite_error_t push_call(vg_lite_context_t * context, uint32_t address,
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_CALL((bytes + 7) / 8);
@@ -4351,8 +4364,7 @@ static vg_lite_error_t push_rectangle(vg_lite_context_t * context, int x, int y,
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_DATA(1);
@@ -4377,8 +4389,7 @@ static vg_lite_error_t push_data(vg_lite_context_t * context, int size, void * d
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 + bytes >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint64_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[(bytes / 8)] = 0;
@@ -4399,8 +4410,7 @@ static vg_lite_error_t push_stall(vg_lite_context_t * context, uint32_t module)
         return VG_LITE_NO_CONTEXT;
 
     if (CMDBUF_OFFSET(*context) + 16 >= CMDBUF_SIZE(*context)) {
-        VG_LITE_RETURN_ERROR(submit(context));
-        VG_LITE_RETURN_ERROR(stall(context, 0, (uint32_t)~0));
+        VG_LITE_RETURN_ERROR(swap_command_buffer(context));
     }
 
     ((uint32_t *) (CMDBUF_BUFFER(*context) + CMDBUF_OFFSET(*context)))[0] = VG_LITE_SEMAPHORE(module);
@@ -7658,6 +7668,20 @@ vg_lite_error_t vg_lite_flush(void)
 
     return VG_LITE_SUCCESS;
 }
+
+// added by MicroEJ
+vg_lite_error_t vg_lite_wait_submitted(void)
+{
+    vg_lite_error_t error;
+
+    /* Wait if GPU has not completed previous CMD buffer */
+    if (submit_flag)
+    {
+        VG_LITE_RETURN_ERROR(stall(&s_context, 0, (uint32_t)~0));
+    }
+
+    return VG_LITE_SUCCESS;
+}
 #else
 vg_lite_error_t vg_lite_finish()
 {
@@ -25,8 +25,9 @@
 *    TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
 *    SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 *
-*    Copyright 2022-2023 MicroEJ Corp. This file has been modified by MicroEJ Corp.
+*    Copyright 2022-2025 MicroEJ Corp. This file has been modified by MicroEJ Corp.
 *    1. Add "vg_lite_get_scissor()"
+*    2. Add "vg_lite_wait_submitted()"
 *
 *****************************************************************************/
 
@@ -1053,6 +1054,20 @@ extern "C" {
      */
     vg_lite_error_t vg_lite_flush(void);
 
+    /*!
+     @abstract This api waits for the completion of the command buffer previously submitted to GPU (if any)
+     without submitting the current command buffer (single thread mode only).
+
+     @discussion
+      The driver uses two command buffers: the CPU fills one of them while the GPU executes the other one.
+
+     @param none.
+
+     @result
+     Returns the status as defined by <code>vg_lite_error_t</code>.
+     */
+    vg_lite_error_t vg_lite_wait_submitted(void); // added by MicroEJ
+
     /*!
      @abstract Draw a path to a target buffer.
 
@@ -35,6 +35,32 @@ extern "C" {
  */
 #define DISPLAY_PANEL_HEIGHT (1280)
 
+/*
+ * @brief Clockwise rotation (in degrees) of the MicroUI display relative to the display
+ * panel: 0, 90, 180 or 270.
+ *
+ * When the rotation is not 0, MicroUI draws in a logical buffer whose size is the size
+ * of the rotated panel (the drawings keep using the logical coordinates and are not
+ * transformed). At each flush, the GPU rotates the dirty regions of the logical buffer
+ * into the frame buffer to display: one rotated blit per region, once per frame. The
+ * touch coordinates are rotated back to the logical coordinates.
+ *
+ * The rotation requires the strategy UI_FEATURE_BRS_SINGLE with
+ * UI_FEATURE_BRS_DRAWING_BUFFER_COUNT set to 1 (see ui_configuration.h) and at least two
+ * frame buffers. The rotation uses the GPU only: there is no PXP path (the PXP driver is
+ * not part of this BSP).
+ *
+ * The logical buffer is placed after the FRAME_BUFFER_COUNT frame buffers, below
+ * FRAME_BUFFER_END_ADDRESS (see display_rotation.h): the SDRAM area of the frame buffers
+ * holds four RGB565 buffers of the panel or two XRGB8888 buffers. The logical buffer takes
+ * the place of one of them: the rotation is available with the RGB565 frame buffers (three
+ * frame buffers at most) and not with the XRGB8888 frame buffers (the two frame buffers
+ * fill the area). Any other configuration does not build.
+ */
+#ifndef DISPLAY_ROTATION
+#define DISPLAY_ROTATION (0)
+#endif
+
 /*
  * @brief Width of the frame buffers
  */
@@ -61,9 +87,28 @@ extern "C" {
 #define FRAME_BUFFER_LINE_ALIGN_BYTE (1) /* 1 | VGLITE_IMAGE_LINE_ALIGN_BYTE */
 
 /*
- * @brief Available number of frame buffers
+ * @brief Number of bytes per pixel of the frame buffers: 2 (RGB565) by default, 4
+ * (XRGB8888) when DEMO_USE_XRGB8888 is set to 1 in the compilation flags (see
+ * display_support.h).
+ * This pixel format is used by the LCDIF, by the VGLite frame buffers and by the restoration
+ * of the back buffer. The RGB565 frame buffers halve the memory bandwidth of the
+ * drawings, the restorations and the flushes.
+ *
+ * The MicroUI display format must be consistent: set the property
+ * "com.microej.pack.display.bpp" to "RGB565" or "ARGB8888" in configuration.properties.
+ */
+#define FRAME_BUFFER_BYTE_PER_PIXEL (DEMO_BUFFER_BYTE_PER_PIXEL)
+
+/*
+ * @brief Available number of frame buffers: three RGB565 frame buffers or two XRGB8888
+ * frame buffers (three XRGB8888 frame buffers do not fit the SDRAM, see
+ * FRAME_BUFFER_END_ADDRESS in display_framebuffer.h).
  */
+#if (4 == FRAME_BUFFER_BYTE_PER_PIXEL)
+#define FRAME_BUFFER_COUNT (2)
+#else
 #define FRAME_BUFFER_COUNT (3)
+#endif
 
 // -----------------------------------------------------------------------------
 // EOF
@@ -31,11 +31,6 @@ extern "C" {
 // Macros and Defines
 // -----------------------------------------------------------------------------
 
-/*
- * @brief Available number of bytes per pixels (RGB565)
- */
-#define FRAME_BUFFER_BYTE_PER_PIXEL (2)
-
 /*
  * @brief Frame buffer alignment. 
  * - 4 bits are required by SMARTDMA
@@ -62,15 +57,41 @@ extern "C" {
  */
 #define FRAME_BUFFER_STRIDE_PIXELS (FRAME_BUFFER_STRIDE_BYTE / FRAME_BUFFER_BYTE_PER_PIXEL)
 
+/*
+ * @brief The frame buffers are placed after the VGLite heap, at the end of the SDRAM.
+ */
+#define FRAME_BUFFER_START_ADDRESS (0x83880000)
+#define FRAME_BUFFER_END_ADDRESS (0x84000000)
+
+/*
+ * @brief Size of a frame buffer: 0x1C2000 for the RGB565 frame buffers, 0x384000 for
+ * the XRGB8888 frame buffers (see FRAME_BUFFER_BYTE_PER_PIXEL).
+ */
+#define FRAME_BUFFER_SIZE ALIGN(FRAME_BUFFER_STRIDE_BYTE * FRAME_BUFFER_HEIGHT, FRAME_BUFFER_ALIGN)
+
+/*
+ * @brief Address of a frame buffer: the frame buffers are contiguous.
+ */
+#define FRAME_BUFFER_ADDRESS(index) (FRAME_BUFFER_START_ADDRESS + ((index) * FRAME_BUFFER_SIZE))
+
 // -----------------------------------------------------------------------------
 // Types
 // -----------------------------------------------------------------------------
 
+/*
+ * @brief Frame buffer pixel type
+ */
+#if (4 == FRAME_BUFFER_BYTE_PER_PIXEL)
+typedef uint32_t framebuffer_pixel_t;
+#else
+typedef uint16_t framebuffer_pixel_t;
+#endif
+
 /*
  * @brief Frame buffer structure definition
  */
 typedef struct s_framebuffer {
-	uint16_t p[FRAME_BUFFER_HEIGHT][FRAME_BUFFER_STRIDE_PIXELS];
+	framebuffer_pixel_t p[FRAME_BUFFER_HEIGHT][FRAME_BUFFER_STRIDE_PIXELS];
 } framebuffer_t;
 
 // -----------------------------------------------------------------------------
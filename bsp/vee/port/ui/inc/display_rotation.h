@@ -0,0 +1,160 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef DISPLAY_ROTATION_H
+#define DISPLAY_ROTATION_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Rotation of the MicroUI display relative to the display panel (see DISPLAY_ROTATION):
+ * placement of the logical buffer MicroUI draws into, mapping of the logical coordinates on the
+ * panel coordinates and matrix of the rotated blits.
+ *
+ * The logical buffer is rotated clockwise on the panel: with a rotation of 90 degrees, the
+ * top-left pixel of the logical buffer is the top-right pixel of the panel. The blits
+ * (LLUI_DISPLAY_impl.c) and the touch events (touch_manager.c) use the same mapping.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+
+#include "display_framebuffer.h"
+#include "ui_rect.h"
+#include "vg_lite.h"
+
+#if (0 != DISPLAY_ROTATION)
+
+#if (90 != DISPLAY_ROTATION) && (180 != DISPLAY_ROTATION) && (270 != DISPLAY_ROTATION)
+#error "DISPLAY_ROTATION must be 0, 90, 180 or 270"
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Size of the logical buffer (the panel rotated by DISPLAY_ROTATION)
+ */
+#if (180 == DISPLAY_ROTATION)
+#define LOGICAL_BUFFER_WIDTH (FRAME_BUFFER_WIDTH)
+#define LOGICAL_BUFFER_HEIGHT (FRAME_BUFFER_HEIGHT)
+#else
+#define LOGICAL_BUFFER_WIDTH (FRAME_BUFFER_HEIGHT)
+#define LOGICAL_BUFFER_HEIGHT (FRAME_BUFFER_WIDTH)
+#endif
+
+/*
+ * @brief The logical buffer is placed after the frame buffers, in the same SDRAM area.
+ */
+#define LOGICAL_BUFFER_STRIDE_BYTE (LOGICAL_BUFFER_WIDTH * FRAME_BUFFER_BYTE_PER_PIXEL)
+#define LOGICAL_BUFFER_SIZE ALIGN(LOGICAL_BUFFER_STRIDE_BYTE * LOGICAL_BUFFER_HEIGHT, FRAME_BUFFER_ALIGN)
+#define LOGICAL_BUFFER_ADDRESS FRAME_BUFFER_ADDRESS(FRAME_BUFFER_COUNT)
+
+#if ((LOGICAL_BUFFER_ADDRESS + LOGICAL_BUFFER_SIZE) > FRAME_BUFFER_END_ADDRESS)
+#error "The logical buffer does not fit after the frame buffers: use the RGB565 frame buffers (see DISPLAY_ROTATION)"
+#endif
+
+// -----------------------------------------------------------------------------
+// Functions
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Gets the pixel of the panel that displays a pixel of the logical buffer.
+ *
+ * @param[in] x the x coordinate in the logical buffer.
+ * @param[in] y the y coordinate in the logical buffer.
+ * @param[out] panel_x the x coordinate in the panel.
+ * @param[out] panel_y the y coordinate in the panel.
+ */
+static inline void DISPLAY_ROTATION_get_panel_point(int32_t x, int32_t y, int32_t *panel_x, int32_t *panel_y) {
+#if (90 == DISPLAY_ROTATION)
+	*panel_x = FRAME_BUFFER_WIDTH - 1 - y;
+	*panel_y = x;
+#elif (180 == DISPLAY_ROTATION)
+	*panel_x = FRAME_BUFFER_WIDTH - 1 - x;
+	*panel_y = FRAME_BUFFER_HEIGHT - 1 - y;
+#else
+	*panel_x = y;
+	*panel_y = FRAME_BUFFER_HEIGHT - 1 - x;
+#endif
+}
+
+/*
+ * @brief Gets the pixel of the logical buffer displayed by a pixel of the panel (for instance
+ * a touch event).
+ *
+ * @param[in] panel_x the x coordinate in the panel.
+ * @param[in] panel_y the y coordinate in the panel.
+ * @param[out] x the x coordinate in the logical buffer.
+ * @param[out] y the y coordinate in the logical buffer.
+ */
+static inline void DISPLAY_ROTATION_get_logical_point(int32_t panel_x, int32_t panel_y, int32_t *x, int32_t *y) {
+#if (90 == DISPLAY_ROTATION)
+	*x = panel_y;
+	*y = FRAME_BUFFER_WIDTH - 1 - panel_x;
+#elif (180 == DISPLAY_ROTATION)
+	*x = FRAME_BUFFER_WIDTH - 1 - panel_x;
+	*y = FRAME_BUFFER_HEIGHT - 1 - panel_y;
+#else
+	*x = FRAME_BUFFER_HEIGHT - 1 - panel_y;
+	*y = panel_x;
+#endif
+}
+
+/*
+ * @brief Gets the matrix of the blit of a region of the logical buffer into a frame buffer
+ * (see vg_lite_blit_rect()): the matrix applies to the coordinates in the region and maps
+ * the top-left corner of the region to its rotated position in the frame buffer.
+ *
+ * @param[in] area the region of the logical buffer.
+ * @param[out] matrix the matrix of the blit.
+ */
+static inline void DISPLAY_ROTATION_get_blit_matrix(const ui_rect_t *area, vg_lite_matrix_t *matrix) {
+	(void)memset(matrix, 0, sizeof(vg_lite_matrix_t));
+	matrix->m[2][2] = 1.f;
+
+#if (90 == DISPLAY_ROTATION)
+	// (x, y) -> (width - y, x)
+	matrix->m[0][1] = -1.f;
+	matrix->m[0][2] = (vg_lite_float_t)(FRAME_BUFFER_WIDTH - area->y1);
+	matrix->m[1][0] = 1.f;
+	matrix->m[1][2] = (vg_lite_float_t)area->x1;
+#elif (180 == DISPLAY_ROTATION)
+	// (x, y) -> (width - x, height - y)
+	matrix->m[0][0] = -1.f;
+	matrix->m[0][2] = (vg_lite_float_t)(FRAME_BUFFER_WIDTH - area->x1);
+	matrix->m[1][1] = -1.f;
+	matrix->m[1][2] = (vg_lite_float_t)(FRAME_BUFFER_HEIGHT - area->y1);
+#else
+	// (x, y) -> (y, height - x)
+	matrix->m[0][1] = 1.f;
+	matrix->m[0][2] = (vg_lite_float_t)area->y1;
+	matrix->m[1][0] = -1.f;
+	matrix->m[1][2] = (vg_lite_float_t)(FRAME_BUFFER_HEIGHT - area->x1);
+#endif
+}
+
+#endif // DISPLAY_ROTATION
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DISPLAY_ROTATION_H
@@ -115,6 +115,34 @@ int32_t EVENT_GENERATOR_touch_moved(int32_t x, int32_t y);
  */
 int32_t EVENT_GENERATOR_touch_released(void);
 
+/*
+ * @brief Notifies to the event generator a touch has been pressed at the given time.
+ *
+ * @param x the pointer X coordinate
+ * @param y the pointer Y coordinate
+ * @param time the platform time (in milliseconds) when the touch has been sampled
+ * @return {@link LLUI_INPUT_OK} if all events have been added, {@link LLUI_INPUT_NOK} otherwise
+ */
+int32_t EVENT_GENERATOR_touch_pressed_at(int32_t x, int32_t y, int64_t time);
+
+/*
+ * @brief Notifies to the event generator a touch has moved at the given time.
+ *
+ * @param x the pointer X coordinate
+ * @param y the pointer Y coordinate
+ * @param time the platform time (in milliseconds) when the touch has been sampled
+ * @return {@link LLUI_INPUT_OK} if all events have been added, {@link LLUI_INPUT_NOK} otherwise
+ */
+int32_t EVENT_GENERATOR_touch_moved_at(int32_t x, int32_t y, int64_t time);
+
+/*
+ * @brief Notifies the event generator a touch has been released at the given time.
+ *
+ * @param time the platform time (in milliseconds) when the release has been sampled
+ * @return {@link LLUI_INPUT_OK} if all events have been added, {@link LLUI_INPUT_NOK} otherwise
+ */
+int32_t EVENT_GENERATOR_touch_released_at(int64_t time);
+
 /*
  * @brief Notifies the event generator that a state has changed.
  *
@@ -134,6 +162,65 @@ int EVENT_GENERATOR_register_special_cb(
 		EVENT_GENERATOR_special_cb_t callback,
 		unsigned int event);
 
+/* Touch timestamps ----------------------------------------------------------*/
+
+/*
+ * The MicroUI touch events do not hold the time when the touch has been sampled: the
+ * application only knows when it handles the events, which depends on the load of the
+ * MicroUI thread. The event generator numbers the touch events added to the MicroUI
+ * events queue (press, move and release) and keeps the sample times of the latest
+ * EVENT_GENERATOR_TOUCH_TIMES events. The application counts the touch events it
+ * handles and retrieves their sample times (velocity, fling, etc.) with the class
+ * com.nxp.event.TouchTimes (project vee-port/natives):
+ *
+ *   native int getTouchEventCount();   // number of touch events added to the queue
+ *   native long getTouchEventTime(int event); // sample time of the event, -1 when unknown
+ *
+ * The events not added (the MicroUI events queue is full) are not numbered. MicroUI
+ * replaces a move event not read yet by the next move event: the event keeps its number
+ * and takes the sample time of the latest move. The replacements are reported by the
+ * MicroUI queue logger (UI_FEATURE_EVENT_DECODER or UI_FEATURE_EVENT_RECORDER); without
+ * logger, each move event is numbered and the numbers drift when moves are replaced.
+ */
+
+/*
+ * @brief Number of touch event times kept by the event generator.
+ */
+#define EVENT_GENERATOR_TOUCH_TIMES (32)
+
+/*
+ * @brief Java native: gets the number of touch events added to the MicroUI events queue
+ * since the startup.
+ *
+ * @return the number of touch events (the number of the latest event)
+ */
+int32_t Java_com_nxp_event_TouchTimes_getTouchEventCount(void);
+
+/*
+ * @brief Java native: gets the platform time when a touch event has been sampled.
+ *
+ * @param event the number of the touch event (from 1 to getTouchEventCount())
+ * @return the platform time in milliseconds, or -1 when the event is too old
+ */
+int64_t Java_com_nxp_event_TouchTimes_getTouchEventTime(int32_t event);
+
+/*
+ * @brief Called by the MicroUI queue logger when the first element of an event is added
+ * to the queue.
+ *
+ * @param event the first element of the event
+ * @param index the index of the element in the queue
+ */
+void EVENT_GENERATOR_log_queue_event(uint32_t event, uint32_t index);
+
+/*
+ * @brief Called by the MicroUI queue logger when an element of the queue is replaced.
+ *
+ * @param index the index of the element in the queue
+ * @param queue_length the length of the queue
+ */
+void EVENT_GENERATOR_log_queue_replace(uint32_t index, uint32_t queue_length);
+
 #endif
 
 // -----------------------------------------------------------------------------
@@ -42,6 +42,90 @@ void framerate_increment(void);
  */
 uint32_t framerate_get(void);
 
+/* Frame timeline ------------------------------------------------------------*/
+
+/*
+ * The stages of the frames measured by the frame timeline.
+ *
+ * The time of the Graphics Engine is charged to one stage at a time: the drawing by
+ * default, the other stages between framerate_stage_enter() and framerate_stage_leave().
+ * The stages are exclusive: a GPU wait during a restoration or during a flush is only
+ * counted as a GPU wait. A frame ends at the end of the flush and starts at its first
+ * drawing (see framerate_frame_start(), called by the buffer refresh strategy) or at the
+ * end of the previous flush.
+ */
+typedef enum
+{
+	FRAMERATE_STAGE_FRAME = 0,	// whole frame: sum of the drawing, restore, GPU wait and flush stages
+	FRAMERATE_STAGE_DRAWING,	// Java drawing
+	FRAMERATE_STAGE_RESTORE,	// restoration of the back buffer (BRS)
+	FRAMERATE_STAGE_GPU_WAIT,	// waits for the end of the GPU operations
+	FRAMERATE_STAGE_FLUSH,		// LLUI_DISPLAY_IMPL_flush() (recorded drawings, etc.)
+	FRAMERATE_STAGE_SWAP,		// waits for the display swap (display task, not part of the frame)
+	FRAMERATE_STAGE_COUNT
+} framerate_stage_t;
+
+/*
+ * Return the current time of the frame timeline (in ticks: only the differences are
+ * meaningful)
+ */
+uint32_t framerate_get_time(void);
+
+/*
+ * Charge the Graphics Engine's time to the given stage; return the previous stage that
+ * has to be given to framerate_stage_leave()
+ */
+framerate_stage_t framerate_stage_enter(framerate_stage_t stage);
+
+/*
+ * Charge the Graphics Engine's time to the given stage again (the one returned by
+ * framerate_stage_enter())
+ */
+void framerate_stage_leave(framerate_stage_t previous);
+
+/*
+ * Record one sample of a stage that is not measured in the Graphics Engine's task
+ * (the display swap): the duration since the given time (see framerate_get_time())
+ */
+void framerate_stage_record(framerate_stage_t stage, uint32_t start_time);
+
+/*
+ * Start the current frame: first drawing after a flush (the time since the end of the
+ * previous flush is not charged to the drawing)
+ */
+void framerate_frame_start(void);
+
+/*
+ * End the current frame (end of flush): record the stages of the frame in the histograms
+ */
+void framerate_frame_end(void);
+
+/*
+ * Return the number of samples of a stage
+ */
+uint32_t framerate_stage_count(framerate_stage_t stage);
+
+/*
+ * Return the percentile (0 to 100) of a stage in microseconds; the value is the upper
+ * bound of the histogram bucket (its precision is 12.5%)
+ */
+uint32_t framerate_stage_percentile(framerate_stage_t stage, uint32_t percentile);
+
+/*
+ * Return the longest sample of a stage in microseconds
+ */
+uint32_t framerate_stage_max(framerate_stage_t stage);
+
+/*
+ * Clear the histograms
+ */
+void framerate_stages_reset(void);
+
+/*
+ * Dump the histograms' percentiles over the trace channel (see UI_LOG_FRAME_Stage)
+ */
+void framerate_stages_dump(void);
+
 /* Default Java API ----------------------------------------------------------*/
 
 #ifndef javaFramerateInit
@@ -51,4 +135,24 @@ uint32_t framerate_get(void);
 #define javaFramerateGet		Java_com_is2t_debug_Framerate_get
 #endif
 
+/*
+ * The frame timeline is declared in the class com.nxp.debug.FrameTimeline (project
+ * vee-port/natives): the stage numbers are the values of framerate_stage_t
+ */
+#ifndef javaFramerateGetStageCount
+#define javaFramerateGetStageCount		Java_com_nxp_debug_FrameTimeline_getStageCount
+#endif
+#ifndef javaFramerateGetStagePercentile
+#define javaFramerateGetStagePercentile		Java_com_nxp_debug_FrameTimeline_getStagePercentile
+#endif
+#ifndef javaFramerateGetStageMax
+#define javaFramerateGetStageMax		Java_com_nxp_debug_FrameTimeline_getStageMax
+#endif
+#ifndef javaFramerateResetStages
+#define javaFramerateResetStages		Java_com_nxp_debug_FrameTimeline_resetStages
+#endif
+#ifndef javaFramerateDumpStages
+#define javaFramerateDumpStages		Java_com_nxp_debug_FrameTimeline_dumpStages
+#endif
+
 #endif	// _FRAMERATE_INTERN
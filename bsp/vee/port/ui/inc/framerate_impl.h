@@ -35,6 +35,16 @@ int32_t framerate_impl_start_task(void);
  */
 void framerate_impl_sleep(uint32_t ms);
 
+/*
+ * Return a time in ticks (used to measure the stages of the frames: wraps at 2^32 ticks)
+ */
+uint32_t framerate_impl_get_ticks(void);
+
+/*
+ * Return the number of ticks per microsecond
+ */
+uint32_t framerate_impl_get_ticks_per_us(void);
+
 #endif	// FRAMERATE_ENABLED
 
 #endif	// FRAMERATE_IMPL
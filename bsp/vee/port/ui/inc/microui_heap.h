@@ -63,6 +63,35 @@ uint32_t MICROUI_HEAP_free_space(void);
  */
 uint32_t MICROUI_HEAP_number_of_allocated_blocks(void);
 
+/*
+ * @brief Returns the size in bytes of the largest block that can be allocated.
+ *
+ * The free blocks of the best fit heap are the gaps between the allocated blocks: the
+ * function does not allocate anything and can be called at any time. The result is an
+ * upper bound when more than BESTFIT_TRACKED_BLOCKS blocks are allocated.
+ */
+uint32_t MICROUI_HEAP_largest_free_block(void);
+
+/*
+ * @brief Returns the fragmentation of the free space in percent: 0 when the largest
+ * free block is the whole free space, close to 100 when the free space is made of
+ * small blocks.
+ *
+ * @see MICROUI_HEAP_largest_free_block()
+ */
+uint32_t MICROUI_HEAP_fragmentation(void);
+
+/*
+ * @brief Returns the number of allocations that have failed since the startup.
+ */
+uint32_t MICROUI_HEAP_number_of_failed_allocations(void);
+
+/*
+ * @brief Returns the number of blocks allocated in the size classes (see
+ * UI_FEATURE_ALLOCATOR_SIZE_CLASSES).
+ */
+uint32_t MICROUI_HEAP_number_of_size_class_blocks(void);
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
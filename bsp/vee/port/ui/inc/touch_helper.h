@@ -37,6 +37,23 @@ void TOUCH_HELPER_moved(int32_t x, int32_t y);
  */
 void TOUCH_HELPER_released(void);
 
+/*
+ * @brief Notifies to an event handler a touch has been pressed (or has moved) at the
+ * given time.
+ *
+ * @param x the pointer X coordinate
+ * @param y the pointer Y coordinate
+ * @param time the platform time (in milliseconds) when the touch has been sampled
+ */
+void TOUCH_HELPER_pressed_at(int32_t x, int32_t y, int64_t time);
+
+/*
+ * @brief Notifies to an event handler a touch has been released at the given time.
+ *
+ * @param time the platform time (in milliseconds) when the release has been sampled
+ */
+void TOUCH_HELPER_released_at(int64_t time);
+
 #endif // !defined TOUCH_HELPER_H
 
 // -----------------------------------------------------------------------------
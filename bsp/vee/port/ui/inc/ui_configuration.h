@@ -29,7 +29,7 @@ extern "C" {
  * This value must be incremented by the implementor of this C module when a configuration define is added, deleted or
  * modified.
  */
-#define UI_CONFIGURATION_VERSION (1)
+#define UI_CONFIGURATION_VERSION (6)
 
 // -----------------------------------------------------------------------------
 // MicroUI's Allocator Options
@@ -118,6 +118,17 @@ extern "C" {
  */
 //#define UI_FEATURE_ALLOCATOR UI_FEATURE_ALLOCATOR_BESTFIT
 
+/**
+ * @brief Uncomment this define to add some size classes in front of the allocator "BESTFIT". Each size class is a
+ * pool of fixed-size slots reserved at the beginning of the MicroUI image heap: { slot size in bytes, number of slots
+ * (at most 32) }. A block is allocated in the smallest class whose slots are large enough and free; the other blocks
+ * are allocated by the best fit allocator.
+ *
+ * The images of the same size (typically the buffered images with the display's size or the icons) are allocated and
+ * freed without fragmenting the best fit heap.
+ */
+//#define UI_FEATURE_ALLOCATOR_SIZE_CLASSES { { 4096u, 16u }, { 32768u, 4u } }
+
 /**
  * @brief When defined, the logger is enabled. The call to LLUI_INPUT_dump()
  * has no effect when the logger is disabled.
@@ -178,6 +189,16 @@ extern "C" {
 
 #endif // UI_FEATURE_EVENT_DECODER
 
+/**
+ * @brief Uncomment this define to replace the logger above by the event recorder (see ui_event_recorder.h). The
+ * define's value is the number of entries of the recorder's ring buffer (a power of two; 16 bytes per entry).
+ *
+ * The recorder stores the MicroUI queue activity and the display flushes in a binary ring buffer without decoding
+ * them: the cost of a record is a few stores, even from an interrupt. LLUI_INPUT_dump() prints the raw ring buffer,
+ * decoded on the host by the script "scripts/ui_event_recorder_decode.py".
+ */
+//#define UI_FEATURE_EVENT_RECORDER (512u)
+
 /**
  * @brief Defines the display buffer refresh strategy (BRS) to use: one of the strategies above, the Graphics Engine's
  * default refresh strategy or a BSP's custom refresh strategy.
@@ -226,6 +247,48 @@ extern "C" {
  */
 //#define UI_FEATURE_BRS_FLUSH_SINGLE_RECTANGLE
 
+/**
+ * @brief When defined, the drawings performed in the display buffer are not performed immediately but recorded
+ * in a display list (see ui_display_list.h). The display list is performed just before the flush (or before a
+ * drawing that cannot be recorded). Before performing the display list:
+ * - the recorded drawings fully hidden by a next opaque drawing (a filled rectangle) are dropped,
+ * - a region (the drawings performed with the same clip) whose drawings are identical to the same region of the
+ * previous frame is copied from the previous frame's buffer (or not drawn at all when the display has only one
+ * buffer) instead of being drawn again.
+ *
+ * Only the drawings fully described by their parameters and by the clip and the color of the graphics context are
+ * recorded: rectangles and lines (the MicroUI images and fonts cannot be kept after the end of a native function).
+ * When a frame contains another drawing in the display buffer, the recorded drawings are performed before it and
+ * the next frame cannot reuse the regions of the frame. A drawing in an image that reads the display buffer
+ * performs the recorded drawings first.
+ *
+ * Warning: the pixels read by the application (GraphicsContext.readPixel(), etc.) may not include the latest
+ * drawings; the errors of the recorded drawings (see LLUI_DISPLAY_reportError()) are not reported to the application.
+ *
+ * By default, the display list is not enabled.
+ */
+//#define UI_FEATURE_DISPLAY_LIST
+
+#if defined(UI_FEATURE_DISPLAY_LIST)
+
+/**
+ * @brief Defines the maximum number of drawings the display list can record between two flushes. When the list is
+ * full, the recorded drawings are performed immediately and the frame cannot be reused by the next frame.
+ */
+#ifndef UI_DISPLAY_LIST_COMMANDS
+#define UI_DISPLAY_LIST_COMMANDS (128u)
+#endif
+
+/**
+ * @brief Defines the maximum number of regions (see UI_FEATURE_DISPLAY_LIST) per frame. When a frame holds more
+ * regions, the last region includes all the next drawings.
+ */
+#ifndef UI_DISPLAY_LIST_REGIONS
+#define UI_DISPLAY_LIST_REGIONS (16u)
+#endif
+
+#endif // UI_FEATURE_DISPLAY_LIST
+
 /**
  * @brief Defines the number of supported destination formats. When not set or smaller than
  * "2", the file ui_drawing.c considers only one destination format is available: the same format as
@@ -239,10 +302,39 @@ extern "C" {
 /**
  * @brief When defined, in addition to the standard image formats (ARGB8888, A8, etc), the VEE Port can
  * support one or several custom formats.
+ *
+ * By default, the custom formats are disabled: the images generator does not produce the compressed images (see
+ * UI_IMAGE_FORMAT_COMPRESSED); they are produced by UI_IMAGE_COMPRESSED_encode() (see ui_image_compressed.h).
  * @see ui_image_drawing.c for more information.
  */
 //#define UI_FEATURE_IMAGE_CUSTOM_FORMATS
 
+#if defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
+
+/**
+ * @brief When defined, the VEE Port supports the compressed images (RLE or block encoding, see
+ * ui_image_compressed.h). The define's value is the custom format used by the compressed images: one of
+ * MICROUI_IMAGE_FORMAT_CUSTOM_0 to MICROUI_IMAGE_FORMAT_CUSTOM_7.
+ *
+ * When not defined, the compressed images are not supported.
+ */
+#ifndef UI_IMAGE_FORMAT_COMPRESSED
+#define UI_IMAGE_FORMAT_COMPRESSED MICROUI_IMAGE_FORMAT_CUSTOM_0
+#endif
+
+#endif // UI_FEATURE_IMAGE_CUSTOM_FORMATS
+
+/**
+ * @brief When defined, the rotated and scaled images drawn by the CPU in a RGB565 destination are drawn by the
+ * implementation of ui_drawing_transform.h (scanline walk with 16.16 fixed-point steps, formats RGB565, RGB888,
+ * ARGB8888 and ARGB8888_PRE) instead of the Graphics Engine's software algorithms. The other images and destinations
+ * are still drawn by the Graphics Engine.
+ *
+ * By default, the software transformations are disabled: the results differ slightly from the Graphics Engine's
+ * algorithms (fixed-point coordinates). The host benchmark "ui/test/transform_benchmark.c" compares both.
+ */
+//#define UI_FEATURE_SOFTWARE_TRANSFORM
+
 /**
  * @brief When defined, in addition to the graphics engine's internal font format, the VEE Port can
  * support one or several custom formats.
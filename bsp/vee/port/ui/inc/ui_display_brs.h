@@ -75,6 +75,40 @@ extern "C" {
  */
 DRAWING_Status UI_DISPLAY_BRS_restore(MICROUI_GraphicsContext *gc, MICROUI_Image *old_back_buffer, ui_rect_t *rect);
 
+/*
+ * @brief Declares that the next drawing fully covers the given rectangle with opaque
+ * pixels (a rectangle fill, the copy of an opaque image, etc.). The rectangle is
+ * clipped by the graphics context's clip.
+ *
+ * The drawing native calls this function just before LLUI_DISPLAY_requestDrawing(),
+ * which notifies the BRS of the new drawing region (see
+ * LLUI_DISPLAY_IMPL_newDrawingRegion()), and calls UI_DISPLAY_BRS_clear_opaque_region()
+ * just after. The BRS does not restore the parts of the past that will be hidden by the
+ * opaque rectangle.
+ *
+ * @param[in] gc the MicroUI GraphicsContext of the next drawing
+ * @param[in] x1 the top-left pixel X coordinate.
+ * @param[in] y1 the top-left pixel Y coordinate.
+ * @param[in] x2 the bottom-right pixel X coordinate.
+ * @param[in] y2 the bottom-right pixel Y coordinate.
+ */
+void UI_DISPLAY_BRS_set_opaque_region(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2);
+
+/*
+ * @brief Forgets the rectangle declared by UI_DISPLAY_BRS_set_opaque_region().
+ */
+void UI_DISPLAY_BRS_clear_opaque_region(void);
+
+/*
+ * @brief Gets the rectangle declared by UI_DISPLAY_BRS_set_opaque_region() for the
+ * current drawing (for the BRS implementations).
+ *
+ * @param[in] gc the MicroUI GraphicsContext given to LLUI_DISPLAY_IMPL_newDrawingRegion()
+ * @param[out] rect the opaque rectangle.
+ * @return false when the drawing does not declare an opaque rectangle.
+ */
+bool UI_DISPLAY_BRS_get_opaque_region(const MICROUI_GraphicsContext *gc, ui_rect_t *rect);
+
 // --------------------------------------------------------------------------------
 // EOF
 // --------------------------------------------------------------------------------
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef UI_DISPLAY_LIST_H
+#define UI_DISPLAY_LIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Display list: records the drawings performed in the display buffer and performs
+ * them just before the flush (see UI_FEATURE_DISPLAY_LIST).
+ *
+ * The MicroUI natives (LLUI_PAINTER_impl.c, LLDW_PAINTER_impl.c, etc.) call:
+ * - UI_DISPLAY_LIST_request_drawing() (or UI_DISPLAY_LIST_request_image_drawing() when the
+ * drawing reads an image) instead of LLUI_DISPLAY_requestDrawing() when the drawing cannot
+ * be recorded: the recorded drawings are performed before the new drawing.
+ * - UI_DISPLAY_LIST_xxx() instead of UI_DRAWING_xxx() when the drawing can be recorded.
+ *
+ * Only the drawings fully described by their parameters and by the clip and the color of
+ * the graphics context are recorded (lines and rectangles): the MicroUI objects (graphics
+ * context, image, font) cannot be kept after the end of a native function.
+ *
+ * The drawings of a frame are grouped in regions: a region is a sequence of drawings
+ * performed with the same clip. At the end of the frame (see UI_DISPLAY_LIST_flush()):
+ * - the drawings fully hidden by a next opaque drawing are dropped,
+ * - a region whose drawings are identical (same hash) to the same region of the previous
+ * frame, and whose clip is fully covered by one of its opaque drawings, is copied from the
+ * previous frame's buffer (see UI_DISPLAY_BRS_restore()); when the previous frame's buffer
+ * is the current buffer, the region is not drawn at all.
+ *
+ * The recorded drawings are performed one after the other, synchronously (see
+ * UI_DISPLAY_LIST_IMPL_set_synchronous_drawings()).
+ *
+ * When UI_FEATURE_DISPLAY_LIST is not defined, this header maps the functions on the
+ * standard ones.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <LLUI_DISPLAY.h>
+
+#include "ui_configuration.h"
+#include "ui_drawing.h"
+
+#if defined(UI_FEATURE_DISPLAY_LIST)
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The display list statistics (since the startup).
+ */
+typedef struct {
+	/*
+	 * @brief The number of recorded drawings.
+	 */
+	uint32_t recorded;
+
+	/*
+	 * @brief The number of recorded drawings not performed because they are hidden by
+	 * a next opaque drawing.
+	 */
+	uint32_t culled;
+
+	/*
+	 * @brief The number of regions copied from the previous frame's buffer.
+	 */
+	uint32_t copied_regions;
+
+	/*
+	 * @brief The number of regions not drawn at all (the buffer already holds them).
+	 */
+	uint32_t skipped_regions;
+
+	/*
+	 * @brief The number of frames whose regions cannot be reused by the next frame
+	 * (a drawing cannot be recorded or the list is full).
+	 */
+	uint32_t unrecorded_frames;
+} UI_DISPLAY_LIST_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Replaces LLUI_DISPLAY_requestDrawing() for the drawings that are not recorded.
+ * When the drawing can be performed in the display buffer, the recorded drawings are
+ * performed first.
+ *
+ * @param[in] gc the MicroUI GraphicsContext target.
+ * @param[in] callback the function to call when the drawing can be performed.
+ *
+ * @return the result of LLUI_DISPLAY_requestDrawing().
+ */
+bool UI_DISPLAY_LIST_request_drawing(MICROUI_GraphicsContext *gc, SNI_callback callback);
+
+/*
+ * @brief Replaces LLUI_DISPLAY_requestDrawing() for the drawings of an image that are not
+ * recorded. When the drawing can be performed in the display buffer or when the image is
+ * the display buffer, the recorded drawings are performed first.
+ *
+ * @param[in] gc the MicroUI GraphicsContext target.
+ * @param[in] img the MicroUI Image to draw.
+ * @param[in] callback the function to call when the drawing can be performed.
+ *
+ * @return the result of LLUI_DISPLAY_requestDrawing().
+ */
+bool UI_DISPLAY_LIST_request_image_drawing(MICROUI_GraphicsContext *gc, MICROUI_Image *img, SNI_callback callback);
+
+/*
+ * @brief Records or performs the drawing (same parameters as UI_DRAWING_xxx()). A drawing
+ * is recorded when it targets the display buffer and when the list is not full; in that
+ * case, the drawing is considered as done.
+ */
+DRAWING_Status UI_DISPLAY_LIST_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x1, jint x2, jint y);
+DRAWING_Status UI_DISPLAY_LIST_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jint y1, jint y2);
+DRAWING_Status UI_DISPLAY_LIST_drawRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2);
+DRAWING_Status UI_DISPLAY_LIST_fillRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2);
+
+/*
+ * @brief Performs the recorded drawings of the frame: drops the hidden drawings, reuses
+ * the regions of the previous frame and draws the other regions. This function must be
+ * called before flushing the display buffer (see LLUI_DISPLAY_IMPL_flush()).
+ *
+ * @param[in] gc the MicroUI GraphicsContext that targets the display buffer to flush.
+ */
+void UI_DISPLAY_LIST_flush(MICROUI_GraphicsContext *gc);
+
+/*
+ * @brief Gets the display list statistics.
+ *
+ * @param[out] statistics the statistics to fill.
+ */
+void UI_DISPLAY_LIST_get_statistics(UI_DISPLAY_LIST_statistics_t *statistics);
+
+/*
+ * @brief Asks the drawers to perform the next drawings synchronously (the drawing is
+ * fully done when the drawing function returns) or asynchronously (default behavior).
+ *
+ * The implementation of this function is optional; a weak function does nothing (the
+ * software drawings are always synchronous).
+ *
+ * @param[in] synchronous true to perform the next drawings synchronously.
+ */
+void UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(bool synchronous);
+
+#else // UI_FEATURE_DISPLAY_LIST
+
+// -----------------------------------------------------------------------------
+// Standard functions
+// -----------------------------------------------------------------------------
+
+#define UI_DISPLAY_LIST_request_drawing(gc, callback) LLUI_DISPLAY_requestDrawing((gc), (callback))
+#define UI_DISPLAY_LIST_request_image_drawing(gc, img, callback) \
+	((void)(img), LLUI_DISPLAY_requestDrawing((gc), (callback)))
+#define UI_DISPLAY_LIST_drawHorizontalLine UI_DRAWING_drawHorizontalLine
+#define UI_DISPLAY_LIST_drawVerticalLine UI_DRAWING_drawVerticalLine
+#define UI_DISPLAY_LIST_drawRectangle UI_DRAWING_drawRectangle
+#define UI_DISPLAY_LIST_fillRectangle UI_DRAWING_fillRectangle
+#define UI_DISPLAY_LIST_flush(gc) ((void)(gc))
+
+#endif // UI_FEATURE_DISPLAY_LIST
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_DISPLAY_LIST_H
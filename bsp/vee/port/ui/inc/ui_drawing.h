@@ -172,6 +172,18 @@ void UI_DRAWING_initializeNewImage(MICROUI_Image *image);
  */
 void UI_DRAWING_freeImageResources(MICROUI_Image *image);
 
+/*
+ * @brief Waits for the end of the drawings that a hardware accelerator (GPU) has not
+ * performed yet. This function is called before a software algorithm reads or writes a
+ * buffer (software drawing, image closing, etc.).
+ *
+ * The default implementation does nothing: the Graphics Engine already waits for the
+ * end of the asynchronous drawings (drawings that return DRAWING_RUNNING). A GPU
+ * implementation that notifies its drawings as done before their end (batching) must
+ * override this function.
+ */
+void UI_DRAWING_synchronizeHardwareDrawings(void);
+
 /**
  * @brief Computes the rendered width of a string.
  *
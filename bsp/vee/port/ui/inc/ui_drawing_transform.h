@@ -0,0 +1,114 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef UI_DRAWING_TRANSFORM_H
+#define UI_DRAWING_TRANSFORM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Software rotation and scaling of the images in a RGB565 destination (see
+ * UI_FEATURE_SOFTWARE_TRANSFORM).
+ *
+ * The destination is walked row after row. For each row, the span of pixels whose
+ * source coordinates fit the image is computed once (the source coordinates are linear
+ * functions of the destination coordinates); then the source coordinates are stepped
+ * from one pixel to the next with 16.16 fixed-point increments: no bounds check and no
+ * floating-point operation per pixel. The samples are gathered in a small buffer and
+ * blended on the destination with the pixel kernels (see ui_pixel_kernels.h).
+ *
+ * The sampling is specialized for the source formats RGB565, RGB888, ARGB8888 and
+ * ARGB8888_PRE. The other sources and destinations are not managed: the caller has to
+ * use the Graphics Engine's software algorithms.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+
+#include <LLUI_DISPLAY.h>
+
+#include "ui_configuration.h"
+
+// --------------------------------------------------------------------------------
+// Functions
+// --------------------------------------------------------------------------------
+
+#if defined(UI_FEATURE_SOFTWARE_TRANSFORM)
+
+/*
+ * @brief Draws a rotated image (nearest neighbor sampling). Same parameters as
+ * UI_DRAWING_drawRotatedImageNearestNeighbor().
+ *
+ * The caller must have synchronized the hardware drawings (the source and the
+ * destination are read and written by the CPU).
+ *
+ * @return false when the source or the destination format is not managed: nothing has
+ * been drawn.
+ */
+bool UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                          jint y, jint rotationX, jint rotationY, jfloat angle,
+                                                          jint alpha);
+
+/*
+ * @brief Draws a rotated image (bilinear sampling). Same parameters as
+ * UI_DRAWING_drawRotatedImageBilinear().
+ *
+ * @return false when the source or the destination format is not managed: nothing has
+ * been drawn.
+ */
+bool UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
+                                                   jint rotationX, jint rotationY, jfloat angle, jint alpha);
+
+/*
+ * @brief Draws a scaled image (nearest neighbor sampling). Same parameters as
+ * UI_DRAWING_drawScaledImageNearestNeighbor().
+ *
+ * @return false when the source or the destination format is not managed: nothing has
+ * been drawn.
+ */
+bool UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                         jint y, jfloat factorX, jfloat factorY, jint alpha);
+
+/*
+ * @brief Draws a scaled image (bilinear sampling). Same parameters as
+ * UI_DRAWING_drawScaledImageBilinear().
+ *
+ * @return false when the source or the destination format is not managed: nothing has
+ * been drawn.
+ */
+bool UI_DRAWING_TRANSFORM_drawScaledImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
+                                                  jfloat factorX, jfloat factorY, jint alpha);
+
+#else // UI_FEATURE_SOFTWARE_TRANSFORM
+
+#define UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(gc, img, x, y, rx, ry, angle, alpha) \
+	((void)(gc), (void)(img), (void)(x), (void)(y), (void)(rx), (void)(ry), (void)(angle), (void)(alpha), false)
+#define UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(gc, img, x, y, rx, ry, angle, alpha) \
+	((void)(gc), (void)(img), (void)(x), (void)(y), (void)(rx), (void)(ry), (void)(angle), (void)(alpha), false)
+#define UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(gc, img, x, y, fx, fy, alpha) \
+	((void)(gc), (void)(img), (void)(x), (void)(y), (void)(fx), (void)(fy), (void)(alpha), false)
+#define UI_DRAWING_TRANSFORM_drawScaledImageBilinear(gc, img, x, y, fx, fy, alpha) \
+	((void)(gc), (void)(img), (void)(x), (void)(y), (void)(fx), (void)(fy), (void)(alpha), false)
+
+#endif // UI_FEATURE_SOFTWARE_TRANSFORM
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_DRAWING_TRANSFORM_H
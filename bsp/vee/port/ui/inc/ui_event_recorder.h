@@ -0,0 +1,159 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef UI_EVENT_RECORDER_H
+#define UI_EVENT_RECORDER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Event recorder: records the activity of the MicroUI events queue and of the
+ * display in a binary ring buffer (see UI_FEATURE_EVENT_RECORDER).
+ *
+ * Each entry is a fixed-size record stamped with the framerate ticks (see
+ * framerate_get_time()): recording an entry only reserves a slot (atomic increment)
+ * and writes four words, from any task or interrupt, without lock and without
+ * formatting. The entries are never interpreted on the target: UI_EVENT_RECORDER_dump()
+ * prints the raw ring buffer and the host tool scripts/ui_event_recorder_decode.py
+ * reconstructs the events stream (MicroUI events, their data, the flushes, etc.).
+ *
+ * The recorder replaces the MicroUI queue logger of LLUI_INPUT_LOG_impl.c: it
+ * implements the LLUI_INPUT_IMPL_log_xxx() functions, and LLUI_INPUT_dump() dumps the
+ * ring buffer.
+ *
+ * When UI_FEATURE_EVENT_RECORDER is not defined, the record function does nothing.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "ui_configuration.h"
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The kinds of recorded entries. The values are decoded by the host tool: only
+ * append new kinds.
+ */
+typedef enum {
+	/*
+	 * @brief A MicroUI event has been added to the queue (data: the event).
+	 */
+	UI_EVENT_RECORDER_QUEUE_EVENT = 1,
+
+	/*
+	 * @brief A data of the previous MicroUI event has been added to the queue (data:
+	 * the event's data).
+	 */
+	UI_EVENT_RECORDER_QUEUE_DATA = 2,
+
+	/*
+	 * @brief A MicroUI event has been replaced in the queue (data: the new event).
+	 */
+	UI_EVENT_RECORDER_QUEUE_REPLACE = 3,
+
+	/*
+	 * @brief An element has been read from the queue (data: the element).
+	 */
+	UI_EVENT_RECORDER_QUEUE_READ = 4,
+
+	/*
+	 * @brief A MicroUI event has been lost: the queue is full (data: the event).
+	 */
+	UI_EVENT_RECORDER_QUEUE_FULL = 5,
+
+	/*
+	 * @brief The Graphics Engine has requested a flush (index: the flush identifier;
+	 * data: the number of dirty regions).
+	 */
+	UI_EVENT_RECORDER_DISPLAY_FLUSH = 6,
+
+	/*
+	 * @brief The back buffer has been sent to the display and a new back buffer is
+	 * available (index: the flush identifier).
+	 */
+	UI_EVENT_RECORDER_DISPLAY_SWAP = 7,
+} UI_EVENT_RECORDER_kind_t;
+
+/*
+ * @brief A recorded entry (16 bytes).
+ */
+typedef struct {
+	/*
+	 * @brief Number of the entry (since the startup), written last: an entry whose
+	 * number does not match its slot is being written.
+	 */
+	uint32_t sequence;
+
+	/*
+	 * @brief Framerate ticks (see framerate_get_time()).
+	 */
+	uint32_t ticks;
+
+	/*
+	 * @brief The recorded data (see UI_EVENT_RECORDER_kind_t).
+	 */
+	uint32_t data;
+
+	/*
+	 * @brief The kind of entry (see UI_EVENT_RECORDER_kind_t).
+	 */
+	uint16_t kind;
+
+	/*
+	 * @brief The element index in the MicroUI queue or the flush identifier.
+	 */
+	uint16_t index;
+} UI_EVENT_RECORDER_entry_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+#if defined(UI_FEATURE_EVENT_RECORDER)
+
+/*
+ * @brief Records an entry. Can be called from any task or interrupt.
+ *
+ * @param[in] kind: the kind of entry.
+ * @param[in] index: the element index in the MicroUI queue or the flush identifier.
+ * @param[in] data: the recorded data.
+ */
+void UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_kind_t kind, uint32_t index, uint32_t data);
+
+/*
+ * @brief Prints the ring buffer for the host tool: a header line, one line per entry
+ * (the four words in hexadecimal) and an end line. The recording goes on during the
+ * dump: the entries being written are dropped by the host tool.
+ */
+void UI_EVENT_RECORDER_dump(void);
+
+#else // UI_FEATURE_EVENT_RECORDER
+
+#define UI_EVENT_RECORDER_record(kind, index, data) ((void)(kind), (void)(index), (void)(data))
+#define UI_EVENT_RECORDER_dump()
+
+#endif // UI_FEATURE_EVENT_RECORDER
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_EVENT_RECORDER_H
@@ -73,6 +73,45 @@ extern "C" {
  */
 #define GET_CUSTOM_FONT_FUNCTIONS_SUFFIX(format) CONCAT(format, _FUNCTIONS_SUFFIX)
 
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The alpha map of a glyph of a custom font (see UI_FONT_DRAWING_getGlyph()).
+ */
+typedef struct {
+	/*
+	 * @brief The address of the first pixel of the alpha map: one byte per pixel, from 0
+	 * (transparent) to 255 (opaque). The address must not change while the font is loaded:
+	 * it identifies the glyph of the font.
+	 */
+	const uint8_t *alpha_map;
+
+	/*
+	 * @brief The number of bytes between two rows of the alpha map.
+	 */
+	uint32_t stride;
+
+	/*
+	 * @brief The position of the alpha map relative to the top-left corner of the
+	 * character's box.
+	 */
+	jint x;
+	jint y;
+
+	/*
+	 * @brief The size of the alpha map in pixels.
+	 */
+	jint width;
+	jint height;
+
+	/*
+	 * @brief The horizontal distance between the character's box and the next one.
+	 */
+	jint advance;
+} UI_FONT_DRAWING_glyph_t;
+
 // --------------------------------------------------------------------------------
 // API
 // --------------------------------------------------------------------------------
@@ -138,6 +177,25 @@ DRAWING_Status UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor(MICROUI_Graph
                                                                    MICROUI_Font *font, jint x, jint y, jint xRotation,
                                                                    jint yRotation, jfloat angle, jint alpha);
 
+/*
+ * @brief Gets the alpha map of a glyph. Only the custom fonts can give their glyphs: the
+ * glyphs of the standard fonts are private to the Graphics Engine. The font manager of a
+ * custom font gives its glyphs by implementing the function
+ * UI_FONT_DRAWING_getGlyph_customX() of its format (the default implementation gives
+ * nothing).
+ *
+ * Several drawings of a glyph with the same transformation can reuse the transformed
+ * alpha map (see VGLITE_GLYPH_CACHE).
+ *
+ * @param[in] font: the font.
+ * @param[in] c: the character.
+ * @param[out] glyph: the alpha map of the character.
+ *
+ * @return false when the font does not give its glyphs or when the character is not in
+ * the font: the glyph is not filled.
+ */
+bool UI_FONT_DRAWING_getGlyph(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+
 // --------------------------------------------------------------------------------
 // EOF
 // --------------------------------------------------------------------------------
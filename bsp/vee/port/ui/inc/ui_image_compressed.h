@@ -0,0 +1,197 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef UI_IMAGE_COMPRESSED_H
+#define UI_IMAGE_COMPRESSED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Encoders and decoders of the compressed images (see UI_IMAGE_FORMAT_COMPRESSED).
+ *
+ * A compressed image starts with a header (UI_IMAGE_COMPRESSED_header_t) followed
+ * by the encoded pixels. Two encodings are available:
+ *
+ * - RLE: a table of "height" 32-bit offsets (one per row, relative to the start of
+ * the encoded data) followed by the rows. A row is a list of runs (a run never
+ * crosses two rows); a run starts with a control byte: when the bit 7 is set, the
+ * next pixel is repeated "(control & 0x7f) + 1" times; otherwise "control + 1"
+ * pixels follow. The pixels are stored in the decoded format (little endian).
+ *
+ * - BLOCK: the image is split in 4x4 pixels blocks (row-major order, the last blocks
+ * of a row / column are padded). A block is encoded in 8 bytes like the BC1 (DXT1)
+ * format: two RGB565 colors c0 and c1 (little endian) followed by sixteen 2-bit
+ * indices (row-major order, least significant bits first). When c0 > c1, the
+ * indices 2 and 3 are (2*c0 + c1) / 3 and (c0 + 2*c1) / 3; otherwise the index 2
+ * is (c0 + c1) / 2 and the index 3 is a transparent pixel.
+ *
+ * The encoders and the decoders only depend on the C library and on the pixel kernels
+ * (see ui_pixel_kernels.h): the images can be compressed on the host (see
+ * UI_IMAGE_COMPRESSED_encode()) and the round trip is validated on the host (see
+ * ui/test/image_compressed_test.c).
+ *
+ * All the multi-bytes values are stored in little endian.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// --------------------------------------------------------------------------------
+// Constants
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Available encodings (see UI_IMAGE_COMPRESSED_header_t.encoding).
+ */
+#define UI_IMAGE_COMPRESSED_ENCODING_RLE (0u)
+#define UI_IMAGE_COMPRESSED_ENCODING_BLOCK (1u)
+
+/*
+ * @brief Available decoded formats (see UI_IMAGE_COMPRESSED_header_t.format); same
+ * values as MICROUI_IMAGE_FORMAT_RGB565 and MICROUI_IMAGE_FORMAT_ARGB8888_PRE.
+ */
+#define UI_IMAGE_COMPRESSED_FORMAT_RGB565 (4u)
+#define UI_IMAGE_COMPRESSED_FORMAT_ARGB8888_PRE (24u)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Header of a compressed image.
+ */
+typedef struct {
+	/*
+	 * @brief The size of the image in pixels.
+	 */
+	uint16_t width;
+	uint16_t height;
+
+	/*
+	 * @brief The encoding of the pixels: RLE or BLOCK.
+	 */
+	uint8_t encoding;
+
+	/*
+	 * @brief The format of the decoded pixels: RGB565 or ARGB8888_PRE (the BLOCK
+	 * encoding only produces opaque or fully transparent pixels).
+	 */
+	uint8_t format;
+
+	uint16_t reserved;
+
+	/*
+	 * @brief The size in bytes of the encoded data that follows the header.
+	 */
+	uint32_t data_size;
+} UI_IMAGE_COMPRESSED_header_t;
+
+// --------------------------------------------------------------------------------
+// Functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Checks the header of a compressed image: the encoding, the decoded format,
+ * the size of the image and the size of the encoded data.
+ *
+ * @param[in] header: the header of the compressed image.
+ * @param[in] width: the expected width of the image.
+ * @param[in] height: the expected height of the image.
+ *
+ * @return true when the image can be decoded.
+ */
+bool UI_IMAGE_COMPRESSED_check_header(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t width, uint32_t height);
+
+/*
+ * @brief Gets the number of bytes of a decoded pixel.
+ *
+ * @param[in] header: the header of the compressed image.
+ *
+ * @return 2 (RGB565) or 4 (ARGB8888_PRE).
+ */
+uint32_t UI_IMAGE_COMPRESSED_get_bytes_per_pixel(const UI_IMAGE_COMPRESSED_header_t *header);
+
+/*
+ * @brief Decodes some consecutive rows of a compressed image. The header must have
+ * been checked before (see UI_IMAGE_COMPRESSED_check_header()).
+ *
+ * The rows are decoded entirely (from the column 0 to the column "width - 1").
+ *
+ * @param[in] header: the header of the compressed image.
+ * @param[in] first_row: the index of the first row to decode.
+ * @param[in] rows: the number of rows to decode.
+ * @param[out] dest: the address of the first decoded pixel (aligned on the size of a
+ * pixel).
+ * @param[in] dest_stride: the number of bytes between two decoded rows (multiple of the
+ * size of a pixel).
+ *
+ * @return false when the encoded data is corrupted (the destination content is
+ * undefined).
+ */
+bool UI_IMAGE_COMPRESSED_decode_rows(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t first_row, uint32_t rows,
+                                     uint8_t *dest, uint32_t dest_stride);
+
+/*
+ * @brief Gets the maximum size in bytes of a compressed image (header included): the
+ * size of the destination of UI_IMAGE_COMPRESSED_encode() that fits all the images of
+ * this size.
+ *
+ * @param[in] width: the width of the image.
+ * @param[in] height: the height of the image.
+ * @param[in] encoding: the encoding of the pixels: RLE or BLOCK.
+ * @param[in] format: the format of the pixels: RGB565 or ARGB8888_PRE.
+ *
+ * @return the maximum size in bytes.
+ */
+uint32_t UI_IMAGE_COMPRESSED_get_max_size(uint32_t width, uint32_t height, uint8_t encoding, uint8_t format);
+
+/*
+ * @brief Compresses an image: writes the header and the encoded pixels.
+ *
+ * The RLE encoding is lossless. The BLOCK encoding keeps two RGB565 colors per block:
+ * a block with one or two colors (and transparent pixels) is encoded without loss, the
+ * other pixels are approximated by the nearest color of the block's palette. With the
+ * format ARGB8888_PRE, the pixels whose opacity is lower than 50% are transparent and the
+ * other ones are opaque.
+ *
+ * @param[in] src: the address of the first pixel of the image, in the decoded format
+ * (aligned on the size of a pixel).
+ * @param[in] src_stride: the number of bytes between two rows of the image (multiple of
+ * the size of a pixel).
+ * @param[in] width: the width of the image (1 to 65535).
+ * @param[in] height: the height of the image (1 to 65535).
+ * @param[in] encoding: the encoding of the pixels: RLE or BLOCK.
+ * @param[in] format: the format of the pixels: RGB565 or ARGB8888_PRE.
+ * @param[out] dest: the address of the compressed image (aligned on 32 bits).
+ * @param[in] dest_size: the size in bytes of the destination (see
+ * UI_IMAGE_COMPRESSED_get_max_size()).
+ *
+ * @return the size in bytes of the compressed image (header included), 0 when the
+ * parameters are invalid or when the compressed image does not fit the destination.
+ */
+uint32_t UI_IMAGE_COMPRESSED_encode(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height,
+                                    uint8_t encoding, uint8_t format, uint8_t *dest, uint32_t dest_size);
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_IMAGE_COMPRESSED_H
@@ -52,6 +52,30 @@ extern "C" {
 
 #include "ui_drawing.h"
 
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+/**
+ * @brief The suffixes to apply at the end of the implementation functions of ui_image_drawing.c's
+ * extern functions that handle an image format between MICROUI_IMAGE_FORMAT_CUSTOM_0
+ * and MICROUI_IMAGE_FORMAT_CUSTOM_7.
+ */
+#define MICROUI_IMAGE_FORMAT_CUSTOM_0_FUNCTIONS_SUFFIX 0
+#define MICROUI_IMAGE_FORMAT_CUSTOM_1_FUNCTIONS_SUFFIX 1
+#define MICROUI_IMAGE_FORMAT_CUSTOM_2_FUNCTIONS_SUFFIX 2
+#define MICROUI_IMAGE_FORMAT_CUSTOM_3_FUNCTIONS_SUFFIX 3
+#define MICROUI_IMAGE_FORMAT_CUSTOM_4_FUNCTIONS_SUFFIX 4
+#define MICROUI_IMAGE_FORMAT_CUSTOM_5_FUNCTIONS_SUFFIX 5
+#define MICROUI_IMAGE_FORMAT_CUSTOM_6_FUNCTIONS_SUFFIX 6
+#define MICROUI_IMAGE_FORMAT_CUSTOM_7_FUNCTIONS_SUFFIX 7
+
+/**
+ * @brief Macro to get the right implementation functions of ui_image_drawing.c's
+ * extern functions according to the custom image format.
+ */
+#define GET_CUSTOM_IMAGE_FUNCTIONS_SUFFIX(format) CONCAT(format, _FUNCTIONS_SUFFIX)
+
 // --------------------------------------------------------------------------------
 // API
 // --------------------------------------------------------------------------------
@@ -22,6 +22,7 @@ extern "C" {
  * - The event 0 is reserved to log the drawings. It is used by the MicroUI CCO and by
  * the MicroUI Graphics Engine (to log the internal drawings).
  * - The events [10,20] are reserved to log the buffer refresh strategies (BRS) events.
+ * - The events [21,22] are reserved to log the frame timeline (see framerate.h).
  *
  * Example:
  *
@@ -69,6 +70,12 @@ extern "C" {
 #define UI_LOG_BRS_RestoreRegion (15)   // Restore region (%u,%u) to (%u,%u)
 #define UI_LOG_BRS_ClearList     (16)   // Clear the list of regions
 
+/*
+ * @brief Identifies the logs for the frame timeline (durations in microseconds).
+ */
+#define UI_LOG_FRAME_Timeline    (21)   // Frame %u: drawing %u, restore %u, GPU wait %u, flush %u
+#define UI_LOG_FRAME_Stage       (22)   // Stage %u: %u samples, p50 %u, p90 %u, p99 %u, max %u
+
 /*
  * @brief Compatibility of Architecture 7 with Architecture 8: use the prototypes
  * of LLTRACE.h (Architecture 8).
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#ifndef UI_PIXEL_KERNELS_H
+#define UI_PIXEL_KERNELS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Pixel kernels used by the software drawings of the C modules: span fill,
+ * span blending and pixel format conversion.
+ *
+ * The kernels process several color channels (or several pixels) per 32-bit word.
+ * On a core that features the DSP extension (Cortex-M7), the channels are split thanks
+ * to the SIMD instructions; otherwise portable C equivalents are used. Both versions
+ * give exactly the same results: they can be validated on any host against some
+ * reference pixels.
+ *
+ * The blending of a channel uses the rounded division by 255: c = (s * a + d * (255 - a)) / 255.
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdint.h>
+
+// --------------------------------------------------------------------------------
+// Functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Fills a span of 16-bit pixels.
+ *
+ * @param[out] dest: the address of the first pixel (16-bit aligned).
+ * @param[in] pixel: the pixel to write.
+ * @param[in] count: the number of pixels to write.
+ */
+void UI_PIXEL_KERNELS_fill_16(uint16_t *dest, uint16_t pixel, uint32_t count);
+
+/*
+ * @brief Fills a span of 32-bit pixels.
+ *
+ * @param[out] dest: the address of the first pixel (32-bit aligned).
+ * @param[in] pixel: the pixel to write.
+ * @param[in] count: the number of pixels to write.
+ */
+void UI_PIXEL_KERNELS_fill_32(uint32_t *dest, uint32_t pixel, uint32_t count);
+
+/*
+ * @brief Converts a span of RGB888 pixels (B, G, R bytes) in opaque ARGB8888 pixels.
+ *
+ * @param[out] dest: the address of the first converted pixel (32-bit aligned).
+ * @param[in] src: the address of the first RGB888 pixel (no alignment constraint).
+ * @param[in] count: the number of pixels to convert.
+ */
+void UI_PIXEL_KERNELS_convert_rgb888_to_argb8888(uint32_t *dest, const uint8_t *src, uint32_t count);
+
+/*
+ * @brief Blends a span of RGB565 pixels on a span of RGB565 pixels applying an opacity.
+ *
+ * @param[in,out] dest: the address of the first destination pixel.
+ * @param[in] src: the address of the first source pixel.
+ * @param[in] alpha: the opacity to apply on the source pixels (0 to 255).
+ * @param[in] count: the number of pixels to blend.
+ */
+void UI_PIXEL_KERNELS_blend_rgb565_on_rgb565(uint16_t *dest, const uint16_t *src, uint32_t alpha, uint32_t count);
+
+/*
+ * @brief Blends a span of premultiplied ARGB8888 pixels on a span of RGB565 pixels
+ * applying an opacity.
+ *
+ * @param[in,out] dest: the address of the first destination pixel.
+ * @param[in] src: the address of the first source pixel.
+ * @param[in] alpha: the opacity to apply on the source pixels (0 to 255).
+ * @param[in] count: the number of pixels to blend.
+ */
+void UI_PIXEL_KERNELS_blend_argb8888_pre_on_rgb565(uint16_t *dest, const uint32_t *src, uint32_t alpha,
+                                                   uint32_t count);
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UI_PIXEL_KERNELS_H
@@ -25,6 +25,9 @@
 // calls ui_drawing functions
 #include "ui_drawing.h"
 
+// performs the recorded drawings (when enabled)
+#include "ui_display_list.h"
+
 // logs the drawings
 #include "ui_log.h"
 
@@ -64,7 +67,7 @@
 // --------------------------------------------------------------------------------
 
 void LLDW_PAINTER_IMPL_drawThickFadedPoint(MICROUI_GraphicsContext *gc, jint x, jint y, jint thickness, jint fade) {
-	if (((thickness > 0) || (fade > 0)) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) &
+	if (((thickness > 0) || (fade > 0)) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) &
 	                                                                   LLDW_PAINTER_IMPL_drawThickFadedPoint)) {
 		LOG_DRAW_START(drawThickFadedPoint);
 		DRAWING_Status status = UI_DRAWING_drawThickFadedPoint(gc, x, y, thickness, fade);
@@ -75,7 +78,7 @@ void LLDW_PAINTER_IMPL_drawThickFadedPoint(MICROUI_GraphicsContext *gc, jint x,
 
 void LLDW_PAINTER_IMPL_drawThickFadedLine(MICROUI_GraphicsContext *gc, jint startX, jint startY, jint endX, jint endY,
                                           jint thickness, jint fade, DRAWING_Cap startCap, DRAWING_Cap endCap) {
-	if (((thickness > 0) || (fade > 0)) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) &
+	if (((thickness > 0) || (fade > 0)) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) &
 	                                                                   LLDW_PAINTER_IMPL_drawThickFadedLine)) {
 		LOG_DRAW_START(drawThickFadedLine);
 		DRAWING_Status status = UI_DRAWING_drawThickFadedLine(gc, startX, startY, endX, endY, thickness, fade, startCap,
@@ -87,7 +90,7 @@ void LLDW_PAINTER_IMPL_drawThickFadedLine(MICROUI_GraphicsContext *gc, jint star
 
 void LLDW_PAINTER_IMPL_drawThickFadedCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter, jint thickness,
                                             jint fade) {
-	if (((thickness > 0) || (fade > 0)) && (diameter > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) &
+	if (((thickness > 0) || (fade > 0)) && (diameter > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) &
 	                                                                                     LLDW_PAINTER_IMPL_drawThickFadedCircle))
 	{
 		LOG_DRAW_START(drawThickFadedCircle);
@@ -100,7 +103,7 @@ void LLDW_PAINTER_IMPL_drawThickFadedCircle(MICROUI_GraphicsContext *gc, jint x,
 void LLDW_PAINTER_IMPL_drawThickFadedCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter,
                                                jfloat startAngle, jfloat arcAngle, jint thickness, jint fade,
                                                DRAWING_Cap start, DRAWING_Cap end) {
-	if (((thickness > 0) || (fade > 0)) && (diameter > 0) && ((int32_t)arcAngle != 0) && LLUI_DISPLAY_requestDrawing(gc,
+	if (((thickness > 0) || (fade > 0)) && (diameter > 0) && ((int32_t)arcAngle != 0) && UI_DISPLAY_LIST_request_drawing(gc,
 																													 (
 																														 SNI_callback)
 	                                                                                                                 &
@@ -116,7 +119,7 @@ void LLDW_PAINTER_IMPL_drawThickFadedCircleArc(MICROUI_GraphicsContext *gc, jint
 
 void LLDW_PAINTER_IMPL_drawThickFadedEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                              jint thickness, jint fade) {
-	if (((thickness > 0) || (fade > 0)) && (width > 0) && (height > 0) && LLUI_DISPLAY_requestDrawing(gc,
+	if (((thickness > 0) || (fade > 0)) && (width > 0) && (height > 0) && UI_DISPLAY_LIST_request_drawing(gc,
 	                                                                                                  (SNI_callback) &
 	                                                                                                  LLDW_PAINTER_IMPL_drawThickFadedEllipse))
 	{
@@ -129,7 +132,7 @@ void LLDW_PAINTER_IMPL_drawThickFadedEllipse(MICROUI_GraphicsContext *gc, jint x
 
 void LLDW_PAINTER_IMPL_drawThickLine(MICROUI_GraphicsContext *gc, jint startX, jint startY, jint endX, jint endY,
                                      jint thickness) {
-	if ((thickness > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawThickLine)) {
+	if ((thickness > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawThickLine)) {
 		LOG_DRAW_START(drawThickLine);
 		DRAWING_Status status = UI_DRAWING_drawThickLine(gc, startX, startY, endX, endY, thickness);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -138,7 +141,7 @@ void LLDW_PAINTER_IMPL_drawThickLine(MICROUI_GraphicsContext *gc, jint startX, j
 }
 
 void LLDW_PAINTER_IMPL_drawThickCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter, jint thickness) {
-	if ((thickness > 0) && (diameter > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) &
+	if ((thickness > 0) && (diameter > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) &
 	                                                                     LLDW_PAINTER_IMPL_drawThickCircle)) {
 		LOG_DRAW_START(drawThickCircle);
 		DRAWING_Status status = UI_DRAWING_drawThickCircle(gc, x, y, diameter, thickness);
@@ -149,7 +152,7 @@ void LLDW_PAINTER_IMPL_drawThickCircle(MICROUI_GraphicsContext *gc, jint x, jint
 
 void LLDW_PAINTER_IMPL_drawThickEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                         jint thickness) {
-	if ((thickness > 0) && (width > 0) && (height > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) &
+	if ((thickness > 0) && (width > 0) && (height > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) &
 	                                                                                  LLDW_PAINTER_IMPL_drawThickEllipse))
 	{
 		LOG_DRAW_START(drawThickEllipse);
@@ -161,7 +164,7 @@ void LLDW_PAINTER_IMPL_drawThickEllipse(MICROUI_GraphicsContext *gc, jint x, jin
 
 void LLDW_PAINTER_IMPL_drawThickCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter, jfloat startAngle,
                                           jfloat arcAngle, jint thickness) {
-	if ((thickness > 0) && (diameter > 0) && ((int32_t)arcAngle != 0) && LLUI_DISPLAY_requestDrawing(gc,
+	if ((thickness > 0) && (diameter > 0) && ((int32_t)arcAngle != 0) && UI_DISPLAY_LIST_request_drawing(gc,
 	                                                                                                 (SNI_callback) &
 	                                                                                                 LLDW_PAINTER_IMPL_drawThickCircleArc))
 	{
@@ -176,7 +179,7 @@ void LLDW_PAINTER_IMPL_drawFlippedImage(MICROUI_GraphicsContext *gc, MICROUI_Ima
                                         jint width, jint height, jint x, jint y, DRAWING_Flip transformation,
                                         jint alpha) {
 	if (!LLUI_DISPLAY_isImageClosed(img) && (alpha > 0)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawFlippedImage)) {
+	    && UI_DISPLAY_LIST_request_image_drawing(gc, img, (SNI_callback) & LLDW_PAINTER_IMPL_drawFlippedImage)) {
 		LOG_DRAW_START(drawFlippedImage);
 		DRAWING_Status status = UI_DRAWING_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y,
 		                                                    transformation, alpha);
@@ -188,7 +191,8 @@ void LLDW_PAINTER_IMPL_drawFlippedImage(MICROUI_GraphicsContext *gc, MICROUI_Ima
 void LLDW_PAINTER_IMPL_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
                                                        jint rotationX, jint rotationY, jfloat angle, jint alpha) {
 	if (!LLUI_DISPLAY_isImageClosed(img) && (alpha > 0)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawRotatedImageNearestNeighbor)) {
+	    && UI_DISPLAY_LIST_request_image_drawing(gc, img,
+	                                             (SNI_callback) & LLDW_PAINTER_IMPL_drawRotatedImageNearestNeighbor)) {
 		LOG_DRAW_START(drawRotatedImageNearestNeighbor);
 		DRAWING_Status status = UI_DRAWING_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle,
 		                                                                   alpha);
@@ -200,7 +204,8 @@ void LLDW_PAINTER_IMPL_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext *
 void LLDW_PAINTER_IMPL_drawRotatedImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
                                                 jint rotationX, jint rotationY, jfloat angle, jint alpha) {
 	if (!LLUI_DISPLAY_isImageClosed(img) && (alpha > 0)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawRotatedImageBilinear)) {
+	    && UI_DISPLAY_LIST_request_image_drawing(gc, img,
+	                                             (SNI_callback) & LLDW_PAINTER_IMPL_drawRotatedImageBilinear)) {
 		LOG_DRAW_START(drawRotatedImageBilinear);
 		DRAWING_Status status = UI_DRAWING_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -211,7 +216,8 @@ void LLDW_PAINTER_IMPL_drawRotatedImageBilinear(MICROUI_GraphicsContext *gc, MIC
 void LLDW_PAINTER_IMPL_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
                                                       jfloat factorX, jfloat factorY, jint alpha) {
 	if (!LLUI_DISPLAY_isImageClosed(img) && (alpha > 0) && (factorX > 0.f) && (factorY > 0.f)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawScaledImageNearestNeighbor)) {
+	    && UI_DISPLAY_LIST_request_image_drawing(gc, img,
+	                                             (SNI_callback) & LLDW_PAINTER_IMPL_drawScaledImageNearestNeighbor)) {
 		LOG_DRAW_START(drawScaledImageNearestNeighbor);
 		DRAWING_Status status = UI_DRAWING_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -222,7 +228,7 @@ void LLDW_PAINTER_IMPL_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext *g
 void LLDW_PAINTER_IMPL_drawScaledImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
                                                jfloat factorX, jfloat factorY, jint alpha) {
 	if (!LLUI_DISPLAY_isImageClosed(img) && (alpha > 0) && (factorX > 0.f) && (factorY > 0.f)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLDW_PAINTER_IMPL_drawScaledImageBilinear)) {
+	    && UI_DISPLAY_LIST_request_image_drawing(gc, img, (SNI_callback) & LLDW_PAINTER_IMPL_drawScaledImageBilinear)) {
 		LOG_DRAW_START(drawScaledImageBilinear);
 		DRAWING_Status status = UI_DRAWING_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -233,7 +239,7 @@ void LLDW_PAINTER_IMPL_drawScaledImageBilinear(MICROUI_GraphicsContext *gc, MICR
 void LLDW_PAINTER_IMPL_drawScaledStringBilinear(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
                                                 MICROUI_Font *font, jint x, jint y, jfloat xRatio, jfloat yRatio) {
 	if ((length > 0) && (xRatio > 0) && (yRatio > 0)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawScaledStringBilinear)) {
+	    && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawScaledStringBilinear)) {
 		LOG_DRAW_START(drawScaledStringBilinear);
 		DRAWING_Status status = UI_DRAWING_drawScaledStringBilinear(gc, chars, length, font, x, y, xRatio, yRatio);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -246,7 +252,7 @@ void LLDW_PAINTER_IMPL_drawScaledRenderableStringBilinear(MICROUI_GraphicsContex
                                                           MICROUI_RenderableString *renderableString, jint x, jint y,
                                                           jfloat xRatio, jfloat yRatio) {
 	if ((length > 0) && (xRatio > 0) && (yRatio > 0)
-	    && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawScaledRenderableStringBilinear)) {
+	    && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawScaledRenderableStringBilinear)) {
 		LOG_DRAW_START(drawScaledStringBilinear);
 		DRAWING_Status status = UI_DRAWING_drawScaledRenderableStringBilinear(gc, chars, length, font, width,
 		                                                                      renderableString, x, y, xRatio, yRatio);
@@ -257,7 +263,7 @@ void LLDW_PAINTER_IMPL_drawScaledRenderableStringBilinear(MICROUI_GraphicsContex
 
 void LLDW_PAINTER_IMPL_drawCharWithRotationBilinear(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font, jint x,
                                                     jint y, jint xRotation, jint yRotation, jfloat angle, jint alpha) {
-	if ((alpha > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawCharWithRotationBilinear)) {
+	if ((alpha > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawCharWithRotationBilinear)) {
 		LOG_DRAW_START(drawCharWithRotationBilinear);
 		DRAWING_Status status = UI_DRAWING_drawCharWithRotationBilinear(gc, c, font, x, y, xRotation, yRotation, angle,
 		                                                                alpha);
@@ -270,7 +276,7 @@ void LLDW_PAINTER_IMPL_drawCharWithRotationNearestNeighbor(MICROUI_GraphicsConte
                                                            jint x, jint y, jint xRotation, jint yRotation, jfloat angle,
                                                            jint alpha) {
 	if ((alpha > 0) &&
-	    LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawCharWithRotationNearestNeighbor)) {
+	    UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLDW_PAINTER_IMPL_drawCharWithRotationNearestNeighbor)) {
 		LOG_DRAW_START(drawCharWithRotationNearestNeighbor);
 		DRAWING_Status status = UI_DRAWING_drawCharWithRotationNearestNeighbor(gc, c, font, x, y, xRotation, yRotation,
 		                                                                       angle, alpha);
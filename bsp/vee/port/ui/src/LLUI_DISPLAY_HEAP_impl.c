@@ -9,7 +9,20 @@
  * @file
  * @brief This MicroUI images heap allocator replaces the default allocator embedded in the
  * MicroUI Graphics Engine. It is using a best fit allocator and provides some additional APIs
- * to retrieve the heap information: total space, free space, number of blocks allocated.
+ * to retrieve the heap information: total space, free space, number of blocks allocated,
+ * largest free block and fragmentation.
+ *
+ * Some size classes can be reserved at the beginning of the heap (see
+ * UI_FEATURE_ALLOCATOR_SIZE_CLASSES): a size class is a pool of fixed-size slots whose
+ * allocation and free are O(1) and do not fragment the best fit heap.
+ *
+ * The blocks cannot be moved (compacted): the Graphics Engine keeps the addresses of the
+ * allocated blocks.
+ *
+ * The best fit allocator does not give access to its free blocks: the blocks it allocates
+ * are tracked in a table sorted by address (see BESTFIT_TRACKED_BLOCKS). The free blocks
+ * are the gaps between the allocated blocks; the largest free block is retrieved by
+ * walking the table, without allocating anything.
  *
  * @see LLUI_DISPLAY_impl.h file comment
  * @author MicroEJ Developer Team
@@ -26,6 +39,8 @@
 // Includes
 // -----------------------------------------------------------------------------
 
+#include <stdbool.h>
+
 #include "microui_heap.h"
 #include "BESTFIT_ALLOCATOR.h"
 
@@ -45,6 +60,69 @@
  */
 #define BESTFITALLOCATOR_BLOCK_SIZE(block) ((*(uint32_t *)((block) - sizeof(uint32_t))) & 0x7ffffff)
 
+/*
+ * @brief Size of the header stored before an allocated block.
+ */
+#define BESTFITALLOCATOR_BLOCK_HEADER_SIZE (sizeof(uint32_t))
+
+/*
+ * @brief Size of the header and footer of a block: a free block of N bytes can hold a
+ * block of N - BESTFITALLOCATOR_BLOCK_OVERHEAD bytes.
+ */
+#define BESTFITALLOCATOR_BLOCK_OVERHEAD (2u * sizeof(uint32_t))
+
+/*
+ * @brief Maximum number of blocks allocated by the best fit allocator that are tracked
+ * to retrieve the largest free block (4 bytes per block). The blocks allocated beyond
+ * this number are not tracked: the largest free block is then an upper bound.
+ */
+#ifndef BESTFIT_TRACKED_BLOCKS
+#define BESTFIT_TRACKED_BLOCKS (128u)
+#endif
+
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+
+/*
+ * @brief Alignment of the slots (the GPU requires 64-byte aligned buffers).
+ */
+#define SIZE_CLASS_ALIGNMENT (64u)
+
+/*
+ * @brief Maximum number of slots of a size class (one bit per slot).
+ */
+#define SIZE_CLASS_MAX_SLOTS (32u)
+
+#define SIZE_CLASS_ALIGN(size) (((size) + (SIZE_CLASS_ALIGNMENT - 1u)) & ~(uintptr_t)(SIZE_CLASS_ALIGNMENT - 1u))
+
+#endif // UI_FEATURE_ALLOCATOR_SIZE_CLASSES
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+
+/*
+ * @brief Configuration of a size class (see UI_FEATURE_ALLOCATOR_SIZE_CLASSES).
+ */
+typedef struct {
+	uint32_t slot_size;
+	uint32_t slots;
+} size_class_configuration_t;
+
+/*
+ * @brief A size class: "slots" consecutive slots of "slot_size" bytes.
+ */
+typedef struct {
+	uint8_t *start;
+	uint8_t *end;
+	uint32_t slot_size;
+	uint32_t slots;
+	uint32_t used; // one bit per slot
+} size_class_t;
+
+#endif // UI_FEATURE_ALLOCATOR_SIZE_CLASSES
+
 // --------------------------------------------------------------------------------
 // Private fields
 // --------------------------------------------------------------------------------
@@ -53,6 +131,247 @@ static BESTFIT_ALLOCATOR image_heap;
 static uint32_t heap_size;
 static uint32_t free_space;
 static uint32_t allocated_blocks_number;
+static uint32_t failed_allocations_number;
+
+/*
+ * @brief Bounds of the blocks of the best fit allocator (after its main header).
+ */
+static uint8_t *best_fit_start;
+static uint8_t *best_fit_limit;
+
+/*
+ * @brief The blocks allocated by the best fit allocator, sorted by address.
+ */
+static uint8_t *tracked_blocks[BESTFIT_TRACKED_BLOCKS];
+static uint32_t tracked_blocks_number;
+static uint32_t untracked_blocks_number;
+
+/*
+ * @brief The largest block the best fit allocator can allocate; valid when
+ * "largest_best_fit_block_valid" is true (reset on each allocation and free).
+ */
+static uint32_t largest_best_fit_block;
+static bool largest_best_fit_block_valid;
+
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+
+static const size_class_configuration_t size_classes_configuration[] = UI_FEATURE_ALLOCATOR_SIZE_CLASSES;
+
+#define SIZE_CLASSES_COUNT (sizeof(size_classes_configuration) / sizeof(size_class_configuration_t))
+
+/*
+ * @brief The size classes sorted by slot size.
+ */
+static size_class_t size_classes[SIZE_CLASSES_COUNT];
+static uint8_t *size_classes_start;
+static uint8_t *size_classes_end;
+static uint32_t size_class_blocks_number;
+
+#endif // UI_FEATURE_ALLOCATOR_SIZE_CLASSES
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+
+/*
+ * @brief Reserves the size classes at the beginning of the heap. The size classes that
+ * do not fit the heap are ignored.
+ *
+ * @return the start address of the best fit heap.
+ */
+static uint8_t * _initialize_size_classes(uint8_t *heap_start, uint8_t *heap_limit) {
+	// sort the classes by slot size (insertion sort)
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < SIZE_CLASSES_COUNT; i++) {
+		size_class_t size_class = { NULL, NULL, (uint32_t)SIZE_CLASS_ALIGN(size_classes_configuration[i].slot_size),
+			                        size_classes_configuration[i].slots, 0u };
+		if (size_class.slots > SIZE_CLASS_MAX_SLOTS) {
+			size_class.slots = SIZE_CLASS_MAX_SLOTS;
+		}
+
+		uint32_t index = count;
+		while ((index > 0u) && (size_classes[index - 1u].slot_size > size_class.slot_size)) {
+			size_classes[index] = size_classes[index - 1u];
+			index--;
+		}
+		size_classes[index] = size_class;
+		count++;
+	}
+
+	uint8_t *addr = &heap_start[SIZE_CLASS_ALIGN((uintptr_t)heap_start) - (uintptr_t)heap_start];
+	size_classes_start = addr;
+	for (uint32_t i = 0; i < SIZE_CLASSES_COUNT; i++) {
+		size_class_t *size_class = &size_classes[i];
+		uint32_t size = size_class->slot_size * size_class->slots;
+		if ((0u == size_class->slot_size) || ((uint32_t)(heap_limit - addr) <= size)) {
+			// does not fit the heap: disable the class
+			size_class->slots = 0u;
+			size = 0u;
+		}
+		size_class->start = addr;
+		addr += size;
+		size_class->end = addr;
+	}
+	size_classes_end = addr;
+
+	return (addr == size_classes_start) ? heap_start : addr;
+}
+
+/*
+ * @brief Gets the size class of a block.
+ *
+ * @return the size class or NULL when the block has been allocated by the best fit allocator.
+ */
+static size_class_t * _get_size_class(const uint8_t *block) {
+	size_class_t *ret = NULL;
+	if ((block >= size_classes_start) && (block < size_classes_end)) {
+		for (uint32_t i = 0; i < SIZE_CLASSES_COUNT; i++) {
+			if ((block >= size_classes[i].start) && (block < size_classes[i].end)) {
+				ret = &size_classes[i];
+				break;
+			}
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Allocates a slot in the smallest size class that can hold the block.
+ *
+ * @return the slot or NULL when no slot is available.
+ */
+static uint8_t * _allocate_in_size_class(uint32_t size) {
+	uint8_t *ret = NULL;
+	for (uint32_t i = 0; (NULL == ret) && (i < SIZE_CLASSES_COUNT); i++) {
+		size_class_t *size_class = &size_classes[i];
+		if (size <= size_class->slot_size) {
+			for (uint32_t slot = 0; slot < size_class->slots; slot++) {
+				uint32_t bit = 1u << slot;
+				if (0u == (size_class->used & bit)) {
+					size_class->used |= bit;
+					free_space -= size_class->slot_size;
+					size_class_blocks_number++;
+					ret = &size_class->start[slot * size_class->slot_size];
+					break;
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Frees a slot of a size class.
+ *
+ * @return false when the block has been allocated by the best fit allocator.
+ */
+static bool _free_in_size_class(const uint8_t *block) {
+	size_class_t *size_class = _get_size_class(block);
+	if (NULL != size_class) {
+		uint32_t slot = (uint32_t)(block - size_class->start) / size_class->slot_size;
+		size_class->used &= ~(1u << slot);
+		free_space += size_class->slot_size;
+		size_class_blocks_number--;
+	}
+	return NULL != size_class;
+}
+
+#else // UI_FEATURE_ALLOCATOR_SIZE_CLASSES
+
+static inline uint8_t * _allocate_in_size_class(uint32_t size) {
+	(void)size;
+	return NULL;
+}
+
+static inline bool _free_in_size_class(const uint8_t *block) {
+	(void)block;
+	return false;
+}
+
+#endif // UI_FEATURE_ALLOCATOR_SIZE_CLASSES
+
+/*
+ * @brief Gets the index of the first tracked block whose address is higher than or
+ * equal to the given block (dichotomy).
+ */
+static uint32_t _get_tracked_block_index(const uint8_t *block) {
+	uint32_t min = 0;
+	uint32_t max = tracked_blocks_number;
+	while (min < max) {
+		uint32_t middle = min + ((max - min) / 2u);
+		if (tracked_blocks[middle] < block) {
+			min = middle + 1u;
+		} else {
+			max = middle;
+		}
+	}
+	return min;
+}
+
+/*
+ * @brief Adds a block allocated by the best fit allocator in the table of the tracked
+ * blocks.
+ */
+static void _track_block(uint8_t *block) {
+	if (BESTFIT_TRACKED_BLOCKS > tracked_blocks_number) {
+		uint32_t index = _get_tracked_block_index(block);
+		for (uint32_t i = tracked_blocks_number; i > index; i--) {
+			tracked_blocks[i] = tracked_blocks[i - 1u];
+		}
+		tracked_blocks[index] = block;
+		tracked_blocks_number++;
+	} else {
+		untracked_blocks_number++;
+	}
+	largest_best_fit_block_valid = false;
+}
+
+/*
+ * @brief Removes a block freed by the best fit allocator from the table of the tracked
+ * blocks.
+ */
+static void _untrack_block(const uint8_t *block) {
+	uint32_t index = _get_tracked_block_index(block);
+	if ((index < tracked_blocks_number) && (block == tracked_blocks[index])) {
+		tracked_blocks_number--;
+		for (uint32_t i = index; i < tracked_blocks_number; i++) {
+			tracked_blocks[i] = tracked_blocks[i + 1u];
+		}
+	} else {
+		untracked_blocks_number--;
+	}
+	largest_best_fit_block_valid = false;
+}
+
+/*
+ * @brief Gets the size of the largest block the best fit allocator can allocate: walks
+ * the gaps between the tracked blocks (the free blocks of the best fit allocator).
+ */
+static uint32_t _get_largest_best_fit_block(void) {
+	if (!largest_best_fit_block_valid) {
+		uint32_t largest_gap = 0;
+		const uint8_t *gap_start = best_fit_start;
+		for (uint32_t i = 0; i < tracked_blocks_number; i++) {
+			const uint8_t *block_start = tracked_blocks[i] - BESTFITALLOCATOR_BLOCK_HEADER_SIZE;
+			uint32_t gap = (uint32_t)(block_start - gap_start);
+			if (gap > largest_gap) {
+				largest_gap = gap;
+			}
+			gap_start = block_start + BESTFITALLOCATOR_BLOCK_SIZE(tracked_blocks[i]);
+		}
+		uint32_t gap = (uint32_t)(best_fit_limit - gap_start);
+		if (gap > largest_gap) {
+			largest_gap = gap;
+		}
+
+		largest_best_fit_block = (largest_gap > BESTFITALLOCATOR_BLOCK_OVERHEAD) ?
+		                         (largest_gap - BESTFITALLOCATOR_BLOCK_OVERHEAD) : 0u;
+		largest_best_fit_block_valid = true;
+	}
+	return largest_best_fit_block;
+}
 
 // --------------------------------------------------------------------------------
 // microui_heap.h functions
@@ -70,31 +389,90 @@ uint32_t MICROUI_HEAP_number_of_allocated_blocks(void) {
 	return allocated_blocks_number;
 }
 
+uint32_t MICROUI_HEAP_largest_free_block(void) {
+	uint32_t largest = _get_largest_best_fit_block();
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+	for (uint32_t i = 0; i < SIZE_CLASSES_COUNT; i++) {
+		const size_class_t *size_class = &size_classes[i];
+		uint32_t all_slots = (SIZE_CLASS_MAX_SLOTS == size_class->slots) ? 0xffffffffu : ((1u << size_class->slots) - 1u);
+		if ((size_class->slot_size > largest) && (all_slots != size_class->used)) {
+			largest = size_class->slot_size;
+		}
+	}
+#endif
+	return largest;
+}
+
+uint32_t MICROUI_HEAP_fragmentation(void) {
+	uint32_t free = free_space;
+	return (0u == free) ? 0u : (100u - (uint32_t)(((uint64_t)MICROUI_HEAP_largest_free_block() * 100u) / free));
+}
+
+uint32_t MICROUI_HEAP_number_of_failed_allocations(void) {
+	return failed_allocations_number;
+}
+
+uint32_t MICROUI_HEAP_number_of_size_class_blocks(void) {
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+	return size_class_blocks_number;
+#else
+	return 0;
+#endif
+}
+
 // --------------------------------------------------------------------------------
 // LLUI_DISPLAY_impl.h functions
 // --------------------------------------------------------------------------------
 
 void LLUI_DISPLAY_IMPL_imageHeapInitialize(uint8_t *heap_start, uint8_t *heap_limit) {
-	heap_size = heap_limit - heap_start - BESTFITALLOCATOR_HEADER_SIZE;
+	uint8_t *start = heap_start;
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+	start = _initialize_size_classes(heap_start, heap_limit);
+#endif
+	heap_size = heap_limit - start - BESTFITALLOCATOR_HEADER_SIZE;
 	free_space = heap_size;
 	BESTFIT_ALLOCATOR_new(&image_heap);
-	BESTFIT_ALLOCATOR_initialize(&image_heap, (int32_t)heap_start, (int32_t)heap_limit);
+	BESTFIT_ALLOCATOR_initialize(&image_heap, (int32_t)start, (int32_t)heap_limit);
+
+	best_fit_start = &start[BESTFITALLOCATOR_HEADER_SIZE];
+	best_fit_limit = heap_limit;
+	tracked_blocks_number = 0;
+	untracked_blocks_number = 0;
+	largest_best_fit_block_valid = false;
+
+#if defined(UI_FEATURE_ALLOCATOR_SIZE_CLASSES)
+	uint32_t size_classes_size = size_classes_end - size_classes_start;
+	heap_size += size_classes_size;
+	free_space += size_classes_size;
+#endif
 }
 
 uint8_t * LLUI_DISPLAY_IMPL_imageHeapAllocate(uint32_t size) {
-	uint8_t *addr = (uint8_t *)BESTFIT_ALLOCATOR_allocate(&image_heap, (int32_t)size);
+	uint8_t *addr = _allocate_in_size_class(size);
+
+	if (NULL == addr) {
+		addr = (uint8_t *)BESTFIT_ALLOCATOR_allocate(&image_heap, (int32_t)size);
+		if (NULL != addr) {
+			free_space -= BESTFITALLOCATOR_BLOCK_SIZE(addr);
+			_track_block(addr);
+		}
+	}
 
 	if (NULL != addr) {
-		free_space -= BESTFITALLOCATOR_BLOCK_SIZE(addr);
 		allocated_blocks_number++;
+	} else {
+		failed_allocations_number++;
 	}
 	return addr;
 }
 
 void LLUI_DISPLAY_IMPL_imageHeapFree(uint8_t *block) {
-	free_space += BESTFITALLOCATOR_BLOCK_SIZE(block);
 	allocated_blocks_number--;
-	BESTFIT_ALLOCATOR_free(&image_heap, (void *)block);
+	if (!_free_in_size_class(block)) {
+		free_space += BESTFITALLOCATOR_BLOCK_SIZE(block);
+		_untrack_block(block);
+		BESTFIT_ALLOCATOR_free(&image_heap, (void *)block);
+	}
 }
 
 // --------------------------------------------------------------------------------
@@ -25,13 +25,19 @@
 #include <LLUI_DISPLAY_impl.h>
 #include "touch_manager.h"
 #include "ui_display_brs.h"
+#include "ui_display_list.h"
+#include "ui_event_recorder.h"
+#include "ui_rect_collection.h"
+#include "ui_rect_util.h"
 
 #include <FreeRTOS.h>
 #include <semphr.h>
 
 #include "display_impl.h"
+#include "display_rotation.h"
 #include "framerate.h"
 #include "ui_vglite.h"
+#include "ui_vglite_state.h"
 
 #include "vglite_window.h"
 
@@ -76,17 +82,24 @@ static SemaphoreHandle_t sync_flush;
 static uint8_t* dirty_area_addr;	// Address of the source framebuffer
 uint8_t dirty_area_flush; // identifier of the flush
 
-#define START_BUFFER_ADDRESS (0x83880000)
-#define BUFFER_SIZE (0x1C2000)
+#if (0 != DISPLAY_ROTATION)
+#if !defined UI_FEATURE_BRS || (UI_FEATURE_BRS != UI_FEATURE_BRS_SINGLE) || (FRAME_BUFFER_COUNT < 2)
+#error "The display rotation requires the strategy UI_FEATURE_BRS_SINGLE and at least two frame buffers"
+#endif
+#endif // DISPLAY_ROTATION
+
+#if (FRAME_BUFFER_ADDRESS(FRAME_BUFFER_COUNT) > FRAME_BUFFER_END_ADDRESS)
+#error "The frame buffers do not fit the SDRAM: reduce FRAME_BUFFER_COUNT or use the RGB565 frame buffers"
+#endif
 
 // cppcheck-suppress [misra-c2012-9.3] array is fully initialized
 const uint32_t s_frameBufferAddress[FRAME_BUFFER_COUNT] = {
-		START_BUFFER_ADDRESS,
+		FRAME_BUFFER_ADDRESS(0),
 #if defined (FRAME_BUFFER_COUNT) && (FRAME_BUFFER_COUNT > 1)
-		(START_BUFFER_ADDRESS + BUFFER_SIZE),
+		FRAME_BUFFER_ADDRESS(1),
 #endif
 #if defined (FRAME_BUFFER_COUNT) && (FRAME_BUFFER_COUNT > 2)
-		(START_BUFFER_ADDRESS + (2 * BUFFER_SIZE)),
+		FRAME_BUFFER_ADDRESS(2),
 #endif
 };
 
@@ -100,10 +113,99 @@ static vg_lite_display_t display;
  */
 static vg_lite_window_t window;
 
+#if (0 != DISPLAY_ROTATION)
+
+/*
+ * @brief The logical buffer MicroUI draws into (source of the rotation)
+ */
+static vg_lite_buffer_t logical_buffer;
+
+/*
+ * @brief The dirty regions of the frame to rotate in the frame buffer to display
+ */
+static ui_rect_collection_t rotation_areas;
+
+/*
+ * @brief The bounds of the dirty regions of the previous frames: the frame buffer to
+ * display has not been updated with them yet (the first one is the latest frame).
+ */
+static ui_rect_t rotation_previous_bounds[FRAME_BUFFER_COUNT - 1];
+
+#endif // DISPLAY_ROTATION
+
 // -----------------------------------------------------------------------------
 // Private functions
 // -----------------------------------------------------------------------------
 
+#if (0 != DISPLAY_ROTATION)
+
+/*
+ * @brief: Configures the logical buffer MicroUI draws into
+ */
+static void __display_rotation_initialize(void) {
+	logical_buffer = window.buffers[0];
+	logical_buffer.width = LOGICAL_BUFFER_WIDTH;
+	logical_buffer.height = LOGICAL_BUFFER_HEIGHT;
+	logical_buffer.stride = LOGICAL_BUFFER_STRIDE_BYTE;
+	logical_buffer.memory = (void*)LOGICAL_BUFFER_ADDRESS;
+	logical_buffer.address = LOGICAL_BUFFER_ADDRESS;
+	memset(logical_buffer.memory, 0, LOGICAL_BUFFER_STRIDE_BYTE * LOGICAL_BUFFER_HEIGHT);
+
+	UI_RECT_COLLECTION_init(&rotation_areas);
+	for (uint32_t i = 0; i < (FRAME_BUFFER_COUNT - 1); i++) {
+		UI_RECT_mark_empty(&rotation_previous_bounds[i]);
+	}
+}
+
+/*
+ * @brief: Rotates a region of the logical buffer into a frame buffer: the matrix maps the
+ * top-left corner of the region to its rotated position in the frame buffer.
+ */
+static void __display_rotation_blit(vg_lite_buffer_t *frame_buffer, const ui_rect_t *area) {
+	uint32_t rect[4] = { (uint32_t)area->x1, (uint32_t)area->y1, (uint32_t)UI_RECT_get_width(area),
+			(uint32_t)UI_RECT_get_height(area) };
+	vg_lite_matrix_t matrix;
+	DISPLAY_ROTATION_get_blit_matrix(area, &matrix);
+
+	if (VG_LITE_SUCCESS != vg_lite_blit_rect(frame_buffer, &logical_buffer, rect, &matrix, VG_LITE_BLEND_NONE, 0,
+			VG_LITE_FILTER_POINT)) {
+		UI_VGLITE_IMPL_error(false, "vg_lite rotation failed\n");
+	}
+}
+
+/*
+ * @brief: Rotates the dirty regions of the frame into the frame buffer to display. This
+ * frame buffer has been displayed for the last time several frames ago: the dirty
+ * regions of the previous frames are rotated too. The GPU operations are finished by
+ * VGLITE_SwapBuffers().
+ */
+static void __display_rotation_update(vg_lite_buffer_t *frame_buffer) {
+	// the regions are fully copied (no clip)
+	UI_VGLITE_STATE_disable_scissor();
+
+	size_t length = UI_RECT_COLLECTION_get_length(&rotation_areas);
+	for (size_t i = 0; i < length; i++) {
+		__display_rotation_blit(frame_buffer, &rotation_areas.data[i]);
+	}
+	for (uint32_t i = 0; i < (FRAME_BUFFER_COUNT - 1); i++) {
+		if (!UI_RECT_is_empty(&rotation_previous_bounds[i])) {
+			__display_rotation_blit(frame_buffer, &rotation_previous_bounds[i]);
+		}
+	}
+
+	// the oldest frame buffer is up-to-date with the oldest bounds: forget them
+	for (uint32_t i = (FRAME_BUFFER_COUNT - 1); i > 1u; i--) {
+		rotation_previous_bounds[i - 1u] = rotation_previous_bounds[i - 2u];
+	}
+	if (0u < length) {
+		rotation_previous_bounds[0] = UI_RECT_get_minimum_bounding_rect(rotation_areas.data, length);
+	} else {
+		UI_RECT_mark_empty(&rotation_previous_bounds[0]);
+	}
+}
+
+#endif // DISPLAY_ROTATION
+
 /*
  * @brief: Flush current framebuffer to the display
  */
@@ -121,10 +223,16 @@ static void __display_task(void * pvParameters) {
 	do {
 		xSemaphoreTake(sync_flush, portMAX_DELAY);
 
+		uint32_t swap_start = framerate_get_time();
 
 		// save the flush conf: can be modified by the next call to flush() as soon as LLUI_DISPLAY_setDrawingBuffer() will wake up the Graphics Engine
 		uint8_t flush_identifier = dirty_area_flush;
 
+#if (0 != DISPLAY_ROTATION)
+		// the logical buffer is not swapped: its dirty regions are rotated into the frame buffer to display
+		__display_rotation_update(VGLITE_GetRenderTarget(&window));
+#endif
+
 		// Two actions:
 		// 1- wait for the end of previous swap (if not already done): wait the
 		// end of sending of current frame buffer to display
@@ -142,7 +250,12 @@ static void __display_task(void * pvParameters) {
 		FBDEV_GetFrameBuffer(&window.display->g_fbdev, 0);
 #endif
 
+#if (0 != DISPLAY_ROTATION)
+		// MicroUI always draws in the logical buffer
+		vg_lite_buffer_t *current_buffer = &logical_buffer;
+#else
 		vg_lite_buffer_t *current_buffer = VGLITE_GetRenderTarget(&window);
+#endif
 
 		// back buffer not restored but can be used for next drawing
 		if (!LLUI_DISPLAY_setDrawingBuffer(flush_identifier, current_buffer->memory, false)) {
@@ -159,6 +272,9 @@ static void __display_task(void * pvParameters) {
 
 #endif // defined FRAME_BUFFER_COUNT
 
+		UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_DISPLAY_SWAP, flush_identifier, 0u);
+		framerate_stage_record(FRAMERATE_STAGE_SWAP, swap_start);
+
 	} while (1);
 }
 
@@ -195,10 +311,10 @@ void LLUI_DISPLAY_IMPL_initialize(LLUI_DISPLAY_SInitData* init_data) {
 	}
 
 	memset((uint32_t*)(s_frameBufferAddress[0]), 0,
-			DEMO_BUFFER_WIDTH*DEMO_BUFFER_HEIGHT*FRAME_BUFFER_BYTE_PER_PIXEL);
+			FRAME_BUFFER_STRIDE_BYTE*FRAME_BUFFER_HEIGHT);
 #if defined (FRAME_BUFFER_COUNT) && (FRAME_BUFFER_COUNT > 1)
 	memset((uint32_t*)(s_frameBufferAddress[1]), 0,
-			DEMO_BUFFER_WIDTH*DEMO_BUFFER_HEIGHT*FRAME_BUFFER_BYTE_PER_PIXEL);
+			FRAME_BUFFER_STRIDE_BYTE*FRAME_BUFFER_HEIGHT);
 #endif
 
 	UI_VGLITE_initialize();
@@ -232,22 +348,45 @@ void LLUI_DISPLAY_IMPL_initialize(LLUI_DISPLAY_SInitData* init_data) {
 	 * Init MicroUI *
 	 ****************/
 
+#if (0 != DISPLAY_ROTATION)
+	__display_rotation_initialize();
+	vg_lite_buffer_t *buffer = &logical_buffer;
+#else
 	vg_lite_buffer_t *buffer = VGLITE_GetRenderTarget(&window);
+#endif
 	init_data->binary_semaphore_0 = (void*)xSemaphoreCreateBinary();
 	init_data->binary_semaphore_1 = (void*)xSemaphoreCreateBinary();
-	init_data->lcd_width = window.width;
-	init_data->lcd_height = window.height;
+	init_data->lcd_width = buffer->width;
+	init_data->lcd_height = buffer->height;
 	init_data->back_buffer_address = (uint8_t*)buffer->memory;
 }
 
 // See the header file for the function documentation
 void LLUI_DISPLAY_IMPL_flush(MICROUI_GraphicsContext* gc, uint8_t flush_identifier, const ui_rect_t areas[], size_t length) {
 	uint8_t* addr = LLUI_DISPLAY_getBufferAddress(&gc->image);
-	
+	framerate_stage_t previous_stage = framerate_stage_enter(FRAMERATE_STAGE_FLUSH);
+
+	UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_DISPLAY_FLUSH, flush_identifier, length);
+
+	// the recorded drawings and the batched GPU drawings must be performed before sending the buffer to the display
+	UI_DISPLAY_LIST_flush(gc);
+	UI_VGLITE_flush_batch();
+
+	framerate_stage_leave(previous_stage);
+	framerate_frame_end();
+
 	// store dirty area to restore after the flush
 	dirty_area_addr = addr;
 	dirty_area_flush = flush_identifier;
 
+#if (0 != DISPLAY_ROTATION)
+	// store the dirty regions to rotate (the strategy reuses its array as soon as the Graphics Engine draws again)
+	UI_RECT_COLLECTION_clear(&rotation_areas);
+	for (size_t i = 0; (i < length) && !UI_RECT_COLLECTION_is_full(&rotation_areas); i++) {
+		UI_RECT_COLLECTION_add_rect(&rotation_areas, areas[i]);
+	}
+#endif
+
 	// wakeup display task
 	xSemaphoreGive(sync_flush);
 }
@@ -23,7 +23,7 @@
 
 #include "ui_configuration.h"
 
-#if defined(UI_FEATURE_EVENT_DECODER)
+#if defined(UI_FEATURE_EVENT_DECODER) && !defined(UI_FEATURE_EVENT_RECORDER)
 
 // -----------------------------------------------------------------------------
 // Includes
@@ -38,6 +38,9 @@
 // deport event description to another file
 #include "microui_event_decoder.h"
 
+// numbers the touch events
+#include "event_generator.h"
+
 // -----------------------------------------------------------------------------
 // Macros and Defines
 // -----------------------------------------------------------------------------
@@ -87,12 +90,12 @@ void LLUI_INPUT_IMPL_log_queue_full(uint32_t data) {
 }
 
 void LLUI_INPUT_IMPL_log_queue_add(uint32_t data, uint32_t index, uint32_t remaining_elements, uint32_t queue_length) {
-	(void)data;
 	(void)queue_length;
 
 	if (queue_is_first_element) {
 		// start new event: set the event size in array
 		queue_log[index] = (uint8_t)(remaining_elements + (uint32_t)1);
+		EVENT_GENERATOR_log_queue_event(data, index);
 	} else {
 		// continue previous event: drop data
 		queue_log[index] = 0;
@@ -103,11 +106,10 @@ void LLUI_INPUT_IMPL_log_queue_add(uint32_t data, uint32_t index, uint32_t remai
 }
 
 void LLUI_INPUT_IMPL_log_queue_replace(uint32_t old, uint32_t data, uint32_t index, uint32_t queue_length) {
-	// previous event has been replaced, nothing to log
+	// previous event has been replaced: same size, nothing to log
 	(void)old;
 	(void)data;
-	(void)index;
-	(void)queue_length;
+	EVENT_GENERATOR_log_queue_replace(index, queue_length);
 }
 
 void LLUI_INPUT_IMPL_log_queue_read(uint32_t data, uint32_t index) {
@@ -172,4 +174,4 @@ void LLUI_INPUT_IMPL_log_dump(bool log_type, uint32_t log, uint32_t index) {
 // EOF
 // -----------------------------------------------------------------------------
 
-#endif // UI_FEATURE_EVENT_DECODER
+#endif // UI_FEATURE_EVENT_DECODER && !UI_FEATURE_EVENT_RECORDER
@@ -28,6 +28,12 @@
 // calls ui_drawing functions
 #include "ui_drawing.h"
 
+// records or performs the drawings (when enabled)
+#include "ui_display_list.h"
+
+// declares the opaque drawings to the display buffer refresh strategy
+#include "ui_display_brs.h"
+
 // logs the drawings
 #include "ui_log.h"
 
@@ -95,7 +101,7 @@ static inline void _check_bound(jint max, jint *bound, jint *size, jint *origin)
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_writePixel(MICROUI_GraphicsContext *gc, jint x, jint y) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_writePixel)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_writePixel)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(writePixel);
 		if (LLUI_DISPLAY_isPixelInClip(gc, x, y)) {
@@ -112,7 +118,7 @@ void LLUI_PAINTER_IMPL_writePixel(MICROUI_GraphicsContext *gc, jint x, jint y) {
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawLine(MICROUI_GraphicsContext *gc, jint startX, jint startY, jint endX, jint endY) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawLine)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawLine)) {
 		LOG_DRAW_START(drawLine);
 		// cannot reduce/clip line: may be endX < startX and / or endY < startY
 		DRAWING_Status status = UI_DRAWING_drawLine(gc, startX, startY, endX, endY);
@@ -133,7 +139,7 @@ void LLUI_PAINTER_IMPL_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x, j
 		// tests on size and clip are performed after suspend to prevent to perform it several times
 		if ((length > 0) && LLUI_DISPLAY_clipHorizontalLine(gc, &x1, &x2, y)) {
 			LLUI_DISPLAY_configureClip(gc, false /* line has been clipped */);
-			status = UI_DRAWING_drawHorizontalLine(gc, x1, x2, y);
+			status = UI_DISPLAY_LIST_drawHorizontalLine(gc, x1, x2, y);
 		} else {
 			// requestDrawing() has been called and accepted: notify the end of empty drawing
 			status = DRAWING_DONE;
@@ -155,7 +161,7 @@ void LLUI_PAINTER_IMPL_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jin
 		// tests on size and clip are performed after suspend to prevent to perform it several times
 		if ((length > 0) && LLUI_DISPLAY_clipVerticalLine(gc, &y1, &y2, x)) {
 			LLUI_DISPLAY_configureClip(gc, false /* line has been clipped */);
-			status = UI_DRAWING_drawVerticalLine(gc, x, y1, y2);
+			status = UI_DISPLAY_LIST_drawVerticalLine(gc, x, y1, y2);
 		} else {
 			// requestDrawing() has been called and accepted: notify the end of empty drawing
 			status = DRAWING_DONE;
@@ -180,7 +186,7 @@ void LLUI_PAINTER_IMPL_drawRectangle(MICROUI_GraphicsContext *gc, jint x, jint y
 
 			// cannot reduce rectangle; can only check if it is fully in clip
 			LLUI_DISPLAY_configureClip(gc, !LLUI_DISPLAY_isRectangleInClip(gc, x1, y1, x2, y2));
-			status = UI_DRAWING_drawRectangle(gc, x1, y1, x2, y2);
+			status = UI_DISPLAY_LIST_drawRectangle(gc, x1, y1, x2, y2);
 		} else {
 			// requestDrawing() has been called and accepted: notify the end of empty drawing
 			status = DRAWING_DONE;
@@ -192,7 +198,12 @@ void LLUI_PAINTER_IMPL_drawRectangle(MICROUI_GraphicsContext *gc, jint x, jint y
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillRectangle(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillRectangle)) {
+	// the MicroUI colors are opaque: the BRS does not have to restore what the rectangle hides
+	UI_DISPLAY_BRS_set_opaque_region(gc, x, y, x + width - 1, y + height - 1);
+	bool drawing = LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillRectangle);
+	UI_DISPLAY_BRS_clear_opaque_region();
+
+	if (drawing) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillRectangle);
 
@@ -204,7 +215,7 @@ void LLUI_PAINTER_IMPL_fillRectangle(MICROUI_GraphicsContext *gc, jint x, jint y
 		// tests on size and clip are performed after suspend to prevent to perform it several times
 		if ((width > 0) && (height > 0) && LLUI_DISPLAY_clipRectangle(gc, &x1, &y1, &x2, &y2)) {
 			LLUI_DISPLAY_configureClip(gc, false /* rectangle has been clipped */);
-			status = UI_DRAWING_fillRectangle(gc, x1, y1, x2, y2);
+			status = UI_DISPLAY_LIST_fillRectangle(gc, x1, y1, x2, y2);
 		} else {
 			// requestDrawing() has been called and accepted: notify the end of empty drawing
 			status = DRAWING_DONE;
@@ -217,7 +228,7 @@ void LLUI_PAINTER_IMPL_fillRectangle(MICROUI_GraphicsContext *gc, jint x, jint y
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawRoundedRectangle(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                             jint cornerEllipseWidth, jint cornerEllipseHeight) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawRoundedRectangle)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawRoundedRectangle)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(drawRoundedRectangle);
 
@@ -238,7 +249,7 @@ void LLUI_PAINTER_IMPL_drawRoundedRectangle(MICROUI_GraphicsContext *gc, jint x,
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillRoundedRectangle(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                             jint cornerEllipseWidth, jint cornerEllipseHeight) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillRoundedRectangle)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillRoundedRectangle)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillRoundedRectangle);
 
@@ -259,7 +270,7 @@ void LLUI_PAINTER_IMPL_fillRoundedRectangle(MICROUI_GraphicsContext *gc, jint x,
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter, jfloat startAngle,
                                      jfloat arcAngle) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawCircleArc)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawCircleArc)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(drawCircleArc);
 
@@ -280,7 +291,7 @@ void LLUI_PAINTER_IMPL_drawCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                       jfloat startAngle, jfloat arcAngle) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawEllipseArc)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawEllipseArc)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(drawEllipseArc);
 
@@ -301,7 +312,7 @@ void LLUI_PAINTER_IMPL_drawEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter, jfloat startAngle,
                                      jfloat arcAngle) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillCircleArc)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillCircleArc)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillCircleArc);
 
@@ -322,7 +333,7 @@ void LLUI_PAINTER_IMPL_fillCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                       jfloat startAngle, jfloat arcAngle) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillEllipseArc)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillEllipseArc)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillEllipseArc);
 
@@ -342,7 +353,7 @@ void LLUI_PAINTER_IMPL_fillEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawEllipse)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawEllipse)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(drawEllipse);
 
@@ -362,7 +373,7 @@ void LLUI_PAINTER_IMPL_drawEllipse(MICROUI_GraphicsContext *gc, jint x, jint y,
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillEllipse)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillEllipse)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillEllipse);
 
@@ -382,7 +393,7 @@ void LLUI_PAINTER_IMPL_fillEllipse(MICROUI_GraphicsContext *gc, jint x, jint y,
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawCircle)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawCircle)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(drawCircle);
 
@@ -402,7 +413,7 @@ void LLUI_PAINTER_IMPL_drawCircle(MICROUI_GraphicsContext *gc, jint x, jint y, j
 
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_fillCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillCircle)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_fillCircle)) {
 		DRAWING_Status status;
 		LOG_DRAW_START(fillCircle);
 
@@ -423,7 +434,23 @@ void LLUI_PAINTER_IMPL_fillCircle(MICROUI_GraphicsContext *gc, jint x, jint y, j
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawImage(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX, jint regionY,
                                  jint width, jint height, jint x, jint y, jint alpha) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLUI_PAINTER_IMPL_drawImage)) {
+	if ((alpha >= 0xff) && !LLUI_DISPLAY_isImageClosed(img) && !LLUI_DISPLAY_isTransparent(img)) {
+		// the BRS does not have to restore what the opaque image hides
+		jint opaque_x = x;
+		jint opaque_y = y;
+		jint opaque_width = width;
+		jint opaque_height = height;
+		jint opaque_region_x = regionX;
+		jint opaque_region_y = regionY;
+		_check_bound(img->width, &opaque_region_x, &opaque_width, &opaque_x);
+		_check_bound(img->height, &opaque_region_y, &opaque_height, &opaque_y);
+		UI_DISPLAY_BRS_set_opaque_region(gc, opaque_x, opaque_y, opaque_x + opaque_width - 1,
+		                                 opaque_y + opaque_height - 1);
+	}
+	bool drawing = UI_DISPLAY_LIST_request_image_drawing(gc, img, (SNI_callback) & LLUI_PAINTER_IMPL_drawImage);
+	UI_DISPLAY_BRS_clear_opaque_region();
+
+	if (drawing) {
 		DRAWING_Status status = DRAWING_DONE;
 		LOG_DRAW_START(drawImage);
 
@@ -477,7 +504,7 @@ void LLUI_PAINTER_IMPL_drawImage(MICROUI_GraphicsContext *gc, MICROUI_Image *img
 // See the header file for the function documentation
 void LLUI_PAINTER_IMPL_drawString(MICROUI_GraphicsContext *gc, jchar *chars, jint offset, jint length,
                                   MICROUI_Font *font, jint x, jint y) {
-	if ((length > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLUI_PAINTER_IMPL_drawString)) {
+	if ((length > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLUI_PAINTER_IMPL_drawString)) {
 		LOG_DRAW_START(drawString);
 		DRAWING_Status status = UI_DRAWING_drawString(gc, chars + offset, length, font, x, y);
 		LLUI_DISPLAY_setDrawingStatus(status);
@@ -510,7 +537,7 @@ jint LLUI_PAINTER_IMPL_initializeRenderableStringSNIContext(jchar *chars, jint o
 void LLUI_PAINTER_IMPL_drawRenderableString(MICROUI_GraphicsContext *gc, jchar *chars, jint offset, jint length,
                                             MICROUI_Font *font, jint width, MICROUI_RenderableString *renderableString,
                                             jint x, jint y) {
-	if ((length > 0) && LLUI_DISPLAY_requestDrawing(gc, (SNI_callback)LLUI_PAINTER_IMPL_drawRenderableString)) {
+	if ((length > 0) && UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback)LLUI_PAINTER_IMPL_drawRenderableString)) {
 		LOG_DRAW_START(drawString);
 		DRAWING_Status status =
 			UI_DRAWING_drawRenderableString(gc, chars + offset, length, font, width, renderableString, x, y);
@@ -18,6 +18,7 @@
 #include "microej_time.h"
 #include "event_generator.h"
 #include "microui_constants.h"
+#include "microej.h"
 #include "buttons_helper_configuration.h"
 
 // -----------------------------------------------------------------------------
@@ -52,6 +53,38 @@ static int button_pressed = 0;
 static int64_t last_special_cb_time = 0;
 #endif
 
+/* Touch timestamps ----------------------------------------------------------*/
+
+/*
+ * A sample time and the number of its touch event. The number is written after the
+ * time: a reader checks it before and after reading the time (the writer is the touch
+ * task, the reader is the MicroUI thread).
+ */
+typedef struct {
+	int64_t time;
+	volatile uint32_t event;
+} touch_time_t;
+
+static touch_time_t touch_times[EVENT_GENERATOR_TOUCH_TIMES];
+static volatile uint32_t touch_event_count = 0;
+
+/*
+ * What the MicroUI events queue did with the latest touch event (reported by the queue
+ * logger, see EVENT_GENERATOR_log_queue_event() and EVENT_GENERATOR_log_queue_replace()).
+ */
+typedef enum {
+	TOUCH_QUEUE_UNKNOWN, // no queue logger: the event is considered as added
+	TOUCH_QUEUE_ADDED,
+	TOUCH_QUEUE_REPLACED,
+} touch_queue_status_t;
+
+static volatile touch_queue_status_t touch_queue_status = TOUCH_QUEUE_UNKNOWN;
+
+/*
+ * Index in the MicroUI events queue of the first element of the latest touch event.
+ */
+static volatile uint32_t touch_queue_index = UINT32_MAX;
+
 // -----------------------------------------------------------------------------
 // Internal functions definition
 // -----------------------------------------------------------------------------
@@ -66,6 +99,16 @@ static int64_t last_special_cb_time = 0;
 static void __call_special_cb(void);
 #endif
 
+/*
+ * @brief Numbers a touch event added to the MicroUI events queue and stores its
+ * sample time. When the event has replaced the previous touch event (MicroUI coalesces
+ * the move events not read yet), the number is not changed: the sample time of the
+ * previous event is updated.
+ *
+ * @return the given status
+ */
+static int32_t __store_touch_time(int32_t status, int64_t time);
+
 // -----------------------------------------------------------------------------
 // Project functions
 // -----------------------------------------------------------------------------
@@ -85,6 +128,18 @@ int EVENT_GENERATOR_register_special_cb(EVENT_GENERATOR_special_cb_t i_special_c
 /* Touch ---------------------------------------------------------------------*/
 
 int32_t EVENT_GENERATOR_touch_pressed(int32_t x, int32_t y) {
+	return EVENT_GENERATOR_touch_pressed_at(x, y, microej_time_get_current_time(MICROEJ_TRUE));
+}
+
+int32_t EVENT_GENERATOR_touch_moved(int32_t x, int32_t y) {
+	return EVENT_GENERATOR_touch_moved_at(x, y, microej_time_get_current_time(MICROEJ_TRUE));
+}
+
+int32_t EVENT_GENERATOR_touch_released(void) {
+	return EVENT_GENERATOR_touch_released_at(microej_time_get_current_time(MICROEJ_TRUE));
+}
+
+int32_t EVENT_GENERATOR_touch_pressed_at(int32_t x, int32_t y, int64_t time) {
 #if defined EVENT_GENERATOR_SPECIAL_FUNCTION
 	if (button_pressed) {
 		__call_special_cb();
@@ -92,10 +147,10 @@ int32_t EVENT_GENERATOR_touch_pressed(int32_t x, int32_t y) {
 	}
 #endif
 
-	return LLUI_INPUT_sendTouchPressedEvent(MICROUI_EVENTGEN_TOUCH, x, y);
+	return __store_touch_time(LLUI_INPUT_sendTouchPressedEvent(MICROUI_EVENTGEN_TOUCH, x, y), time);
 }
 
-int32_t EVENT_GENERATOR_touch_moved(int32_t x, int32_t y) {
+int32_t EVENT_GENERATOR_touch_moved_at(int32_t x, int32_t y, int64_t time) {
 #if defined EVENT_GENERATOR_SPECIAL_FUNCTION
 	if (button_pressed) {
 		__call_special_cb();
@@ -103,17 +158,53 @@ int32_t EVENT_GENERATOR_touch_moved(int32_t x, int32_t y) {
 	}
 #endif
 
-	return LLUI_INPUT_sendTouchMovedEvent(MICROUI_EVENTGEN_TOUCH, x, y);
+	return __store_touch_time(LLUI_INPUT_sendTouchMovedEvent(MICROUI_EVENTGEN_TOUCH, x, y), time);
 }
 
-int32_t EVENT_GENERATOR_touch_released(void) {
+int32_t EVENT_GENERATOR_touch_released_at(int64_t time) {
 #if defined EVENT_GENERATOR_SPECIAL_FUNCTION
 	if (button_pressed) {
 		return LLUI_INPUT_NOK;
 	}
 #endif
 
-	return LLUI_INPUT_sendTouchReleasedEvent(MICROUI_EVENTGEN_TOUCH);
+	return __store_touch_time(LLUI_INPUT_sendTouchReleasedEvent(MICROUI_EVENTGEN_TOUCH), time);
+}
+
+/* Touch timestamps ----------------------------------------------------------*/
+
+int32_t Java_com_nxp_event_TouchTimes_getTouchEventCount(void) {
+	return (int32_t)touch_event_count;
+}
+
+int64_t Java_com_nxp_event_TouchTimes_getTouchEventTime(int32_t event) {
+	touch_time_t *entry = &touch_times[(uint32_t)event % EVENT_GENERATOR_TOUCH_TIMES];
+	int64_t time = -1;
+
+	if ((0 < event) && (entry->event == (uint32_t)event)) {
+		time = entry->time;
+		if (entry->event != (uint32_t)event) {
+			// overwritten while reading
+			time = -1;
+		}
+	}
+	return time;
+}
+
+void EVENT_GENERATOR_log_queue_event(uint32_t event, uint32_t index) {
+	// the generator identifier is the second byte of the event's first element
+	if ((uint32_t)MICROUI_EVENTGEN_TOUCH == ((event >> 16) & 0xffu)) {
+		touch_queue_index = index;
+		touch_queue_status = TOUCH_QUEUE_ADDED;
+	}
+}
+
+void EVENT_GENERATOR_log_queue_replace(uint32_t index, uint32_t queue_length) {
+	// a touch event is made of its first element and one data element
+	uint32_t first = touch_queue_index;
+	if ((UINT32_MAX != first) && ((first == index) || (((first + 1u) % queue_length) == index))) {
+		touch_queue_status = TOUCH_QUEUE_REPLACED;
+	}
 }
 
 // -----------------------------------------------------------------------------
@@ -141,6 +232,24 @@ static void __call_special_cb(void) {
 }
 #endif
 
+// See the section 'Internal function definitions' for the function documentation
+static int32_t __store_touch_time(int32_t status, int64_t time) {
+	if (LLUI_INPUT_OK == status) {
+		// only the touch task adds the touch events
+		uint32_t event = touch_event_count;
+		if ((TOUCH_QUEUE_REPLACED != touch_queue_status) || (0u == event)) {
+			event++;
+		}
+		touch_time_t *entry = &touch_times[event % EVENT_GENERATOR_TOUCH_TIMES];
+		entry->event = 0u;
+		entry->time = time;
+		entry->event = event;
+		touch_event_count = event;
+	}
+	touch_queue_status = TOUCH_QUEUE_UNKNOWN;
+	return status;
+}
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
@@ -1,16 +1,32 @@
 /*
  * C
  *
- * Copyright 2015-2023 MicroEJ Corp. All rights reserved.
+ * Copyright 2015-2025 MicroEJ Corp. All rights reserved.
  * Use of this source code is governed by a BSD-style license that can be found with this software.
  */
 
 /* Includes ------------------------------------------------------------------*/
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "framerate_impl.h"
 #include "microej_time.h"
 #include "microej.h"
+#include "ui_log.h"
+
+/* Defines -------------------------------------------------------------------*/
+
+#ifdef FRAMERATE_ENABLED
+
+/*
+ * Histograms of the stages: the first buckets hold one microsecond each, then each power
+ * of 2 is split in 8 buckets (precision of 12.5%) up to 4 seconds
+ */
+#define FRAMERATE_SUB_BUCKETS_SHIFT (3u)
+#define FRAMERATE_SUB_BUCKETS (1u << FRAMERATE_SUB_BUCKETS_SHIFT)
+#define FRAMERATE_BUCKETS (160u)
+
+#endif
 
 /* Globals -------------------------------------------------------------------*/
 
@@ -18,6 +34,89 @@
 static uint32_t framerate_schedule_time = 0;	// means "not initialised"
 static uint32_t framerate_counter;
 static uint32_t framerate_last;
+
+// histograms of the stages (in microseconds)
+static uint32_t framerate_histograms[FRAMERATE_STAGE_COUNT][FRAMERATE_BUCKETS];
+static uint32_t framerate_samples[FRAMERATE_STAGE_COUNT];
+static uint32_t framerate_max[FRAMERATE_STAGE_COUNT];
+
+// current frame (only used by the Graphics Engine's task)
+static framerate_stage_t framerate_current_stage = FRAMERATE_STAGE_DRAWING;
+static uint32_t framerate_transition_time;
+static uint32_t framerate_frame_ticks[FRAMERATE_STAGE_COUNT];
+static bool framerate_frame_started;
+#endif
+
+/* Private API ---------------------------------------------------------------*/
+
+#ifdef FRAMERATE_ENABLED
+
+static uint32_t _framerate_get_bucket(uint32_t us)
+{
+	uint32_t bucket;
+	if (us < FRAMERATE_SUB_BUCKETS)
+	{
+		bucket = us;
+	}
+	else
+	{
+		uint32_t msb = 31u - (uint32_t)__builtin_clz(us);
+		bucket = (FRAMERATE_SUB_BUCKETS * (msb - FRAMERATE_SUB_BUCKETS_SHIFT + 1u))
+				+ ((us >> (msb - FRAMERATE_SUB_BUCKETS_SHIFT)) & (FRAMERATE_SUB_BUCKETS - 1u));
+		if (bucket >= FRAMERATE_BUCKETS)
+		{
+			bucket = FRAMERATE_BUCKETS - 1u;
+		}
+	}
+	return bucket;
+}
+
+/*
+ * Return the highest value of a bucket (in microseconds)
+ */
+static uint32_t _framerate_get_bucket_max(uint32_t bucket)
+{
+	uint32_t max;
+	if (bucket < (FRAMERATE_SUB_BUCKETS - 1u))
+	{
+		max = bucket;
+	}
+	else if (bucket == (FRAMERATE_BUCKETS - 1u))
+	{
+		max = UINT32_MAX;
+	}
+	else
+	{
+		// lowest value of the next bucket, minus one
+		uint32_t next = bucket + 1u;
+		uint32_t msb = (next / FRAMERATE_SUB_BUCKETS) + FRAMERATE_SUB_BUCKETS_SHIFT - 1u;
+		uint32_t sub = next % FRAMERATE_SUB_BUCKETS;
+		max = ((FRAMERATE_SUB_BUCKETS + sub) << (msb - FRAMERATE_SUB_BUCKETS_SHIFT)) - 1u;
+	}
+	return max;
+}
+
+static void _framerate_add_sample(framerate_stage_t stage, uint32_t us)
+{
+	// the bucket is updated before the number of samples: the percentiles can be read at any time
+	framerate_histograms[stage][_framerate_get_bucket(us)]++;
+	framerate_samples[stage]++;
+	if (us > framerate_max[stage])
+	{
+		framerate_max[stage] = us;
+	}
+}
+
+/*
+ * Charge the time since the last transition to the current stage
+ */
+static void _framerate_charge_current_stage(void)
+{
+	uint32_t now = framerate_impl_get_ticks();
+	framerate_frame_ticks[framerate_current_stage] += now - framerate_transition_time;
+	framerate_transition_time = now;
+}
+
 #endif
 
 /* API -----------------------------------------------------------------------*/
@@ -87,6 +186,169 @@ void framerate_task_work(void)
 #endif
 }
 
+/* Frame timeline API --------------------------------------------------------*/
+
+uint32_t framerate_get_time(void)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_impl_get_ticks();
+#else
+	return 0;
+#endif
+}
+
+framerate_stage_t framerate_stage_enter(framerate_stage_t stage)
+{
+#ifdef FRAMERATE_ENABLED
+	framerate_stage_t previous = framerate_current_stage;
+	_framerate_charge_current_stage();
+	framerate_current_stage = stage;
+	return previous;
+#else
+	UNUSED(stage);
+	return FRAMERATE_STAGE_DRAWING;
+#endif
+}
+
+void framerate_stage_leave(framerate_stage_t previous)
+{
+#ifdef FRAMERATE_ENABLED
+	_framerate_charge_current_stage();
+	framerate_current_stage = previous;
+#else
+	UNUSED(previous);
+#endif
+}
+
+void framerate_stage_record(framerate_stage_t stage, uint32_t start_time)
+{
+#ifdef FRAMERATE_ENABLED
+	_framerate_add_sample(stage, (framerate_impl_get_ticks() - start_time) / framerate_impl_get_ticks_per_us());
+#else
+	UNUSED(stage);
+	UNUSED(start_time);
+#endif
+}
+
+void framerate_frame_start(void)
+{
+#ifdef FRAMERATE_ENABLED
+	if (!framerate_frame_started)
+	{
+		// forget the time since the end of the previous flush (the application was not drawing)
+		framerate_frame_started = true;
+		framerate_frame_ticks[FRAMERATE_STAGE_DRAWING] = 0;
+		framerate_transition_time = framerate_impl_get_ticks();
+	}
+#endif
+}
+
+void framerate_frame_end(void)
+{
+#ifdef FRAMERATE_ENABLED
+	_framerate_charge_current_stage();
+
+	uint32_t ticks_per_us = framerate_impl_get_ticks_per_us();
+	uint32_t us[FRAMERATE_STAGE_COUNT];
+	us[FRAMERATE_STAGE_FRAME] = 0;
+	for (uint32_t stage = FRAMERATE_STAGE_DRAWING; stage <= FRAMERATE_STAGE_FLUSH; stage++)
+	{
+		us[stage] = framerate_frame_ticks[stage] / ticks_per_us;
+		us[FRAMERATE_STAGE_FRAME] += us[stage];
+		_framerate_add_sample((framerate_stage_t)stage, us[stage]);
+		framerate_frame_ticks[stage] = 0;
+	}
+	_framerate_add_sample(FRAMERATE_STAGE_FRAME, us[FRAMERATE_STAGE_FRAME]);
+
+	LLTRACE_record_event_u32x5(LLUI_EVENT_group, LLUI_EVENT_offset + UI_LOG_FRAME_Timeline, us[FRAMERATE_STAGE_FRAME],
+			us[FRAMERATE_STAGE_DRAWING], us[FRAMERATE_STAGE_RESTORE], us[FRAMERATE_STAGE_GPU_WAIT],
+			us[FRAMERATE_STAGE_FLUSH]);
+
+	// next frame
+	framerate_current_stage = FRAMERATE_STAGE_DRAWING;
+	framerate_frame_started = false;
+#endif
+}
+
+uint32_t framerate_stage_count(framerate_stage_t stage)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_samples[stage];
+#else
+	UNUSED(stage);
+	return 0;
+#endif
+}
+
+uint32_t framerate_stage_percentile(framerate_stage_t stage, uint32_t percentile)
+{
+#ifdef FRAMERATE_ENABLED
+	uint32_t ret = 0;
+	uint32_t samples = framerate_samples[stage];
+	if (samples > (uint32_t)0)
+	{
+		// rank of the sample (1-based)
+		uint32_t p = (percentile > (uint32_t)100) ? (uint32_t)100 : percentile;
+		uint32_t rank = (uint32_t)((((uint64_t)samples * p) + (uint64_t)99) / (uint64_t)100);
+		rank = (rank == (uint32_t)0) ? (uint32_t)1 : rank;
+
+		uint32_t bucket = 0;
+		uint32_t sum = framerate_histograms[stage][0];
+		while (sum < rank)
+		{
+			bucket++;
+			sum += framerate_histograms[stage][bucket];
+		}
+
+		ret = _framerate_get_bucket_max(bucket);
+		ret = (ret > framerate_max[stage]) ? framerate_max[stage] : ret;
+	}
+	return ret;
+#else
+	UNUSED(stage);
+	UNUSED(percentile);
+	return 0;
+#endif
+}
+
+uint32_t framerate_stage_max(framerate_stage_t stage)
+{
+#ifdef FRAMERATE_ENABLED
+	return framerate_max[stage];
+#else
+	UNUSED(stage);
+	return 0;
+#endif
+}
+
+void framerate_stages_reset(void)
+{
+#ifdef FRAMERATE_ENABLED
+	for (uint32_t stage = 0; stage < (uint32_t)FRAMERATE_STAGE_COUNT; stage++)
+	{
+		framerate_samples[stage] = 0;
+		framerate_max[stage] = 0;
+		for (uint32_t bucket = 0; bucket < FRAMERATE_BUCKETS; bucket++)
+		{
+			framerate_histograms[stage][bucket] = 0;
+		}
+	}
+#endif
+}
+
+void framerate_stages_dump(void)
+{
+#ifdef FRAMERATE_ENABLED
+	for (uint32_t stage = 0; stage < (uint32_t)FRAMERATE_STAGE_COUNT; stage++)
+	{
+		framerate_stage_t s = (framerate_stage_t)stage;
+		LLTRACE_record_event_u32x6(LLUI_EVENT_group, LLUI_EVENT_offset + UI_LOG_FRAME_Stage, stage,
+				framerate_stage_count(s), framerate_stage_percentile(s, 50), framerate_stage_percentile(s, 90),
+				framerate_stage_percentile(s, 99), framerate_stage_max(s));
+	}
+#endif
+}
+
 /* Java API ------------------------------------------------------------------*/
 
 int32_t javaFramerateInit(int32_t schedule_time)
@@ -98,3 +360,37 @@ uint32_t javaFramerateGet(void)
 {
 	return framerate_get();
 }
+
+/*
+ * Check the stage given by the application
+ */
+static inline bool _framerate_is_stage(int32_t stage)
+{
+	return (stage >= 0) && (stage < (int32_t)FRAMERATE_STAGE_COUNT);
+}
+
+uint32_t javaFramerateGetStageCount(int32_t stage)
+{
+	return _framerate_is_stage(stage) ? framerate_stage_count((framerate_stage_t)stage) : 0;
+}
+
+uint32_t javaFramerateGetStagePercentile(int32_t stage, int32_t percentile)
+{
+	return (_framerate_is_stage(stage) && (percentile >= 0))
+			? framerate_stage_percentile((framerate_stage_t)stage, (uint32_t)percentile) : 0;
+}
+
+uint32_t javaFramerateGetStageMax(int32_t stage)
+{
+	return _framerate_is_stage(stage) ? framerate_stage_max((framerate_stage_t)stage) : 0;
+}
+
+void javaFramerateResetStages(void)
+{
+	framerate_stages_reset();
+}
+
+void javaFramerateDumpStages(void)
+{
+	framerate_stages_dump();
+}
@@ -16,6 +16,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "fsl_common.h"
 #include "framerate_impl.h"
 
 /* Defines -------------------------------------------------------------------*/
@@ -50,5 +51,22 @@ __weak void framerate_impl_sleep(uint32_t ms)
 	return;
 }
 
+__weak uint32_t framerate_impl_get_ticks(void)
+{
+	// the FreeRTOS tick is too coarse: use the cycle counter (enabled on the first call)
+	if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0u)
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CYCCNT = 0;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+	}
+	return DWT->CYCCNT;
+}
+
+__weak uint32_t framerate_impl_get_ticks_per_us(void)
+{
+	return SystemCoreClock / 1000000u;
+}
+
 #endif
 
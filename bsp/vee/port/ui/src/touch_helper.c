@@ -24,6 +24,8 @@
 // -----------------------------------------------------------------------------
 #include "LLUI_INPUT.h"
 #include "microej.h"
+#include "microej_time.h"
+#include "touch_helper.h"
 #include "touch_helper_configuration.h"
 #include "event_generator.h"
 
@@ -60,6 +62,10 @@ static uint16_t previous_touch_x, previous_touch_y;
 // -----------------------------------------------------------------------------
 
 void TOUCH_HELPER_pressed(int32_t x, int32_t y) {
+	TOUCH_HELPER_pressed_at(x, y, microej_time_get_current_time(MICROEJ_TRUE));
+}
+
+void TOUCH_HELPER_pressed_at(int32_t x, int32_t y, int64_t time) {
 	// here, pen is down for sure
 
 	if (touch_pressed == MICROEJ_TRUE) {
@@ -80,12 +86,12 @@ void TOUCH_HELPER_pressed(int32_t x, int32_t y) {
 			touch_moved = MICROEJ_TRUE;
 
 			// send a MicroUI touch event (don't care if event is lost)
-			EVENT_GENERATOR_touch_moved(x, y);
+			EVENT_GENERATOR_touch_moved_at(x, y, time);
 		}
 		// else: same position; no need to send an event
 	} else {
 		// pen was up => press event
-		if (EVENT_GENERATOR_touch_pressed(x, y) == LLUI_INPUT_OK) {
+		if (EVENT_GENERATOR_touch_pressed_at(x, y, time) == LLUI_INPUT_OK) {
 			// the event has been managed: we can store the new touch state
 			// touch is pressed now
 			previous_touch_x = x;
@@ -103,11 +109,15 @@ void TOUCH_HELPER_moved(int32_t x, int32_t y) {
 }
 
 void TOUCH_HELPER_released(void) {
+	TOUCH_HELPER_released_at(microej_time_get_current_time(MICROEJ_TRUE));
+}
+
+void TOUCH_HELPER_released_at(int64_t time) {
 	// here, pen is up for sure
 
 	if (touch_pressed == MICROEJ_TRUE) {
 		// pen was down => release event
-		if (EVENT_GENERATOR_touch_released() == LLUI_INPUT_OK) {
+		if (EVENT_GENERATOR_touch_released_at(time) == LLUI_INPUT_OK) {
 			// the event has been managed: we can store the new touch state
 			// touch is released now
 			touch_pressed = MICROEJ_FALSE;
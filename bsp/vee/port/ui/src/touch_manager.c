@@ -9,6 +9,8 @@
 // Includes
 // -----------------------------------------------------------------------------
 #include "display_support.h"
+#include "display_configuration.h"
+#include "display_rotation.h"
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "board.h"
@@ -26,6 +28,8 @@
 
 #include "touch_helper.h"
 
+#include "microej.h"
+#include "microej_time.h"
 #include "mej_log.h"
 
 // RTOS
@@ -37,7 +41,9 @@
 // -----------------------------------------------------------------------------
 
 /*
- * @brief Task delay (in ms) between detecting a multiple pressed events
+ * @brief Maximum delay (in ms) between two samples while the touch is pressed: the touch
+ * controller raises an interrupt for each new sample (press, move and release); the
+ * touch is read again when no interrupt occurs during this delay.
  */
 #define TOUCH_DELAY 15
 
@@ -58,9 +64,10 @@
 // -----------------------------------------------------------------------------
 
 /**
- * Retrieves the touch state and coordinates
+ * Retrieves the touch state and coordinates; the events are stamped with the time of
+ * the given tick (the tick of the interrupt)
  */
-static status_t __touch_manager_read(void);
+static status_t __touch_manager_read(TickType_t sample_tick);
 
 /**
  * Touch thread routine
@@ -98,6 +105,11 @@ static volatile bool s_touchEvent = false;
  */
 static SemaphoreHandle_t touch_interrupt_sem;
 
+/*
+ * @brief Tick of the latest touch interrupt (time of the sample to read)
+ */
+static volatile TickType_t touch_interrupt_tick;
+
 // -----------------------------------------------------------------------------
 // Public functions
 // -----------------------------------------------------------------------------
@@ -194,6 +206,9 @@ void TOUCH_MANAGER_interrupt(void) {
 
 		GPIO_PortClearInterruptFlags(CM7_GPIO2, (1UL << CM7_GPIO2_TOUCH_PIN));
 
+		// stamp the sample now: the touch task may be delayed by the other tasks
+		touch_interrupt_tick = xTaskGetTickCountFromISR();
+
 		portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
 		xSemaphoreGiveFromISR(touch_interrupt_sem, &xHigherPriorityTaskWoken);
 		if (xHigherPriorityTaskWoken != pdFALSE) {
@@ -212,32 +227,45 @@ void CM7_GPIO2_3_IRQHandler(void) {
 // -----------------------------------------------------------------------------
 
 // See the section 'Internal function definitions' for the function documentation
-static status_t __touch_manager_read(void) {
+static status_t __touch_manager_read(TickType_t sample_tick) {
 	int touch_x;
 	int touch_y;
 	status_t status;
 
 	status = GT911_GetSingleTouch(&s_touchHandle, &touch_x, &touch_y);
+
+	// platform time of the sample: the current time minus the time elapsed since the interrupt
+	int64_t time = microej_time_get_current_time(MICROEJ_TRUE) -
+			((int64_t)(xTaskGetTickCount() - sample_tick) * portTICK_PERIOD_MS);
+
 	if (kStatus_Success == status) {
-		TOUCH_HELPER_pressed(touch_x, touch_y);
+#if (0 != DISPLAY_ROTATION)
+		// rotate the panel coordinates to the logical coordinates (see DISPLAY_ROTATION)
+		int32_t logical_x;
+		int32_t logical_y;
+		DISPLAY_ROTATION_get_logical_point(touch_x, touch_y, &logical_x, &logical_y);
+		touch_x = logical_x;
+		touch_y = logical_y;
+#endif
+		TOUCH_HELPER_pressed_at(touch_x, touch_y, time);
 	} else if (kStatus_TOUCHPANEL_NotTouched == status) {
-		TOUCH_HELPER_released();
+		TOUCH_HELPER_released_at(time);
 	}
 	return status;
 }
 
 // See the section 'Internal function definitions' for the function documentation
 static void __touch_manager_task(void *pvParameters) {
+	bool pressed = false;
 	while (1) {
-		/* Suspend ourselves */
-		// Workaround to read touch data without IRQ handler.
-		xSemaphoreTake(touch_interrupt_sem, portMAX_DELAY);
-		status_t status;
-		/* We have been woken up, lets work ! */
-		do {
-			vTaskDelay(TOUCH_DELAY / portTICK_PERIOD_MS);
-			status = __touch_manager_read();
-		} while (kStatus_Success == status);
+		// wait for the next sample: the read is performed as soon as the interrupt occurs (the I2C transfer
+		// is interrupt-driven: the task sleeps until its end); when pressed, the touch is read again after
+		// TOUCH_DELAY without interrupt (missed release)
+		TickType_t timeout = pressed ? (TOUCH_DELAY / portTICK_PERIOD_MS) : portMAX_DELAY;
+		bool interrupted = pdTRUE == xSemaphoreTake(touch_interrupt_sem, timeout);
+		TickType_t sample_tick = interrupted ? touch_interrupt_tick : xTaskGetTickCount();
+
+		pressed = kStatus_Success == __touch_manager_read(sample_tick);
 
 		/* Reenable interrupt for next event */
 		GPIO_EnableInterrupts(CM7_GPIO2, (1UL << CM7_GPIO2_TOUCH_PIN));
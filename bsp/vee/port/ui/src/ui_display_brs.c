@@ -20,6 +20,21 @@
 #include "bsp_util.h"
 #include "ui_drawing.h"
 
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The graphics context of the drawing that has declared an opaque rectangle
+ * (NULL when there is no opaque rectangle).
+ */
+static const MICROUI_GraphicsContext *opaque_gc;
+
+/*
+ * @brief The opaque rectangle of the next drawing (already clipped).
+ */
+static ui_rect_t opaque_region;
+
 // --------------------------------------------------------------------------------
 // ui_display_brs.h API
 // --------------------------------------------------------------------------------
@@ -68,6 +83,35 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DISPLAY_BRS_restore(MICROUI_GraphicsCont
 	return ret;
 }
 
+// See the header file for the function documentation
+void UI_DISPLAY_BRS_set_opaque_region(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	jint cx1 = x1;
+	jint cy1 = y1;
+	jint cx2 = x2;
+	jint cy2 = y2;
+
+	if ((x1 <= x2) && (y1 <= y2) && LLUI_DISPLAY_clipRectangle(gc, &cx1, &cy1, &cx2, &cy2)) {
+		opaque_region = UI_RECT_new_xyxy(cx1, cy1, cx2, cy2);
+		opaque_gc = gc;
+	} else {
+		opaque_gc = NULL;
+	}
+}
+
+// See the header file for the function documentation
+void UI_DISPLAY_BRS_clear_opaque_region(void) {
+	opaque_gc = NULL;
+}
+
+// See the header file for the function documentation
+bool UI_DISPLAY_BRS_get_opaque_region(const MICROUI_GraphicsContext *gc, ui_rect_t *rect) {
+	bool ret = (NULL != opaque_gc) && (gc == opaque_gc);
+	if (ret) {
+		*rect = opaque_region;
+	}
+	return ret;
+}
+
 // --------------------------------------------------------------------------------
 // EOF
 // --------------------------------------------------------------------------------
@@ -21,6 +21,7 @@
 
 #include "ui_rect_collection.h"
 #include "ui_rect_util.h"
+#include "framerate.h"
 
 // --------------------------------------------------------------------------------
 // Defines
@@ -77,17 +78,36 @@ static ui_rect_t flush_bounds = {
 // Private functions
 // --------------------------------------------------------------------------------
 
+/*
+ * @brief Tells if a rectangle fits the full graphics context.
+ */
+static inline bool _is_full_screen(MICROUI_GraphicsContext *gc, const ui_rect_t *rect) {
+	return (rect->x1 == 0) && (rect->y1 == 0) && (rect->x2 == (gc->image.width - 1)) &&
+	       (rect->y2 == (gc->image.height - 1));
+}
+
+/*
+ * @brief Tells if a region to restore will be hidden by the opaque rectangle of the next
+ * drawing (see UI_DISPLAY_BRS_set_opaque_region()).
+ *
+ * @param[in] opaque the opaque rectangle or NULL when the drawing is not opaque.
+ */
+static inline bool _is_hidden(const ui_rect_t *opaque, const ui_rect_t *rect) {
+	return (NULL != opaque) && UI_RECT_contains_rect(opaque, rect);
+}
+
 /*
  * This function removes all regions saved in the next collection to restore in the
- * new back buffer if they are included in the new region.
+ * new back buffer if they are included in the new region or hidden by the opaque
+ * rectangle of the drawing.
  */
-static void _remove_drawing_regions(MICROUI_GraphicsContext *gc, ui_rect_t *region) {
+static void _remove_drawing_regions(MICROUI_GraphicsContext *gc, ui_rect_t *region, const ui_rect_t *opaque) {
 	(void)gc;
 
 	for (uint32_t i = 0u; i < (UI_FEATURE_BRS_DRAWING_BUFFER_COUNT - 1u); i++) {
 		ui_rect_t *r = dirty_regions[i].data;
 		while (r != UI_RECT_COLLECTION_get_end(&dirty_regions[i])) {
-			if (!UI_RECT_is_empty(r) && UI_RECT_contains_rect(region, r)) {
+			if (!UI_RECT_is_empty(r) && (UI_RECT_contains_rect(region, r) || _is_hidden(opaque, r))) {
 				// this region will be re-drawn: remove it from the restoration array
 				LOG_REGION(UI_LOG_BRS_RemoveRegion, r);
 				UI_RECT_mark_empty(r);
@@ -132,16 +152,18 @@ static void _add_drawing_region(MICROUI_GraphicsContext *gc, ui_rect_t *region)
  * @brief Checks if the past has to be restored and if the collection that represents
  * the past has to be cleared.
  *
- * The past may be not restored if the new drawing region includes the past (no need to
- * restore) or if the current back buffer is the same buffer than before last flush()
- * (because it already contains the past).
+ * The past may be not restored if the new drawing region or the opaque rectangle of the
+ * drawing includes the past (no need to restore) or if the current back buffer is the
+ * same buffer than before last flush() (because it already contains the past).
  *
  * @param[in] gc the MicroUI GraphicsContext that targets the current back buffer
  * @param[in] dirty_region the region of the next drawing.
+ * @param[in] opaque the opaque rectangle of the next drawing or NULL.
  * @param[out] clear_past true if the caller has to clear the past collection.
  * @return true if the past has to be restored.
  */
-static bool _check_restore(MICROUI_GraphicsContext *gc, const ui_rect_t *dirty_region, bool *clear_past) {
+static bool _check_restore(MICROUI_GraphicsContext *gc, const ui_rect_t *dirty_region, const ui_rect_t *opaque,
+                           bool *clear_past) {
 	bool restore;
 	*clear_past = false;
 
@@ -156,9 +178,8 @@ static bool _check_restore(MICROUI_GraphicsContext *gc, const ui_rect_t *dirty_r
 			    LLUI_DISPLAY_getBufferAddress(&gc->image)) {
 				// target a new buffer
 
-				if ((dirty_region->x1 == 0) && (dirty_region->y1 == 0) && (dirty_region->x2 == (gc->image.width - 1)) &&
-				    (dirty_region->y2 == (gc->image.height - 1))) {
-					// new dirty region fits the full screen; the "past" is useless
+				if (_is_full_screen(gc, dirty_region) || ((NULL != opaque) && _is_full_screen(gc, opaque))) {
+					// new dirty region (or opaque drawing) fits the full screen; the "past" is useless
 					*clear_past = true;
 					restore = false;
 				}
@@ -208,16 +229,22 @@ static DRAWING_Status _restore_sub_rect(MICROUI_GraphicsContext *gc, MICROUI_Ima
  * restoration step and returns false. The complete restoration will be completed
  * until this function returns true.
  *
+ * The parts of the past hidden by the opaque rectangle of the drawing are not restored:
+ * the regions fully hidden are dropped and, when the opaque rectangle includes the new
+ * region, it replaces the new region to split the regions to restore.
+ *
  * @param[in] gc the MicroUI GraphicsContext that targets the current back buffer
  * @param[in] dirty_region the region of the next drawing.
+ * @param[in] opaque the opaque rectangle of the next drawing or NULL.
  * @return DRAWING_RUNNING if the a restoration is step is running or DRAWING_DONE if the restoration
  * is fully completed and the region added as region to restore
  */
-static DRAWING_Status _prepare_back_buffer(MICROUI_GraphicsContext *gc, ui_rect_t *dirty_region) {
+static DRAWING_Status _prepare_back_buffer(MICROUI_GraphicsContext *gc, ui_rect_t *dirty_region,
+                                           const ui_rect_t *opaque) {
 	DRAWING_Status restore_status = DRAWING_DONE;
 	bool clear_past = false;
 
-	if (_check_restore(gc, dirty_region, &clear_past)) {
+	if (_check_restore(gc, dirty_region, opaque, &clear_past)) {
 		MICROUI_Image *previous_buffer = LLUI_DISPLAY_getSourceImage(&gc->image);
 		LLUI_DISPLAY_configureClip(gc, false); // regions to restore can be fully out of clip
 
@@ -225,14 +252,19 @@ static DRAWING_Status _prepare_back_buffer(MICROUI_GraphicsContext *gc, ui_rect_
 		restore_status = _restore_sub_rect(gc, previous_buffer);
 
 		if (DRAWING_DONE == restore_status) {
+			const ui_rect_t *drawn = _is_hidden(opaque, dirty_region) ? opaque : dirty_region;
 			ui_rect_t *r = dirty_regions[index_dirty_region_to_restore].data;
 			while ((DRAWING_DONE == restore_status) &&
 			       (r != UI_RECT_COLLECTION_get_end(&dirty_regions[index_dirty_region_to_restore]))) {
 				if (!UI_RECT_is_empty(r)) {
-					// split (if required) the current region in sub-parts
-					if (0u < UI_RECT_subtract(diff, r, dirty_region)) {
-						// restore sub-part(s)
+					if (_is_hidden(opaque, r)) {
+						// the drawing will hide this region: no need to restore it
+						LOG_REGION(UI_LOG_BRS_RemoveRegion, r);
+					} else if (0u < UI_RECT_subtract(diff, r, drawn)) {
+						// the current region has been split (if required) in sub-parts: restore sub-part(s)
 						restore_status = _restore_sub_rect(gc, previous_buffer);
+					} else {
+						// the region is included in the new region
 					}
 
 					// current region is now restored or is currently in restore (thanks to array of sub-parts)
@@ -280,11 +312,18 @@ DRAWING_Status LLUI_DISPLAY_IMPL_newDrawingRegion(MICROUI_GraphicsContext *gc, u
 
 	DRAWING_Status ret = DRAWING_DONE;
 
+	ui_rect_t opaque_region;
+	const ui_rect_t *opaque = UI_DISPLAY_BRS_get_opaque_region(gc, &opaque_region) ? &opaque_region : NULL;
+
 	if (!backbuffer_ready) {
 		if (!drawing_now) {
-			_remove_drawing_regions(gc, region);
+			_remove_drawing_regions(gc, region, opaque);
 		} else {
-			ret = _prepare_back_buffer(gc, region);
+			// first drawing of the frame
+			framerate_frame_start();
+			framerate_stage_t previous_stage = framerate_stage_enter(FRAMERATE_STAGE_RESTORE);
+			ret = _prepare_back_buffer(gc, region, opaque);
+			framerate_stage_leave(previous_stage);
 		}
 	} else {
 		_add_drawing_region(gc, region); // don't care if drawing now or not
@@ -0,0 +1,607 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the display list.
+ *
+ * The recorded drawings are kept in an array (in the order of the drawings). The MicroUI
+ * objects given to a native function cannot be used after the end of the native function:
+ * a recorded drawing holds the fields of the graphics context it depends on (clip and
+ * color) and its parameters, never a copy of a MicroUI object. The recorded drawings are
+ * performed on a graphics context that targets the display buffer: the one given to the
+ * current native function or to the flush when available, otherwise the display's
+ * graphics context of the frame (it describes the display buffer, which stays allocated).
+ *
+ * @see ui_display_list.h
+ * @see UI_FEATURE_DISPLAY_LIST comment
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+#include "ui_display_list.h"
+#if defined(UI_FEATURE_DISPLAY_LIST)
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "bsp_util.h"
+#include "ui_display_brs.h"
+#include "ui_rect_util.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief FNV-1a hash parameters.
+ */
+#define HASH_OFFSET_BASIS (2166136261u)
+#define HASH_PRIME (16777619u)
+
+/*
+ * @brief Maximum number of opaque drawings considered to drop the hidden drawings.
+ */
+#define OCCLUDERS (8u)
+
+/*
+ * @brief Maximum number of parameters of a drawing.
+ */
+#define COMMAND_ARGUMENTS (4u)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The recorded drawings.
+ */
+typedef enum {
+	COMMAND_DRAW_HORIZONTAL_LINE,
+	COMMAND_DRAW_VERTICAL_LINE,
+	COMMAND_DRAW_RECTANGLE,
+	COMMAND_FILL_RECTANGLE,
+} command_type_t;
+
+/*
+ * @brief The actions on a region at the end of the frame.
+ */
+typedef enum {
+	REGION_DRAW,
+	REGION_COPY,
+	REGION_SKIP,
+} region_action_t;
+
+/*
+ * @brief The fields of the graphics context a recorded drawing depends on.
+ */
+typedef struct {
+	ui_rect_t clip;
+	uint32_t foreground_color;
+
+	/*
+	 * @brief false when the native function has already clipped the drawing (see
+	 * LLUI_DISPLAY_configureClip()).
+	 */
+	bool clip_enabled;
+} drawing_state_t;
+
+/*
+ * @brief A recorded drawing.
+ */
+typedef struct {
+	drawing_state_t state;
+
+	/*
+	 * @brief The region of the display buffer the drawing may modify.
+	 */
+	ui_rect_t bounds;
+
+	/*
+	 * @brief The parameters of the drawing function (except the graphics context).
+	 */
+	jint args[COMMAND_ARGUMENTS];
+
+	command_type_t type;
+
+	/*
+	 * @brief true when all the pixels in the bounds are replaced.
+	 */
+	bool opaque;
+
+	/*
+	 * @brief true when the drawing is hidden by a next opaque drawing.
+	 */
+	bool culled;
+} command_t;
+
+/*
+ * @brief A sequence of drawings performed with the same clip.
+ */
+typedef struct {
+	ui_rect_t clip;
+	uint32_t hash;
+	uint16_t first_command;
+	uint16_t end_command;
+	region_action_t action;
+} region_t;
+
+/*
+ * @brief A region of the previous frame.
+ */
+typedef struct {
+	ui_rect_t clip;
+	uint32_t hash;
+} previous_region_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static command_t commands[UI_DISPLAY_LIST_COMMANDS];
+static uint32_t commands_count;
+
+static region_t regions[UI_DISPLAY_LIST_REGIONS];
+static uint32_t regions_count;
+
+/*
+ * @brief The display's graphics context of the frame, stored when the first drawing of
+ * the list is recorded: it performs the list when the current native function does not
+ * target the display buffer (see _prepare_immediate_drawing()).
+ */
+static MICROUI_GraphicsContext display_gc;
+
+/*
+ * @brief The address of the display buffer the recorded drawings target.
+ */
+static uint8_t *display_buffer;
+
+/*
+ * @brief false when the frame contains a drawing not recorded or performed before
+ * the end of the frame: the next frame cannot reuse it.
+ */
+static bool frame_reusable = true;
+
+static previous_region_t previous_regions[UI_DISPLAY_LIST_REGIONS];
+static uint32_t previous_regions_count;
+static bool previous_frame_reusable;
+
+static UI_DISPLAY_LIST_statistics_t list_statistics;
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static uint32_t _hash(uint32_t hash, const void *data, size_t size) {
+	const uint8_t *bytes = (const uint8_t *)data;
+	uint32_t ret = hash;
+	for (size_t i = 0; i < size; i++) {
+		ret = (ret ^ bytes[i]) * HASH_PRIME;
+	}
+	return ret;
+}
+
+static inline bool _is_same_rect(const ui_rect_t *first, const ui_rect_t *second) {
+	return (first->x1 == second->x1) && (first->y1 == second->y1) && (first->x2 == second->x2)
+	       && (first->y2 == second->y2);
+}
+
+static inline bool _intersects(const ui_rect_t *first, const ui_rect_t *second) {
+	return (first->x1 <= second->x2) && (second->x1 <= first->x2) && (first->y1 <= second->y2)
+	       && (second->y1 <= first->y2);
+}
+
+static inline bool _contains(const ui_rect_t *container, const ui_rect_t *rect) {
+	return (container->x1 <= rect->x1) && (container->y1 <= rect->y1) && (container->x2 >= rect->x2)
+	       && (container->y2 >= rect->y2);
+}
+
+static inline uint32_t _get_area(const ui_rect_t *rect) {
+	return (uint32_t)UI_RECT_get_width(rect) * (uint32_t)UI_RECT_get_height(rect);
+}
+
+/*
+ * @brief Gets the part of the rectangle in the clip of the graphics context.
+ */
+static ui_rect_t _clip(const MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	const ui_rect_t *clip = &gc->clip;
+	return UI_RECT_new_xyxy(MAX(x1, clip->x1), MAX(y1, clip->y1), MIN(x2, clip->x2), MIN(y2, clip->y2));
+}
+
+static void _get_state(MICROUI_GraphicsContext *gc, drawing_state_t *state) {
+	state->clip = gc->clip;
+	state->foreground_color = gc->foreground_color;
+	state->clip_enabled = LLUI_DISPLAY_isClipEnabled(gc);
+}
+
+static void _set_state(MICROUI_GraphicsContext *gc, const drawing_state_t *state) {
+	gc->clip = state->clip;
+	gc->foreground_color = state->foreground_color;
+	LLUI_DISPLAY_configureClip(gc, state->clip_enabled);
+}
+
+static void _reset_list(void) {
+	commands_count = 0;
+	regions_count = 0;
+}
+
+/*
+ * @brief Marks the recorded drawings fully hidden by a next opaque drawing.
+ */
+static void _cull(void) {
+	ui_rect_t occluders[OCCLUDERS];
+	uint32_t occluders_count = 0;
+
+	// from the last drawing to the first one: the occluders are always drawn after
+	for (uint32_t i = commands_count; i > 0u; i--) {
+		command_t *command = &commands[i - 1u];
+
+		for (uint32_t o = 0; !command->culled && (o < occluders_count); o++) {
+			if (_contains(&occluders[o], &command->bounds)) {
+				command->culled = true;
+				list_statistics.culled++;
+			}
+		}
+
+		if (!command->culled && command->opaque) {
+			if (occluders_count < OCCLUDERS) {
+				occluders[occluders_count] = command->bounds;
+				occluders_count++;
+			} else {
+				// replace the smallest occluder
+				uint32_t smallest = 0;
+				for (uint32_t o = 1; o < OCCLUDERS; o++) {
+					if (_get_area(&occluders[o]) < _get_area(&occluders[smallest])) {
+						smallest = o;
+					}
+				}
+				if (_get_area(&command->bounds) > _get_area(&occluders[smallest])) {
+					occluders[smallest] = command->bounds;
+				}
+			}
+		}
+	}
+}
+
+static void _perform_command(MICROUI_GraphicsContext *gc, const command_t *command) {
+	const jint *args = command->args;
+
+	_set_state(gc, &command->state);
+
+	// the drawings are synchronous: the status is always DRAWING_DONE
+	switch (command->type) {
+	case COMMAND_DRAW_HORIZONTAL_LINE:
+		(void)UI_DRAWING_drawHorizontalLine(gc, args[0], args[1], args[2]);
+		break;
+	case COMMAND_DRAW_VERTICAL_LINE:
+		(void)UI_DRAWING_drawVerticalLine(gc, args[0], args[1], args[2]);
+		break;
+	case COMMAND_DRAW_RECTANGLE:
+		(void)UI_DRAWING_drawRectangle(gc, args[0], args[1], args[2], args[3]);
+		break;
+	case COMMAND_FILL_RECTANGLE:
+	default:
+		(void)UI_DRAWING_fillRectangle(gc, args[0], args[1], args[2], args[3]);
+		break;
+	}
+}
+
+static void _perform_commands(MICROUI_GraphicsContext *gc, uint32_t first, uint32_t end) {
+	for (uint32_t i = first; i < end; i++) {
+		if (!commands[i].culled) {
+			_perform_command(gc, &commands[i]);
+		}
+	}
+}
+
+/*
+ * @brief Performs all the recorded drawings now (before a drawing that cannot be
+ * recorded): the frame cannot be reused anymore.
+ *
+ * @param[in] gc a graphics context that targets the display buffer; its fields are
+ * restored after the drawings.
+ */
+static void _perform_pending_commands(MICROUI_GraphicsContext *gc) {
+	if (0u < commands_count) {
+		drawing_state_t state;
+		_get_state(gc, &state);
+
+		UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(true);
+		_cull();
+		_perform_commands(gc, 0, commands_count);
+		UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(false);
+
+		_set_state(gc, &state);
+		_reset_list();
+		frame_reusable = false;
+	}
+}
+
+/*
+ * @brief Prepares a drawing that is not recorded.
+ *
+ * @param[in] gc the destination of the drawing.
+ * @param[in] source the image read by the drawing or NULL.
+ */
+static void _prepare_immediate_drawing(MICROUI_GraphicsContext *gc, MICROUI_Image *source) {
+	if (LLUI_DISPLAY_isLCD(&gc->image)) {
+		// the drawing must be performed after the recorded drawings
+		_perform_pending_commands(gc);
+		frame_reusable = false;
+	} else if ((0u < commands_count) && (NULL != source) && (LLUI_DISPLAY_getBufferAddress(source) == display_buffer)) {
+		// the drawing reads the display buffer: it must hold the recorded drawings
+		_perform_pending_commands(&display_gc);
+	} else {
+		// the drawing neither modifies nor reads the display buffer
+	}
+}
+
+/*
+ * @brief Adds the recorded drawing in the current region or in a new region.
+ */
+static void _add_to_region(const command_t *command) {
+	const drawing_state_t *state = &command->state;
+	region_t *region = (0u < regions_count) ? &regions[regions_count - 1u] : NULL;
+
+	if ((NULL == region) || !_is_same_rect(&region->clip, &state->clip)) {
+		if (regions_count < UI_DISPLAY_LIST_REGIONS) {
+			region = &regions[regions_count];
+			regions_count++;
+			region->clip = state->clip;
+			region->hash = HASH_OFFSET_BASIS;
+			region->first_command = (uint16_t)(command - commands);
+		} else {
+			// too many regions: the last region includes all the next drawings
+			region->clip = UI_RECT_get_minimum_bounding_rect_two_rects(&region->clip, &state->clip);
+		}
+	}
+
+	region->end_command = (uint16_t)((command - commands) + 1);
+
+	// the hash includes all the parameters and all the fields of the graphics context that
+	// may change the pixels
+	uint32_t hash = region->hash;
+	hash = _hash(hash, &command->type, sizeof(command->type));
+	hash = _hash(hash, &state->clip, sizeof(state->clip));
+	hash = _hash(hash, &state->foreground_color, sizeof(state->foreground_color));
+	hash = _hash(hash, &state->clip_enabled, sizeof(state->clip_enabled));
+	hash = _hash(hash, command->args, sizeof(command->args));
+	region->hash = hash;
+}
+
+/*
+ * @brief Allocates a new drawing in the list.
+ *
+ * @return NULL when the drawing cannot be recorded: the caller has to perform the
+ * drawing.
+ */
+static command_t * _new_command(MICROUI_GraphicsContext *gc, command_type_t type) {
+	command_t *ret = NULL;
+
+	if (!LLUI_DISPLAY_isLCD(&gc->image) || (commands_count >= UI_DISPLAY_LIST_COMMANDS)) {
+		// not the display buffer or list is full
+		_prepare_immediate_drawing(gc, NULL);
+	} else {
+		if (0u == commands_count) {
+			(void)memcpy(&display_gc, gc, sizeof(MICROUI_GraphicsContext));
+			display_buffer = LLUI_DISPLAY_getBufferAddress(&gc->image);
+		}
+
+		ret = &commands[commands_count];
+		commands_count++;
+		list_statistics.recorded++;
+
+		_get_state(gc, &ret->state);
+		(void)memset(ret->args, 0, sizeof(ret->args));
+		ret->type = type;
+		ret->opaque = false;
+		ret->culled = false;
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Decides, for each region, whether it is drawn, copied from the previous frame's
+ * buffer or not drawn at all.
+ */
+static void _select_region_actions(MICROUI_GraphicsContext *gc) {
+	bool equal[UI_DISPLAY_LIST_REGIONS];
+	bool same_frame = frame_reusable && previous_frame_reusable && (regions_count == previous_regions_count);
+
+	for (uint32_t r = 0; r < regions_count; r++) {
+		regions[r].action = REGION_DRAW;
+		equal[r] = same_frame && (regions[r].hash == previous_regions[r].hash)
+		           && _is_same_rect(&regions[r].clip, &previous_regions[r].clip);
+	}
+
+	bool same_buffer = LLUI_DISPLAY_getBufferAddress(LLUI_DISPLAY_getSourceImage(&gc->image))
+	                   == LLUI_DISPLAY_getBufferAddress(&gc->image);
+
+	for (uint32_t r = 0; r < regions_count; r++) {
+		region_t *region = &regions[r];
+		bool reusable = equal[r] && (REGION_DRAW == region->action);
+
+		// the region's content must not depend on the previous drawings: one of its opaque
+		// drawings covers it
+		bool covered = false;
+		for (uint32_t c = region->first_command; reusable && !covered && (c < region->end_command); c++) {
+			covered = commands[c].opaque && _contains(&commands[c].bounds, &region->clip);
+		}
+		reusable = reusable && covered;
+
+		// the next regions drawn over it must be identical and fully inside it (they are
+		// part of the previous frame's content)
+		for (uint32_t n = r + 1u; reusable && (n < regions_count); n++) {
+			if (_intersects(&regions[n].clip, &region->clip)) {
+				reusable = equal[n] && _contains(&region->clip, &regions[n].clip);
+			}
+		}
+
+		// when the buffer is reused as is, no previous drawing may have modified it
+		for (uint32_t c = 0; reusable && same_buffer && (c < region->first_command); c++) {
+			reusable = commands[c].culled || !_intersects(&commands[c].bounds, &region->clip);
+		}
+
+		if (reusable) {
+			region->action = same_buffer ? REGION_SKIP : REGION_COPY;
+			for (uint32_t n = r + 1u; n < regions_count; n++) {
+				if (_intersects(&regions[n].clip, &region->clip)) {
+					regions[n].action = REGION_SKIP;
+				}
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------
+// ui_display_list.h functions
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_DISPLAY_LIST_request_drawing(MICROUI_GraphicsContext *gc, SNI_callback callback) {
+	return UI_DISPLAY_LIST_request_image_drawing(gc, NULL, callback);
+}
+
+// See the header file for the function documentation
+bool UI_DISPLAY_LIST_request_image_drawing(MICROUI_GraphicsContext *gc, MICROUI_Image *img, SNI_callback callback) {
+	bool ret = LLUI_DISPLAY_requestDrawing(gc, callback);
+	if (ret) {
+		_prepare_immediate_drawing(gc, img);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DISPLAY_LIST_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x1, jint x2, jint y) {
+	DRAWING_Status ret = DRAWING_DONE;
+	command_t *command = _new_command(gc, COMMAND_DRAW_HORIZONTAL_LINE);
+	if (NULL != command) {
+		command->args[0] = x1;
+		command->args[1] = x2;
+		command->args[2] = y;
+		command->bounds = UI_RECT_new_xyxy(x1, y, x2, y);
+		_add_to_region(command);
+	} else {
+		ret = UI_DRAWING_drawHorizontalLine(gc, x1, x2, y);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DISPLAY_LIST_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jint y1, jint y2) {
+	DRAWING_Status ret = DRAWING_DONE;
+	command_t *command = _new_command(gc, COMMAND_DRAW_VERTICAL_LINE);
+	if (NULL != command) {
+		command->args[0] = x;
+		command->args[1] = y1;
+		command->args[2] = y2;
+		command->bounds = UI_RECT_new_xyxy(x, y1, x, y2);
+		_add_to_region(command);
+	} else {
+		ret = UI_DRAWING_drawVerticalLine(gc, x, y1, y2);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DISPLAY_LIST_drawRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	DRAWING_Status ret = DRAWING_DONE;
+	command_t *command = _new_command(gc, COMMAND_DRAW_RECTANGLE);
+	if (NULL != command) {
+		command->args[0] = x1;
+		command->args[1] = y1;
+		command->args[2] = x2;
+		command->args[3] = y2;
+		// the rectangle may be partially out of the clip
+		command->bounds = _clip(gc, x1, y1, x2, y2);
+		_add_to_region(command);
+	} else {
+		ret = UI_DRAWING_drawRectangle(gc, x1, y1, x2, y2);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DISPLAY_LIST_fillRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	DRAWING_Status ret = DRAWING_DONE;
+	command_t *command = _new_command(gc, COMMAND_FILL_RECTANGLE);
+	if (NULL != command) {
+		command->args[0] = x1;
+		command->args[1] = y1;
+		command->args[2] = x2;
+		command->args[3] = y2;
+		command->bounds = UI_RECT_new_xyxy(x1, y1, x2, y2);
+		command->opaque = true;
+		_add_to_region(command);
+	} else {
+		ret = UI_DRAWING_fillRectangle(gc, x1, y1, x2, y2);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+void UI_DISPLAY_LIST_flush(MICROUI_GraphicsContext *gc) {
+	if (0u < commands_count) {
+		drawing_state_t state;
+		_get_state(gc, &state);
+
+		UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(true);
+
+		_cull();
+		_select_region_actions(gc);
+
+		MICROUI_Image *previous_buffer = LLUI_DISPLAY_getSourceImage(&gc->image);
+		for (uint32_t r = 0; r < regions_count; r++) {
+			region_t *region = &regions[r];
+			if (REGION_COPY == region->action) {
+				LLUI_DISPLAY_configureClip(gc, false); // region may be out of the current clip
+				(void)UI_DISPLAY_BRS_restore(gc, previous_buffer, &region->clip);
+				list_statistics.copied_regions++;
+			} else if (REGION_SKIP == region->action) {
+				list_statistics.skipped_regions++;
+			} else {
+				_perform_commands(gc, region->first_command, region->end_command);
+			}
+		}
+
+		UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(false);
+		_set_state(gc, &state);
+	}
+
+	// the regions of this frame are the reference of the next frame
+	for (uint32_t r = 0; r < regions_count; r++) {
+		previous_regions[r].clip = regions[r].clip;
+		previous_regions[r].hash = regions[r].hash;
+	}
+	previous_regions_count = regions_count;
+	previous_frame_reusable = frame_reusable;
+	if (!frame_reusable) {
+		list_statistics.unrecorded_frames++;
+	}
+
+	_reset_list();
+	frame_reusable = true;
+}
+
+// See the header file for the function documentation
+void UI_DISPLAY_LIST_get_statistics(UI_DISPLAY_LIST_statistics_t *statistics) {
+	*statistics = list_statistics;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT void UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(bool synchronous) {
+	// the software drawings are always synchronous
+	(void)synchronous;
+}
+
+#endif // UI_FEATURE_DISPLAY_LIST
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
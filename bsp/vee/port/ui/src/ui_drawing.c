@@ -62,9 +62,31 @@
 #include "dw_drawing_soft.h"
 #include "ui_image_drawing.h"
 #include "ui_font_drawing.h"
+#include "ui_drawing_transform.h"
 #include "ui_configuration.h"
 #include "bsp_util.h"
 
+// --------------------------------------------------------------------------------
+// Configuration Sanity Check
+// --------------------------------------------------------------------------------
+
+/*
+ * Sanity check between the expected version of the configuration and the actual
+ * version of the configuration.
+ *
+ * If an error is raised here, it means that a new version of the CCO has been
+ * installed and the configuration ui_configuration.h must be updated based
+ * on the one provided by the new CCO version.
+ */
+
+#if !defined UI_CONFIGURATION_VERSION
+	#error "Undefined UI_CONFIGURATION_VERSION, it must be defined in ui_configuration.h"
+#endif
+
+#if defined UI_CONFIGURATION_VERSION && UI_CONFIGURATION_VERSION != 6
+	#error "Version of the configuration file ui_configuration.h is not compatible with this implementation."
+#endif
+
 // --------------------------------------------------------------------------------
 // Defines
 // --------------------------------------------------------------------------------
@@ -949,6 +971,8 @@ void LLUI_DISPLAY_IMPL_initializeNewImage(MICROUI_Image *image) {
 
 // See the header file for the function documentation
 void LLUI_DISPLAY_IMPL_freeImageResources(MICROUI_Image *image) {
+	// the image buffer is going to be released: no pending drawing may use it anymore
+	UI_DRAWING_synchronizeHardwareDrawings();
 	// just make an indirection (useful for multi destination formats)
 	UI_DRAWING_freeImageResources(image);
 }
@@ -1029,6 +1053,8 @@ void LLUI_DISPLAY_IMPL_initializeNewImage(MICROUI_Image *image) {
 // See the header file for the function documentation and implementation of
 // LLUI_DISPLAY_IMPL_getNewImageStrideInBytes
 void LLUI_DISPLAY_IMPL_freeImageResources(MICROUI_Image *image) {
+	// the image buffer is going to be released: no pending drawing may use it anymore
+	UI_DRAWING_synchronizeHardwareDrawings();
 	int32_t drawer = LLUI_DISPLAY_IMPL_getDrawerIdentifier(image->format);
 	drawer = (drawer >= 0) ? drawer : 0;
 	(*UI_DRAWER_freeImageResources[drawer])(image);
@@ -1074,6 +1100,11 @@ BSP_DECLARE_WEAK_FCNT void UI_DRAWING_freeImageResources(MICROUI_Image *image) {
 	// nothing to initialize by default
 }
 
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT void UI_DRAWING_synchronizeHardwareDrawings(void) {
+	// nothing to synchronize by default
+}
+
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT jint UI_DRAWING_stringWidth(jchar *chars, jint length, MICROUI_Font *font) {
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
@@ -1103,36 +1134,42 @@ BSP_DECLARE_WEAK_FCNT jint UI_DRAWING_initializeRenderableStringSNIContext(jchar
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_writePixel(MICROUI_GraphicsContext *gc, jint x, jint y) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_writePixel(gc, x, y);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawLine(MICROUI_GraphicsContext *gc, jint startX, jint startY,
                                                                  jint endX, jint endY) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawLine(gc, startX, startY, endX, endY);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x1,
                                                                            jint x2, jint y) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawHorizontalLine(gc, x1, x2, y);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jint y1,
                                                                          jint y2) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawVerticalLine(gc, x, y1, y2);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1,
                                                                       jint x2, jint y2) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawRectangle(gc, x1, y1, x2, y2);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1,
                                                                       jint x2, jint y2) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillRectangle(gc, x1, y1, x2, y2);
 }
 
@@ -1141,6 +1178,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRoundedRectangle(MIC
                                                                              jint y, jint width, jint height,
                                                                              jint cornerEllipseWidth,
                                                                              jint cornerEllipseHeight) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 }
 
@@ -1149,6 +1187,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillRoundedRectangle(MIC
                                                                              jint y, jint width, jint height,
                                                                              jint cornerEllipseWidth,
                                                                              jint cornerEllipseHeight) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 }
 
@@ -1156,6 +1195,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillRoundedRectangle(MIC
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                       jint diameter, jfloat startAngle,
                                                                       jfloat arcAngle) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 }
 
@@ -1163,6 +1203,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawCircleArc(MICROUI_Gr
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                        jint width, jint height, jfloat startAngle,
                                                                        jfloat arcAngle) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 }
 
@@ -1170,6 +1211,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawEllipseArc(MICROUI_G
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                       jint diameter, jfloat startAngle,
                                                                       jfloat arcAngle) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 }
 
@@ -1177,30 +1219,35 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillCircleArc(MICROUI_Gr
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                        jint width, jint height, jfloat startAngle,
                                                                        jfloat arcAngle) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawEllipse(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                     jint width, jint height) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawEllipse(gc, x, y, width, height);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillEllipse(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                     jint width, jint height) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillEllipse(gc, x, y, width, height);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawCircle(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                    jint diameter) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_drawCircle(gc, x, y, diameter);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillCircle(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                    jint diameter) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return UI_DRAWING_SOFT_fillCircle(gc, x, y, diameter);
 }
 
@@ -1208,6 +1255,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_fillCircle(MICROUI_Graph
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawImage(MICROUI_GraphicsContext *gc, MICROUI_Image *img,
                                                                   jint regionX, jint regionY, jint width, jint height,
                                                                   jint x, jint y, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 	return UI_DRAWING_SOFT_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
 #else
@@ -1219,6 +1267,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawImage(MICROUI_Graphi
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_copyImage(MICROUI_GraphicsContext *gc, MICROUI_Image *img,
                                                                   jint regionX, jint regionY, jint width, jint height,
                                                                   jint x, jint y) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 	return UI_DRAWING_SOFT_copyImage(gc, img, regionX, regionY, width, height, x, y);
 #else
@@ -1230,6 +1279,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_copyImage(MICROUI_Graphi
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRegion(MICROUI_GraphicsContext *gc, jint regionX,
                                                                    jint regionY, jint width, jint height, jint x,
                                                                    jint y, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 	return UI_DRAWING_SOFT_drawRegion(gc, regionX, regionY, width, height, x, y, alpha);
 #else
@@ -1240,6 +1290,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRegion(MICROUI_Graph
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawString(MICROUI_GraphicsContext *gc, jchar *chars,
                                                                    jint length, MICROUI_Font *font, jint x, jint y) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return UI_DRAWING_SOFT_drawString(gc, chars, length, font, x, y);
@@ -1254,6 +1305,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRenderableString(MIC
                                                                              jint width,
                                                                              MICROUI_RenderableString *renderableString,
                                                                              jint x, jint y) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return UI_DRAWING_SOFT_drawRenderableString(gc, chars, length, font, width, renderableString, x, y);
@@ -1265,6 +1317,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRenderableString(MIC
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedPoint(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                             jint thickness, jint fade) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickFadedPoint(gc, x, y, thickness, fade);
 }
 
@@ -1273,6 +1326,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedLine(MICRO
                                                                            jint startY, jint endX, jint endY,
                                                                            jint thickness, jint fade,
                                                                            DRAWING_Cap startCap, DRAWING_Cap endCap) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickFadedLine(gc, startX, startY, endX, endY, thickness, fade, startCap, endCap);
 }
 
@@ -1280,6 +1334,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedLine(MICRO
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedCircle(MICROUI_GraphicsContext *gc, jint x,
                                                                              jint y, jint diameter, jint thickness,
                                                                              jint fade) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickFadedCircle(gc, x, y, diameter, thickness, fade);
 }
 
@@ -1289,6 +1344,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedCircleArc(
                                                                                 jfloat startAngle, jfloat arcAngle,
                                                                                 jint thickness, jint fade,
                                                                                 DRAWING_Cap start, DRAWING_Cap end) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickFadedCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness, fade, start,
 	                                               end);
 }
@@ -1297,6 +1353,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedCircleArc(
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedEllipse(MICROUI_GraphicsContext *gc, jint x,
                                                                               jint y, jint width, jint height,
                                                                               jint thickness, jint fade) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickFadedEllipse(gc, x, y, width, height, thickness, fade);
 }
 
@@ -1304,18 +1361,21 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickFadedEllipse(MI
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickLine(MICROUI_GraphicsContext *gc, jint startX,
                                                                       jint startY, jint endX, jint endY,
                                                                       jint thickness) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickLine(gc, startX, startY, endX, endY, thickness);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickCircle(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                         jint diameter, jint thickness) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickCircle(gc, x, y, diameter, thickness);
 }
 
 // See the header file for the function documentation
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickEllipse(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                          jint width, jint height, jint thickness) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickEllipse(gc, x, y, width, height, thickness);
 }
 
@@ -1323,6 +1383,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickEllipse(MICROUI
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawThickCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y,
                                                                            jint diameter, jfloat startAngle,
                                                                            jfloat arcAngle, jint thickness) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 	return DW_DRAWING_SOFT_drawThickCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness);
 }
 
@@ -1331,6 +1392,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawFlippedImage(MICROUI
                                                                          MICROUI_Image *img, jint regionX, jint regionY,
                                                                          jint width, jint height, jint x, jint y,
                                                                          DRAWING_Flip transformation, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 	return DW_DRAWING_SOFT_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
 #else
@@ -1344,11 +1406,16 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRotatedImageNearestN
                                                                                         jint y, jint rotationX,
                                                                                         jint rotationY, jfloat angle,
                                                                                         jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
+	DRAWING_Status ret = DRAWING_DONE;
+	if (!UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha)) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
-	return DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		ret = DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
 #else
-	return UI_IMAGE_DRAWING_drawRotatedNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		ret = UI_IMAGE_DRAWING_drawRotatedNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
 #endif
+	}
+	return ret;
 }
 
 // See the header file for the function documentation
@@ -1356,11 +1423,16 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawRotatedImageBilinear
                                                                                  MICROUI_Image *img, jint x, jint y,
                                                                                  jint rotationX, jint rotationY,
                                                                                  jfloat angle, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
+	DRAWING_Status ret = DRAWING_DONE;
+	if (!UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha)) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
-	return DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		ret = DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
 #else
-	return UI_IMAGE_DRAWING_drawRotatedBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		ret = UI_IMAGE_DRAWING_drawRotatedBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
 #endif
+	}
+	return ret;
 }
 
 // See the header file for the function documentation
@@ -1368,11 +1440,16 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawScaledImageNearestNe
                                                                                        MICROUI_Image *img, jint x,
                                                                                        jint y, jfloat factorX,
                                                                                        jfloat factorY, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
+	DRAWING_Status ret = DRAWING_DONE;
+	if (!UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha)) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
-	return DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+		ret = DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
 #else
-	return UI_IMAGE_DRAWING_drawScaledNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+		ret = UI_IMAGE_DRAWING_drawScaledNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
 #endif
+	}
+	return ret;
 }
 
 // See the header file for the function documentation
@@ -1380,17 +1457,23 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawScaledImageBilinear(
                                                                                 MICROUI_Image *img, jint x, jint y,
                                                                                 jfloat factorX, jfloat factorY,
                                                                                 jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
+	DRAWING_Status ret = DRAWING_DONE;
+	if (!UI_DRAWING_TRANSFORM_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha)) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
-	return DW_DRAWING_SOFT_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
+		ret = DW_DRAWING_SOFT_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
 #else
-	return UI_IMAGE_DRAWING_drawScaledBilinear(gc, img, x, y, factorX, factorY, alpha);
+		ret = UI_IMAGE_DRAWING_drawScaledBilinear(gc, img, x, y, factorX, factorY, alpha);
 #endif
+	}
+	return ret;
 }
 
 BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawScaledStringBilinear(MICROUI_GraphicsContext *gc,
                                                                                  jchar *chars, jint length,
                                                                                  MICROUI_Font *font, jint x, jint y,
                                                                                  jfloat xRatio, jfloat yRatio) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return DW_DRAWING_SOFT_drawScaledStringBilinear(gc, chars, length, font, x, y, xRatio, yRatio);
@@ -1407,6 +1490,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawScaledRenderableStri
                                                                                            renderableString, jint x,
                                                                                            jint y, jfloat xRatio,
                                                                                            jfloat yRatio) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return DW_DRAWING_SOFT_drawScaledRenderableStringBilinear(gc, chars, length, font, width, renderableString, x, y,
@@ -1422,6 +1506,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawCharWithRotationBili
                                                                                      jint x, jint y, jint xRotation,
                                                                                      jint yRotation, jfloat angle,
                                                                                      jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return DW_DRAWING_SOFT_drawCharWithRotationBilinear(gc, c, font, x, y, xRotation, yRotation, angle, alpha);
@@ -1436,6 +1521,7 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_DRAWING_DEFAULT_drawCharWithRotationNear
                                                                                             jint xRotation,
                                                                                             jint yRotation,
                                                                                             jfloat angle, jint alpha) {
+	UI_DRAWING_synchronizeHardwareDrawings();
 #if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 	assert(!LLUI_DISPLAY_isCustomFormat(font->format));
 	return DW_DRAWING_SOFT_drawCharWithRotationNearestNeighbor(gc, c, font, x, y, xRotation, yRotation, angle, alpha);
@@ -0,0 +1,523 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the software rotation and scaling of the images.
+ *
+ * The source coordinates (u, v) of a destination pixel (x, y) are an affine function of
+ * (x, y): u = u0 + du_dx * x + du_dy * y (same for v). For each destination row, the
+ * span of destination pixels whose source coordinates fit the image is solved in floating
+ * point, then adjusted with the same fixed-point values as the pixel loop: the pixel loop
+ * never reads outside the image.
+ *
+ * @see ui_drawing_transform.h
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+
+#include "ui_drawing_transform.h"
+#include "ui_pixel_kernels.h"
+
+#if defined(UI_FEATURE_SOFTWARE_TRANSFORM)
+
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Number of samples gathered before blending them on the destination.
+ */
+#define SPAN_PIXELS (64)
+
+/*
+ * @brief 16.16 fixed-point values.
+ */
+#define FIXED_SHIFT (16)
+#define FIXED_ONE (1 << FIXED_SHIFT)
+#define FIXED_HALF (FIXED_ONE / 2)
+
+/*
+ * @brief Mask of the channels 0 and 2 of an ARGB8888 pixel.
+ */
+#define LANES_MASK (0x00ff00ffu)
+
+/*
+ * @brief Adds 0.5 (rounding) in both lanes.
+ */
+#define LANES_HALF (0x00800080u)
+
+#define DEG_TO_RAD (3.14159265358979f / 180.f)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The source image.
+ */
+typedef struct {
+	const uint8_t *address;
+	uint32_t stride;
+	int32_t width;
+	int32_t height;
+	MICROUI_ImageFormat format;
+} source_t;
+
+/*
+ * @brief The source coordinates of the destination pixel (x, y) (pixel centers):
+ * u = u0 + du_dx * x + du_dy * y and v = v0 + dv_dx * x + dv_dy * y.
+ */
+typedef struct {
+	float u0;
+	float du_dx;
+	float du_dy;
+	float v0;
+	float dv_dx;
+	float dv_dy;
+} mapping_t;
+
+/*
+ * @brief A rectangle (bounds included).
+ */
+typedef struct {
+	int32_t x1;
+	int32_t y1;
+	int32_t x2;
+	int32_t y2;
+} bounds_t;
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Tells whether the CPU can draw in the Graphics Context.
+ */
+static inline bool _is_software_destination(MICROUI_GraphicsContext *gc) {
+	return (MICROUI_IMAGE_FORMAT_RGB565 == (MICROUI_ImageFormat)gc->image.format)
+	       || (LLUI_DISPLAY_isLCD(&gc->image) && (16u == LLUI_DISPLAY_getImageBPP(&gc->image)));
+}
+
+/*
+ * @brief Tells whether the image format is managed.
+ */
+static inline bool _is_software_source(MICROUI_Image *img) {
+	MICROUI_ImageFormat format = (MICROUI_ImageFormat)img->format;
+	return (MICROUI_IMAGE_FORMAT_RGB565 == format) || (MICROUI_IMAGE_FORMAT_RGB888 == format)
+	       || (MICROUI_IMAGE_FORMAT_ARGB8888 == format) || (MICROUI_IMAGE_FORMAT_ARGB8888_PRE == format);
+}
+
+/*
+ * @brief Divides both lanes by 255 (rounded): each lane must be lower than or equal
+ * to 255 * 255.
+ */
+static inline uint32_t _div255_lanes(uint32_t lanes) {
+	uint32_t t = lanes + LANES_HALF;
+	return ((t + ((t >> 8) & LANES_MASK)) >> 8) & LANES_MASK;
+}
+
+/*
+ * @brief Interpolates two ARGB8888 pixels: (p0 * (256 - f) + p1 * f) / 256.
+ */
+static inline uint32_t _lerp(uint32_t p0, uint32_t p1, uint32_t f) {
+	uint32_t inv = 256u - f;
+	uint32_t lanes_02 = ((((p0 & LANES_MASK) * inv) + ((p1 & LANES_MASK) * f)) >> 8) & LANES_MASK;
+	uint32_t lanes_13 = (((((p0 >> 8) & LANES_MASK) * inv) + (((p1 >> 8) & LANES_MASK) * f)) >> 8) & LANES_MASK;
+	return lanes_02 | (lanes_13 << 8);
+}
+
+/*
+ * @brief Reads a source pixel and converts it in a premultiplied ARGB8888 pixel. Inlined
+ * with a constant format: the compiler keeps only one case.
+ */
+static inline uint32_t _read(const source_t *src, MICROUI_ImageFormat format, int32_t x, int32_t y) {
+	const uint8_t *row = &src->address[(uint32_t)y * src->stride];
+	uint32_t ret;
+
+	switch (format) {
+	case MICROUI_IMAGE_FORMAT_RGB565: {
+		uint32_t pixel = ((const uint16_t *)row)[x];
+		uint32_t red = (pixel >> 11) & 0x1fu;
+		uint32_t green = (pixel >> 5) & 0x3fu;
+		uint32_t blue = pixel & 0x1fu;
+		ret = 0xff000000u | (((red << 3) | (red >> 2)) << 16) | (((green << 2) | (green >> 4)) << 8)
+		      | ((blue << 3) | (blue >> 2));
+		break;
+	}
+
+	case MICROUI_IMAGE_FORMAT_RGB888: {
+		const uint8_t *pixel = &row[(uint32_t)x * 3u];
+		ret = 0xff000000u | ((uint32_t)pixel[2] << 16) | ((uint32_t)pixel[1] << 8) | (uint32_t)pixel[0];
+		break;
+	}
+
+	case MICROUI_IMAGE_FORMAT_ARGB8888: {
+		uint32_t pixel = ((const uint32_t *)row)[x];
+		uint32_t alpha = pixel >> 24;
+		if (0xffu == alpha) {
+			ret = pixel;
+		} else {
+			uint32_t lanes_02 = _div255_lanes((pixel & LANES_MASK) * alpha);
+			uint32_t green = _div255_lanes(((pixel >> 8) & 0xffu) * alpha);
+			ret = (alpha << 24) | (green << 8) | lanes_02;
+		}
+		break;
+	}
+
+	default:
+		// MICROUI_IMAGE_FORMAT_ARGB8888_PRE
+		ret = ((const uint32_t *)row)[x];
+		break;
+	}
+	return ret;
+}
+
+/*
+ * @brief Gathers the nearest samples of a RGB565 source without any conversion.
+ */
+static void _gather_nearest_rgb565(uint16_t *buffer, const source_t *src, int32_t u, int32_t v, int32_t du,
+                                   int32_t dv, uint32_t count) {
+	int32_t su = u;
+	int32_t sv = v;
+	for (uint32_t i = 0; i < count; i++) {
+		const uint8_t *row = &src->address[(uint32_t)(sv >> FIXED_SHIFT) * src->stride];
+		buffer[i] = ((const uint16_t *)row)[su >> FIXED_SHIFT];
+		su += du;
+		sv += dv;
+	}
+}
+
+/*
+ * @brief Gathers the nearest samples (premultiplied ARGB8888).
+ */
+static inline void _gather_nearest(uint32_t *buffer, const source_t *src, MICROUI_ImageFormat format, int32_t u,
+                                   int32_t v, int32_t du, int32_t dv, uint32_t count) {
+	int32_t su = u;
+	int32_t sv = v;
+	for (uint32_t i = 0; i < count; i++) {
+		buffer[i] = _read(src, format, su >> FIXED_SHIFT, sv >> FIXED_SHIFT);
+		su += du;
+		sv += dv;
+	}
+}
+
+/*
+ * @brief Gathers the bilinear samples (premultiplied ARGB8888). The samples on the image
+ * borders repeat the border pixels.
+ */
+static inline void _gather_bilinear(uint32_t *buffer, const source_t *src, MICROUI_ImageFormat format, int32_t u,
+                                    int32_t v, int32_t du, int32_t dv, uint32_t count) {
+	int32_t su = u + FIXED_HALF; // the coordinates are positive: (su >> 16) - 1 is the left sample
+	int32_t sv = v + FIXED_HALF;
+	int32_t last_x = src->width - 1;
+	int32_t last_y = src->height - 1;
+
+	for (uint32_t i = 0; i < count; i++) {
+		int32_t x1 = su >> FIXED_SHIFT;
+		int32_t y1 = sv >> FIXED_SHIFT;
+		int32_t x0 = (0 < x1) ? (x1 - 1) : 0;
+		int32_t y0 = (0 < y1) ? (y1 - 1) : 0;
+		x1 = (last_x < x1) ? last_x : x1;
+		y1 = (last_y < y1) ? last_y : y1;
+		uint32_t fx = ((uint32_t)su >> 8) & 0xffu;
+		uint32_t fy = ((uint32_t)sv >> 8) & 0xffu;
+
+		uint32_t top = _lerp(_read(src, format, x0, y0), _read(src, format, x1, y0), fx);
+		uint32_t bottom = _lerp(_read(src, format, x0, y1), _read(src, format, x1, y1), fx);
+		buffer[i] = _lerp(top, bottom, fy);
+
+		su += du;
+		sv += dv;
+	}
+}
+
+/*
+ * @brief Gathers the samples of a span. The switch selects a loop specialized for the
+ * source format.
+ */
+static void _gather(uint32_t *buffer, const source_t *src, bool bilinear, int32_t u, int32_t v, int32_t du,
+                    int32_t dv, uint32_t count) {
+	if (bilinear) {
+		switch (src->format) {
+		case MICROUI_IMAGE_FORMAT_RGB565:
+			_gather_bilinear(buffer, src, MICROUI_IMAGE_FORMAT_RGB565, u, v, du, dv, count);
+			break;
+		case MICROUI_IMAGE_FORMAT_RGB888:
+			_gather_bilinear(buffer, src, MICROUI_IMAGE_FORMAT_RGB888, u, v, du, dv, count);
+			break;
+		case MICROUI_IMAGE_FORMAT_ARGB8888:
+			_gather_bilinear(buffer, src, MICROUI_IMAGE_FORMAT_ARGB8888, u, v, du, dv, count);
+			break;
+		default:
+			_gather_bilinear(buffer, src, MICROUI_IMAGE_FORMAT_ARGB8888_PRE, u, v, du, dv, count);
+			break;
+		}
+	} else {
+		switch (src->format) {
+		case MICROUI_IMAGE_FORMAT_RGB888:
+			_gather_nearest(buffer, src, MICROUI_IMAGE_FORMAT_RGB888, u, v, du, dv, count);
+			break;
+		case MICROUI_IMAGE_FORMAT_ARGB8888:
+			_gather_nearest(buffer, src, MICROUI_IMAGE_FORMAT_ARGB8888, u, v, du, dv, count);
+			break;
+		default:
+			_gather_nearest(buffer, src, MICROUI_IMAGE_FORMAT_ARGB8888_PRE, u, v, du, dv, count);
+			break;
+		}
+	}
+}
+
+/*
+ * @brief Restricts [*first, *last] to the destination pixels whose source coordinate
+ * start + step * (x + 0.5) is in [0, limit[ (approximation, see _fit_span()).
+ */
+static void _solve_span(int32_t *first, int32_t *last, float start, float step, int32_t limit) {
+	if (0.f == step) {
+		if ((start < 0.f) || (start >= (float)limit)) {
+			// the row is fully outside the image
+			*last = *first - 1;
+		}
+	} else {
+		float t0 = ((0.f - start) / step) - 0.5f;
+		float t1 = (((float)limit - start) / step) - 0.5f;
+		float tmin = (t0 < t1) ? t0 : t1;
+		float tmax = (t0 < t1) ? t1 : t0;
+		// one more pixel on each side: the exact bounds are given by _fit_span()
+		int32_t lower = (tmin < (float)*first) ? *first : ((int32_t)floorf(tmin) - 1);
+		int32_t upper = (tmax > (float)*last) ? *last : ((int32_t)ceilf(tmax) + 1);
+		*first = (lower > *first) ? lower : *first;
+		*last = (upper < *last) ? upper : *last;
+	}
+}
+
+/*
+ * @brief Tells whether the fixed-point source coordinates fit the image.
+ */
+static inline bool _is_inside(int64_t u, int64_t v, const source_t *src) {
+	return (0 <= u) && (u < ((int64_t)src->width << FIXED_SHIFT)) && (0 <= v)
+	       && (v < ((int64_t)src->height << FIXED_SHIFT));
+}
+
+/*
+ * @brief Removes the pixels at both ends of the span whose fixed-point source coordinates
+ * do not fit the image. The coordinates are linear: the remaining pixels fit the image.
+ *
+ * @return the number of pixels of the span.
+ */
+static uint32_t _fit_span(int32_t *first, int32_t last, int32_t *u, int32_t *v, int32_t du, int32_t dv,
+                          const source_t *src) {
+	int32_t x = *first;
+	int32_t end = last;
+
+	while ((x <= end) && !_is_inside(*u, *v, src)) {
+		x++;
+		*u += du;
+		*v += dv;
+	}
+	while ((x <= end) && !_is_inside((int64_t)*u + ((int64_t)(end - x) * du), (int64_t)*v + ((int64_t)(end - x) * dv),
+	                                 src)) {
+		end--;
+	}
+
+	*first = x;
+	return (uint32_t)(end - x + 1);
+}
+
+/*
+ * @brief Draws the image transformed by the mapping in the destination bounds.
+ *
+ * @return false when the source or the destination format is not managed.
+ */
+static bool _draw(MICROUI_GraphicsContext *gc, MICROUI_Image *img, const mapping_t *mapping, bounds_t *bounds,
+                  jint alpha, bool bilinear) {
+	bool ret = _is_software_destination(gc) && _is_software_source(img);
+
+	if (ret) {
+		source_t src;
+		src.address = LLUI_DISPLAY_getBufferAddress(img);
+		src.stride = LLUI_DISPLAY_getStrideInBytes(img);
+		src.width = img->width;
+		src.height = img->height;
+		src.format = (MICROUI_ImageFormat)img->format;
+
+		// clip the destination bounds
+		if (LLUI_DISPLAY_isClipEnabled(gc)) {
+			bounds->x1 = (bounds->x1 < gc->clip.x1) ? gc->clip.x1 : bounds->x1;
+			bounds->y1 = (bounds->y1 < gc->clip.y1) ? gc->clip.y1 : bounds->y1;
+			bounds->x2 = (bounds->x2 > gc->clip.x2) ? gc->clip.x2 : bounds->x2;
+			bounds->y2 = (bounds->y2 > gc->clip.y2) ? gc->clip.y2 : bounds->y2;
+		} else {
+			bounds->x1 = (bounds->x1 < 0) ? 0 : bounds->x1;
+			bounds->y1 = (bounds->y1 < 0) ? 0 : bounds->y1;
+			bounds->x2 = (bounds->x2 >= gc->image.width) ? (gc->image.width - 1) : bounds->x2;
+			bounds->y2 = (bounds->y2 >= gc->image.height) ? (gc->image.height - 1) : bounds->y2;
+		}
+
+		uint32_t dest_stride = LLUI_DISPLAY_getStrideInBytes(&gc->image);
+		uint8_t *dest_address = LLUI_DISPLAY_getBufferAddress(&gc->image);
+		int32_t du = (int32_t)(mapping->du_dx * (float)FIXED_ONE);
+		int32_t dv = (int32_t)(mapping->dv_dx * (float)FIXED_ONE);
+		uint32_t buffer[SPAN_PIXELS];
+
+		for (int32_t y = bounds->y1; (0 < alpha) && (y <= bounds->y2); y++) {
+			float row_u = mapping->u0 + (mapping->du_dy * ((float)y + 0.5f));
+			float row_v = mapping->v0 + (mapping->dv_dy * ((float)y + 0.5f));
+
+			int32_t first = bounds->x1;
+			int32_t last = bounds->x2;
+			_solve_span(&first, &last, row_u, mapping->du_dx, src.width);
+			_solve_span(&first, &last, row_v, mapping->dv_dx, src.height);
+
+			if (first <= last) {
+				int32_t u = (int32_t)((row_u + (mapping->du_dx * ((float)first + 0.5f))) * (float)FIXED_ONE);
+				int32_t v = (int32_t)((row_v + (mapping->dv_dx * ((float)first + 0.5f))) * (float)FIXED_ONE);
+				uint32_t remaining = _fit_span(&first, last, &u, &v, du, dv, &src);
+				uint16_t *dest = (uint16_t *)&dest_address[((uint32_t)y * dest_stride) + ((uint32_t)first * 2u)];
+
+				while (0u < remaining) {
+					uint32_t count = (remaining < (uint32_t)SPAN_PIXELS) ? remaining : (uint32_t)SPAN_PIXELS;
+
+					if (!bilinear && (MICROUI_IMAGE_FORMAT_RGB565 == src.format)) {
+						_gather_nearest_rgb565((uint16_t *)buffer, &src, u, v, du, dv, count);
+						UI_PIXEL_KERNELS_blend_rgb565_on_rgb565(dest, (uint16_t *)buffer, (uint32_t)alpha, count);
+					} else {
+						_gather(buffer, &src, bilinear, u, v, du, dv, count);
+						UI_PIXEL_KERNELS_blend_argb8888_pre_on_rgb565(dest, buffer, (uint32_t)alpha, count);
+					}
+
+					u += (int32_t)count * du;
+					v += (int32_t)count * dv;
+					dest += count;
+					remaining -= count;
+				}
+			}
+		}
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Draws a rotated image: the destination pixel D comes from the source pixel
+ * rotate(angle) * (D - R) + R - (x, y) (R is the rotation center).
+ */
+static bool _draw_rotated(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y, jint rotationX,
+                          jint rotationY, jfloat angle, jint alpha, bool bilinear) {
+	float rad = angle * DEG_TO_RAD;
+	float c = cosf(rad);
+	float s = sinf(rad);
+	float rx = (float)rotationX;
+	float ry = (float)rotationY;
+
+	mapping_t mapping;
+	mapping.du_dx = c;
+	mapping.du_dy = -s;
+	mapping.u0 = (rx - (float)x) - (c * rx) + (s * ry);
+	mapping.dv_dx = s;
+	mapping.dv_dy = c;
+	mapping.v0 = (ry - (float)y) - (s * rx) - (c * ry);
+
+	// destination bounds: the four corners rotated by -angle around R
+	float ox = (float)x - rx;
+	float oy = (float)y - ry;
+	float w = (float)img->width;
+	float h = (float)img->height;
+	float min_x = 0.f;
+	float max_x = 0.f;
+	float min_y = 0.f;
+	float max_y = 0.f;
+	for (uint32_t i = 0; i < 4u; i++) {
+		float qx = ox + ((0u != (i & 1u)) ? w : 0.f);
+		float qy = oy + ((0u != (i & 2u)) ? h : 0.f);
+		float dx = rx + (c * qx) + (s * qy);
+		float dy = ry - (s * qx) + (c * qy);
+		min_x = ((0u == i) || (dx < min_x)) ? dx : min_x;
+		max_x = ((0u == i) || (dx > max_x)) ? dx : max_x;
+		min_y = ((0u == i) || (dy < min_y)) ? dy : min_y;
+		max_y = ((0u == i) || (dy > max_y)) ? dy : max_y;
+	}
+
+	bounds_t bounds;
+	bounds.x1 = (int32_t)floorf(min_x);
+	bounds.y1 = (int32_t)floorf(min_y);
+	bounds.x2 = (int32_t)ceilf(max_x);
+	bounds.y2 = (int32_t)ceilf(max_y);
+
+	return _draw(gc, img, &mapping, &bounds, alpha, bilinear);
+}
+
+/*
+ * @brief Draws a scaled image: the destination pixel D comes from the source pixel
+ * (D - (x, y)) / factor.
+ */
+static bool _draw_scaled(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y, jfloat factorX,
+                         jfloat factorY, jint alpha, bool bilinear) {
+	bool ret;
+
+	if ((0.f < factorX) && (0.f < factorY)) {
+		mapping_t mapping;
+		mapping.du_dx = 1.f / factorX;
+		mapping.du_dy = 0.f;
+		mapping.u0 = -(float)x / factorX;
+		mapping.dv_dx = 0.f;
+		mapping.dv_dy = 1.f / factorY;
+		mapping.v0 = -(float)y / factorY;
+
+		bounds_t bounds;
+		bounds.x1 = x;
+		bounds.y1 = y;
+		bounds.x2 = x + (int32_t)ceilf(factorX * (float)img->width);
+		bounds.y2 = y + (int32_t)ceilf(factorY * (float)img->height);
+
+		ret = _draw(gc, img, &mapping, &bounds, alpha, bilinear);
+	} else {
+		// let the Graphics Engine manage the invalid factors
+		ret = false;
+	}
+
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// ui_drawing_transform.h functions
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                          jint y, jint rotationX, jint rotationY, jfloat angle,
+                                                          jint alpha) {
+	return _draw_rotated(gc, img, x, y, rotationX, rotationY, angle, alpha, false);
+}
+
+// See the header file for the function documentation
+bool UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
+                                                   jint rotationX, jint rotationY, jfloat angle, jint alpha) {
+	return _draw_rotated(gc, img, x, y, rotationX, rotationY, angle, alpha, true);
+}
+
+// See the header file for the function documentation
+bool UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                         jint y, jfloat factorX, jfloat factorY, jint alpha) {
+	return _draw_scaled(gc, img, x, y, factorX, factorY, alpha, false);
+}
+
+// See the header file for the function documentation
+bool UI_DRAWING_TRANSFORM_drawScaledImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x, jint y,
+                                                  jfloat factorX, jfloat factorY, jint alpha) {
+	return _draw_scaled(gc, img, x, y, factorX, factorY, alpha, true);
+}
+
+#endif // UI_FEATURE_SOFTWARE_TRANSFORM
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
@@ -0,0 +1,165 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the event recorder and of the MicroUI queue logger based on it.
+ *
+ * @see ui_event_recorder.h
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+#include "ui_configuration.h"
+
+#if defined(UI_FEATURE_EVENT_RECORDER)
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+// implements some LLUI_INPUT_impl functions
+#include <LLUI_INPUT_impl.h>
+
+#include "ui_event_recorder.h"
+#include "event_generator.h"
+#include "framerate_impl.h"
+#include "ui_util.h"
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+#if !defined(FRAMERATE_ENABLED)
+#error "The event recorder stamps the entries with the framerate ticks: enable FRAMERATE_ENABLED"
+#endif
+
+/*
+ * @brief Number of entries of the ring buffer: must be a power of two (the slot is a
+ * mask of the sequence number, which wraps without discontinuity).
+ */
+#define RECORDER_ENTRIES ((uint32_t)(UI_FEATURE_EVENT_RECORDER))
+
+#if (0 == (UI_FEATURE_EVENT_RECORDER)) || (0 != ((UI_FEATURE_EVENT_RECORDER) & ((UI_FEATURE_EVENT_RECORDER) - 1)))
+#error "UI_FEATURE_EVENT_RECORDER must be a power of two"
+#endif
+
+/*
+ * @brief Version of the dump format (see scripts/ui_event_recorder_decode.py).
+ */
+#define RECORDER_DUMP_VERSION (1)
+
+// -----------------------------------------------------------------------------
+// Global Variables
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The ring buffer.
+ */
+static volatile UI_EVENT_RECORDER_entry_t recorder_entries[RECORDER_ENTRIES];
+
+/*
+ * @brief Sequence number of the next entry.
+ */
+static uint32_t recorder_next_sequence;
+
+/*
+ * @brief true when the next element added in the MicroUI queue is the first element of
+ * an event, false when it is the event's data.
+ */
+static bool queue_is_first_element;
+
+// -----------------------------------------------------------------------------
+// ui_event_recorder.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+void UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_kind_t kind, uint32_t index, uint32_t data) {
+	uint32_t ticks = framerate_get_time();
+	uint32_t sequence = __atomic_fetch_add(&recorder_next_sequence, 1u, __ATOMIC_RELAXED);
+	volatile UI_EVENT_RECORDER_entry_t *entry = &recorder_entries[sequence & (RECORDER_ENTRIES - 1u)];
+
+	// invalidate the slot while it is written: the host tool drops the entries whose
+	// sequence does not match their slot
+	entry->sequence = ~sequence;
+	entry->ticks = ticks;
+	entry->data = data;
+	entry->kind = (uint16_t)kind;
+	entry->index = (uint16_t)index;
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	entry->sequence = sequence;
+}
+
+// See the header file for the function documentation
+void UI_EVENT_RECORDER_dump(void) {
+	uint32_t next = __atomic_load_n(&recorder_next_sequence, __ATOMIC_ACQUIRE);
+	uint32_t count = MIN(next, RECORDER_ENTRIES);
+
+	UI_DEBUG_PRINT("UI_EVENT_RECORDER %d %u %u %u\n", RECORDER_DUMP_VERSION, (unsigned int)RECORDER_ENTRIES,
+	               (unsigned int)framerate_impl_get_ticks_per_us(), (unsigned int)next);
+
+	// oldest entry first
+	for (uint32_t sequence = next - count; sequence != next; sequence++) {
+		volatile UI_EVENT_RECORDER_entry_t *entry = &recorder_entries[sequence & (RECORDER_ENTRIES - 1u)];
+		UI_DEBUG_PRINT("%08x %08x %08x %04x %04x\n", (unsigned int)entry->sequence, (unsigned int)entry->ticks,
+		               (unsigned int)entry->data, (unsigned int)entry->kind, (unsigned int)entry->index);
+	}
+
+	UI_DEBUG_PRINT("UI_EVENT_RECORDER END\n");
+}
+
+// -----------------------------------------------------------------------------
+// LLUI_INPUT_impl.h functions
+// -----------------------------------------------------------------------------
+
+void LLUI_INPUT_IMPL_log_queue_init(uint32_t length) {
+	(void)length;
+	queue_is_first_element = true;
+}
+
+void LLUI_INPUT_IMPL_log_queue_full(uint32_t data) {
+	UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_QUEUE_FULL, 0u, data);
+}
+
+void LLUI_INPUT_IMPL_log_queue_add(uint32_t data, uint32_t index, uint32_t remaining_elements, uint32_t queue_length) {
+	(void)queue_length;
+
+	UI_EVENT_RECORDER_record(queue_is_first_element ? UI_EVENT_RECORDER_QUEUE_EVENT : UI_EVENT_RECORDER_QUEUE_DATA,
+	                         index, data);
+	if (queue_is_first_element) {
+		EVENT_GENERATOR_log_queue_event(data, index);
+	}
+
+	// prepare next log
+	queue_is_first_element = remaining_elements == (uint32_t)0;
+}
+
+void LLUI_INPUT_IMPL_log_queue_replace(uint32_t old, uint32_t data, uint32_t index, uint32_t queue_length) {
+	(void)old;
+	UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_QUEUE_REPLACE, index, data);
+	EVENT_GENERATOR_log_queue_replace(index, queue_length);
+}
+
+void LLUI_INPUT_IMPL_log_queue_read(uint32_t data, uint32_t index) {
+	UI_EVENT_RECORDER_record(UI_EVENT_RECORDER_QUEUE_READ, index, data);
+}
+
+void LLUI_INPUT_IMPL_log_dump(bool log_type, uint32_t log, uint32_t index) {
+	(void)index;
+
+	// the queue content is already in the ring buffer: only the start of the dump is
+	// useful (see LLUI_INPUT_impl.h)
+	if (!log_type && ((uint32_t)0 == log)) {
+		UI_EVENT_RECORDER_dump();
+	}
+}
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#endif // UI_FEATURE_EVENT_RECORDER
@@ -280,6 +280,15 @@ extern DRAWING_Status UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor_custom
                                                                                   jint xRotation, jint yRotation,
                                                                                   jfloat angle, jint alpha);
 
+extern bool UI_FONT_DRAWING_getGlyph_custom0(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom1(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom2(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom3(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom4(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom5(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom6(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+extern bool UI_FONT_DRAWING_getGlyph_custom7(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
+
 // --------------------------------------------------------------------------------
 // Typedef of drawing functions
 // --------------------------------------------------------------------------------
@@ -310,6 +319,7 @@ typedef DRAWING_Status (*UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor_t)(
                                                                                 MICROUI_Font *font, jint x, jint y,
                                                                                 jint xRotation, jint yRotation,
                                                                                 jfloat angle, jint alph);
+typedef bool (*UI_FONT_DRAWING_getGlyph_t)(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph);
 
 // --------------------------------------------------------------------------------
 // Tables according to the source font format.
@@ -422,6 +432,17 @@ static const UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor_t
 	&UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor_custom7,
 };
 
+static const UI_FONT_DRAWING_getGlyph_t UI_FONT_DRAWING_getGlyph_custom[] = {
+	&UI_FONT_DRAWING_getGlyph_custom0,
+	&UI_FONT_DRAWING_getGlyph_custom1,
+	&UI_FONT_DRAWING_getGlyph_custom2,
+	&UI_FONT_DRAWING_getGlyph_custom3,
+	&UI_FONT_DRAWING_getGlyph_custom4,
+	&UI_FONT_DRAWING_getGlyph_custom5,
+	&UI_FONT_DRAWING_getGlyph_custom6,
+	&UI_FONT_DRAWING_getGlyph_custom7,
+};
+
 // --------------------------------------------------------------------------------
 // Private functions
 // --------------------------------------------------------------------------------
@@ -528,6 +549,20 @@ DRAWING_Status UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor(MICROUI_Graph
 	                                                                                                 alpha);
 }
 
+// See the header file for the function documentation
+bool UI_FONT_DRAWING_getGlyph(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph) {
+	bool ret = false;
+	if (LLUI_DISPLAY_isCustomFormat(font->format)) {
+		// only the font manager of a custom font can give the glyphs
+		// (the table does not hold the stub and soft functions)
+		// cppcheck-suppress [misra-c2012-10.6] convert font format to an index
+		uint32_t index = (uint32_t)GET_CUSTOM_FONT_INDEX(font) - (uint32_t)TABLE_INDEX_CUSTOM_OFFSET;
+		ret = (*UI_FONT_DRAWING_getGlyph_custom[index])(font, c, glyph);
+	}
+	// else: the glyphs of the standard fonts are private to the Graphics Engine
+	return ret;
+}
+
 // --------------------------------------------------------------------------------
 // Table weak functions
 // --------------------------------------------------------------------------------
@@ -1076,6 +1111,78 @@ BSP_DECLARE_WEAK_FCNT DRAWING_Status UI_FONT_DRAWING_drawCharWithRotationNearest
 	return UI_DRAWING_STUB_drawCharWithRotationNearestNeighbor(gc, c, font, x, y, xRotation, yRotation, angle, alpha);
 }
 
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom0(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom1(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom2(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom3(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom4(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom5(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom6(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
+// See the header file for the function documentation
+BSP_DECLARE_WEAK_FCNT bool UI_FONT_DRAWING_getGlyph_custom7(MICROUI_Font *font, jchar c,
+                                                            UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	return false;
+}
+
 #else // #if defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 
 /*
@@ -1173,6 +1280,15 @@ DRAWING_Status UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor(MICROUI_Graph
 	       : UI_DRAWING_STUB_drawCharWithRotationNearestNeighbor(gc, c, font, x, y, xRotation, yRotation, angle, alpha);
 }
 
+// See the header file for the function documentation
+bool UI_FONT_DRAWING_getGlyph(MICROUI_Font *font, jchar c, UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)font;
+	(void)c;
+	(void)glyph;
+	// the glyphs of the standard fonts are private to the Graphics Engine
+	return false;
+}
+
 #endif // #if defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
 
 // --------------------------------------------------------------------------------
@@ -0,0 +1,535 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Encoders and decoders of the compressed images.
+ *
+ * @see ui_image_compressed.h
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_image_compressed.h"
+#include "ui_pixel_kernels.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Size of a block (in pixels) and size of an encoded block (in bytes).
+ */
+#define BLOCK_SIZE 4u
+#define BLOCK_BYTES 8u
+
+/*
+ * @brief Bit of a RLE control byte that identifies a repeated pixel.
+ */
+#define RLE_REPEAT_BIT 0x80u
+
+/*
+ * @brief Maximum number of pixels of a RLE run.
+ */
+#define RLE_MAX_RUN 128u
+
+/*
+ * @brief Index of a transparent pixel in a block whose first color is not greater than the second one.
+ */
+#define BLOCK_TRANSPARENT_INDEX 3u
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static inline const uint8_t * _get_data(const UI_IMAGE_COMPRESSED_header_t *header) {
+	return &(((const uint8_t *)header)[sizeof(UI_IMAGE_COMPRESSED_header_t)]);
+}
+
+static inline uint32_t _read_u16(const uint8_t *data) {
+	return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+static inline uint32_t _read_u32(const uint8_t *data) {
+	return _read_u16(data) | (_read_u16(&data[2]) << 16);
+}
+
+static inline void _write_u16(uint8_t *data, uint32_t value) {
+	data[0] = (uint8_t)value;
+	data[1] = (uint8_t)(value >> 8);
+}
+
+static inline void _write_u32(uint8_t *data, uint32_t value) {
+	_write_u16(data, value);
+	_write_u16(&data[2], value >> 16);
+}
+
+static inline uint32_t _get_blocks(uint32_t size) {
+	return (size + BLOCK_SIZE - 1u) / BLOCK_SIZE;
+}
+
+static inline uint32_t _read_pixel(const uint8_t *src, uint32_t bpp) {
+	return (2u == bpp) ? (uint32_t)*((const uint16_t *)src) : *((const uint32_t *)src);
+}
+
+static inline void _write_pixel(uint8_t *dest, uint32_t pixel, uint32_t bpp) {
+	if (2u == bpp) {
+		*((uint16_t *)dest) = (uint16_t)pixel;
+	} else {
+		*((uint32_t *)dest) = pixel;
+	}
+}
+
+/*
+ * @brief Converts a RGB565 color in a RGB888 color.
+ */
+static uint32_t _to_rgb888(uint32_t color) {
+	uint32_t red = (color >> 11) & 0x1fu;
+	uint32_t green = (color >> 5) & 0x3fu;
+	uint32_t blue = color & 0x1fu;
+	red = (red << 3) | (red >> 2);
+	green = (green << 2) | (green >> 4);
+	blue = (blue << 3) | (blue >> 2);
+	return (red << 16) | (green << 8) | blue;
+}
+
+/*
+ * @brief Converts a RGB888 color in an opaque pixel of the decoded format.
+ */
+static uint32_t _to_pixel(uint32_t color, uint32_t bpp) {
+	uint32_t ret;
+	if (2u == bpp) {
+		ret = ((color >> 8) & 0xf800u) | ((color >> 5) & 0x07e0u) | ((color >> 3) & 0x001fu);
+	} else {
+		ret = 0xff000000u | color;
+	}
+	return ret;
+}
+
+/*
+ * @brief Computes the weighted mean of two RGB888 colors (channel per channel).
+ */
+static uint32_t _mix(uint32_t color0, uint32_t color1, uint32_t weight0, uint32_t weight1) {
+	uint32_t ret = 0;
+	for (uint32_t shift = 0; shift < 24u; shift += 8u) {
+		uint32_t channel0 = (color0 >> shift) & 0xffu;
+		uint32_t channel1 = (color1 >> shift) & 0xffu;
+		ret |= (((channel0 * weight0) + (channel1 * weight1)) / (weight0 + weight1)) << shift;
+	}
+	return ret;
+}
+
+/*
+ * @brief Computes the four pixels (decoded format) a block can reference.
+ */
+static void _get_block_palette(const uint8_t *block, uint32_t bpp, uint32_t palette[4]) {
+	uint32_t c0 = _read_u16(block);
+	uint32_t c1 = _read_u16(&block[2]);
+	uint32_t color0 = _to_rgb888(c0);
+	uint32_t color1 = _to_rgb888(c1);
+
+	palette[0] = _to_pixel(color0, bpp);
+	palette[1] = _to_pixel(color1, bpp);
+	if (c0 > c1) {
+		palette[2] = _to_pixel(_mix(color0, color1, 2u, 1u), bpp);
+		palette[3] = _to_pixel(_mix(color0, color1, 1u, 2u), bpp);
+	} else {
+		palette[2] = _to_pixel(_mix(color0, color1, 1u, 1u), bpp);
+		palette[3] = 0u; // transparent (black when the decoded format is opaque)
+	}
+}
+
+static bool _decode_rle_rows(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t first_row, uint32_t rows,
+                             uint8_t *dest, uint32_t dest_stride) {
+	const uint8_t *data = _get_data(header);
+	const uint8_t *data_end = &data[header->data_size];
+	uint32_t width = header->width;
+	uint32_t bpp = UI_IMAGE_COMPRESSED_get_bytes_per_pixel(header);
+	bool ret = true;
+
+	for (uint32_t row = first_row; ret && (row < (first_row + rows)); row++) {
+		uint32_t offset = _read_u32(&data[row * sizeof(uint32_t)]);
+		const uint8_t *src = &data[offset];
+		uint8_t *dest_row = &dest[(row - first_row) * dest_stride];
+		uint32_t x = 0;
+
+		ret = offset < header->data_size;
+		while (ret && (x < width)) {
+			uint32_t control = *src;
+			src++;
+			uint32_t count = (control & ~RLE_REPEAT_BIT) + 1u;
+			uint8_t *dest_pixel = &dest_row[x * bpp];
+			x += count;
+
+			if ((RLE_REPEAT_BIT & control) != 0u) {
+				ret = (x <= width) && ((uint32_t)(data_end - src) >= bpp);
+				if (ret) {
+					// the destination is aligned on the size of a pixel (see UI_IMAGE_COMPRESSED_decode_rows())
+					if (2u == bpp) {
+						UI_PIXEL_KERNELS_fill_16((uint16_t *)dest_pixel, (uint16_t)_read_u16(src), count);
+					} else {
+						UI_PIXEL_KERNELS_fill_32((uint32_t *)dest_pixel, _read_u32(src), count);
+					}
+				}
+				src += bpp;
+			} else {
+				ret = (x <= width) && ((uint32_t)(data_end - src) >= (count * bpp));
+				if (ret) {
+					(void)memcpy(dest_pixel, src, count * bpp);
+				}
+				src += count * bpp;
+			}
+
+			// next control byte
+			ret = ret && ((x == width) || (src < data_end));
+		}
+	}
+
+	return ret;
+}
+
+static bool _decode_block_rows(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t first_row, uint32_t rows,
+                               uint8_t *dest, uint32_t dest_stride) {
+	const uint8_t *data = _get_data(header);
+	uint32_t width = header->width;
+	uint32_t bpp = UI_IMAGE_COMPRESSED_get_bytes_per_pixel(header);
+	uint32_t blocks_per_row = _get_blocks(width);
+	uint32_t last_row = first_row + rows;
+
+	for (uint32_t block_y = first_row / BLOCK_SIZE; (block_y * BLOCK_SIZE) < last_row; block_y++) {
+		// rows of the block to decode
+		uint32_t block_first_row = block_y * BLOCK_SIZE;
+		uint32_t y_start = (block_first_row < first_row) ? first_row : block_first_row;
+		uint32_t y_end = ((block_first_row + BLOCK_SIZE) > last_row) ? last_row : (block_first_row + BLOCK_SIZE);
+
+		const uint8_t *block = &data[block_y * blocks_per_row * BLOCK_BYTES];
+		for (uint32_t block_x = 0; block_x < blocks_per_row; block_x++) {
+			uint32_t palette[4];
+			_get_block_palette(block, bpp, palette);
+			uint32_t indices = _read_u32(&block[4]);
+
+			uint32_t block_first_column = block_x * BLOCK_SIZE;
+			uint32_t columns = ((block_first_column + BLOCK_SIZE) > width) ? (width - block_first_column) : BLOCK_SIZE;
+
+			for (uint32_t y = y_start; y < y_end; y++) {
+				uint8_t *dest_pixel = &dest[((y - first_row) * dest_stride) + (block_first_column * bpp)];
+				uint32_t row_indices = indices >> ((y - block_first_row) * 2u * BLOCK_SIZE);
+				for (uint32_t x = 0; x < columns; x++) {
+					_write_pixel(dest_pixel, palette[(row_indices >> (x * 2u)) & 3u], bpp);
+					dest_pixel += bpp;
+				}
+			}
+
+			block += BLOCK_BYTES;
+		}
+	}
+
+	// the data size has been checked with the header
+	return true;
+}
+
+/*
+ * @brief Gets the number of identical pixels from the column "x" of a row (at most RLE_MAX_RUN).
+ */
+static uint32_t _get_repeated_pixels(const uint8_t *src, uint32_t x, uint32_t width, uint32_t bpp) {
+	uint32_t pixel = _read_pixel(&src[x * bpp], bpp);
+	uint32_t count = 1u;
+	while (((x + count) < width) && (count < RLE_MAX_RUN) && (pixel == _read_pixel(&src[(x + count) * bpp], bpp))) {
+		count++;
+	}
+	return count;
+}
+
+/*
+ * @brief Encodes a row: the pixels repeated at least twice are encoded in a repeated run, the other ones in a list
+ * of pixels.
+ *
+ * @return the size of the encoded row, 0 when it does not fit the destination.
+ */
+static uint32_t _encode_rle_row(const uint8_t *src, uint32_t width, uint32_t bpp, uint8_t *dest, uint32_t dest_size) {
+	uint32_t size = 0u;
+	uint32_t x = 0u;
+	bool ret = true;
+
+	while (ret && (x < width)) {
+		uint32_t count = _get_repeated_pixels(src, x, width, bpp);
+		uint32_t bytes;
+
+		if (1u < count) {
+			bytes = bpp;
+			ret = (size + 1u + bytes) <= dest_size;
+			if (ret) {
+				dest[size] = (uint8_t)(RLE_REPEAT_BIT | (count - 1u));
+			}
+		} else {
+			// the list stops before the next repeated pixels
+			while (((x + count) < width) && (count < RLE_MAX_RUN) && (1u == _get_repeated_pixels(src, x + count, width,
+			                                                                                     bpp))) {
+				count++;
+			}
+			bytes = count * bpp;
+			ret = (size + 1u + bytes) <= dest_size;
+			if (ret) {
+				dest[size] = (uint8_t)(count - 1u);
+			}
+		}
+
+		if (ret) {
+			(void)memcpy(&dest[size + 1u], &src[x * bpp], bytes);
+			size += 1u + bytes;
+			x += count;
+		}
+	}
+
+	return ret ? size : 0u;
+}
+
+/*
+ * @brief Gets the RGB888 color of a source pixel. The ARGB8888_PRE pixels whose opacity is lower than 50% are
+ * transparent; the other ones are encoded as opaque pixels.
+ *
+ * @return false when the pixel is transparent.
+ */
+static bool _get_block_color(uint32_t pixel, uint32_t bpp, uint32_t *color) {
+	bool opaque = true;
+	if (2u == bpp) {
+		*color = _to_rgb888(pixel);
+	} else {
+		uint32_t alpha = pixel >> 24;
+		opaque = alpha >= 0x80u;
+		*color = 0u;
+		for (uint32_t shift = 0; opaque && (shift < 24u); shift += 8u) {
+			// not pre-multiplied
+			uint32_t channel = (((pixel >> shift) & 0xffu) * 255u) / alpha;
+			*color |= ((channel > 0xffu) ? 0xffu : channel) << shift;
+		}
+	}
+	return opaque;
+}
+
+static uint32_t _get_distance(uint32_t color0, uint32_t color1) {
+	uint32_t ret = 0u;
+	for (uint32_t shift = 0; shift < 24u; shift += 8u) {
+		int32_t delta = (int32_t)((color0 >> shift) & 0xffu) - (int32_t)((color1 >> shift) & 0xffu);
+		ret += (uint32_t)(delta * delta);
+	}
+	return ret;
+}
+
+/*
+ * @brief Encodes a block: the two colors are the farthest colors of the block (RGB565) and each pixel references the
+ * nearest color of the block's palette. A block with one or two colors is encoded without loss.
+ *
+ * @param[in] src: the top-left pixel of the block.
+ * @param[in] columns: the number of columns of the block in the image (the other columns are padding).
+ * @param[in] rows: the number of rows of the block in the image (the other rows are padding).
+ */
+static void _encode_block(const uint8_t *src, uint32_t src_stride, uint32_t columns, uint32_t rows, uint32_t bpp,
+                          uint8_t *block) {
+	uint32_t colors[BLOCK_SIZE * BLOCK_SIZE];
+	bool opaque[BLOCK_SIZE * BLOCK_SIZE];
+	bool transparent = false;
+	uint32_t count = 0u;
+
+	for (uint32_t y = 0; y < rows; y++) {
+		for (uint32_t x = 0; x < columns; x++) {
+			uint32_t color;
+			bool is_opaque = _get_block_color(_read_pixel(&src[(y * src_stride) + (x * bpp)], bpp), bpp, &color);
+			// the colors of the block are RGB565 colors
+			colors[count] = _to_rgb888(_to_pixel(color, 2u));
+			opaque[count] = is_opaque;
+			transparent = transparent || !is_opaque;
+			count++;
+		}
+	}
+
+	// the two farthest opaque colors
+	uint32_t c0 = 0u;
+	uint32_t c1 = 0u;
+	uint32_t max_distance = 0u;
+	bool found = false;
+	for (uint32_t i = 0; i < count; i++) {
+		for (uint32_t j = i; j < count; j++) {
+			uint32_t distance = _get_distance(colors[i], colors[j]);
+			if (opaque[i] && opaque[j] && (!found || (distance > max_distance))) {
+				max_distance = distance;
+				found = true;
+				c0 = _to_pixel(colors[i], 2u);
+				c1 = _to_pixel(colors[j], 2u);
+			}
+		}
+	}
+
+	// the four colors mode (c0 > c1) has no transparent pixel
+	if ((transparent && (c0 > c1)) || (!transparent && (c0 < c1))) {
+		uint32_t swap = c0;
+		c0 = c1;
+		c1 = swap;
+	}
+	_write_u16(block, c0);
+	_write_u16(&block[2], c1);
+
+	uint32_t palette[4];
+	_get_block_palette(block, 4u, palette);
+	uint32_t palette_length = (c0 > c1) ? 4u : BLOCK_TRANSPARENT_INDEX;
+
+	uint32_t indices = 0u;
+	uint32_t pixel = 0u;
+	for (uint32_t y = 0; y < rows; y++) {
+		for (uint32_t x = 0; x < columns; x++) {
+			uint32_t index = BLOCK_TRANSPARENT_INDEX;
+			if (opaque[pixel]) {
+				index = 0u;
+				for (uint32_t i = 1; i < palette_length; i++) {
+					if (_get_distance(colors[pixel], palette[i]) < _get_distance(colors[pixel], palette[index])) {
+						index = i;
+					}
+				}
+			}
+			indices |= index << (((y * BLOCK_SIZE) + x) * 2u);
+			pixel++;
+		}
+	}
+	_write_u32(&block[4], indices);
+}
+
+static uint32_t _encode_rle(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height, uint32_t bpp,
+                            uint8_t *data, uint32_t data_size) {
+	// the table of offsets
+	uint32_t size = height * sizeof(uint32_t);
+	bool ret = size <= data_size;
+
+	for (uint32_t row = 0; ret && (row < height); row++) {
+		_write_u32(&data[row * sizeof(uint32_t)], size);
+		uint32_t row_size = _encode_rle_row(&src[row * src_stride], width, bpp, &data[size], data_size - size);
+		ret = 0u != row_size;
+		size += row_size;
+	}
+
+	return ret ? size : 0u;
+}
+
+static uint32_t _encode_blocks(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height, uint32_t bpp,
+                               uint8_t *data, uint32_t data_size) {
+	uint32_t size = _get_blocks(width) * _get_blocks(height) * BLOCK_BYTES;
+	bool ret = size <= data_size;
+
+	for (uint32_t y = 0; ret && (y < height); y += BLOCK_SIZE) {
+		for (uint32_t x = 0; x < width; x += BLOCK_SIZE) {
+			uint32_t columns = ((x + BLOCK_SIZE) > width) ? (width - x) : BLOCK_SIZE;
+			uint32_t rows = ((y + BLOCK_SIZE) > height) ? (height - y) : BLOCK_SIZE;
+			_encode_block(&src[(y * src_stride) + (x * bpp)], src_stride, columns, rows, bpp, data);
+			data += BLOCK_BYTES;
+		}
+	}
+
+	return ret ? size : 0u;
+}
+
+// --------------------------------------------------------------------------------
+// ui_image_compressed.h functions
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_IMAGE_COMPRESSED_check_header(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t width, uint32_t height) {
+	bool ret = (width == header->width) && (height == header->height) && (0u != width) && (0u != height)
+	           && ((UI_IMAGE_COMPRESSED_FORMAT_RGB565 == header->format)
+	               || (UI_IMAGE_COMPRESSED_FORMAT_ARGB8888_PRE == header->format));
+
+	if (ret) {
+		if (UI_IMAGE_COMPRESSED_ENCODING_RLE == header->encoding) {
+			// the table of offsets
+			ret = header->data_size >= (height * sizeof(uint32_t));
+		} else if (UI_IMAGE_COMPRESSED_ENCODING_BLOCK == header->encoding) {
+			ret = header->data_size >= (_get_blocks(width) * _get_blocks(height) * BLOCK_BYTES);
+		} else {
+			// unknown encoding
+			ret = false;
+		}
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+uint32_t UI_IMAGE_COMPRESSED_get_bytes_per_pixel(const UI_IMAGE_COMPRESSED_header_t *header) {
+	return (UI_IMAGE_COMPRESSED_FORMAT_RGB565 == header->format) ? 2u : 4u;
+}
+
+// See the header file for the function documentation
+bool UI_IMAGE_COMPRESSED_decode_rows(const UI_IMAGE_COMPRESSED_header_t *header, uint32_t first_row, uint32_t rows,
+                                     uint8_t *dest, uint32_t dest_stride) {
+	bool ret;
+	if ((first_row + rows) > header->height) {
+		ret = false;
+	} else if (UI_IMAGE_COMPRESSED_ENCODING_RLE == header->encoding) {
+		ret = _decode_rle_rows(header, first_row, rows, dest, dest_stride);
+	} else {
+		ret = _decode_block_rows(header, first_row, rows, dest, dest_stride);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+uint32_t UI_IMAGE_COMPRESSED_get_max_size(uint32_t width, uint32_t height, uint8_t encoding, uint8_t format) {
+	uint32_t bpp = (UI_IMAGE_COMPRESSED_FORMAT_RGB565 == format) ? 2u : 4u;
+	uint32_t data_size;
+	if (UI_IMAGE_COMPRESSED_ENCODING_RLE == encoding) {
+		// the offset of the row and, at worst, one control byte per pixel
+		data_size = height * (sizeof(uint32_t) + (width * (1u + bpp)));
+	} else {
+		data_size = _get_blocks(width) * _get_blocks(height) * BLOCK_BYTES;
+	}
+	return sizeof(UI_IMAGE_COMPRESSED_header_t) + data_size;
+}
+
+// See the header file for the function documentation
+uint32_t UI_IMAGE_COMPRESSED_encode(const uint8_t *src, uint32_t src_stride, uint32_t width, uint32_t height,
+                                    uint8_t encoding, uint8_t format, uint8_t *dest, uint32_t dest_size) {
+	UI_IMAGE_COMPRESSED_header_t *header = (UI_IMAGE_COMPRESSED_header_t *)dest;
+	uint32_t size = 0u;
+
+	if ((0u != width) && (width <= UINT16_MAX) && (0u != height) && (height <= UINT16_MAX)
+	    && ((UI_IMAGE_COMPRESSED_FORMAT_RGB565 == format) || (UI_IMAGE_COMPRESSED_FORMAT_ARGB8888_PRE == format))
+	    && (dest_size > sizeof(UI_IMAGE_COMPRESSED_header_t))) {
+		header->width = (uint16_t)width;
+		header->height = (uint16_t)height;
+		header->encoding = encoding;
+		header->format = format;
+		header->reserved = 0u;
+
+		uint8_t *data = &dest[sizeof(UI_IMAGE_COMPRESSED_header_t)];
+		uint32_t data_size = dest_size - sizeof(UI_IMAGE_COMPRESSED_header_t);
+		uint32_t bpp = UI_IMAGE_COMPRESSED_get_bytes_per_pixel(header);
+		if (UI_IMAGE_COMPRESSED_ENCODING_RLE == encoding) {
+			data_size = _encode_rle(src, src_stride, width, height, bpp, data, data_size);
+		} else if (UI_IMAGE_COMPRESSED_ENCODING_BLOCK == encoding) {
+			data_size = _encode_blocks(src, src_stride, width, height, bpp, data, data_size);
+		} else {
+			// unknown encoding
+			data_size = 0u;
+		}
+
+		if (0u != data_size) {
+			header->data_size = data_size;
+			size = sizeof(UI_IMAGE_COMPRESSED_header_t) + data_size;
+		}
+	}
+
+	return size;
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
@@ -0,0 +1,231 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the pixel kernels.
+ *
+ * A 32-bit word holds two 16-bit lanes: the channels 0 and 2 (blue and red) or the
+ * channels 1 and 3 (green and alpha) of an ARGB8888 pixel. A channel multiplied by an
+ * opacity (at most 255 * 255) fits in its lane: both channels are multiplied at once.
+ *
+ * @see ui_pixel_kernels.h
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_pixel_kernels.h"
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+// CMSIS SIMD intrinsics
+#include "fsl_common.h"
+#endif
+
+// --------------------------------------------------------------------------------
+// Macros and Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Mask of the channels 0 and 2 of an ARGB8888 pixel.
+ */
+#define LANES_MASK (0x00ff00ffu)
+
+/*
+ * @brief Adds 0.5 (rounding) in both lanes.
+ */
+#define LANES_HALF (0x00800080u)
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+/*
+ * @brief Extracts the channels 0 and 2 (UXTB16) or 1 and 3 (UXTB16 with a rotation).
+ */
+#define GET_LANES_02(pixel) __UXTB16(pixel)
+#define GET_LANES_13(pixel) __UXTB16(__ROR((pixel), 8u))
+
+#else
+
+#define GET_LANES_02(pixel) ((pixel) & LANES_MASK)
+#define GET_LANES_13(pixel) (((pixel) >> 8) & LANES_MASK)
+
+#endif
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Divides both lanes by 255 (rounded): each lane must be lower than or equal
+ * to 255 * 255.
+ */
+static inline uint32_t _div255_lanes(uint32_t lanes) {
+	uint32_t t = lanes + LANES_HALF;
+	return ((t + ((t >> 8) & LANES_MASK)) >> 8) & LANES_MASK;
+}
+
+/*
+ * @brief Converts a RGB565 pixel in an opaque ARGB8888 pixel.
+ */
+static inline uint32_t _rgb565_to_argb8888(uint32_t pixel) {
+	uint32_t red = (pixel >> 11) & 0x1fu;
+	uint32_t green = (pixel >> 5) & 0x3fu;
+	uint32_t blue = pixel & 0x1fu;
+	red = (red << 3) | (red >> 2);
+	green = (green << 2) | (green >> 4);
+	blue = (blue << 3) | (blue >> 2);
+	return 0xff000000u | (red << 16) | (green << 8) | blue;
+}
+
+/*
+ * @brief Converts an ARGB8888 pixel in a RGB565 pixel (the alpha channel is ignored).
+ */
+static inline uint16_t _argb8888_to_rgb565(uint32_t pixel) {
+	return (uint16_t)(((pixel >> 8) & 0xf800u) | ((pixel >> 5) & 0x07e0u) | ((pixel >> 3) & 0x001fu));
+}
+
+/*
+ * @brief Blends two ARGB8888 pixels: (src * alpha + dest * (255 - alpha)) / 255.
+ */
+static inline uint32_t _blend(uint32_t src, uint32_t dest, uint32_t alpha) {
+	uint32_t inv = 255u - alpha;
+	uint32_t lanes_02 = _div255_lanes((GET_LANES_02(src) * alpha) + (GET_LANES_02(dest) * inv));
+	uint32_t lanes_13 = _div255_lanes((GET_LANES_13(src) * alpha) + (GET_LANES_13(dest) * inv));
+	return lanes_02 | (lanes_13 << 8);
+}
+
+/*
+ * @brief Applies an opacity on a premultiplied ARGB8888 pixel.
+ */
+static inline uint32_t _apply_opacity(uint32_t pixel, uint32_t alpha) {
+	return _div255_lanes(GET_LANES_02(pixel) * alpha) | (_div255_lanes(GET_LANES_13(pixel) * alpha) << 8);
+}
+
+/*
+ * @brief Draws a premultiplied ARGB8888 pixel on an opaque ARGB8888 pixel:
+ * src + dest * (255 - src_alpha) / 255.
+ */
+static inline uint32_t _blend_premultiplied(uint32_t src, uint32_t dest) {
+	uint32_t inv = 255u - (src >> 24);
+	uint32_t lanes_02 = _div255_lanes(GET_LANES_02(dest) * inv);
+	uint32_t lanes_13 = _div255_lanes(GET_LANES_13(dest) * inv);
+	return src + (lanes_02 | (lanes_13 << 8));
+}
+
+// --------------------------------------------------------------------------------
+// ui_pixel_kernels.h functions
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+void UI_PIXEL_KERNELS_fill_16(uint16_t *dest, uint16_t pixel, uint32_t count) {
+	uint16_t *d = dest;
+	uint32_t remaining = count;
+
+	if ((0u < remaining) && (0u != ((uintptr_t)d & 2u))) {
+		// align on 32 bits
+		*d = pixel;
+		d++;
+		remaining--;
+	}
+
+	// two pixels per store
+	uint32_t pixels = (uint32_t)pixel | ((uint32_t)pixel << 16);
+	uint32_t *d32 = (uint32_t *)d;
+	for (uint32_t i = remaining / 2u; i > 0u; i--) {
+		*d32 = pixels;
+		d32++;
+	}
+
+	if (0u != (remaining & 1u)) {
+		*((uint16_t *)d32) = pixel;
+	}
+}
+
+// See the header file for the function documentation
+void UI_PIXEL_KERNELS_fill_32(uint32_t *dest, uint32_t pixel, uint32_t count) {
+	uint32_t *d = dest;
+	uint32_t remaining = count;
+
+	// four pixels per iteration
+	for (; remaining >= 4u; remaining -= 4u) {
+		d[0] = pixel;
+		d[1] = pixel;
+		d[2] = pixel;
+		d[3] = pixel;
+		d += 4;
+	}
+	for (; remaining > 0u; remaining--) {
+		*d = pixel;
+		d++;
+	}
+}
+
+// See the header file for the function documentation
+void UI_PIXEL_KERNELS_convert_rgb888_to_argb8888(uint32_t *dest, const uint8_t *src, uint32_t count) {
+	uint32_t *d = dest;
+	const uint8_t *s = src;
+	uint32_t remaining = count;
+
+	// four pixels (three words) per iteration (little endian: B0 G0 R0 B1 | G1 R1 B2 G2 | R2 B3 G3 R3)
+	for (; remaining >= 4u; remaining -= 4u) {
+		uint32_t words[3];
+		(void)memcpy(words, s, sizeof(words)); // unaligned loads
+		d[0] = 0xff000000u | words[0];
+		d[1] = 0xff000000u | (words[0] >> 24) | (words[1] << 8);
+		d[2] = 0xff000000u | (words[1] >> 16) | (words[2] << 16);
+		d[3] = 0xff000000u | (words[2] >> 8);
+		d += 4;
+		s += 12;
+	}
+	for (; remaining > 0u; remaining--) {
+		*d = 0xff000000u | ((uint32_t)s[2] << 16) | ((uint32_t)s[1] << 8) | (uint32_t)s[0];
+		d++;
+		s += 3;
+	}
+}
+
+// See the header file for the function documentation
+void UI_PIXEL_KERNELS_blend_rgb565_on_rgb565(uint16_t *dest, const uint16_t *src, uint32_t alpha, uint32_t count) {
+	if (255u <= alpha) {
+		// opaque pixels
+		(void)memcpy(dest, src, count * sizeof(uint16_t));
+	} else if (0u < alpha) {
+		for (uint32_t i = 0; i < count; i++) {
+			uint32_t pixel = _blend(_rgb565_to_argb8888(src[i]), _rgb565_to_argb8888(dest[i]), alpha);
+			dest[i] = _argb8888_to_rgb565(pixel);
+		}
+	} else {
+		// fully transparent: nothing to draw
+	}
+}
+
+// See the header file for the function documentation
+void UI_PIXEL_KERNELS_blend_argb8888_pre_on_rgb565(uint16_t *dest, const uint32_t *src, uint32_t alpha,
+                                                   uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t pixel = src[i];
+		if (255u > alpha) {
+			pixel = _apply_opacity(pixel, alpha);
+		}
+
+		uint32_t pixel_alpha = pixel >> 24;
+		if (0xffu == pixel_alpha) {
+			dest[i] = _argb8888_to_rgb565(pixel);
+		} else if (0u != pixel_alpha) {
+			dest[i] = _argb8888_to_rgb565(_blend_premultiplied(pixel, _rgb565_to_argb8888(dest[i])));
+		} else {
+			// transparent pixel
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
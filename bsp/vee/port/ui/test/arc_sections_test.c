@@ -0,0 +1,355 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host validation of the arc sections of the VGLite paths (ui_drawing_vglite_path.c):
+ * computes the paths of the ellipses, the filled ellipses, the ellipse arcs and the thick
+ * ellipse arcs for the radii from 2 to 800 pixels and checks that:
+ *
+ * - the paths fit the buffers declared in ui_drawing_vglite_path.h,
+ * - the number of cubic curves of a whole ellipse decreases with the radius,
+ * - each cubic curve stays close to its ellipse: the radial distance between the curve
+ * and the ellipse is lower than ARC_TOLERANCE plus the rounding of the coordinates of the
+ * path (integers in the path unit, see DRAWING_SCALE_FACTOR).
+ *
+ * The caps of the thick arcs are not checked (they are not on the ellipses).
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DVG_DRIVER_SINGLE_THREAD -Iui/test/stubs -Iui/inc -Iui_vglite/inc \
+ *		-I../../sdk_overlay/middleware/vglite/inc ui/test/arc_sections_test.c \
+ *		ui_vglite/src/ui_drawing_vglite_path.c ui_vglite/src/mej_math.c -lm -o arc_sections_test
+ *	./arc_sections_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ui_drawing_vglite_path.h"
+#include "ui_vglite.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+#define MIN_RADIUS (2)
+#define MAX_RADIUS (800)
+
+/*
+ * @brief Maximum radial distance (in pixels) between a cubic curve and its ellipse:
+ * ARC_TOLERANCE (0.125 pixel) plus the rounding of the points (half a path unit on each
+ * axis: sqrt(2) / 2 path unit), multiplied by the scale of the path.
+ */
+#define ARC_TOLERANCE (0.125)
+#define ROUNDING_ERROR (0.7072)
+#define MAX_ERROR(scale) (ARC_TOLERANCE + ((ROUNDING_ERROR * (scale)) / DRAWING_SCALE_FACTOR))
+
+/*
+ * @brief Number of points checked on each cubic curve.
+ */
+#define SAMPLES (64)
+
+#define VGLITE_END_CMD (0)
+#define VGLITE_MOVE_CMD (2)
+#define VGLITE_LINE_CMD (4)
+#define VGLITE_CUBIC_CMD (8)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Result of the check of a path.
+ */
+typedef struct {
+	int cubics; // number of cubic curves
+	double error; // largest radial distance in pixels
+	bool valid; // false when the path holds an unknown command
+} path_check_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Path buffer: larger than the largest path to detect the overflows.
+ */
+static int16_t path_data[1024];
+
+static uint32_t errors;
+
+// --------------------------------------------------------------------------------
+// VGLite and UI stubs
+// --------------------------------------------------------------------------------
+
+vg_lite_error_t vg_lite_init_path(vg_lite_path_t *path, vg_lite_format_t data_format, vg_lite_quality_t quality,
+                                  uint32_t path_length, void *path_data, vg_lite_float_t min_x, vg_lite_float_t min_y,
+                                  vg_lite_float_t max_x, vg_lite_float_t max_y) {
+	path->format = data_format;
+	path->quality = quality;
+	path->path_length = (int32_t)path_length;
+	path->path = path_data;
+	path->bounding_box[0] = min_x;
+	path->bounding_box[1] = min_y;
+	path->bounding_box[2] = max_x;
+	path->bounding_box[3] = max_y;
+	return VG_LITE_SUCCESS;
+}
+
+void vg_lite_scale(vg_lite_float_t scale_x, vg_lite_float_t scale_y, vg_lite_matrix_t *matrix) {
+	for (int i = 0; i < 3; i++) {
+		matrix->m[i][0] *= scale_x;
+		matrix->m[i][1] *= scale_y;
+	}
+}
+
+void vg_lite_translate(vg_lite_float_t x, vg_lite_float_t y, vg_lite_matrix_t *matrix) {
+	(void)x;
+	(void)y;
+	(void)matrix;
+}
+
+void vg_lite_rotate(vg_lite_float_t degrees, vg_lite_matrix_t *matrix) {
+	(void)degrees;
+	(void)matrix;
+}
+
+void UI_VGLITE_IMPL_error(bool critical, const char *format, ...) {
+	va_list args;
+	va_start(args, format);
+	(void)printf("error%s: ", critical ? " (critical)" : "");
+	(void)vprintf(format, args);
+	(void)printf("\n");
+	va_end(args);
+	errors++;
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static void _error(const char *shape, int radius, const char *format, ...) {
+	if (errors < 20u) {
+		va_list args;
+		va_start(args, format);
+		(void)printf("%s (radius %d): ", shape, radius);
+		(void)vprintf(format, args);
+		(void)printf("\n");
+		va_end(args);
+	}
+	errors++;
+}
+
+/*
+ * @brief Gets the radial distance between a point and an ellipse (in the path unit): the
+ * distance along the ray from the center to the point.
+ */
+static double _get_radial_distance(double x, double y, double radius_w, double radius_h) {
+	double distance = sqrt((x * x) + (y * y));
+	double ret = distance;
+	if (0.0 < distance) {
+		double cos = x / distance;
+		double sin = y / distance;
+		double ellipse = 1.0 / sqrt(((cos * cos) / (radius_w * radius_w)) + ((sin * sin) / (radius_h * radius_h)));
+		ret = fabs(distance - ellipse);
+	}
+	return ret;
+}
+
+/*
+ * @brief Parses a path and gets the largest radial distance between its cubic curves and
+ * the nearest of one or two ellipses (the outer and the inner ellipses of an arc), in
+ * pixels. The coordinates are multiplied by "scale".
+ */
+static path_check_t _check_path(const int16_t *path, int length, double scale, double radius_out_w,
+                                double radius_out_h, double radius_in_w, double radius_in_h) {
+	path_check_t ret = { 0, 0.0, true };
+	double x = 0.0;
+	double y = 0.0;
+	int index = 0;
+	int count = length / (int)sizeof(int16_t);
+
+	while (ret.valid && (index < count)) {
+		int16_t cmd = path[index];
+		if (VGLITE_END_CMD == cmd) {
+			index = count;
+		} else if ((VGLITE_MOVE_CMD == cmd) || (VGLITE_LINE_CMD == cmd)) {
+			x = path[index + 1] * scale;
+			y = path[index + 2] * scale;
+			index += 3;
+		} else if (VGLITE_CUBIC_CMD == cmd) {
+			double px[4] = { x, path[index + 1] * scale, path[index + 3] * scale, path[index + 5] * scale };
+			double py[4] = { y, path[index + 2] * scale, path[index + 4] * scale, path[index + 6] * scale };
+			double error = 0.0;
+			double error_in = 0.0;
+			for (int s = 0; s <= SAMPLES; s++) {
+				double t = (double)s / SAMPLES;
+				double u = 1.0 - t;
+				double bx = (u * u * u * px[0]) + (3.0 * u * u * t * px[1]) + (3.0 * u * t * t * px[2]) +
+				            (t * t * t * px[3]);
+				double by = (u * u * u * py[0]) + (3.0 * u * u * t * py[1]) + (3.0 * u * t * t * py[2]) +
+				            (t * t * t * py[3]);
+				error = fmax(error, _get_radial_distance(bx, by, radius_out_w, radius_out_h));
+				if (0.0 < radius_in_w) {
+					error_in = fmax(error_in, _get_radial_distance(bx, by, radius_in_w, radius_in_h));
+				}
+			}
+			if (0.0 < radius_in_w) {
+				error = fmin(error, error_in);
+			}
+			ret.error = fmax(ret.error, error / DRAWING_SCALE_FACTOR);
+			ret.cubics++;
+			x = px[3];
+			y = py[3];
+			index += 7;
+		} else {
+			ret.valid = false;
+		}
+	}
+	return ret;
+}
+
+static void _init_path(vg_lite_path_t *path, size_t length) {
+	(void)memset(path, 0, sizeof(vg_lite_path_t));
+	(void)memset(path_data, 0, sizeof(path_data));
+	path->path = path_data;
+	path->path_length = (int32_t)length;
+}
+
+static void _check(const char *shape, int radius, path_check_t check, int length, size_t max_length,
+                   int max_cubics, double max_error) {
+	if (!check.valid) {
+		_error(shape, radius, "unknown command");
+	}
+	if (length > (int)max_length) {
+		_error(shape, radius, "%d bytes, the buffer holds %u bytes", length, (unsigned int)max_length);
+	}
+	if (check.cubics > max_cubics) {
+		_error(shape, radius, "%d cubic curves, expected at most %d", check.cubics, max_cubics);
+	}
+	if (check.error > max_error) {
+		_error(shape, radius, "radial distance %.3f pixel", check.error);
+	}
+}
+
+/*
+ * @brief Checks the outline of an ellipse (two ellipses in the same path, as the outlined
+ * ellipses are drawn) and returns the number of cubic curves of a whole ellipse.
+ */
+static path_check_t _check_ellipse(int radius_w, int radius_h) {
+	vg_lite_path_t path;
+	vglite_path_ellipse_t buffers[2];
+	_init_path(&path, sizeof(buffers));
+
+	int offset = UI_DRAWING_VGLITE_PATH_compute_ellipse(&path, 0, radius_w, radius_h, false);
+	path_check_t ret = _check_path(path_data, offset, 1.0, radius_w, radius_h, 0.0, 0.0);
+
+	int length = UI_DRAWING_VGLITE_PATH_compute_ellipse(&path, offset, radius_w - 2, radius_h - 2, true);
+	path_check_t check = _check_path(path_data, length, 1.0, radius_w, radius_h, radius_w - 2, radius_h - 2);
+	_check("ellipse", radius_w / 2, check, length, sizeof(buffers), 2 * (int)MEJ_VGLITE_PATH_ARC_MAX_SECTIONS,
+	       MAX_ERROR(1.0));
+	return ret;
+}
+
+static path_check_t _check_filled_ellipse(int radius_w, int radius_h) {
+	vg_lite_path_t path;
+	vg_lite_matrix_t matrix = { { { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, 0.f, 1.f } } };
+	_init_path(&path, 0);
+
+	(void)UI_DRAWING_VGLITE_PATH_compute_filled_ellipse(&path, radius_w, radius_h, &matrix);
+	// the path is a circle scaled by the matrix: the rounding of its points is scaled too
+	double scale = fmax(matrix.m[0][0], matrix.m[1][1]);
+	path_check_t check = _check_path((const int16_t *)path.path, path.path_length, scale, radius_w, radius_h, 0.0,
+	                                 0.0);
+	_check("filled ellipse", radius_w / 2, check, path.path_length, sizeof(vglite_path_ellipse_t),
+	       (int)MEJ_VGLITE_PATH_ARC_MAX_SECTIONS, MAX_ERROR(fmax(scale, 1.0)));
+	return check;
+}
+
+static void _check_ellipse_arc(int radius_w, int radius_h, float start_angle, float arc_angle, bool fill) {
+	vg_lite_path_t path;
+	vglite_path_ellipse_arc_t buffer;
+	_init_path(&path, sizeof(buffer));
+
+	int length = UI_DRAWING_VGLITE_PATH_compute_ellipse_arc(&path, radius_w, radius_h, radius_w - 2, radius_h - 2,
+	                                                        start_angle, arc_angle, fill);
+	path_check_t check = _check_path(path_data, length, 1.0, radius_w, radius_h, fill ? 0.0 : (radius_w - 2),
+	                                 radius_h - 2);
+	_check(fill ? "filled ellipse arc" : "ellipse arc", radius_w / 2, check, length, sizeof(buffer),
+	       2 * (int)MEJ_VGLITE_PATH_ARC_MAX_SECTIONS, MAX_ERROR(1.0));
+}
+
+static void _check_thick_ellipse_arc(int diameter_w, int diameter_h, int thickness, float start_angle,
+                                     float arc_angle) {
+	vg_lite_path_t path;
+	vglite_path_thick_ellipse_arc_t buffer;
+	_init_path(&path, sizeof(buffer));
+
+	(void)UI_DRAWING_VGLITE_PATH_compute_thick_shape_ellipse_arc(&path, diameter_w, diameter_h, thickness,
+	                                                             start_angle, arc_angle, 0);
+	int radius_out_w = (diameter_w + thickness) / 2;
+	int radius_out_h = (diameter_h + thickness) / 2;
+	int radius_in_w = ((diameter_w - thickness) / 2) - 1;
+	int radius_in_h = ((diameter_h - thickness) / 2) - 1;
+	path_check_t check = _check_path(path_data, path.path_length, 1.0, radius_out_w, radius_out_h, radius_in_w,
+	                                 radius_in_h);
+	_check("thick ellipse arc", radius_out_w / 2, check, path.path_length, sizeof(buffer),
+	       2 * (int)MEJ_VGLITE_PATH_ARC_MAX_SECTIONS, MAX_ERROR(1.0));
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	static const float arc_angles[] = { 30.f, 90.f, 135.f, 180.f, 270.f, 359.f, 360.f, -200.f };
+	int previous_cubics = 0;
+	int first_radius = MIN_RADIUS;
+	double max_error = 0.0;
+
+	(void)printf("radius (pixels)  cubic curves per ellipse\n");
+	for (int radius = MIN_RADIUS; radius <= MAX_RADIUS; radius++) {
+		// the paths are computed in the path unit (see DRAWING_SCALE_FACTOR)
+		int r = (int)(radius * DRAWING_SCALE_FACTOR);
+
+		path_check_t ellipse = _check_ellipse(r, r);
+		max_error = fmax(max_error, ellipse.error);
+		if (ellipse.cubics < previous_cubics) {
+			_error("ellipse", radius, "%d cubic curves, %d for a smaller radius", ellipse.cubics, previous_cubics);
+		}
+		if ((ellipse.cubics != previous_cubics) && (0 != previous_cubics)) {
+			(void)printf("%4d - %4d        %d\n", first_radius, radius - 1, previous_cubics);
+			first_radius = radius;
+		}
+		previous_cubics = ellipse.cubics;
+
+		(void)_check_ellipse(r, r / 2);
+		(void)_check_filled_ellipse(r, r);
+
+		for (uint32_t i = 0; i < (sizeof(arc_angles) / sizeof(arc_angles[0])); i++) {
+			float start_angle = (float)((radius * 37) % 360);
+			_check_ellipse_arc(r, r, start_angle, arc_angles[i], false);
+			_check_ellipse_arc(r, r, start_angle, arc_angles[i], true);
+			if (radius >= 4) {
+				_check_thick_ellipse_arc(2 * r, 2 * r, r / 2, start_angle, arc_angles[i]);
+			}
+		}
+	}
+	(void)printf("%4d - %4d        %d\n", first_radius, MAX_RADIUS, previous_cubics);
+	(void)printf("largest radial distance of the ellipses: %.3f pixel\n", max_error);
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,415 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host benchmark of the display list (see UI_FEATURE_DISPLAY_LIST): replays a trace of
+ * frames twice, once drawn directly and once through the display list, and compares the
+ * content of the display after each frame and the number of pixels written.
+ *
+ * The trace is the one of a dashboard: each frame, the application repaints all the widgets
+ * (a clip per widget); most of the widgets are static, a gauge and a counter change at
+ * each frame. Some frames contain a drawing that cannot be recorded (a drawing in the
+ * display buffer) or a drawing of the display buffer in an image. The next frames draw a
+ * page over the dashboard (an opaque fill that hides all the previous drawings), then the
+ * same frame again and again, first with two swapped buffers, then with a single buffer.
+ * After each frame, the numbers of culled drawings, of copied regions and of skipped
+ * regions are compared with the numbers expected for the frame.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DUI_FEATURE_DISPLAY_LIST -Iui/test/stubs -Iui/inc -Iutil/inc \
+ *		ui/test/display_list_benchmark.c ui/src/ui_display_list.c -o display_list_benchmark
+ *	./display_list_benchmark
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ui_display_list.h"
+#include "ui_display_brs.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+#define WIDTH (480)
+#define HEIGHT (272)
+#define DASHBOARD_FRAMES (600u)
+#define PAGE_FRAMES (100u)
+#define IDENTICAL_FRAMES (100u)
+#define SINGLE_BUFFER_FRAMES (100u)
+#define PAGE_START (DASHBOARD_FRAMES)
+#define IDENTICAL_START (PAGE_START + PAGE_FRAMES)
+#define SINGLE_BUFFER_START (IDENTICAL_START + IDENTICAL_FRAMES)
+#define FRAMES (SINGLE_BUFFER_START + SINGLE_BUFFER_FRAMES)
+#define WIDGETS_PER_ROW (4)
+#define WIDGETS_ROWS (3)
+#define WIDGETS (WIDGETS_PER_ROW * WIDGETS_ROWS)
+
+/*
+ * @brief The frame of the single buffer trace whose gauge differs from the other frames.
+ */
+#define SINGLE_BUFFER_CHANGE (SINGLE_BUFFER_START + 50u)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The drawing functions of a frame: the ones of the display list or the ones of
+ * the drawing engine.
+ */
+typedef struct {
+	DRAWING_Status (*fill)(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2);
+	DRAWING_Status (*rect)(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2);
+	DRAWING_Status (*hline)(MICROUI_GraphicsContext *gc, jint x1, jint x2, jint y);
+	DRAWING_Status (*vline)(MICROUI_GraphicsContext *gc, jint x, jint y1, jint y2);
+} drawings_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The two display buffers (swapped at each flush), the reference display and an
+ * image.
+ */
+static uint32_t buffers[2][WIDTH * HEIGHT];
+static uint32_t reference[WIDTH * HEIGHT];
+static uint32_t image[WIDTH * HEIGHT];
+
+static MICROUI_Image back_buffer_images[2];
+static uint32_t back_buffer;
+
+/*
+ * @brief true when the display has a single buffer: the previous frame is in the buffer
+ * drawn.
+ */
+static bool single_buffer;
+
+static uint64_t written_pixels;
+
+// --------------------------------------------------------------------------------
+// Graphics Engine stubs
+// --------------------------------------------------------------------------------
+
+MICROUI_Image * LLUI_DISPLAY_getSourceImage(MICROUI_Image *img) {
+	// the previous frame
+	bool swapped = !single_buffer && (img->data == (uint8_t *)buffers[back_buffer]);
+	return swapped ? &back_buffer_images[back_buffer ^ 1u] : img;
+}
+
+jboolean LLUI_DISPLAY_requestDrawing(MICROUI_GraphicsContext *gc, SNI_callback callback) {
+	(void)gc;
+	(void)callback;
+	return JTRUE;
+}
+
+void LLUI_DISPLAY_setDrawingStatus(DRAWING_Status status) {
+	(void)status;
+}
+
+// --------------------------------------------------------------------------------
+// Drawings stubs
+// --------------------------------------------------------------------------------
+
+static void _fill(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	if (LLUI_DISPLAY_isClipEnabled(gc)) {
+		x1 = MAX(x1, gc->clip.x1);
+		y1 = MAX(y1, gc->clip.y1);
+		x2 = MIN(x2, gc->clip.x2);
+		y2 = MIN(y2, gc->clip.y2);
+	}
+	uint32_t *pixels = (uint32_t *)LLUI_DISPLAY_getBufferAddress(&gc->image);
+	for (jint y = y1; y <= y2; y++) {
+		for (jint x = x1; x <= x2; x++) {
+			pixels[(y * gc->image.width) + x] = gc->foreground_color;
+		}
+	}
+	written_pixels += ((x1 <= x2) && (y1 <= y2)) ? (uint64_t)(x2 - x1 + 1) * (uint64_t)(y2 - y1 + 1) : 0u;
+}
+
+DRAWING_Status UI_DRAWING_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x1, jint x2, jint y) {
+	_fill(gc, x1, y, x2, y);
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DRAWING_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jint y1, jint y2) {
+	_fill(gc, x, y1, x, y2);
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DRAWING_drawRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	_fill(gc, x1, y1, x2, y1);
+	_fill(gc, x1, y2, x2, y2);
+	_fill(gc, x1, y1, x1, y2);
+	_fill(gc, x2, y1, x2, y2);
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DRAWING_fillRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	_fill(gc, x1, y1, x2, y2);
+	return DRAWING_DONE;
+}
+
+DRAWING_Status UI_DISPLAY_BRS_restore(MICROUI_GraphicsContext *gc, MICROUI_Image *old_back_buffer, ui_rect_t *rect) {
+	uint32_t *destination = (uint32_t *)LLUI_DISPLAY_getBufferAddress(&gc->image);
+	const uint32_t *source = (const uint32_t *)LLUI_DISPLAY_getBufferAddress(old_back_buffer);
+	for (jint y = rect->y1; y <= rect->y2; y++) {
+		(void)memcpy(&destination[(y * WIDTH) + rect->x1], &source[(y * WIDTH) + rect->x1],
+		             (size_t)UI_RECT_get_width(rect) * sizeof(uint32_t));
+	}
+	written_pixels += (uint64_t)UI_RECT_get_width(rect) * (uint64_t)UI_RECT_get_height(rect);
+	return DRAWING_DONE;
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static void _init_image(MICROUI_Image *img, uint32_t *pixels, uint8_t flags) {
+	img->width = WIDTH;
+	img->height = HEIGHT;
+	img->format = MICROUI_IMAGE_FORMAT_ARGB8888;
+	img->flags = flags;
+	img->stride = WIDTH * sizeof(uint32_t);
+	img->data = (uint8_t *)pixels;
+}
+
+static void _set_clip(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
+	gc->clip = UI_RECT_new_xyxy(x1, y1, x2, y2);
+	gc->clip_enabled = true;
+}
+
+/*
+ * @brief Draws the widgets of the dashboard, one clip per widget.
+ *
+ * @param[in] state the value of the gauge and of the counter.
+ *
+ * @return the number of drawings.
+ */
+static uint32_t _draw_dashboard(MICROUI_GraphicsContext *gc, const drawings_t *drawings, uint32_t state) {
+	const jint widget_width = WIDTH / WIDGETS_PER_ROW;
+	const jint widget_height = HEIGHT / WIDGETS_ROWS;
+	uint32_t ret = 0;
+
+	for (jint w = 0; w < WIDGETS; w++) {
+		jint x1 = (w % WIDGETS_PER_ROW) * widget_width;
+		jint y1 = (w / WIDGETS_PER_ROW) * widget_height;
+		jint x2 = x1 + widget_width - 1;
+		jint y2 = y1 + widget_height - 1;
+		_set_clip(gc, x1, y1, x2, y2);
+
+		gc->foreground_color = 0xff202020u + ((uint32_t)w * 0x00050505u);
+		(void)(*drawings->fill)(gc, x1, y1, x2, y2);
+		gc->foreground_color = 0xffc0c0c0u;
+		(void)(*drawings->rect)(gc, x1 + 2, y1 + 2, x2 - 2, y2 - 2);
+		ret += 2u;
+		for (jint l = y1 + 10; l < (y2 - 10); l += 12) {
+			(void)(*drawings->hline)(gc, x1 + 10, x2 - 10, l);
+			ret++;
+		}
+
+		if (0 == w) {
+			// gauge: its level changes at each frame
+			jint level = (jint)(state % (uint32_t)(widget_height - 20));
+			gc->foreground_color = 0xff00c000u;
+			(void)(*drawings->fill)(gc, x1 + 20, y2 - 10 - level, x1 + 40, y2 - 10);
+			ret++;
+		} else if (5 == w) {
+			// counter: a digit every 10 frames; its color also changes (same position)
+			gc->foreground_color = 0xff000000u | ((state / 10u) * 0x00102030u);
+			(void)(*drawings->vline)(gc, x1 + 60, y1 + 20, y2 - 20);
+			ret++;
+		} else {
+			// static widget
+		}
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Draws a page over the whole display: its background hides all the previous
+ * drawings.
+ */
+static void _draw_page(MICROUI_GraphicsContext *gc, const drawings_t *drawings, uint32_t color) {
+	_set_clip(gc, 0, 0, WIDTH - 1, HEIGHT - 1);
+	gc->foreground_color = color;
+	(void)(*drawings->fill)(gc, 0, 0, WIDTH - 1, HEIGHT - 1);
+	gc->foreground_color = 0xffffffffu;
+	(void)(*drawings->rect)(gc, 20, 20, WIDTH - 21, HEIGHT - 21);
+	(void)(*drawings->hline)(gc, 40, WIDTH - 41, 40);
+}
+
+/*
+ * @brief Draws a frame of the trace. The drawings are recorded or performed according to
+ * the functions (UI_DISPLAY_LIST_xxx or UI_DRAWING_xxx).
+ *
+ * @param[out] expected the numbers of culled drawings, of copied regions and of skipped
+ * regions expected for the frame (only the corresponding fields are set).
+ */
+static void _draw_frame(MICROUI_GraphicsContext *gc, uint32_t frame, bool display_list,
+                        UI_DISPLAY_LIST_statistics_t *expected) {
+	drawings_t drawings;
+	drawings.fill = display_list ? &UI_DISPLAY_LIST_fillRectangle : &UI_DRAWING_fillRectangle;
+	drawings.rect = display_list ? &UI_DISPLAY_LIST_drawRectangle : &UI_DRAWING_drawRectangle;
+	drawings.hline = display_list ? &UI_DISPLAY_LIST_drawHorizontalLine : &UI_DRAWING_drawHorizontalLine;
+	drawings.vline = display_list ? &UI_DISPLAY_LIST_drawVerticalLine : &UI_DRAWING_drawVerticalLine;
+
+	(void)memset(expected, 0, sizeof(UI_DISPLAY_LIST_statistics_t));
+
+	if (frame < PAGE_START) {
+		(void)_draw_dashboard(gc, &drawings, frame);
+
+		// the static widgets are copied from the previous frame when both frames are
+		// recorded; the counter too when it has not changed
+		uint32_t cycle = frame % 100u;
+		bool reused = (0u != frame) && (50u != cycle) && (51u != cycle) && (70u != cycle) && (71u != cycle);
+		if (reused) {
+			expected->copied_regions = (WIDGETS - 2u) + ((0u != (frame % 10u)) ? 1u : 0u);
+		}
+	} else if (frame < IDENTICAL_START) {
+		// the page hides all the widgets; its color changes in the middle of the trace
+		expected->culled = _draw_dashboard(gc, &drawings, frame);
+		_draw_page(gc, &drawings, 0xff000000u | (((frame - PAGE_START) / (PAGE_FRAMES / 2u)) * 0x00406080u));
+		bool reused = (PAGE_START != frame) && ((PAGE_START + (PAGE_FRAMES / 2u)) != frame);
+		expected->copied_regions = reused ? 1u : 0u;
+	} else if (frame < SINGLE_BUFFER_START) {
+		// the same frame: all the widgets are copied from the other buffer
+		(void)_draw_dashboard(gc, &drawings, 0u);
+		expected->copied_regions = (IDENTICAL_START != frame) ? WIDGETS : 0u;
+	} else {
+		// the same frame (except the gauge of one frame): the buffer already holds the widgets
+		uint32_t state = (SINGLE_BUFFER_CHANGE == frame) ? 1u : 0u;
+		(void)_draw_dashboard(gc, &drawings, state);
+		bool changed = (SINGLE_BUFFER_CHANGE == frame) || ((SINGLE_BUFFER_CHANGE + 1u) == frame);
+		expected->skipped_regions = changed ? (WIDGETS - 1u) : WIDGETS;
+	}
+
+	if ((frame < PAGE_START) && (50u == (frame % 100u))) {
+		// a drawing that cannot be recorded (for instance an antialiased shape)
+		if (display_list) {
+			(void)UI_DISPLAY_LIST_request_drawing(gc, NULL);
+		}
+		gc->foreground_color = 0xffff0000u;
+		(void)UI_DRAWING_fillRectangle(gc, gc->clip.x1, gc->clip.y1, gc->clip.x1 + 5, gc->clip.y1 + 5);
+	}
+
+	if ((frame < PAGE_START) && (70u == (frame % 100u))) {
+		// a copy of the display buffer in an image (for instance a screenshot)
+		MICROUI_GraphicsContext image_gc;
+		(void)memset(&image_gc, 0, sizeof(image_gc));
+		_init_image(&image_gc.image, image, 0u);
+		if (display_list) {
+			(void)UI_DISPLAY_LIST_request_image_drawing(&image_gc, &gc->image, NULL);
+		}
+		(void)memcpy(image, LLUI_DISPLAY_getBufferAddress(&gc->image), sizeof(image));
+	}
+}
+
+static double _now(void) {
+	struct timespec now;
+	(void)clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	MICROUI_GraphicsContext gc;
+	UI_DISPLAY_LIST_statistics_t expected;
+	uint32_t errors = 0;
+
+	_init_image(&back_buffer_images[0], buffers[0], LLUI_DISPLAY_STUB_FLAG_LCD);
+	_init_image(&back_buffer_images[1], buffers[1], LLUI_DISPLAY_STUB_FLAG_LCD);
+
+	// direct drawings: the reference content of each frame
+	(void)memset(&gc, 0, sizeof(gc));
+	_init_image(&gc.image, reference, LLUI_DISPLAY_STUB_FLAG_LCD);
+	written_pixels = 0;
+	double start = _now();
+	for (uint32_t frame = 0; frame < FRAMES; frame++) {
+		_draw_frame(&gc, frame, false, &expected);
+	}
+	double direct_time = _now() - start;
+	uint64_t direct_pixels = written_pixels;
+
+	// display list: the content and the statistics are compared with the reference after
+	// each frame
+	UI_DISPLAY_LIST_statistics_t statistics;
+	UI_DISPLAY_LIST_statistics_t previous;
+	UI_DISPLAY_LIST_get_statistics(&previous);
+	(void)memset(reference, 0, sizeof(reference)); // the page is drawn on the bottom rows
+	written_pixels = 0;
+	double list_time = 0.0;
+	for (uint32_t frame = 0; frame < FRAMES; frame++) {
+		(void)memset(&gc, 0, sizeof(gc));
+		gc.image = back_buffer_images[back_buffer];
+		single_buffer = (frame >= SINGLE_BUFFER_START);
+
+		start = _now();
+		_draw_frame(&gc, frame, true, &expected);
+		UI_DISPLAY_LIST_flush(&gc);
+		list_time += _now() - start;
+
+		// same frame drawn directly
+		MICROUI_GraphicsContext reference_gc;
+		(void)memset(&reference_gc, 0, sizeof(reference_gc));
+		_init_image(&reference_gc.image, reference, LLUI_DISPLAY_STUB_FLAG_LCD);
+		uint64_t pixels = written_pixels;
+		UI_DISPLAY_LIST_statistics_t ignored;
+		_draw_frame(&reference_gc, frame, false, &ignored);
+		written_pixels = pixels;
+
+		UI_DISPLAY_LIST_get_statistics(&statistics);
+		uint32_t culled = statistics.culled - previous.culled;
+		uint32_t copied = statistics.copied_regions - previous.copied_regions;
+		uint32_t skipped = statistics.skipped_regions - previous.skipped_regions;
+		previous = statistics;
+
+		bool content_error = (0 != memcmp(reference, buffers[back_buffer], sizeof(reference)));
+		bool statistics_error = (expected.culled != culled) || (expected.copied_regions != copied)
+		                        || (expected.skipped_regions != skipped);
+		if (content_error || statistics_error) {
+			if (0u == errors) {
+				(void)printf("frame %u differs from the reference (culled %u/%u, copied %u/%u, skipped %u/%u)\n",
+				             frame, culled, expected.culled, copied, expected.copied_regions, skipped,
+				             expected.skipped_regions);
+			}
+			errors++;
+		}
+
+		if ((frame + 1u) < SINGLE_BUFFER_START) {
+			back_buffer ^= 1u;
+		}
+	}
+
+	(void)printf("frames:             %u (%ux%u, %u widgets)\n", FRAMES, WIDTH, HEIGHT, WIDGETS);
+	(void)printf("direct:             %8.2f ms, %llu pixels written\n", direct_time,
+	             (unsigned long long)direct_pixels);
+	(void)printf("display list:       %8.2f ms, %llu pixels written\n", list_time,
+	             (unsigned long long)written_pixels);
+	(void)printf("recorded drawings:  %u\n", statistics.recorded);
+	(void)printf("culled drawings:    %u\n", statistics.culled);
+	(void)printf("copied regions:     %u\n", statistics.copied_regions);
+	(void)printf("skipped regions:    %u\n", statistics.skipped_regions);
+	(void)printf("unrecorded frames:  %u\n", statistics.unrecorded_frames);
+	(void)printf("frames in error:    %u\n", errors);
+
+	return (0u == errors) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the display rotation (display_rotation.h, DISPLAY_ROTATION): checks the placement of the logical
+ * buffer after the frame buffers, compares the mapping of the logical coordinates on the panel coordinates (and back,
+ * for the touch events) with a reference built from clockwise quarter turns, then replays frames of random dirty
+ * regions: each region of the logical buffer is blitted into a host frame buffer with the matrix of the port
+ * (DISPLAY_ROTATION_get_blit_matrix()) by a CPU stand-in of vg_lite_blit_rect() (point sampling at the pixel centers)
+ * and the frame buffer is compared pixel per pixel with a CPU reference rotation of the whole logical buffer.
+ *
+ * Build and run from bsp/vee/port, once per rotation (see README.rst):
+ *
+ *	gcc -O2 -DDISPLAY_ROTATION=90 -Iui/test/stubs -Iui/inc -I../../sdk_overlay/middleware/vglite/inc \
+ *		ui/test/display_rotation_test.c -o display_rotation_test
+ *	./display_rotation_test
+ *	gcc -O2 -DDISPLAY_ROTATION=180 -Iui/test/stubs -Iui/inc -I../../sdk_overlay/middleware/vglite/inc \
+ *		ui/test/display_rotation_test.c -o display_rotation_test
+ *	./display_rotation_test
+ *	gcc -O2 -DDISPLAY_ROTATION=270 -Iui/test/stubs -Iui/inc -I../../sdk_overlay/middleware/vglite/inc \
+ *		ui/test/display_rotation_test.c -o display_rotation_test
+ *	./display_rotation_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display_rotation.h"
+
+#if (0 == DISPLAY_ROTATION)
+#error "Build the test with DISPLAY_ROTATION set to 90, 180 or 270"
+#endif
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Number of frames to replay.
+ */
+#define FRAME_COUNT (60u)
+
+/*
+ * @brief Maximum number of dirty regions per frame.
+ */
+#define REGION_MAX_COUNT (4u)
+
+/*
+ * @brief Size of a XRGB8888 frame buffer of the panel (see FRAME_BUFFER_SIZE).
+ */
+#define XRGB8888_FRAME_BUFFER_SIZE ALIGN(FRAME_BUFFER_WIDTH * 4 * FRAME_BUFFER_HEIGHT, FRAME_BUFFER_ALIGN)
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static uint32_t errors;
+
+/*
+ * @brief The logical buffer MicroUI draws into, the frame buffer updated by the blits of the
+ * dirty regions and the reference rotation of the logical buffer.
+ */
+static framebuffer_pixel_t logical_buffer[LOGICAL_BUFFER_HEIGHT][LOGICAL_BUFFER_WIDTH];
+static framebuffer_pixel_t frame_buffer[FRAME_BUFFER_HEIGHT][FRAME_BUFFER_WIDTH];
+static framebuffer_pixel_t reference[FRAME_BUFFER_HEIGHT][FRAME_BUFFER_WIDTH];
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Gets the reference position of a pixel of the logical buffer on the panel: the
+ * logical buffer is turned clockwise by a quarter turn DISPLAY_ROTATION / 90 times (a
+ * quarter turn moves the pixel (x, y) of a w x h buffer to the pixel (h - 1 - y, x) of a
+ * h x w buffer).
+ */
+static void _get_reference_panel_point(int32_t x, int32_t y, int32_t *panel_x, int32_t *panel_y) {
+	int32_t width = LOGICAL_BUFFER_WIDTH;
+	int32_t height = LOGICAL_BUFFER_HEIGHT;
+	for (uint32_t turn = 0; turn < (uint32_t)(DISPLAY_ROTATION / 90); turn++) {
+		int32_t turned_x = height - 1 - y;
+		y = x;
+		x = turned_x;
+		int32_t turned_width = height;
+		height = width;
+		width = turned_width;
+	}
+	*panel_x = x;
+	*panel_y = y;
+}
+
+static void _check_placement(void) {
+	(void)printf("rotation %u: %u frame buffers of 0x%x bytes at 0x%x, logical buffer %ux%u at 0x%x, 0x%x bytes left\n",
+	             DISPLAY_ROTATION, FRAME_BUFFER_COUNT, FRAME_BUFFER_SIZE, FRAME_BUFFER_START_ADDRESS,
+	             LOGICAL_BUFFER_WIDTH, LOGICAL_BUFFER_HEIGHT, LOGICAL_BUFFER_ADDRESS,
+	             FRAME_BUFFER_END_ADDRESS - (LOGICAL_BUFFER_ADDRESS + LOGICAL_BUFFER_SIZE));
+
+	bool turned = (90 == DISPLAY_ROTATION) || (270 == DISPLAY_ROTATION);
+	if ((LOGICAL_BUFFER_WIDTH != (turned ? FRAME_BUFFER_HEIGHT : FRAME_BUFFER_WIDTH))
+	    || (LOGICAL_BUFFER_HEIGHT != (turned ? FRAME_BUFFER_WIDTH : FRAME_BUFFER_HEIGHT))) {
+		(void)printf("wrong size of the logical buffer\n");
+		errors++;
+	}
+	if ((LOGICAL_BUFFER_SIZE < (LOGICAL_BUFFER_STRIDE_BYTE * LOGICAL_BUFFER_HEIGHT))
+	    || (LOGICAL_BUFFER_STRIDE_BYTE < (LOGICAL_BUFFER_WIDTH * FRAME_BUFFER_BYTE_PER_PIXEL))) {
+		(void)printf("logical buffer smaller than its pixels\n");
+		errors++;
+	}
+	if (0u != (LOGICAL_BUFFER_ADDRESS % FRAME_BUFFER_ALIGN)) {
+		(void)printf("logical buffer not aligned\n");
+		errors++;
+	}
+	if (LOGICAL_BUFFER_ADDRESS < (FRAME_BUFFER_ADDRESS(FRAME_BUFFER_COUNT - 1) + FRAME_BUFFER_SIZE)) {
+		(void)printf("logical buffer over the last frame buffer\n");
+		errors++;
+	}
+	if ((LOGICAL_BUFFER_ADDRESS + LOGICAL_BUFFER_SIZE) > FRAME_BUFFER_END_ADDRESS) {
+		(void)printf("logical buffer after the end of the frame buffers area\n");
+		errors++;
+	}
+
+	// the limits documented next to DISPLAY_ROTATION: three RGB565 frame buffers at most, no
+	// XRGB8888 frame buffers
+	uint32_t area_size = FRAME_BUFFER_END_ADDRESS - FRAME_BUFFER_START_ADDRESS;
+	if ((2 == FRAME_BUFFER_BYTE_PER_PIXEL) && (((4u * FRAME_BUFFER_SIZE) + LOGICAL_BUFFER_SIZE) <= area_size)) {
+		(void)printf("more than three RGB565 frame buffers fit with the logical buffer\n");
+		errors++;
+	}
+	if ((3u * XRGB8888_FRAME_BUFFER_SIZE) <= area_size) {
+		(void)printf("two XRGB8888 frame buffers fit with the logical buffer\n");
+		errors++;
+	}
+}
+
+static void _check_mapping(void) {
+	// the top-left pixel of the logical buffer (see display_rotation.h)
+	int32_t corner_x;
+	int32_t corner_y;
+	DISPLAY_ROTATION_get_panel_point(0, 0, &corner_x, &corner_y);
+	int32_t expected_corner_x = (180 == DISPLAY_ROTATION) || (90 == DISPLAY_ROTATION) ? FRAME_BUFFER_WIDTH - 1 : 0;
+	int32_t expected_corner_y = (180 == DISPLAY_ROTATION) || (270 == DISPLAY_ROTATION) ? FRAME_BUFFER_HEIGHT - 1 : 0;
+	if ((expected_corner_x != corner_x) || (expected_corner_y != corner_y)) {
+		(void)printf("top-left pixel displayed at %d,%d instead of %d,%d\n", corner_x, corner_y, expected_corner_x,
+		             expected_corner_y);
+		errors++;
+	}
+
+	uint32_t mapping_errors = 0;
+	for (int32_t y = 0; y < LOGICAL_BUFFER_HEIGHT; y++) {
+		for (int32_t x = 0; x < LOGICAL_BUFFER_WIDTH; x++) {
+			int32_t panel_x;
+			int32_t panel_y;
+			int32_t reference_x;
+			int32_t reference_y;
+			int32_t logical_x;
+			int32_t logical_y;
+			DISPLAY_ROTATION_get_panel_point(x, y, &panel_x, &panel_y);
+			_get_reference_panel_point(x, y, &reference_x, &reference_y);
+			DISPLAY_ROTATION_get_logical_point(reference_x, reference_y, &logical_x, &logical_y);
+			if ((panel_x != reference_x) || (panel_y != reference_y) || (logical_x != x) || (logical_y != y)) {
+				if (0u == mapping_errors) {
+					(void)printf("pixel %d,%d: panel %d,%d instead of %d,%d, touch %d,%d\n", x, y, panel_x, panel_y,
+					             reference_x, reference_y, logical_x, logical_y);
+				}
+				mapping_errors++;
+			}
+		}
+	}
+	errors += mapping_errors;
+}
+
+/*
+ * @brief Rotates the whole logical buffer in the reference frame buffer.
+ */
+static void _rotate_reference(void) {
+	for (int32_t y = 0; y < LOGICAL_BUFFER_HEIGHT; y++) {
+		for (int32_t x = 0; x < LOGICAL_BUFFER_WIDTH; x++) {
+			int32_t panel_x;
+			int32_t panel_y;
+			_get_reference_panel_point(x, y, &panel_x, &panel_y);
+			reference[panel_y][panel_x] = logical_buffer[y][x];
+		}
+	}
+}
+
+/*
+ * @brief CPU stand-in of vg_lite_blit_rect() with VG_LITE_FILTER_POINT and VG_LITE_BLEND_NONE:
+ * each pixel of the frame buffer whose center is the image of a point of the region by the
+ * matrix gets the pixel of the region under this point.
+ */
+static void _blit(const ui_rect_t *area) {
+	vg_lite_matrix_t matrix;
+	DISPLAY_ROTATION_get_blit_matrix(area, &matrix);
+	const vg_lite_float_t (*m)[3] = matrix.m;
+
+	if ((0.f != m[2][0]) || (0.f != m[2][1]) || (1.f != m[2][2])) {
+		(void)printf("blit matrix not affine\n");
+		errors++;
+		return;
+	}
+
+	// the inverse of the matrix maps the frame buffer on the region
+	double determinant = ((double)m[0][0] * m[1][1]) - ((double)m[0][1] * m[1][0]);
+	if (0.0 == determinant) {
+		(void)printf("blit matrix not invertible\n");
+		errors++;
+		return;
+	}
+
+	int32_t width = UI_RECT_get_width(area);
+	int32_t height = UI_RECT_get_height(area);
+	for (int32_t y = 0; y < FRAME_BUFFER_HEIGHT; y++) {
+		for (int32_t x = 0; x < FRAME_BUFFER_WIDTH; x++) {
+			double dx = ((double)x + 0.5) - m[0][2];
+			double dy = ((double)y + 0.5) - m[1][2];
+			double u = ((m[1][1] * dx) - (m[0][1] * dy)) / determinant;
+			double v = ((m[0][0] * dy) - (m[1][0] * dx)) / determinant;
+			if ((0.0 <= u) && (u < (double)width) && (0.0 <= v) && (v < (double)height)) {
+				frame_buffer[y][x] = logical_buffer[area->y1 + (int32_t)floor(v)][area->x1 + (int32_t)floor(u)];
+			}
+		}
+	}
+}
+
+static ui_rect_t _get_random_region(uint32_t frame, uint32_t index) {
+	ui_rect_t ret;
+	if ((0u == frame) && (0u == index)) {
+		// the first frame is fully drawn
+		ret = UI_RECT_new_xyxy(0, 0, LOGICAL_BUFFER_WIDTH - 1, LOGICAL_BUFFER_HEIGHT - 1);
+	} else if (1u == index) {
+		// a single pixel on a border
+		int32_t x = rand() % LOGICAL_BUFFER_WIDTH;
+		ret = UI_RECT_new_xyxy(x, LOGICAL_BUFFER_HEIGHT - 1, x, LOGICAL_BUFFER_HEIGHT - 1);
+	} else {
+		int32_t x1 = rand() % LOGICAL_BUFFER_WIDTH;
+		int32_t y1 = rand() % LOGICAL_BUFFER_HEIGHT;
+		int32_t x2 = x1 + (rand() % (LOGICAL_BUFFER_WIDTH - x1));
+		int32_t y2 = y1 + (rand() % (LOGICAL_BUFFER_HEIGHT - y1));
+		ret = UI_RECT_new_xyxy(x1, y1, x2, y2);
+	}
+	return ret;
+}
+
+static void _test_frames(void) {
+	for (uint32_t frame = 0; frame < FRAME_COUNT; frame++) {
+		// the drawings of the frame: new pixels in some regions of the logical buffer
+		ui_rect_t regions[REGION_MAX_COUNT];
+		uint32_t count = 1u + ((uint32_t)rand() % REGION_MAX_COUNT);
+		for (uint32_t r = 0; r < count; r++) {
+			regions[r] = _get_random_region(frame, r);
+			for (int32_t y = regions[r].y1; y <= regions[r].y2; y++) {
+				for (int32_t x = regions[r].x1; x <= regions[r].x2; x++) {
+					logical_buffer[y][x] = (framebuffer_pixel_t)rand();
+				}
+			}
+		}
+
+		// the flush: one blit per dirty region
+		for (uint32_t r = 0; r < count; r++) {
+			_blit(&regions[r]);
+		}
+
+		_rotate_reference();
+		uint32_t pixel_errors = 0;
+		for (int32_t y = 0; y < FRAME_BUFFER_HEIGHT; y++) {
+			for (int32_t x = 0; x < FRAME_BUFFER_WIDTH; x++) {
+				if (frame_buffer[y][x] != reference[y][x]) {
+					if (0u == pixel_errors) {
+						(void)printf("frame %u: pixel %d,%d is 0x%x instead of 0x%x\n", frame, x, y,
+						             (uint32_t)frame_buffer[y][x], (uint32_t)reference[y][x]);
+					}
+					pixel_errors++;
+				}
+			}
+		}
+		errors += pixel_errors;
+	}
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	srand(45);
+
+	_check_placement();
+	_check_mapping();
+	_test_frames();
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,556 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the cache of the converted images (ui_vglite_format_cache.c, VGLITE_FORMAT_CACHE): checks the
+ * CLUTs of the indexed formats (A1, A2, C1, C2, C4 read as INDEX_1, INDEX_2 and INDEX_4) by expanding some random
+ * indexed images with the CLUTs and with the MicroUI definitions of the formats, then replays a random sequence of
+ * drawings, loadings and closings of RGB888 and compressed images. After each operation, the statistics of the cache
+ * (hits, conversions, evictions, entries, memory) are compared with a model of the LRU policy and the pixels of a
+ * drawn image are compared with the source pixels (RGB888 converted in XRGB8888, compressed images decoded).
+ *
+ * The GPU memory is a host stand-in implemented below (vg_lite_allocate() and vg_lite_free()); it can be made to
+ * fail once to check that the cache releases all its images.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DVG_DRIVER_SINGLE_THREAD -DUI_FEATURE_IMAGE_CUSTOM_FORMATS -Iui/test/stubs -Iui/inc -Iui_vglite/inc \
+ *		-I../../sdk_overlay/middleware/vglite/inc ui/test/format_cache_test.c ui_vglite/src/ui_vglite_format_cache.c \
+ *		ui/src/ui_image_compressed.c ui/src/ui_pixel_kernels.c -o format_cache_test
+ *	./format_cache_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui_vglite_format_cache.h"
+#include "ui_vglite.h"
+#include "ui_image_compressed.h"
+#include "ui_configuration.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The images of the sequence: RGB888 images (large and small ones), compressed images and an RGB888 image
+ * larger than the cache.
+ */
+#define RGB888_IMAGES (20u)
+#define COMPRESSED_IMAGES (6u)
+#define IMAGES (RGB888_IMAGES + COMPRESSED_IMAGES + 1u)
+#define TOO_LARGE_IMAGE (IMAGES - 1u)
+
+/*
+ * @brief Number of operations of the sequence; the GPU memory fails once in the middle of the sequence.
+ */
+#define OPERATIONS (5000u)
+#define ALLOCATION_FAILURE_OPERATION (OPERATIONS / 2u)
+
+/*
+ * @brief Size of the indexed images.
+ */
+#define INDEXED_WIDTH (37)
+#define INDEXED_HEIGHT (11)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+typedef struct {
+	MICROUI_Image image;
+
+	/*
+	 * @brief RGB888 pixels or RGB565 pixels of a compressed image.
+	 */
+	uint8_t *pixels;
+
+	/*
+	 * @brief Bytes of the converted pixels.
+	 */
+	uint32_t bytes;
+
+	/*
+	 * @brief State of the image in the model of the cache.
+	 */
+	bool cached;
+	uint32_t last_use;
+} test_image_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static test_image_t images[IMAGES];
+
+/*
+ * @brief The model of the cache.
+ */
+static UI_VGLITE_FORMAT_CACHE_statistics_t expected;
+static uint32_t model_clock;
+
+/*
+ * @brief The GPU memory stand-in.
+ */
+static uint32_t gpu_memory_used;
+static bool allocation_failure;
+
+static uint32_t errors;
+
+// --------------------------------------------------------------------------------
+// Stubs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Allocates the buffer as the VGLite driver does: stride aligned on 16 pixels.
+ */
+vg_lite_error_t vg_lite_allocate(vg_lite_buffer_t *buffer) {
+	vg_lite_error_t ret = VG_LITE_OUT_OF_MEMORY;
+	if (!allocation_failure) {
+		uint32_t bpp = (VG_LITE_RGB565 == buffer->format) ? 2u : 4u;
+		buffer->stride = (int32_t)((((uint32_t)buffer->width + 15u) & ~(uint32_t)15u) * bpp);
+		buffer->memory = malloc((uint32_t)buffer->stride * (uint32_t)buffer->height);
+		buffer->address = 0u;
+		gpu_memory_used += (uint32_t)buffer->stride * (uint32_t)buffer->height;
+		ret = VG_LITE_SUCCESS;
+	}
+	allocation_failure = false;
+	return ret;
+}
+
+vg_lite_error_t vg_lite_free(vg_lite_buffer_t *buffer) {
+	gpu_memory_used -= (uint32_t)buffer->stride * (uint32_t)buffer->height;
+	free(buffer->memory);
+	buffer->memory = NULL;
+	return VG_LITE_SUCCESS;
+}
+
+void UI_VGLITE_flush_batch(void) {
+	// no batched drawing
+}
+
+void UI_VGLITE_IMPL_error(bool critical, const char *format, ...) {
+	(void)critical;
+	va_list args;
+	va_start(args, format);
+	(void)vprintf(format, args);
+	va_end(args);
+	(void)printf("\n");
+	errors++;
+}
+
+// --------------------------------------------------------------------------------
+// Indexed formats
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Gets the color of an indexed pixel as defined by MicroUI: the A1 and A2 pixels are the alpha of the
+ * foreground color (white), the C1, C2 and C4 pixels are gray levels.
+ */
+static uint32_t _get_reference_color(MICROUI_ImageFormat format, uint32_t index, bool premultiplied) {
+	static const uint8_t levels_1[] = { 0x00u, 0xffu };
+	static const uint8_t levels_2[] = { 0x00u, 0x55u, 0xaau, 0xffu };
+	uint32_t level;
+	bool alpha;
+
+	switch (format) {
+	case MICROUI_IMAGE_FORMAT_A1:
+		level = levels_1[index];
+		alpha = true;
+		break;
+	case MICROUI_IMAGE_FORMAT_A2:
+		level = levels_2[index];
+		alpha = true;
+		break;
+	case MICROUI_IMAGE_FORMAT_C1:
+		level = levels_1[index];
+		alpha = false;
+		break;
+	case MICROUI_IMAGE_FORMAT_C2:
+		level = levels_2[index];
+		alpha = false;
+		break;
+	default:
+		// C4: 0x00, 0x11, ..., 0xff
+		level = index * 0x11u;
+		alpha = false;
+		break;
+	}
+
+	uint32_t ret;
+	if (!alpha) {
+		ret = 0xff000000u | (level * 0x010101u);
+	} else if (premultiplied) {
+		ret = (level << 24) | (level * 0x010101u);
+	} else {
+		ret = (level << 24) | 0xffffffu;
+	}
+	return ret;
+}
+
+/*
+ * @brief Expands a random indexed image with the CLUT (as the GPU stand-in reads an INDEX_1, INDEX_2 or INDEX_4 image:
+ * the pixels are packed from the least significant bits) and compares the colors with the MicroUI definitions.
+ */
+static void _test_clut(MICROUI_ImageFormat format, uint32_t bpp, bool premultiplied) {
+	uint32_t clut[UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS];
+	uint32_t count = UI_VGLITE_FORMAT_CACHE_get_clut(format, premultiplied, clut);
+	if (((uint32_t)1 << bpp) != count) {
+		(void)printf("format %d: %u colors\n", format, count);
+		errors++;
+		return;
+	}
+
+	uint32_t stride = (((uint32_t)INDEXED_WIDTH * bpp) + 7u) / 8u;
+	uint8_t pixels[INDEXED_HEIGHT][((INDEXED_WIDTH * 4) + 7) / 8];
+	for (uint32_t y = 0; y < (uint32_t)INDEXED_HEIGHT; y++) {
+		for (uint32_t i = 0; i < stride; i++) {
+			pixels[y][i] = (uint8_t)rand();
+		}
+	}
+
+	uint32_t clut_errors = 0;
+	for (uint32_t y = 0; y < (uint32_t)INDEXED_HEIGHT; y++) {
+		for (uint32_t x = 0; x < (uint32_t)INDEXED_WIDTH; x++) {
+			uint32_t bit = x * bpp;
+			uint32_t index = ((uint32_t)pixels[y][bit / 8u] >> (bit % 8u)) & (count - 1u);
+			uint32_t color = clut[index];
+			uint32_t reference = _get_reference_color(format, index, premultiplied);
+			if (color != reference) {
+				if (0u == clut_errors) {
+					(void)printf("format %d (premultiplied %d): index %u is 0x%08x instead of 0x%08x\n", format,
+					             premultiplied, index, color, reference);
+				}
+				clut_errors++;
+			}
+		}
+	}
+	errors += clut_errors;
+}
+
+// --------------------------------------------------------------------------------
+// Images
+// --------------------------------------------------------------------------------
+
+static void _create_rgb888_image(test_image_t *image, uint32_t width, uint32_t height) {
+	// odd stride: the source rows are not aligned
+	uint32_t stride = (width * 3u) + 1u;
+	image->pixels = malloc(stride * height);
+	for (uint32_t i = 0; i < (stride * height); i++) {
+		image->pixels[i] = (uint8_t)rand();
+	}
+	image->image.width = (jchar)width;
+	image->image.height = (jchar)height;
+	image->image.format = MICROUI_IMAGE_FORMAT_RGB888;
+	image->image.stride = stride;
+	image->image.data = image->pixels;
+	image->bytes = ((width + 15u) & ~15u) * 4u * height;
+}
+
+static void _create_compressed_image(test_image_t *image, uint32_t width, uint32_t height) {
+	// RGB565 pixels with runs
+	uint32_t stride = width * 2u;
+	image->pixels = malloc(stride * height);
+	uint16_t *pixels = (uint16_t *)image->pixels;
+	uint16_t color = 0u;
+	for (uint32_t i = 0; i < (width * height); i++) {
+		if (0 == (rand() % 8)) {
+			color = (uint16_t)rand();
+		}
+		pixels[i] = color;
+	}
+
+	uint32_t max_size = UI_IMAGE_COMPRESSED_get_max_size(width, height, UI_IMAGE_COMPRESSED_ENCODING_RLE,
+	                                                     UI_IMAGE_COMPRESSED_FORMAT_RGB565);
+	uint8_t *encoded = malloc(max_size);
+	if (0u == UI_IMAGE_COMPRESSED_encode(image->pixels, stride, width, height, UI_IMAGE_COMPRESSED_ENCODING_RLE,
+	                                     UI_IMAGE_COMPRESSED_FORMAT_RGB565, encoded, max_size)) {
+		(void)printf("cannot encode a %ux%u image\n", width, height);
+		errors++;
+	}
+	image->image.width = (jchar)width;
+	image->image.height = (jchar)height;
+	image->image.format = (jbyte)UI_IMAGE_FORMAT_COMPRESSED;
+	image->image.stride = 0u;
+	image->image.data = encoded;
+	image->bytes = ((width + 15u) & ~15u) * 2u * height;
+}
+
+static bool _is_compressed(const test_image_t *image) {
+	return UI_IMAGE_FORMAT_COMPRESSED == (MICROUI_ImageFormat)(uint8_t)image->image.format;
+}
+
+/*
+ * @brief Compares the converted pixels given by the cache with the source pixels.
+ */
+static void _check_pixels(const test_image_t *image, const vg_lite_buffer_t *buffer) {
+	uint32_t width = image->image.width;
+	uint32_t height = image->image.height;
+	bool compressed = _is_compressed(image);
+	vg_lite_buffer_format_t format = compressed ? VG_LITE_RGB565 : VG_LITE_RGBX8888;
+
+	if ((format != buffer->format) || ((int32_t)width != buffer->width) || ((int32_t)height != buffer->height)) {
+		(void)printf("%ux%u image: buffer %dx%d, format %d\n", width, height, buffer->width, buffer->height,
+		             buffer->format);
+		errors++;
+		return;
+	}
+
+	uint32_t pixel_errors = 0;
+	for (uint32_t y = 0; y < height; y++) {
+		const uint8_t *row = &((const uint8_t *)buffer->memory)[y * (uint32_t)buffer->stride];
+		for (uint32_t x = 0; x < width; x++) {
+			uint32_t pixel;
+			uint32_t reference;
+			if (compressed) {
+				pixel = ((const uint16_t *)row)[x];
+				reference = ((const uint16_t *)image->pixels)[(y * width) + x];
+			} else {
+				const uint8_t *bgr = &image->pixels[(y * image->image.stride) + (x * 3u)];
+				pixel = ((const uint32_t *)row)[x];
+				reference = 0xff000000u | ((uint32_t)bgr[2] << 16) | ((uint32_t)bgr[1] << 8) | bgr[0];
+			}
+			if (pixel != reference) {
+				if (0u == pixel_errors) {
+					(void)printf("%ux%u image: pixel (%u,%u) is 0x%x instead of 0x%x\n", width, height, x, y, pixel,
+					             reference);
+				}
+				pixel_errors++;
+			}
+		}
+	}
+	errors += pixel_errors;
+}
+
+// --------------------------------------------------------------------------------
+// Model of the cache
+// --------------------------------------------------------------------------------
+
+static void _model_remove(test_image_t *image) {
+	image->cached = false;
+	expected.entries--;
+	expected.memory_used -= image->bytes;
+}
+
+/*
+ * @brief Converts an image in the model: evicts the least recently used images until the image fits.
+ *
+ * @return false when the image is larger than the cache.
+ */
+static bool _model_convert(test_image_t *image, bool allocated) {
+	bool ret = false;
+	if (image->bytes <= (uint32_t)VGLITE_FORMAT_CACHE) {
+		bool full = true;
+		while (full && ((expected.entries >= (uint32_t)VGLITE_FORMAT_CACHE_ENTRIES) ||
+		                ((expected.memory_used + image->bytes) > (uint32_t)VGLITE_FORMAT_CACHE))) {
+			test_image_t *lru = NULL;
+			for (uint32_t i = 0; i < IMAGES; i++) {
+				if (images[i].cached && ((NULL == lru) || (images[i].last_use < lru->last_use))) {
+					lru = &images[i];
+				}
+			}
+			if (NULL != lru) {
+				_model_remove(lru);
+				expected.evictions++;
+			} else {
+				// the model differs from the cache (error already reported)
+				full = false;
+			}
+		}
+
+		if (allocated) {
+			image->cached = true;
+			image->last_use = model_clock;
+			expected.conversions++;
+			expected.entries++;
+			expected.memory_used += image->bytes;
+			ret = true;
+		} else {
+			// the GPU memory is full: the cache releases all its images
+			for (uint32_t i = 0; i < IMAGES; i++) {
+				if (images[i].cached) {
+					_model_remove(&images[i]);
+				}
+			}
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Gets the image in the model (UI_VGLITE_FORMAT_CACHE_configure_source() and
+ * UI_VGLITE_FORMAT_CACHE_load_image()).
+ *
+ * @param[in] convert false when the image is only looked for (compressed image drawn without loading).
+ */
+static bool _model_use(test_image_t *image, bool convert, bool allocated) {
+	bool ret;
+	model_clock++;
+	if (image->cached) {
+		image->last_use = model_clock;
+		expected.hits++;
+		ret = true;
+	} else if (convert) {
+		ret = _model_convert(image, allocated);
+	} else {
+		ret = false;
+	}
+	return ret;
+}
+
+static void _check_statistics(uint32_t operation) {
+	UI_VGLITE_FORMAT_CACHE_statistics_t statistics;
+	UI_VGLITE_FORMAT_CACHE_get_statistics(&statistics);
+	if (0 != memcmp(&statistics, &expected, sizeof(statistics))) {
+		(void)printf("operation %u: hits %u/%u, conversions %u/%u, evictions %u/%u, entries %u/%u, memory %u/%u\n",
+		             operation, statistics.hits, expected.hits, statistics.conversions, expected.conversions,
+		             statistics.evictions, expected.evictions, statistics.entries, expected.entries,
+		             statistics.memory_used, expected.memory_used);
+		errors++;
+		// continue from the cache state
+		expected = statistics;
+	}
+	if ((gpu_memory_used != statistics.memory_used) || (statistics.memory_used > (uint32_t)VGLITE_FORMAT_CACHE)) {
+		(void)printf("operation %u: GPU memory %u, cache memory %u\n", operation, gpu_memory_used,
+		             statistics.memory_used);
+		errors++;
+	}
+}
+
+// --------------------------------------------------------------------------------
+// Sequence
+// --------------------------------------------------------------------------------
+
+static void _draw(test_image_t *image, uint32_t operation) {
+	bool allocated = ALLOCATION_FAILURE_OPERATION != operation;
+	allocation_failure = !allocated;
+
+	bool expected_ret;
+	bool compressed = _is_compressed(image);
+	if (compressed && (0 == (rand() % 2))) {
+		// on demand decoding (see ui_image_drawing_compressed_vglite.c)
+		bool loaded = _model_use(image, true, allocated);
+		if (loaded != UI_VGLITE_FORMAT_CACHE_load_image(&image->image)) {
+			(void)printf("operation %u: load_image() returns %d\n", operation, !loaded);
+			errors++;
+		}
+	}
+
+	expected_ret = _model_use(image, !compressed, allocated);
+	vg_lite_buffer_t buffer;
+	(void)memset(&buffer, 0, sizeof(buffer));
+	bool ret = UI_VGLITE_FORMAT_CACHE_configure_source(&buffer, &image->image);
+	if (ret != expected_ret) {
+		(void)printf("operation %u: configure_source() returns %d\n", operation, ret);
+		errors++;
+	} else if (ret) {
+		_check_pixels(image, &buffer);
+	} else {
+		// image not converted
+	}
+
+	if (UI_VGLITE_FORMAT_CACHE_is_image_loaded(&image->image) != image->cached) {
+		(void)printf("operation %u: is_image_loaded() returns %d\n", operation, !image->cached);
+		errors++;
+	}
+	allocation_failure = false;
+}
+
+static void _test_sequence(void) {
+	for (uint32_t i = 0; i < RGB888_IMAGES; i++) {
+		// large images (the memory is the limit) and small images (the number of entries is the limit)
+		uint32_t max = (0u == (i % 2u)) ? 300u : 24u;
+		_create_rgb888_image(&images[i], 1u + ((uint32_t)rand() % max), 1u + ((uint32_t)rand() % (max * 2u / 3u)));
+	}
+	for (uint32_t i = RGB888_IMAGES; i < TOO_LARGE_IMAGE; i++) {
+		_create_compressed_image(&images[i], 1u + ((uint32_t)rand() % 200u), 1u + ((uint32_t)rand() % 100u));
+	}
+	_create_rgb888_image(&images[TOO_LARGE_IMAGE], 400u, 400u);
+
+	for (uint32_t operation = 0; operation < OPERATIONS; operation++) {
+		test_image_t *image = &images[(uint32_t)rand() % IMAGES];
+		if (ALLOCATION_FAILURE_OPERATION == operation) {
+			// an RGB888 image to convert: the GPU memory fails
+			uint32_t i = 0;
+			while ((i < (RGB888_IMAGES - 1u)) && images[i].cached) {
+				i++;
+			}
+			_draw(&images[i], operation);
+			if (0u != expected.entries) {
+				(void)printf("GPU memory full: %u entries\n", expected.entries);
+				errors++;
+			}
+		} else if (0 == (rand() % 20)) {
+			// the image is closed
+			if (image->cached) {
+				_model_remove(image);
+			}
+			UI_VGLITE_FORMAT_CACHE_free_image(&image->image);
+		} else {
+			_draw(image, operation);
+		}
+		_check_statistics(operation);
+	}
+
+	(void)printf("%u operations: %u hits, %u conversions, %u evictions\n", OPERATIONS, expected.hits,
+	             expected.conversions, expected.evictions);
+	if ((0u == expected.evictions) || (0u == expected.hits)) {
+		(void)printf("the sequence does not fill the cache\n");
+		errors++;
+	}
+
+	UI_VGLITE_FORMAT_CACHE_clear();
+	UI_VGLITE_FORMAT_CACHE_statistics_t statistics;
+	UI_VGLITE_FORMAT_CACHE_get_statistics(&statistics);
+	if ((0u != statistics.entries) || (0u != statistics.memory_used) || (0u != gpu_memory_used)) {
+		(void)printf("clear: %u entries, %u bytes\n", statistics.entries, statistics.memory_used);
+		errors++;
+	}
+
+	for (uint32_t i = 0; i < IMAGES; i++) {
+		free(images[i].pixels);
+		if (_is_compressed(&images[i])) {
+			free(images[i].image.data);
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	srand(29);
+
+	for (uint32_t p = 0; p < 2u; p++) {
+		bool premultiplied = 0u != p;
+		_test_clut(MICROUI_IMAGE_FORMAT_A1, 1u, premultiplied);
+		_test_clut(MICROUI_IMAGE_FORMAT_A2, 2u, premultiplied);
+		_test_clut(MICROUI_IMAGE_FORMAT_C1, 1u, premultiplied);
+		_test_clut(MICROUI_IMAGE_FORMAT_C2, 2u, premultiplied);
+		_test_clut(MICROUI_IMAGE_FORMAT_C4, 4u, premultiplied);
+	}
+	uint32_t clut[UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS];
+	if ((0u != UI_VGLITE_FORMAT_CACHE_get_clut(MICROUI_IMAGE_FORMAT_A4, false, clut)) ||
+	    (0u != UI_VGLITE_FORMAT_CACHE_get_clut(MICROUI_IMAGE_FORMAT_RGB888, false, clut))) {
+		(void)printf("CLUT of a format not indexed\n");
+		errors++;
+	}
+
+	_test_sequence();
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
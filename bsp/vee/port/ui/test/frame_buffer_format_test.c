@@ -0,0 +1,327 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the pixel format of the frame buffers (FRAME_BUFFER_BYTE_PER_PIXEL, DEMO_USE_XRGB8888): checks
+ * the layout of the frame buffers (size, stride, addresses, pixel type) and replays some frames of random drawings
+ * with the "predraw" buffer refresh strategy (ui_display_brs_predraw.c) and its restoration (ui_display_brs.c) over
+ * FRAME_BUFFER_COUNT host frame buffers. The drawings are rectangle fills (declared opaque or not) and patterns that
+ * do not cover their region (the restoration is required). After each flush, the displayed frame buffer is compared
+ * pixel per pixel with an ARGB8888 reference of the display, converted to the format of the frame buffers by
+ * truncation (the port has no dithering).
+ *
+ * Build and run from bsp/vee/port, once per format (see README.rst):
+ *
+ *	gcc -O2 -DDEMO_USE_XRGB8888=0 -Iui/test/stubs -Iui/inc -Iutil/inc ui/test/frame_buffer_format_test.c \
+ *		ui/src/ui_display_brs.c ui/src/ui_display_brs_predraw.c ui/src/ui_rect_util.c -o frame_buffer_format_test
+ *	./frame_buffer_format_test
+ *	gcc -O2 -DDEMO_USE_XRGB8888=1 -Iui/test/stubs -Iui/inc -Iutil/inc ui/test/frame_buffer_format_test.c \
+ *		ui/src/ui_display_brs.c ui/src/ui_display_brs_predraw.c ui/src/ui_rect_util.c -o frame_buffer_format_test
+ *	./frame_buffer_format_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "display_framebuffer.h"
+#include "ui_display_brs.h"
+#include "ui_drawing.h"
+#include "framerate.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Number of frames to replay.
+ */
+#define FRAME_COUNT (120u)
+
+/*
+ * @brief Maximum number of drawings per frame.
+ */
+#define DRAWING_MAX_COUNT (6u)
+
+/*
+ * @brief Expected size of a frame buffer (see FRAME_BUFFER_SIZE).
+ */
+#if (4 == FRAME_BUFFER_BYTE_PER_PIXEL)
+#define EXPECTED_FRAME_BUFFER_SIZE (0x384000u)
+#else
+#define EXPECTED_FRAME_BUFFER_SIZE (0x1C2000u)
+#endif
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static uint32_t errors;
+
+/*
+ * @brief The host frame buffers, at the same offsets as the frame buffers in the SDRAM.
+ */
+static uint8_t *frame_buffers_memory;
+static uint8_t *frame_buffers[FRAME_BUFFER_COUNT];
+
+/*
+ * @brief Index of the frame buffer sent to the display by the last flush.
+ */
+static uint32_t displayed_index;
+
+/*
+ * @brief The frame buffer sent to the display by the last flush (source of the restorations).
+ */
+static MICROUI_Image displayed_image;
+
+/*
+ * @brief The ARGB8888 reference of the display.
+ */
+static uint32_t reference[FRAME_BUFFER_HEIGHT][FRAME_BUFFER_WIDTH];
+
+static uint32_t flushes;
+static uint64_t compared_pixels;
+
+// --------------------------------------------------------------------------------
+// Stubs
+// --------------------------------------------------------------------------------
+
+void framerate_frame_start(void) {
+}
+
+framerate_stage_t framerate_stage_enter(framerate_stage_t stage) {
+	return stage;
+}
+
+void framerate_stage_leave(framerate_stage_t previous) {
+	(void)previous;
+}
+
+MICROUI_Image * LLUI_DISPLAY_getSourceImage(MICROUI_Image *image) {
+	(void)image;
+	return &displayed_image;
+}
+
+bool LLUI_DISPLAY_clipRectangle(MICROUI_GraphicsContext *gc, jint *x1, jint *y1, jint *x2, jint *y2) {
+	*x1 = (*x1 < gc->clip.x1) ? gc->clip.x1 : *x1;
+	*y1 = (*y1 < gc->clip.y1) ? gc->clip.y1 : *y1;
+	*x2 = (*x2 > gc->clip.x2) ? gc->clip.x2 : *x2;
+	*y2 = (*y2 > gc->clip.y2) ? gc->clip.y2 : *y2;
+	return (*x1 <= *x2) && (*y1 <= *y2);
+}
+
+DRAWING_Status UI_DRAWING_copyImage(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX, jint regionY,
+                                    jint width, jint height, jint x, jint y) {
+	(void)gc;
+	(void)img;
+	(void)regionX;
+	(void)regionY;
+	(void)width;
+	(void)height;
+	(void)x;
+	(void)y;
+	// the frame buffers must be restored by the memcpy of UI_DISPLAY_BRS_restore()
+	(void)printf("unexpected copyImage()\n");
+	errors++;
+	return DRAWING_DONE;
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Converts an ARGB8888 color to the format of the frame buffers (truncation).
+ */
+static framebuffer_pixel_t _convert(uint32_t color) {
+#if (4 == FRAME_BUFFER_BYTE_PER_PIXEL)
+	return (framebuffer_pixel_t)(0xff000000u | color);
+#else
+	return (framebuffer_pixel_t)(((color >> 8) & 0xf800u) | ((color >> 5) & 0x07e0u) | ((color >> 3) & 0x001fu));
+#endif
+}
+
+/*
+ * @brief Tells if a pixel of a pattern drawing is drawn (the other pixels keep the past).
+ */
+static bool _is_pattern_pixel(int32_t x, int32_t y) {
+	return 0 == ((x + (2 * y)) % 3);
+}
+
+static void _check_layout(void) {
+	if (EXPECTED_FRAME_BUFFER_SIZE != FRAME_BUFFER_SIZE) {
+		(void)printf("frame buffer size: 0x%x\n", (unsigned int)FRAME_BUFFER_SIZE);
+		errors++;
+	}
+	if (((uint32_t)FRAME_BUFFER_WIDTH * FRAME_BUFFER_BYTE_PER_PIXEL) > FRAME_BUFFER_STRIDE_BYTE) {
+		(void)printf("frame buffer stride: %u bytes\n", (unsigned int)FRAME_BUFFER_STRIDE_BYTE);
+		errors++;
+	}
+	if ((sizeof(framebuffer_pixel_t) != FRAME_BUFFER_BYTE_PER_PIXEL) || (sizeof(framebuffer_t) > FRAME_BUFFER_SIZE)) {
+		(void)printf("frame buffer type: %u bytes per pixel, %u bytes\n", (unsigned int)sizeof(framebuffer_pixel_t),
+		             (unsigned int)sizeof(framebuffer_t));
+		errors++;
+	}
+	for (uint32_t i = 0; i < FRAME_BUFFER_COUNT; i++) {
+		if (0u != (FRAME_BUFFER_ADDRESS(i) % FRAME_BUFFER_ALIGN)) {
+			(void)printf("frame buffer %u: address 0x%x not aligned\n", i, (unsigned int)FRAME_BUFFER_ADDRESS(i));
+			errors++;
+		}
+	}
+	if (FRAME_BUFFER_ADDRESS(FRAME_BUFFER_COUNT) > FRAME_BUFFER_END_ADDRESS) {
+		(void)printf("%u frame buffers do not fit the SDRAM\n", (unsigned int)FRAME_BUFFER_COUNT);
+		errors++;
+	}
+}
+
+/*
+ * @brief Compares the displayed frame buffer with the reference.
+ */
+static void _check_displayed_buffer(void) {
+	const framebuffer_t *fb = (const framebuffer_t *)frame_buffers[displayed_index];
+	uint32_t frame_errors = 0;
+	for (int32_t y = 0; y < FRAME_BUFFER_HEIGHT; y++) {
+		for (int32_t x = 0; x < FRAME_BUFFER_WIDTH; x++) {
+			framebuffer_pixel_t expected = _convert(reference[y][x]);
+			if (fb->p[y][x] != expected) {
+				if (0u == frame_errors) {
+					(void)printf("flush %u: pixel (%d,%d) is 0x%x instead of 0x%x\n", flushes, x, y,
+					             (unsigned int)fb->p[y][x], (unsigned int)expected);
+				}
+				frame_errors++;
+			}
+		}
+	}
+	compared_pixels += (uint64_t)FRAME_BUFFER_WIDTH * FRAME_BUFFER_HEIGHT;
+	errors += frame_errors;
+}
+
+/*
+ * @brief Draws a rectangle fill or a pattern in the back buffer and in the reference, as a drawing native does:
+ * declares the opaque rectangle, notifies the strategy and draws.
+ */
+static void _draw(MICROUI_GraphicsContext *gc, ui_rect_t rect, uint32_t color, bool opaque, bool pattern) {
+	if (opaque) {
+		UI_DISPLAY_BRS_set_opaque_region(gc, rect.x1, rect.y1, rect.x2, rect.y2);
+	}
+
+	ui_rect_t region = rect;
+	if (DRAWING_DONE != LLUI_DISPLAY_IMPL_newDrawingRegion(gc, &region, true)) {
+		(void)printf("asynchronous restoration\n");
+		errors++;
+	}
+	LLUI_DISPLAY_configureClip(gc, true);
+
+	framebuffer_t *fb = (framebuffer_t *)LLUI_DISPLAY_getBufferAddress(&gc->image);
+	for (int32_t y = rect.y1; y <= rect.y2; y++) {
+		for (int32_t x = rect.x1; x <= rect.x2; x++) {
+			if (!pattern || _is_pattern_pixel(x, y)) {
+				fb->p[y][x] = _convert(color);
+				reference[y][x] = color;
+			}
+		}
+	}
+
+	UI_DISPLAY_BRS_clear_opaque_region();
+}
+
+static ui_rect_t _random_rect(void) {
+	int32_t x1 = rand() % FRAME_BUFFER_WIDTH;
+	int32_t y1 = rand() % FRAME_BUFFER_HEIGHT;
+	int32_t x2 = x1 + (rand() % (FRAME_BUFFER_WIDTH / 2));
+	int32_t y2 = y1 + (rand() % (FRAME_BUFFER_HEIGHT / 2));
+	x2 = (x2 < FRAME_BUFFER_WIDTH) ? x2 : (FRAME_BUFFER_WIDTH - 1);
+	y2 = (y2 < FRAME_BUFFER_HEIGHT) ? y2 : (FRAME_BUFFER_HEIGHT - 1);
+	return UI_RECT_new_xyxy(x1, y1, x2, y2);
+}
+
+static uint32_t _random_color(void) {
+	return (((uint32_t)rand() & 0xffffu) << 8) ^ (uint32_t)rand();
+}
+
+// --------------------------------------------------------------------------------
+// LLUI_DISPLAY_impl.h API
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Sends the back buffer to the display and targets the next frame buffer, as the VGLite window does.
+ */
+void LLUI_DISPLAY_IMPL_flush(MICROUI_GraphicsContext *gc, uint8_t flushIdentifier, const ui_rect_t regions[],
+                             size_t length) {
+	(void)flushIdentifier;
+	(void)regions;
+	(void)length;
+
+	displayed_index = (displayed_index + 1u) % FRAME_BUFFER_COUNT;
+	if (LLUI_DISPLAY_getBufferAddress(&gc->image) != frame_buffers[displayed_index]) {
+		(void)printf("flush %u: not the back buffer\n", flushes);
+		errors++;
+	}
+	displayed_image = gc->image;
+	_check_displayed_buffer();
+	flushes++;
+
+	gc->image.data = frame_buffers[(displayed_index + 1u) % FRAME_BUFFER_COUNT];
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	_check_layout();
+
+	frame_buffers_memory = calloc(1u, FRAME_BUFFER_COUNT * FRAME_BUFFER_SIZE);
+	for (uint32_t i = 0; i < FRAME_BUFFER_COUNT; i++) {
+		frame_buffers[i] = frame_buffers_memory + (FRAME_BUFFER_ADDRESS(i) - FRAME_BUFFER_START_ADDRESS);
+	}
+	(void)memset(reference, 0, sizeof(reference));
+
+	MICROUI_GraphicsContext gc = { 0 };
+	gc.image.width = FRAME_BUFFER_WIDTH;
+	gc.image.height = FRAME_BUFFER_HEIGHT;
+	gc.image.format = MICROUI_IMAGE_FORMAT_LCD;
+	gc.image.flags = LLUI_DISPLAY_STUB_FLAG_LCD;
+	gc.image.stride = FRAME_BUFFER_STRIDE_BYTE;
+	gc.image.data = frame_buffers[0];
+	gc.clip = UI_RECT_new_xyxy(0, 0, FRAME_BUFFER_WIDTH - 1, FRAME_BUFFER_HEIGHT - 1);
+	gc.clip_enabled = true;
+	displayed_index = FRAME_BUFFER_COUNT - 1u;
+	displayed_image = gc.image;
+	displayed_image.data = frame_buffers[displayed_index];
+
+	srand(44);
+
+	for (uint32_t frame = 0; frame < FRAME_COUNT; frame++) {
+		if (0u == (frame % 16u)) {
+			// full screen opaque fill: the past is not restored
+			_draw(&gc, gc.clip, _random_color(), true, false);
+		}
+		uint32_t count = 1u + ((uint32_t)rand() % DRAWING_MAX_COUNT);
+		for (uint32_t d = 0; d < count; d++) {
+			// the first drawing of a frame covers its region: the strategy does not restore it
+			int kind = rand() % ((0u == d) ? 2 : 3);
+			_draw(&gc, _random_rect(), _random_color(), 0 == kind, 2 == kind);
+		}
+		(void)LLUI_DISPLAY_IMPL_refresh(&gc, (uint8_t)frame);
+	}
+
+	free(frame_buffers_memory);
+
+	(void)printf("%u bytes per pixel, %u frame buffers of 0x%x bytes: %u flushes, %llu pixels compared\n",
+	             (unsigned int)FRAME_BUFFER_BYTE_PER_PIXEL, (unsigned int)FRAME_BUFFER_COUNT,
+	             (unsigned int)FRAME_BUFFER_SIZE, flushes, (unsigned long long)compared_pixels);
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,608 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the cache of the transformed glyphs (ui_vglite_glyph_cache.c): draws scaled strings and
+ * rotated characters of a custom font stand-in and compares the destination with a per-pixel reference (exact for
+ * the nearest neighbor interpolation and for the integer transformations, one alpha level for the bilinear
+ * interpolation). Checks the hits, the misses and the evictions of repeated drawings, that the memory stays below
+ * VGLITE_GLYPH_CACHE and that a block is never released while a blit that reads it is pending.
+ *
+ * The GPU is a host stand-in implemented below: the blits are queued by vg_lite_blit_rect() and performed (alpha
+ * map multiplied by the color's alpha, blended on an alpha canvas) by UI_VGLITE_flush_batch(), as with the option
+ * VGLITE_BATCH_OPERATIONS. The released blocks are overwritten: a blit performed after the release of its alpha
+ * map draws wrong pixels.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DVG_DRIVER_SINGLE_THREAD -DVGLITE_GLYPH_CACHE=8192 -Iui/test/stubs -Iui/inc -Iui_vglite/inc \
+ *		-I../../sdk_overlay/middleware/vglite/inc ui/test/glyph_cache_test.c ui_vglite/src/ui_vglite_glyph_cache.c \
+ *		-lm -o glyph_cache_test
+ *	./glyph_cache_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui_vglite_glyph_cache.h"
+#include "ui_vglite.h"
+#include "ui_vglite_state.h"
+#include "ui_font_drawing.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+#define WIDTH (320)
+#define HEIGHT (200)
+
+#define MAX_BLITS (256u)
+#define MAX_BLOCKS (256u)
+
+/*
+ * @brief The characters of the font stand-in: 'A' to 'Z' and the space (no pixel).
+ */
+#define FIRST_CHAR ('A')
+#define CHARS (26)
+#define GLYPH_HEIGHT (12)
+
+#define DEG_TO_RAD (3.14159265358979f / 180.f)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+typedef struct {
+	const uint8_t *memory;
+	int32_t stride;
+	int32_t width;
+	int32_t height;
+	int32_t x;
+	int32_t y;
+	uint32_t alpha;
+} blit_t;
+
+typedef struct {
+	uint8_t *block;
+	uint32_t size;
+} block_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static uint8_t canvas[HEIGHT][WIDTH];
+static uint8_t reference[HEIGHT][WIDTH];
+
+static uint8_t glyph_pixels[CHARS][GLYPH_HEIGHT * 16];
+static UI_FONT_DRAWING_glyph_t glyphs[CHARS];
+static UI_FONT_DRAWING_glyph_t space_glyph;
+
+static MICROUI_GraphicsContext gc;
+static MICROUI_Font font;
+static vg_lite_buffer_t destination;
+
+static ui_rect_t scissor;
+
+static blit_t blits[MAX_BLITS];
+static uint32_t blits_number;
+
+static block_t blocks[MAX_BLOCKS];
+static uint32_t blocks_number;
+
+static UI_VGLITE_GLYPH_CACHE_statistics_t previous_statistics;
+
+static uint32_t errors;
+
+// --------------------------------------------------------------------------------
+// Custom font stand-in
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Generates the glyphs: width from 6 to 10 pixels, vertical offset from 1 to 3 pixels, random alpha maps with
+ * transparent, opaque and intermediate pixels.
+ */
+static void _generate_font(void) {
+	for (int32_t c = 0; c < CHARS; c++) {
+		UI_FONT_DRAWING_glyph_t *glyph = &glyphs[c];
+		glyph->width = 6 + (c % 5);
+		glyph->height = GLYPH_HEIGHT;
+		glyph->stride = 16u;
+		glyph->x = 1;
+		glyph->y = 1 + (c % 3);
+		glyph->advance = glyph->width + 2;
+		glyph->alpha_map = glyph_pixels[c];
+		for (uint32_t i = 0; i < sizeof(glyph_pixels[c]); i++) {
+			uint32_t kind = (uint32_t)rand() % 4u;
+			glyph_pixels[c][i] = (0u == kind) ? 0u : ((1u == kind) ? 255u : (uint8_t)rand());
+		}
+	}
+	space_glyph.alpha_map = NULL;
+	space_glyph.advance = 5;
+}
+
+bool UI_FONT_DRAWING_getGlyph(MICROUI_Font *f, jchar c, UI_FONT_DRAWING_glyph_t *glyph) {
+	(void)f;
+	bool ret = true;
+	if ((c >= (jchar)FIRST_CHAR) && (c < (jchar)(FIRST_CHAR + CHARS))) {
+		*glyph = glyphs[c - FIRST_CHAR];
+	} else if ((jchar)' ' == c) {
+		*glyph = space_glyph;
+	} else {
+		// character not in the font
+		ret = false;
+	}
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// MicroUI images heap stand-in
+// --------------------------------------------------------------------------------
+
+uint8_t * LLUI_DISPLAY_IMPL_imageHeapAllocate(uint32_t size) {
+	uint8_t *ret = NULL;
+	if (blocks_number < MAX_BLOCKS) {
+		ret = (uint8_t *)malloc(size);
+		blocks[blocks_number].block = ret;
+		blocks[blocks_number].size = size;
+		blocks_number++;
+	}
+	return ret;
+}
+
+void LLUI_DISPLAY_IMPL_imageHeapFree(uint8_t *block) {
+	for (uint32_t b = 0; b < blocks_number; b++) {
+		if (block == blocks[b].block) {
+			for (uint32_t i = 0; i < blits_number; i++) {
+				if ((blits[i].memory >= block) && (blits[i].memory < &block[blocks[b].size])) {
+					(void)printf("block %p released while a blit reads it\n", (void *)block);
+					errors++;
+				}
+			}
+			// a blit performed later draws wrong pixels
+			(void)memset(block, 0x5a, blocks[b].size);
+			free(block);
+			blocks_number--;
+			blocks[b] = blocks[blocks_number];
+			break;
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------
+// GPU stand-in
+// --------------------------------------------------------------------------------
+
+static uint32_t _div255(uint32_t value) {
+	return (value + 127u) / 255u;
+}
+
+/*
+ * @brief Blends an alpha on the canvas (source over).
+ */
+static void _blend(uint8_t (*dest)[WIDTH], int32_t x, int32_t y, uint32_t alpha) {
+	if ((x >= 0) && (x < WIDTH) && (y >= 0) && (y < HEIGHT) && (0u != alpha)) {
+		uint32_t d = dest[y][x];
+		dest[y][x] = (uint8_t)(alpha + _div255(d * (255u - alpha)));
+	}
+}
+
+void vg_lite_identity(vg_lite_matrix_t *matrix) {
+	(void)memset(matrix, 0, sizeof(vg_lite_matrix_t));
+	matrix->m[0][0] = 1.f;
+	matrix->m[1][1] = 1.f;
+	matrix->m[2][2] = 1.f;
+}
+
+vg_lite_error_t vg_lite_blit_rect(vg_lite_buffer_t *target, vg_lite_buffer_t *source, uint32_t *rect,
+                                  vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color,
+                                  vg_lite_filter_t filter) {
+	vg_lite_error_t ret = VG_LITE_SUCCESS;
+	if ((&destination != target) || (VG_LITE_A8 != source->format) || (VG_LITE_BLEND_SRC_OVER != blend)
+	    || (VG_LITE_FILTER_POINT != filter) || (VG_LITE_MULTIPLY_IMAGE_MODE != source->image_mode)
+	    || (0u != rect[0]) || (0u != rect[1]) || (matrix->m[0][0] != 1.f) || (matrix->m[1][1] != 1.f)
+	    || (MAX_BLITS == blits_number)) {
+		(void)printf("unexpected blit\n");
+		errors++;
+		ret = VG_LITE_INVALID_ARGUMENT;
+	} else {
+		blit_t *blit = &blits[blits_number];
+		blits_number++;
+		blit->memory = (const uint8_t *)source->memory;
+		blit->stride = source->stride;
+		blit->width = (int32_t)rect[2];
+		blit->height = (int32_t)rect[3];
+		blit->x = (int32_t)matrix->m[0][2];
+		blit->y = (int32_t)matrix->m[1][2];
+		blit->alpha = color >> 24;
+	}
+	return ret;
+}
+
+vg_lite_buffer_t * UI_VGLITE_configure_destination(MICROUI_GraphicsContext *g) {
+	(void)g;
+	return &destination;
+}
+
+DRAWING_Status UI_VGLITE_post_operation(MICROUI_GraphicsContext *g, vg_lite_error_t vg_lite_error) {
+	(void)g;
+	if (VG_LITE_SUCCESS != vg_lite_error) {
+		(void)printf("drawing error %d\n", vg_lite_error);
+		errors++;
+	}
+	// the blits stay in the GPU commands list
+	return DRAWING_DONE;
+}
+
+/*
+ * @brief Performs the pending blits.
+ */
+void UI_VGLITE_flush_batch(void) {
+	for (uint32_t i = 0; i < blits_number; i++) {
+		const blit_t *blit = &blits[i];
+		for (int32_t y = 0; y < blit->height; y++) {
+			for (int32_t x = 0; x < blit->width; x++) {
+				int32_t dx = blit->x + x;
+				int32_t dy = blit->y + y;
+				if ((dx >= scissor.x1) && (dx <= scissor.x2) && (dy >= scissor.y1) && (dy <= scissor.y2)) {
+					_blend(canvas, dx, dy, _div255(blit->memory[(y * blit->stride) + x] * blit->alpha));
+				}
+			}
+		}
+	}
+	blits_number = 0;
+}
+
+bool UI_VGLITE_enable_vg_lite_scissor_region(MICROUI_GraphicsContext *g, int x1, int y1, int x2, int y2) {
+	// the clip is the canvas
+	(void)g;
+	scissor = UI_RECT_new_xyxy(0, 0, WIDTH - 1, HEIGHT - 1);
+	return (x1 <= x2) && (y1 <= y2) && (x2 >= 0) && (y2 >= 0) && (x1 < WIDTH) && (y1 < HEIGHT);
+}
+
+bool UI_VGLITE_need_to_premultiply(void) {
+	return false;
+}
+
+uint32_t UI_VGLITE_premultiply_alpha(uint32_t color, uint8_t alpha) {
+	(void)color;
+	(void)alpha;
+	(void)printf("unexpected pre-multiplication\n");
+	errors++;
+	return 0u;
+}
+
+vg_lite_error_t UI_VGLITE_STATE_disable_premultiply(void) {
+	return VG_LITE_SUCCESS;
+}
+
+void UI_VGLITE_IMPL_error(bool critical, const char *format, ...) {
+	(void)critical;
+	va_list args;
+	va_start(args, format);
+	(void)vprintf(format, args);
+	va_end(args);
+	(void)printf("\n");
+	errors++;
+}
+
+// --------------------------------------------------------------------------------
+// Reference functions
+// --------------------------------------------------------------------------------
+
+static float _get_alpha(const UI_FONT_DRAWING_glyph_t *glyph, int32_t u, int32_t v) {
+	float ret = 0.f;
+	if ((u >= 0) && (u < glyph->width) && (v >= 0) && (v < glyph->height)) {
+		ret = (float)glyph->alpha_map[((uint32_t)v * glyph->stride) + (uint32_t)u];
+	}
+	return ret;
+}
+
+static uint32_t _sample(const UI_FONT_DRAWING_glyph_t *glyph, float sx, float sy, bool bilinear) {
+	float alpha;
+	if (bilinear) {
+		float fx = sx - 0.5f;
+		float fy = sy - 0.5f;
+		float u = floorf(fx);
+		float v = floorf(fy);
+		float wx = fx - u;
+		float wy = fy - v;
+		float top = (_get_alpha(glyph, (int32_t)u, (int32_t)v) * (1.f - wx)) +
+		            (_get_alpha(glyph, (int32_t)u + 1, (int32_t)v) * wx);
+		float bottom = (_get_alpha(glyph, (int32_t)u, (int32_t)v + 1) * (1.f - wx)) +
+		               (_get_alpha(glyph, (int32_t)u + 1, (int32_t)v + 1) * wx);
+		alpha = (top * (1.f - wy)) + (bottom * wy) + 0.5f;
+	} else {
+		alpha = _get_alpha(glyph, (int32_t)floorf(sx), (int32_t)floorf(sy));
+	}
+	return (alpha >= 255.f) ? 255u : (uint32_t)alpha;
+}
+
+/*
+ * @brief Draws a glyph transformed by the inverse matrix m (from the destination to the character's box whose
+ * top-left corner is at (x, y)): each pixel of the destination is sampled.
+ */
+static void _reference_glyph(const UI_FONT_DRAWING_glyph_t *glyph, const float m[2][2], int32_t x, int32_t y,
+                             bool bilinear, uint32_t alpha) {
+	for (int32_t dy = 0; dy < HEIGHT; dy++) {
+		for (int32_t dx = 0; dx < WIDTH; dx++) {
+			float px = (float)(dx - x) + 0.5f;
+			float py = (float)(dy - y) + 0.5f;
+			float sx = (m[0][0] * px) + (m[0][1] * py) - (float)glyph->x;
+			float sy = (m[1][0] * px) + (m[1][1] * py) - (float)glyph->y;
+			_blend(reference, dx, dy, _div255(_sample(glyph, sx, sy, bilinear) * alpha));
+		}
+	}
+}
+
+static void _reference_scaled_string(const char *string, int32_t x, int32_t y, float x_ratio, float y_ratio) {
+	// ratios rounded to 1/64
+	float m[2][2] = { { 64.f / roundf(x_ratio * 64.f), 0.f }, { 0.f, 64.f / roundf(y_ratio * 64.f) } };
+	int32_t pen = 0;
+	for (const char *c = string; '\0' != *c; c++) {
+		UI_FONT_DRAWING_glyph_t glyph;
+		(void)UI_FONT_DRAWING_getGlyph(&font, (jchar)*c, &glyph);
+		if (NULL != glyph.alpha_map) {
+			_reference_glyph(&glyph, m, x + (int32_t)lroundf((float)pen * x_ratio), y, true, 255u);
+		}
+		pen += glyph.advance;
+	}
+}
+
+static void _reference_rotated_char(char c, int32_t x, int32_t y, int32_t rx, int32_t ry, float angle, bool bilinear,
+                                    uint32_t alpha) {
+	// angle rounded to half a degree
+	float radians = (roundf(angle * 2.f) / 2.f) * DEG_TO_RAD;
+	float cos_a = cosf(radians);
+	float sin_a = sinf(radians);
+	float m[2][2] = { { cos_a, -sin_a }, { sin_a, cos_a } };
+	// the top-left corner of the character's box rotated around the center, rounded to the nearest pixel
+	float dx = (float)(x - rx);
+	float dy = (float)(y - ry);
+	int32_t ox = rx + (int32_t)floorf((cos_a * dx) + (sin_a * dy) + 0.5f);
+	int32_t oy = ry + (int32_t)floorf((-sin_a * dx) + (cos_a * dy) + 0.5f);
+	UI_FONT_DRAWING_glyph_t glyph;
+	(void)UI_FONT_DRAWING_getGlyph(&font, (jchar)c, &glyph);
+	_reference_glyph(&glyph, m, ox, oy, bilinear, alpha);
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static void _clear(void) {
+	UI_VGLITE_flush_batch();
+	(void)memset(canvas, 0, sizeof(canvas));
+	(void)memset(reference, 0, sizeof(reference));
+}
+
+static void _compare(const char *test, uint32_t tolerance) {
+	uint32_t different = 0;
+	uint32_t drawn = 0;
+	UI_VGLITE_flush_batch();
+	for (int32_t y = 0; y < HEIGHT; y++) {
+		for (int32_t x = 0; x < WIDTH; x++) {
+			int32_t delta = (int32_t)canvas[y][x] - (int32_t)reference[y][x];
+			drawn += (0u != reference[y][x]) ? 1u : 0u;
+			if ((uint32_t)abs(delta) > tolerance) {
+				if (0u == different) {
+					(void)printf("%s: pixel (%d,%d) is %u, expected %u\n", test, x, y, canvas[y][x], reference[y][x]);
+				}
+				different++;
+			}
+		}
+	}
+	if ((0u != different) || (0u == drawn)) {
+		(void)printf("%s: %u different pixels (%u drawn)\n", test, different, drawn);
+		errors++;
+	}
+}
+
+static void _check_memory(const char *test) {
+	UI_VGLITE_GLYPH_CACHE_statistics_t statistics;
+	UI_VGLITE_GLYPH_CACHE_get_statistics(&statistics);
+	uint32_t memory = 0;
+	for (uint32_t b = 0; b < blocks_number; b++) {
+		memory += blocks[b].size;
+	}
+	if ((statistics.memory_used > (uint32_t)VGLITE_GLYPH_CACHE) || (statistics.memory_used != memory)
+	    || (statistics.entries != blocks_number)) {
+		(void)printf("%s: %u bytes in %u entries, %u bytes in %u blocks\n", test, statistics.memory_used,
+		             statistics.entries, memory, blocks_number);
+		errors++;
+	}
+}
+
+static bool _draw_scaled_string(const char *string, jint x, jint y, jfloat x_ratio, jfloat y_ratio) {
+	jchar chars[64];
+	jint length = 0;
+	for (const char *c = string; '\0' != *c; c++) {
+		chars[length] = (jchar)*c;
+		length++;
+	}
+	DRAWING_Status status;
+	// the blits are performed when a glyph is evicted or at the end of the frame (see _compare())
+	bool ret = UI_VGLITE_GLYPH_CACHE_draw_scaled_string(&gc, chars, length, &font, x, y, x_ratio, y_ratio, &status);
+	_check_memory(string);
+	return ret;
+}
+
+static bool _draw_rotated_char(char c, jint x, jint y, jint rx, jint ry, jfloat angle, jint alpha, bool bilinear) {
+	DRAWING_Status status;
+	bool ret = UI_VGLITE_GLYPH_CACHE_draw_rotated_char(&gc, (jchar)c, &font, x, y, rx, ry, angle, alpha, bilinear,
+	                                                   &status);
+	_check_memory("rotated char");
+	return ret;
+}
+
+/*
+ * @brief Checks the hits, the misses and the evictions since the previous check (UINT32_MAX: at least one eviction).
+ */
+static void _check_statistics(const char *test, uint32_t hits, uint32_t misses, uint32_t evictions) {
+	UI_VGLITE_GLYPH_CACHE_statistics_t statistics;
+	UI_VGLITE_GLYPH_CACHE_get_statistics(&statistics);
+	uint32_t h = statistics.hits - previous_statistics.hits;
+	uint32_t m = statistics.misses - previous_statistics.misses;
+	uint32_t e = statistics.evictions - previous_statistics.evictions;
+	(void)printf("%-28s %3u hits %3u misses %3u evictions %2u entries %5u bytes\n", test, h, m, e, statistics.entries,
+	             statistics.memory_used);
+	if ((h != hits) || (m != misses) || ((UINT32_MAX != evictions) && (e != evictions))
+	    || ((UINT32_MAX == evictions) && (0u == e))) {
+		(void)printf("%s: expected %u hits, %u misses, %u evictions\n", test, hits, misses, evictions);
+		errors++;
+	}
+	previous_statistics = statistics;
+}
+
+// --------------------------------------------------------------------------------
+// Tests
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief A ratio of 1 copies the glyphs; a ratio of 2 (nearest neighbor and bilinear give the same result at the
+ * pixels' centers except on the edges) is checked against an integer mapping.
+ */
+static void _test_integer_transformations(void) {
+	_clear();
+	(void)_draw_scaled_string("HELLO", 10, 10, 1.f, 1.f);
+	_reference_scaled_string("HELLO", 10, 10, 1.f, 1.f);
+	_compare("scale 1", 0u);
+
+	// 90 degrees counterclockwise: the pixel (u, v) of the glyph goes to (gy + v, -(gx + u) - 1) from the box's
+	// corner rotated around the center
+	_clear();
+	(void)_draw_rotated_char('R', 100, 50, 90, 40, 90.f, 255, false);
+	const UI_FONT_DRAWING_glyph_t *glyph = &glyphs['R' - FIRST_CHAR];
+	int32_t ox = 90 + (50 - 40); // cos = 0, sin = 1
+	int32_t oy = 40 - (100 - 90);
+	for (int32_t v = 0; v < glyph->height; v++) {
+		for (int32_t u = 0; u < glyph->width; u++) {
+			_blend(reference, ox + glyph->y + v, oy - (glyph->x + u) - 1, glyph->alpha_map[(v * 16) + u]);
+		}
+	}
+	_compare("rotate 90 nearest neighbor", 0u);
+
+	// 180 degrees: the pixel (u, v) goes to (-(gx + u) - 1, -(gy + v) - 1)
+	_clear();
+	(void)_draw_rotated_char('W', 200, 100, 200, 100, 180.f, 255, false);
+	glyph = &glyphs['W' - FIRST_CHAR];
+	for (int32_t v = 0; v < glyph->height; v++) {
+		for (int32_t u = 0; u < glyph->width; u++) {
+			_blend(reference, 200 - (glyph->x + u) - 1, 100 - (glyph->y + v) - 1, glyph->alpha_map[(v * 16) + u]);
+		}
+	}
+	_compare("rotate 180 nearest neighbor", 0u);
+}
+
+static void _test_transformations(void) {
+	// the glyphs of a string fit the cache
+	static const float ratios[][2] = { { 2.f, 2.f }, { 1.5f, 0.75f }, { 0.6f, 1.3f }, { 3.1f, 2.2f } };
+	static const char *strings[] = { "QUICK BROWN", "JUMPS OVER", "THE LAZY DOG", "FOX" };
+	for (uint32_t i = 0; i < (sizeof(ratios) / sizeof(ratios[0])); i++) {
+		char test[64];
+		(void)snprintf(test, sizeof(test), "scale %.2f x %.2f", ratios[i][0], ratios[i][1]);
+		_clear();
+		if (!_draw_scaled_string(strings[i], 5, 20, ratios[i][0], ratios[i][1])) {
+			(void)printf("%s: not drawn by the cache\n", test);
+			errors++;
+		}
+		_reference_scaled_string(strings[i], 5, 20, ratios[i][0], ratios[i][1]);
+		_compare(test, 1u);
+	}
+
+	static const float angles[] = { 0.f, 17.f, 45.5f, 90.f, 133.f, 200.f, 271.5f, -30.f };
+	for (uint32_t i = 0; i < (sizeof(angles) / sizeof(angles[0])); i++) {
+		for (uint32_t bilinear = 0; bilinear < 2u; bilinear++) {
+			char test[64];
+			(void)snprintf(test, sizeof(test), "rotate %.1f %s", angles[i], (0u != bilinear) ? "bilinear" : "nearest");
+			_clear();
+			(void)_draw_rotated_char('G', 150, 90, 143, 101, angles[i], 200, 0u != bilinear);
+			_reference_rotated_char('G', 150, 90, 143, 101, angles[i], 0u != bilinear, 200u);
+			// nearest neighbor: same computing as the reference
+			_compare(test, bilinear);
+		}
+	}
+}
+
+static void _test_statistics(void) {
+	UI_VGLITE_GLYPH_CACHE_invalidate_all();
+	UI_VGLITE_GLYPH_CACHE_get_statistics(&previous_statistics);
+	(void)_draw_scaled_string("A", 0, 0, 1.f, 1.f); // releases the invalidated glyphs
+	_check_statistics("invalidate", 0u, 1u, 0u);
+
+	// 5 distinct glyphs, then all hits
+	(void)_draw_scaled_string("ABCDE", 0, 0, 1.f, 1.f);
+	_check_statistics("ABCDE first drawing", 1u, 4u, 0u);
+	(void)_draw_scaled_string("ABCDE", 40, 60, 1.f, 1.f);
+	_check_statistics("ABCDE second drawing", 5u, 0u, 0u);
+
+	// another ratio: other glyphs; a ratio rounded to the same 1/64 reuses them
+	(void)_draw_scaled_string("ABC", 0, 0, 2.f, 2.f);
+	_check_statistics("ABC ratio 2", 0u, 3u, 0u);
+	(void)_draw_scaled_string("ABC", 0, 0, 2.004f, 1.996f);
+	_check_statistics("ABC ratio 2.004", 3u, 0u, 0u);
+
+	// the same character drawn with several colors and several positions
+	(void)_draw_rotated_char('K', 50, 50, 60, 60, 30.f, 255, true);
+	(void)_draw_rotated_char('K', 120, 80, 100, 70, 30.2f, 120, true);
+	_check_statistics("K rotated twice", 1u, 1u, 0u);
+
+	// large glyphs (about 1 KB) fill the cache: the least recently drawn glyphs are evicted
+	(void)_draw_scaled_string("FGHIJK", 0, 0, 2.5f, 2.5f);
+	_check_statistics("FGHIJK ratio 2.5", 0u, 6u, UINT32_MAX);
+	(void)_draw_scaled_string("FGHIJK", 0, 0, 2.5f, 2.5f);
+	_check_statistics("FGHIJK ratio 2.5 again", 6u, 0u, 0u);
+	(void)_draw_scaled_string("ABCDE", 0, 0, 1.f, 1.f);
+	_check_statistics("ABCDE evicted", 0u, 5u, UINT32_MAX);
+
+	// the glyphs of a drawing are never evicted by the drawing itself: too many glyphs are not drawn by the cache
+	_clear();
+	if (_draw_scaled_string("ABCDEFGHIJKLMNOPQRSTUVWXYZ", 0, 0, 3.5f, 3.5f)) {
+		(void)printf("too many glyphs: drawn by the cache\n");
+		errors++;
+	}
+	if (!_draw_scaled_string("ABC", 0, 0, 3.5f, 3.5f)) {
+		(void)printf("ABC ratio 3.5: not drawn by the cache\n");
+		errors++;
+	}
+
+	// a character not in the font: the font manager draws the string
+	if (_draw_scaled_string("AB\x7f", 0, 0, 1.f, 1.f)) {
+		(void)printf("character not in the font: drawn by the cache\n");
+		errors++;
+	}
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	srand(40);
+	_generate_font();
+	gc.foreground_color = 0x00336699u;
+
+	_test_integer_transformations();
+	_test_transformations();
+	_test_statistics();
+
+	UI_VGLITE_GLYPH_CACHE_statistics_t statistics;
+	UI_VGLITE_GLYPH_CACHE_get_statistics(&statistics);
+	(void)printf("total: %u hits, %u misses, %u evictions, %u fallbacks\n", statistics.hits, statistics.misses,
+	             statistics.evictions, statistics.fallbacks);
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the compressed images (ui_image_compressed.c): encodes some generated images (random pixels,
+ * runs longer than a RLE run, gradients, blocks of two colors) with the RLE and the BLOCK encodings in RGB565 and in
+ * ARGB8888_PRE, decodes them entirely and by strips of rows (as the GPU stream buffer does) and compares the decoded
+ * pixels with the source pixels: exact for the RLE encoding and for the images whose blocks have at most two colors,
+ * bounded error for the BLOCK encoding of the gradients. Checks that a destination too small and some truncated data
+ * are rejected and prints the compression ratios.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -Iui/test/stubs -Iui/inc ui/test/image_compressed_test.c ui/src/ui_image_compressed.c \
+ *		ui/src/ui_pixel_kernels.c -o image_compressed_test
+ *	./image_compressed_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui_image_compressed.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Additional pixels at the end of the source and destination rows (stride larger than the width).
+ */
+#define ROW_PADDING (3u)
+
+/*
+ * @brief Maximum error of a channel of the gradients encoded with the BLOCK encoding: the truncation of the colors
+ * in RGB565 (7) and the rounding of the interpolated colors.
+ */
+#define BLOCK_MAX_ERROR (8u)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+typedef enum {
+	IMAGE_NOISE,
+	IMAGE_RUNS,
+	IMAGE_GRADIENT,
+	IMAGE_TWO_COLORS_BLOCKS,
+	IMAGE_KIND_COUNT,
+} image_kind_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static const char *kind_names[IMAGE_KIND_COUNT] = {
+	"noise",
+	"runs",
+	"gradient",
+	"two colors blocks",
+};
+
+static const uint32_t widths[] = { 1u, 3u, 4u, 5u, 127u, 128u, 129u, 300u };
+static const uint32_t heights[] = { 1u, 4u, 7u, 33u };
+
+static uint32_t errors;
+
+/*
+ * @brief Source and encoded bytes per kind of image, encoding and format (compression ratios).
+ */
+static uint64_t source_bytes[IMAGE_KIND_COUNT][2][2];
+static uint64_t encoded_bytes[IMAGE_KIND_COUNT][2][2];
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static uint32_t _expand_rgb565(uint32_t color) {
+	uint32_t red = (color >> 11) & 0x1fu;
+	uint32_t green = (color >> 5) & 0x3fu;
+	uint32_t blue = color & 0x1fu;
+	return (((red << 3) | (red >> 2)) << 16) | (((green << 2) | (green >> 4)) << 8) | ((blue << 3) | (blue >> 2));
+}
+
+/*
+ * @brief Gets a random pixel: any RGB565 color or any pre-multiplied ARGB8888 color.
+ */
+static uint32_t _get_random_pixel(uint32_t bpp) {
+	uint32_t pixel;
+	if (2u == bpp) {
+		pixel = (uint32_t)rand() & 0xffffu;
+	} else {
+		uint32_t alpha = (uint32_t)rand() & 0xffu;
+		pixel = alpha << 24;
+		for (uint32_t shift = 0; shift < 24u; shift += 8u) {
+			pixel |= (((uint32_t)rand() % (alpha + 1u)) << shift);
+		}
+	}
+	return pixel;
+}
+
+/*
+ * @brief Gets a random pixel the BLOCK encoding keeps without loss: an opaque RGB565 color or a transparent pixel.
+ */
+static uint32_t _get_random_block_pixel(uint32_t bpp, bool transparent) {
+	uint32_t color = (uint32_t)rand() & 0xffffu;
+	uint32_t pixel = color;
+	if (4u == bpp) {
+		pixel = transparent ? 0u : (0xff000000u | _expand_rgb565(color));
+	}
+	return pixel;
+}
+
+static void _write_pixel(uint8_t *image, uint32_t stride, uint32_t x, uint32_t y, uint32_t bpp, uint32_t pixel) {
+	uint8_t *address = &image[(y * stride) + (x * bpp)];
+	if (2u == bpp) {
+		*((uint16_t *)address) = (uint16_t)pixel;
+	} else {
+		*((uint32_t *)address) = pixel;
+	}
+}
+
+static uint32_t _read_pixel(const uint8_t *image, uint32_t stride, uint32_t x, uint32_t y, uint32_t bpp) {
+	const uint8_t *address = &image[(y * stride) + (x * bpp)];
+	return (2u == bpp) ? (uint32_t)*((const uint16_t *)address) : *((const uint32_t *)address);
+}
+
+static void _generate(uint8_t *image, uint32_t stride, uint32_t width, uint32_t height, uint32_t bpp,
+                      image_kind_t kind) {
+	(void)memset(image, 0x5a, stride * height);
+
+	for (uint32_t y = 0; y < height; y++) {
+		uint32_t run_pixel = 0u;
+		uint32_t run_length = 0u;
+
+		for (uint32_t x = 0; x < width; x++) {
+			uint32_t pixel;
+			switch (kind) {
+			case IMAGE_NOISE:
+				pixel = _get_random_pixel(bpp);
+				break;
+			case IMAGE_RUNS:
+				if (0u == run_length) {
+					// from single pixels to runs longer than a RLE run
+					run_length = 1u + ((0u == ((uint32_t)rand() % 4u)) ? ((uint32_t)rand() % 300u) : 0u);
+					run_pixel = _get_random_pixel(bpp);
+				}
+				run_length--;
+				pixel = run_pixel;
+				break;
+			case IMAGE_GRADIENT: {
+				// the colors of a block are on a line: the BLOCK encoding approximates them with its palette
+				uint32_t value = ((x + y) > 255u) ? 255u : (x + y);
+				uint32_t red = value;
+				uint32_t green = 255u - value;
+				uint32_t blue = value / 2u;
+				pixel = (2u == bpp) ? (((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3))
+				        : (0xff000000u | (red << 16) | (green << 8) | blue);
+				break;
+			}
+			default:
+				// filled below
+				pixel = 0u;
+				break;
+			}
+			_write_pixel(image, stride, x, y, bpp, pixel);
+		}
+	}
+
+	if (IMAGE_TWO_COLORS_BLOCKS == kind) {
+		for (uint32_t block_y = 0; block_y < height; block_y += 4u) {
+			for (uint32_t block_x = 0; block_x < width; block_x += 4u) {
+				bool transparent = (4u == bpp) && (0u == ((uint32_t)rand() % 3u));
+				uint32_t colors[3] = { _get_random_block_pixel(bpp, false), _get_random_block_pixel(bpp, false),
+					                   _get_random_block_pixel(bpp, true) };
+				for (uint32_t y = block_y; (y < (block_y + 4u)) && (y < height); y++) {
+					for (uint32_t x = block_x; (x < (block_x + 4u)) && (x < width); x++) {
+						uint32_t index = (uint32_t)rand() % (transparent ? 3u : 2u);
+						_write_pixel(image, stride, x, y, bpp, colors[index]);
+					}
+				}
+			}
+		}
+	}
+}
+
+/*
+ * @brief Gets the largest difference of the channels of two pixels (the RGB565 channels are compared as RGB888
+ * channels).
+ */
+static uint32_t _get_error(uint32_t pixel0, uint32_t pixel1, uint32_t bpp) {
+	if (2u == bpp) {
+		pixel0 = _expand_rgb565(pixel0);
+		pixel1 = _expand_rgb565(pixel1);
+	}
+	uint32_t ret = 0u;
+	for (uint32_t shift = 0; shift < 32u; shift += 8u) {
+		uint32_t channel0 = (pixel0 >> shift) & 0xffu;
+		uint32_t channel1 = (pixel1 >> shift) & 0xffu;
+		uint32_t error = (channel0 > channel1) ? (channel0 - channel1) : (channel1 - channel0);
+		ret = (error > ret) ? error : ret;
+	}
+	return ret;
+}
+
+/*
+ * @brief Compares the decoded rows with the source rows.
+ */
+static void _compare(const char *name, const uint8_t *source, uint32_t source_stride, const uint8_t *decoded,
+                     uint32_t decoded_stride, uint32_t width, uint32_t first_row, uint32_t rows, uint32_t bpp,
+                     uint32_t max_error) {
+	uint32_t padding = (2u == bpp) ? 0xa5a5u : 0xa5a5a5a5u;
+	uint32_t reported = 0u;
+	for (uint32_t y = first_row; y < (first_row + rows); y++) {
+		for (uint32_t x = 0; x < width; x++) {
+			uint32_t expected = _read_pixel(source, source_stride, x, y, bpp);
+			uint32_t pixel = _read_pixel(decoded, decoded_stride, x, y - first_row, bpp);
+			if (_get_error(expected, pixel, bpp) > max_error) {
+				if (reported < 3u) {
+					(void)printf("%s: pixel (%u, %u) is 0x%08x instead of 0x%08x\n", name, x, y, pixel, expected);
+				}
+				errors++;
+				reported++;
+			}
+		}
+		// the padding of the rows is left unchanged
+		for (uint32_t x = width; x < (width + ROW_PADDING); x++) {
+			if (padding != _read_pixel(decoded, decoded_stride, x, y - first_row, bpp)) {
+				(void)printf("%s: padding of the row %u modified\n", name, y);
+				errors++;
+				break;
+			}
+		}
+	}
+}
+
+static void _test_image(uint32_t width, uint32_t height, uint8_t encoding, uint8_t format, image_kind_t kind) {
+	uint32_t bpp = (UI_IMAGE_COMPRESSED_FORMAT_RGB565 == format) ? 2u : 4u;
+	uint32_t stride = (width + ROW_PADDING) * bpp;
+	bool rle = UI_IMAGE_COMPRESSED_ENCODING_RLE == encoding;
+	char name[96];
+	(void)snprintf(name, sizeof(name), "%s %ux%u %s %s", kind_names[kind], width, height, rle ? "RLE" : "BLOCK",
+	               (2u == bpp) ? "RGB565" : "ARGB8888_PRE");
+
+	uint8_t *source = (uint8_t *)malloc(stride * height);
+	uint8_t *decoded = (uint8_t *)malloc(stride * height);
+	uint32_t max_size = UI_IMAGE_COMPRESSED_get_max_size(width, height, encoding, format);
+	uint32_t *encoded = (uint32_t *)malloc(max_size);
+
+	_generate(source, stride, width, height, bpp, kind);
+
+	// lossless except the BLOCK encoding of the images with more than two colors per block
+	uint32_t max_error = 0u;
+	if (!rle && (IMAGE_TWO_COLORS_BLOCKS != kind)) {
+		max_error = (IMAGE_GRADIENT == kind) ? BLOCK_MAX_ERROR : 0xffu;
+	}
+
+	uint32_t size = UI_IMAGE_COMPRESSED_encode(source, stride, width, height, encoding, format, (uint8_t *)encoded,
+	                                           max_size);
+	const UI_IMAGE_COMPRESSED_header_t *header = (const UI_IMAGE_COMPRESSED_header_t *)encoded;
+	if ((0u == size) || (size > max_size) || !UI_IMAGE_COMPRESSED_check_header(header, width, height)
+	    || (size != (sizeof(UI_IMAGE_COMPRESSED_header_t) + header->data_size))) {
+		(void)printf("%s: cannot encode (%u bytes)\n", name, size);
+		errors++;
+	} else {
+		source_bytes[kind][rle ? 0 : 1][(2u == bpp) ? 0 : 1] += (uint64_t)width * height * bpp;
+		encoded_bytes[kind][rle ? 0 : 1][(2u == bpp) ? 0 : 1] += size;
+
+		// the whole image
+		(void)memset(decoded, 0xa5, stride * height);
+		if (!UI_IMAGE_COMPRESSED_decode_rows(header, 0, height, decoded, stride)) {
+			(void)printf("%s: cannot decode\n", name);
+			errors++;
+		} else {
+			_compare(name, source, stride, decoded, stride, width, 0, height, bpp, max_error);
+		}
+
+		// by strips of rows
+		for (uint32_t first_row = 0; first_row < height;) {
+			uint32_t rows = 1u + ((uint32_t)rand() % 6u);
+			rows = ((first_row + rows) > height) ? (height - first_row) : rows;
+			(void)memset(decoded, 0xa5, stride * rows);
+			if (!UI_IMAGE_COMPRESSED_decode_rows(header, first_row, rows, decoded, stride)) {
+				(void)printf("%s: cannot decode the rows %u to %u\n", name, first_row, first_row + rows - 1u);
+				errors++;
+			} else {
+				_compare(name, source, stride, decoded, stride, width, first_row, rows, bpp, max_error);
+			}
+			first_row += rows;
+		}
+
+		// a destination too small
+		if (0u != UI_IMAGE_COMPRESSED_encode(source, stride, width, height, encoding, format, (uint8_t *)encoded,
+		                                     size - 1u)) {
+			(void)printf("%s: encoded in a destination too small\n", name);
+			errors++;
+		}
+	}
+
+	free(encoded);
+	free(decoded);
+	free(source);
+}
+
+/*
+ * @brief Checks that the decoding of a RLE image whose last row is truncated fails.
+ */
+static void _test_truncated_data(void) {
+	uint32_t width = 50u;
+	uint32_t height = 5u;
+	uint32_t stride = (width + ROW_PADDING) * 2u;
+	uint8_t *source = (uint8_t *)malloc(stride * height);
+	uint8_t *decoded = (uint8_t *)malloc(stride * height);
+	uint32_t max_size = UI_IMAGE_COMPRESSED_get_max_size(width, height, UI_IMAGE_COMPRESSED_ENCODING_RLE,
+	                                                     UI_IMAGE_COMPRESSED_FORMAT_RGB565);
+	uint32_t *encoded = (uint32_t *)malloc(max_size);
+
+	_generate(source, stride, width, height, 2u, IMAGE_NOISE);
+	(void)UI_IMAGE_COMPRESSED_encode(source, stride, width, height, UI_IMAGE_COMPRESSED_ENCODING_RLE,
+	                                 UI_IMAGE_COMPRESSED_FORMAT_RGB565, (uint8_t *)encoded, max_size);
+	UI_IMAGE_COMPRESSED_header_t *header = (UI_IMAGE_COMPRESSED_header_t *)encoded;
+	header->data_size -= 2u;
+	if (UI_IMAGE_COMPRESSED_decode_rows(header, height - 1u, 1u, decoded, stride)) {
+		(void)printf("truncated data: decoded\n");
+		errors++;
+	}
+
+	free(encoded);
+	free(decoded);
+	free(source);
+}
+
+int main(void) {
+	static const uint8_t encodings[] = { UI_IMAGE_COMPRESSED_ENCODING_RLE, UI_IMAGE_COMPRESSED_ENCODING_BLOCK };
+	static const uint8_t formats[] = { UI_IMAGE_COMPRESSED_FORMAT_RGB565, UI_IMAGE_COMPRESSED_FORMAT_ARGB8888_PRE };
+
+	srand(30);
+
+	for (uint32_t kind = 0; kind < (uint32_t)IMAGE_KIND_COUNT; kind++) {
+		for (uint32_t e = 0; e < 2u; e++) {
+			for (uint32_t f = 0; f < 2u; f++) {
+				for (uint32_t w = 0; w < (sizeof(widths) / sizeof(widths[0])); w++) {
+					for (uint32_t h = 0; h < (sizeof(heights) / sizeof(heights[0])); h++) {
+						_test_image(widths[w], heights[h], encodings[e], formats[f], (image_kind_t)kind);
+					}
+				}
+				(void)printf("%-18s %-5s %-12s compression ratio %5.2f\n", kind_names[kind], (0u == e) ? "RLE" : "BLOCK",
+				             (0u == f) ? "RGB565" : "ARGB8888_PRE",
+				             (double)source_bytes[kind][e][f] / (double)encoded_bytes[kind][e][f]);
+			}
+		}
+	}
+
+	_test_truncated_data();
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the MicroUI images heap (LLUI_DISPLAY_HEAP_impl.c): replays a random
+ * workload of image allocations and frees and checks after each operation that the largest
+ * free block and the free space reported by microui_heap.h match the free blocks of the
+ * best fit allocator, and that retrieving them does not call the allocator.
+ *
+ * The best fit allocator is a host stand-in implemented below: a block is a header word
+ * (full size, free flag), the data and a footer word (full size); the free blocks are
+ * merged with their neighbors. The heap is mapped in the low 2GB of the address space
+ * because the allocator receives the addresses as int32_t.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DUI_FEATURE_ALLOCATOR=UI_FEATURE_ALLOCATOR_BESTFIT -Iui/test/stubs -Iui/inc \
+ *		ui/test/image_heap_test.c ui/src/LLUI_DISPLAY_HEAP_impl.c -o image_heap_test
+ *	./image_heap_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include "BESTFIT_ALLOCATOR.h"
+#include "microui_heap.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+#define HEAP_SIZE (4u * 1024u * 1024u)
+#define OPERATIONS (20000u)
+
+/*
+ * @brief Maximum number of blocks allocated at the same time: below BESTFIT_TRACKED_BLOCKS
+ * in the first half of the workload (exact largest free block), above in the second half
+ * (upper bound).
+ */
+#define MAX_BLOCKS_EXACT (96u)
+#define MAX_BLOCKS_UPPER_BOUND (192u)
+
+#define MAIN_HEADER_SIZE (68u)
+#define BLOCK_OVERHEAD (8u)
+#define MIN_BLOCK_SIZE (16u)
+#define FREE_FLAG (0x80000000u)
+#define SIZE_MASK (0x7ffffffu)
+
+// --------------------------------------------------------------------------------
+// LLUI_DISPLAY_impl.h functions (implemented by LLUI_DISPLAY_HEAP_impl.c)
+// --------------------------------------------------------------------------------
+
+void LLUI_DISPLAY_IMPL_imageHeapInitialize(uint8_t *heap_start, uint8_t *heap_limit);
+uint8_t * LLUI_DISPLAY_IMPL_imageHeapAllocate(uint32_t size);
+void LLUI_DISPLAY_IMPL_imageHeapFree(uint8_t *block);
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static BESTFIT_ALLOCATOR *allocator;
+static uint32_t allocator_calls;
+
+static uint8_t *blocks[MAX_BLOCKS_UPPER_BOUND];
+static uint32_t blocks_number;
+
+// --------------------------------------------------------------------------------
+// Best fit allocator stand-in
+// --------------------------------------------------------------------------------
+
+static inline uint32_t _get_word(const uint8_t *addr) {
+	return *(const uint32_t *)addr;
+}
+
+static inline void _set_block(uint8_t *block, uint32_t size, uint32_t flags) {
+	*(uint32_t *)block = size | flags;
+	*(uint32_t *)&block[size - sizeof(uint32_t)] = size;
+}
+
+void BESTFIT_ALLOCATOR_new(BESTFIT_ALLOCATOR *env) {
+	env->start = NULL;
+	env->limit = NULL;
+}
+
+void BESTFIT_ALLOCATOR_initialize(BESTFIT_ALLOCATOR *env, int32_t start, int32_t limit) {
+	allocator = env;
+	env->start = (uint8_t *)(uintptr_t)(uint32_t)start + MAIN_HEADER_SIZE;
+	env->limit = (uint8_t *)(uintptr_t)(uint32_t)limit;
+	_set_block(env->start, (uint32_t)(env->limit - env->start), FREE_FLAG);
+}
+
+void * BESTFIT_ALLOCATOR_allocate(BESTFIT_ALLOCATOR *env, int32_t size) {
+	allocator_calls++;
+	uint32_t full_size = (((uint32_t)size + 3u) & ~3u) + BLOCK_OVERHEAD;
+	full_size = (full_size < MIN_BLOCK_SIZE) ? MIN_BLOCK_SIZE : full_size;
+
+	uint8_t *best = NULL;
+	for (uint8_t *block = env->start; block < env->limit; block += _get_word(block) & SIZE_MASK) {
+		uint32_t block_size = _get_word(block) & SIZE_MASK;
+		if ((0u != (_get_word(block) & FREE_FLAG)) && (block_size >= full_size) &&
+		    ((NULL == best) || (block_size < (_get_word(best) & SIZE_MASK)))) {
+			best = block;
+		}
+	}
+
+	void *ret = NULL;
+	if (NULL != best) {
+		uint32_t best_size = _get_word(best) & SIZE_MASK;
+		if ((best_size - full_size) >= MIN_BLOCK_SIZE) {
+			_set_block(&best[full_size], best_size - full_size, FREE_FLAG);
+		} else {
+			full_size = best_size;
+		}
+		_set_block(best, full_size, 0u);
+		ret = &best[sizeof(uint32_t)];
+	}
+	return ret;
+}
+
+void BESTFIT_ALLOCATOR_free(BESTFIT_ALLOCATOR *env, void *addr) {
+	allocator_calls++;
+	uint8_t *block = (uint8_t *)addr - sizeof(uint32_t);
+	uint32_t size = _get_word(block) & SIZE_MASK;
+
+	uint8_t *next = &block[size];
+	if ((next < env->limit) && (0u != (_get_word(next) & FREE_FLAG))) {
+		size += _get_word(next) & SIZE_MASK;
+	}
+	if (block > env->start) {
+		uint32_t previous_size = _get_word(block - sizeof(uint32_t));
+		uint8_t *previous = block - previous_size;
+		if (0u != (_get_word(previous) & FREE_FLAG)) {
+			block = previous;
+			size += previous_size;
+		}
+	}
+	_set_block(block, size, FREE_FLAG);
+}
+
+/*
+ * @brief Walks the blocks of the stand-in: gets the largest block it can allocate and
+ * its free space.
+ */
+static uint32_t _walk_free_blocks(uint32_t *free_space) {
+	uint32_t largest = 0;
+	*free_space = 0;
+	for (uint8_t *block = allocator->start; block < allocator->limit; block += _get_word(block) & SIZE_MASK) {
+		uint32_t block_size = _get_word(block) & SIZE_MASK;
+		if (0u != (_get_word(block) & FREE_FLAG)) {
+			*free_space += block_size;
+			if ((block_size - BLOCK_OVERHEAD) > largest) {
+				largest = block_size - BLOCK_OVERHEAD;
+			}
+		}
+	}
+	return largest;
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static double _now_us(void) {
+	struct timespec ts;
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((double)ts.tv_sec * 1e6) + ((double)ts.tv_nsec / 1e3);
+}
+
+/*
+ * @brief Gets the size of an image: mostly icons (1-16 KB), some large images (up to
+ * 256 KB) and some buffered images of the display size (261120 bytes).
+ */
+static uint32_t _get_image_size(void) {
+	uint32_t kind = (uint32_t)rand() % 10u;
+	uint32_t size;
+	if (kind < 6u) {
+		size = 1024u + ((uint32_t)rand() % (15u * 1024u));
+	} else if (kind < 9u) {
+		size = 16u * 1024u + ((uint32_t)rand() % (240u * 1024u));
+	} else {
+		size = 480u * 272u * 2u;
+	}
+	return size;
+}
+
+/*
+ * @brief Gets the largest block by dichotomy with some allocations (as before the
+ * tracking of the blocks): checks that the reported block can be allocated and compares
+ * the time.
+ */
+static uint32_t _probe_largest_block(void) {
+	uint32_t min = 0;
+	uint32_t max = MICROUI_HEAP_free_space();
+	while (min < max) {
+		uint32_t size = min + ((max - min + 1u) / 2u);
+		void *block = BESTFIT_ALLOCATOR_allocate(allocator, (int32_t)size);
+		if (NULL != block) {
+			BESTFIT_ALLOCATOR_free(allocator, block);
+			min = size;
+		} else {
+			max = size - 1u;
+		}
+	}
+	return min;
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	uint8_t *heap = (uint8_t *)mmap(NULL, HEAP_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT,
+	                                -1, 0);
+	if (MAP_FAILED == heap) {
+		(void)printf("cannot map the heap\n");
+		return 1;
+	}
+
+	LLUI_DISPLAY_IMPL_imageHeapInitialize(heap, &heap[HEAP_SIZE]);
+	srand(34);
+
+	uint32_t errors = 0;
+	uint32_t failed_allocations = 0;
+	uint32_t max_fragmentation = 0;
+	double tracked_time = 0.0;
+	double probed_time = 0.0;
+
+	for (uint32_t operation = 0; operation < OPERATIONS; operation++) {
+		uint32_t max_blocks = (operation < (OPERATIONS / 2u)) ? MAX_BLOCKS_EXACT : MAX_BLOCKS_UPPER_BOUND;
+		bool exact = MAX_BLOCKS_EXACT == max_blocks;
+
+		if ((blocks_number < max_blocks) && ((0u == blocks_number) || (0u != ((uint32_t)rand() % 3u)))) {
+			uint32_t size = exact ? _get_image_size() : (1024u + ((uint32_t)rand() % 4096u));
+			uint8_t *block = LLUI_DISPLAY_IMPL_imageHeapAllocate(size);
+			if (NULL != block) {
+				blocks[blocks_number] = block;
+				blocks_number++;
+			} else {
+				failed_allocations++;
+			}
+		} else {
+			uint32_t index = (uint32_t)rand() % blocks_number;
+			LLUI_DISPLAY_IMPL_imageHeapFree(blocks[index]);
+			blocks_number--;
+			blocks[index] = blocks[blocks_number];
+		}
+
+		uint32_t free_space;
+		uint32_t expected = _walk_free_blocks(&free_space);
+
+		uint32_t calls = allocator_calls;
+		double t0 = _now_us();
+		uint32_t largest = MICROUI_HEAP_largest_free_block();
+		uint32_t fragmentation = MICROUI_HEAP_fragmentation();
+		tracked_time += _now_us() - t0;
+
+		if (calls != allocator_calls) {
+			(void)printf("operation %u: the allocator has been called\n", operation);
+			errors++;
+		}
+		if (free_space != MICROUI_HEAP_free_space()) {
+			(void)printf("operation %u: free space %u, expected %u\n", operation, MICROUI_HEAP_free_space(), free_space);
+			errors++;
+		}
+		if ((exact && (largest != expected)) || (largest < expected)) {
+			(void)printf("operation %u: largest free block %u, expected %u (%u blocks)\n", operation, largest, expected,
+			             blocks_number);
+			errors++;
+		}
+		max_fragmentation = (fragmentation > max_fragmentation) ? fragmentation : max_fragmentation;
+
+		if (0u == (operation % 100u)) {
+			t0 = _now_us();
+			uint32_t probed = _probe_largest_block();
+			probed_time += _now_us() - t0;
+			if (exact && (probed != largest)) {
+				(void)printf("operation %u: largest free block %u, allocatable %u\n", operation, largest, probed);
+				errors++;
+			}
+		}
+	}
+
+	(void)printf("%u operations, %u failed allocations, fragmentation up to %u%%\n", OPERATIONS, failed_allocations,
+	             max_fragmentation);
+	(void)printf("largest free block: %.3f us (tracked blocks), %.3f us (dichotomy)\n", tracked_time / OPERATIONS,
+	             probed_time / (OPERATIONS / 100u));
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
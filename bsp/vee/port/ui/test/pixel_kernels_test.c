@@ -0,0 +1,275 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host validation of the pixel kernels (ui_pixel_kernels.c): compares each kernel
+ * with a scalar reference (one channel at a time, rounded division by 255) for all the
+ * opacities, for several alignments of the buffers and for all the lengths of the tails
+ * that are not processed by the unrolled loops. The pixels around the spans are checked
+ * to be left unchanged.
+ *
+ * On the host, the portable C version of the kernels is validated; the DSP version gives
+ * the same results (see ui_pixel_kernels.h).
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -Iui/test/stubs -Iui/inc ui/test/pixel_kernels_test.c ui/src/ui_pixel_kernels.c \
+ *		-o pixel_kernels_test
+ *	./pixel_kernels_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ui_pixel_kernels.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Maximum length of a span: covers several iterations of the unrolled loops and
+ * all their tails.
+ */
+#define MAX_COUNT (70u)
+
+/*
+ * @brief Maximum offset (in pixels or in bytes) of a span in its buffer.
+ */
+#define MAX_OFFSET (4u)
+
+/*
+ * @brief Number of pixels before and after a span.
+ */
+#define GUARD (4u)
+
+#define BUFFER_LENGTH (MAX_OFFSET + MAX_COUNT + GUARD)
+#define GUARD_PIXEL (0xa5a5a5a5u)
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static uint32_t errors;
+
+// --------------------------------------------------------------------------------
+// Reference functions
+// --------------------------------------------------------------------------------
+
+static uint32_t _div255(uint32_t value) {
+	// 255 is odd: value / 255 is never a half, (value + 127) / 255 is the rounded division
+	return (value + 127u) / 255u;
+}
+
+static uint32_t _get_channel(uint32_t pixel, uint32_t channel) {
+	return (pixel >> (channel * 8u)) & 0xffu;
+}
+
+/*
+ * @brief Converts a RGB565 pixel in an opaque ARGB8888 pixel: the high bits of each
+ * channel are copied in its low bits (as the Graphics Engine does).
+ */
+static uint32_t _rgb565_to_argb8888(uint16_t pixel) {
+	uint32_t red = ((uint32_t)pixel >> 11) & 0x1fu;
+	uint32_t green = ((uint32_t)pixel >> 5) & 0x3fu;
+	uint32_t blue = (uint32_t)pixel & 0x1fu;
+	red = (red * 0x21u) >> 2;
+	green = (green * 0x41u) >> 4;
+	blue = (blue * 0x21u) >> 2;
+	return 0xff000000u | (red << 16) | (green << 8) | blue;
+}
+
+static uint16_t _argb8888_to_rgb565(uint32_t pixel) {
+	return (uint16_t)(((_get_channel(pixel, 2u) >> 3) << 11) | ((_get_channel(pixel, 1u) >> 2) << 5) |
+	                  (_get_channel(pixel, 0u) >> 3));
+}
+
+static uint16_t _reference_blend_rgb565(uint16_t src, uint16_t dest, uint32_t alpha) {
+	uint32_t s = _rgb565_to_argb8888(src);
+	uint32_t d = _rgb565_to_argb8888(dest);
+	uint32_t ret = 0;
+	for (uint32_t channel = 0; channel < 3u; channel++) {
+		uint32_t c = _div255((_get_channel(s, channel) * alpha) + (_get_channel(d, channel) * (255u - alpha)));
+		ret |= c << (channel * 8u);
+	}
+	return _argb8888_to_rgb565(ret);
+}
+
+static uint16_t _reference_blend_argb8888_pre(uint32_t src, uint16_t dest, uint32_t alpha) {
+	uint32_t s = 0;
+	for (uint32_t channel = 0; channel < 4u; channel++) {
+		s |= _div255(_get_channel(src, channel) * alpha) << (channel * 8u);
+	}
+
+	uint32_t src_alpha = _get_channel(s, 3u);
+	uint16_t ret = dest;
+	if (0u != src_alpha) {
+		uint32_t d = _rgb565_to_argb8888(dest);
+		uint32_t pixel = 0;
+		for (uint32_t channel = 0; channel < 3u; channel++) {
+			uint32_t c = _get_channel(s, channel) + _div255(_get_channel(d, channel) * (255u - src_alpha));
+			pixel |= c << (channel * 8u);
+		}
+		ret = _argb8888_to_rgb565(pixel);
+	}
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static uint32_t _random_pixel(void) {
+	return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+/*
+ * @brief Gets a random premultiplied ARGB8888 pixel (each color channel lower than or
+ * equal to the alpha channel); one pixel out of four is opaque, one out of eight is
+ * transparent.
+ */
+static uint32_t _random_premultiplied_pixel(void) {
+	uint32_t kind = (uint32_t)rand() % 8u;
+	uint32_t alpha = (kind < 2u) ? 255u : ((2u == kind) ? 0u : ((uint32_t)rand() % 256u));
+	uint32_t pixel = alpha << 24;
+	for (uint32_t channel = 0; channel < 3u; channel++) {
+		pixel |= ((uint32_t)rand() % (alpha + 1u)) << (channel * 8u);
+	}
+	return pixel;
+}
+
+static void _check(const char *kernel, uint32_t offset, uint32_t count, uint32_t index, uint32_t value,
+                   uint32_t expected) {
+	if (value != expected) {
+		if (errors < 20u) {
+			(void)printf("%s (offset %u, count %u): pixel %u is 0x%08x, expected 0x%08x\n", kernel, offset, count,
+			             index, value, expected);
+		}
+		errors++;
+	}
+}
+
+static void _test_fill_16(void) {
+	uint16_t buffer[BUFFER_LENGTH];
+	for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+		for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+			uint16_t pixel = (uint16_t)_random_pixel();
+			(void)memset(buffer, 0xa5, sizeof(buffer));
+			UI_PIXEL_KERNELS_fill_16(&buffer[offset], pixel, count);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				bool in_span = (i >= offset) && (i < (offset + count));
+				_check("fill_16", offset, count, i, buffer[i], in_span ? pixel : (uint16_t)GUARD_PIXEL);
+			}
+		}
+	}
+}
+
+static void _test_fill_32(void) {
+	uint32_t buffer[BUFFER_LENGTH];
+	for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+		for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+			uint32_t pixel = _random_pixel();
+			(void)memset(buffer, 0xa5, sizeof(buffer));
+			UI_PIXEL_KERNELS_fill_32(&buffer[offset], pixel, count);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				bool in_span = (i >= offset) && (i < (offset + count));
+				_check("fill_32", offset, count, i, buffer[i], in_span ? pixel : GUARD_PIXEL);
+			}
+		}
+	}
+}
+
+static void _test_convert_rgb888_to_argb8888(void) {
+	uint8_t src[(BUFFER_LENGTH * 3u) + MAX_OFFSET];
+	uint32_t dest[BUFFER_LENGTH];
+	for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+		for (uint32_t count = 0; count <= MAX_COUNT; count++) {
+			for (uint32_t i = 0; i < sizeof(src); i++) {
+				src[i] = (uint8_t)rand();
+			}
+			(void)memset(dest, 0xa5, sizeof(dest));
+			// the source is not aligned (offset in bytes), the destination is (offset in pixels)
+			const uint8_t *s = &src[offset];
+			UI_PIXEL_KERNELS_convert_rgb888_to_argb8888(&dest[offset], s, count);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				uint32_t expected = GUARD_PIXEL;
+				if ((i >= offset) && (i < (offset + count))) {
+					const uint8_t *p = &s[(i - offset) * 3u];
+					expected = 0xff000000u | ((uint32_t)p[2] << 16) | ((uint32_t)p[1] << 8) | (uint32_t)p[0];
+				}
+				_check("convert_rgb888_to_argb8888", offset, count, i, dest[i], expected);
+			}
+		}
+	}
+}
+
+static void _test_blend_rgb565_on_rgb565(void) {
+	uint16_t src[BUFFER_LENGTH];
+	uint16_t dest[BUFFER_LENGTH];
+	uint16_t expected[BUFFER_LENGTH];
+	for (uint32_t alpha = 0; alpha <= 255u; alpha++) {
+		for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+			uint32_t count = (uint32_t)rand() % (MAX_COUNT + 1u);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				src[i] = (uint16_t)_random_pixel();
+				dest[i] = (uint16_t)_random_pixel();
+				bool in_span = (i >= offset) && (i < (offset + count));
+				expected[i] = in_span ? _reference_blend_rgb565(src[i], dest[i], alpha) : dest[i];
+			}
+			UI_PIXEL_KERNELS_blend_rgb565_on_rgb565(&dest[offset], &src[offset], alpha, count);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				_check("blend_rgb565_on_rgb565", offset, count, i, dest[i], expected[i]);
+			}
+		}
+	}
+}
+
+static void _test_blend_argb8888_pre_on_rgb565(void) {
+	uint32_t src[BUFFER_LENGTH];
+	uint16_t dest[BUFFER_LENGTH];
+	uint16_t expected[BUFFER_LENGTH];
+	for (uint32_t alpha = 0; alpha <= 255u; alpha++) {
+		for (uint32_t offset = 0; offset < MAX_OFFSET; offset++) {
+			uint32_t count = (uint32_t)rand() % (MAX_COUNT + 1u);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				src[i] = _random_premultiplied_pixel();
+				dest[i] = (uint16_t)_random_pixel();
+				bool in_span = (i >= offset) && (i < (offset + count));
+				expected[i] = in_span ? _reference_blend_argb8888_pre(src[i], dest[i], alpha) : dest[i];
+			}
+			UI_PIXEL_KERNELS_blend_argb8888_pre_on_rgb565(&dest[offset], &src[offset], alpha, count);
+			for (uint32_t i = 0; i < BUFFER_LENGTH; i++) {
+				_check("blend_argb8888_pre_on_rgb565", offset, count, i, dest[i], expected[i]);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	srand(33);
+
+	_test_fill_16();
+	_test_fill_32();
+	_test_convert_rgb888_to_argb8888();
+	_test_blend_rgb565_on_rgb565();
+	_test_blend_argb8888_pre_on_rgb565();
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the best fit allocator header (see ../README.rst). The functions
+ * are implemented by the test (the addresses are given as int32_t: the heap must be mapped
+ * in the low 2GB of the address space).
+ */
+
+#ifndef BESTFIT_ALLOCATOR_H
+#define BESTFIT_ALLOCATOR_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint8_t *start;
+	uint8_t *limit;
+} BESTFIT_ALLOCATOR;
+
+void BESTFIT_ALLOCATOR_new(BESTFIT_ALLOCATOR *env);
+void BESTFIT_ALLOCATOR_initialize(BESTFIT_ALLOCATOR *env, int32_t start, int32_t limit);
+void * BESTFIT_ALLOCATOR_allocate(BESTFIT_ALLOCATOR *env, int32_t size);
+void BESTFIT_ALLOCATOR_free(BESTFIT_ALLOCATOR *env, void *block);
+
+#endif // BESTFIT_ALLOCATOR_H
@@ -0,0 +1,16 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the Graphics Engine header (see ../README.rst).
+ */
+
+#ifndef LLDW_PAINTER_impl_H
+#define LLDW_PAINTER_impl_H
+
+#include "LLUI_DISPLAY.h"
+
+#endif // LLDW_PAINTER_impl_H
@@ -0,0 +1,26 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the trace header: the events are not recorded (see ../README.rst).
+ */
+
+#ifndef LLTRACE_H
+#define LLTRACE_H
+
+#include <stdint.h>
+
+#define LLTRACE_record_event_void(...) ((void)0)
+#define LLTRACE_record_event_u32(...) ((void)0)
+#define LLTRACE_record_event_u32x2(...) ((void)0)
+#define LLTRACE_record_event_u32x3(...) ((void)0)
+#define LLTRACE_record_event_u32x4(...) ((void)0)
+#define LLTRACE_record_event_u32x5(...) ((void)0)
+#define LLTRACE_record_event_u32x6(...) ((void)0)
+#define LLTRACE_record_event_end(...) ((void)0)
+#define LLTRACE_record_event_end_u32(...) ((void)0)
+
+#endif // LLTRACE_H
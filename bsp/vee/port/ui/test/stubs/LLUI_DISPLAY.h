@@ -0,0 +1,153 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the Graphics Engine header: only the types and the functions used by
+ * the host tests (see ../README.rst). The image's pixels are given by the field "data"; the
+ * display is an image whose field "flags" is LLUI_DISPLAY_STUB_FLAG_LCD.
+ */
+
+#ifndef LLUI_DISPLAY_H
+#define LLUI_DISPLAY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sni.h"
+#include "ui_rect.h"
+#include "display_support.h"
+
+#define LLUI_DISPLAY_STUB_FLAG_LCD (0x01u)
+#define LLUI_DISPLAY_STUB_FLAG_TRANSPARENT (0x02u)
+#define LLUI_DISPLAY_STUB_FLAG_CLOSED (0x04u)
+
+typedef enum {
+	MICROUI_IMAGE_FORMAT_LCD = 0,
+	MICROUI_IMAGE_FORMAT_ARGB8888 = 2,
+	MICROUI_IMAGE_FORMAT_RGB888 = 3,
+	MICROUI_IMAGE_FORMAT_RGB565 = 4,
+	MICROUI_IMAGE_FORMAT_A4 = 7,
+	MICROUI_IMAGE_FORMAT_A8 = 8,
+	MICROUI_IMAGE_FORMAT_A2 = 11,
+	MICROUI_IMAGE_FORMAT_A1 = 12,
+	MICROUI_IMAGE_FORMAT_C4 = 13,
+	MICROUI_IMAGE_FORMAT_C2 = 14,
+	MICROUI_IMAGE_FORMAT_C1 = 15,
+	MICROUI_IMAGE_FORMAT_ARGB8888_PRE = 24,
+	MICROUI_IMAGE_FORMAT_CUSTOM_0 = 247,
+} MICROUI_ImageFormat;
+
+typedef struct {
+	jchar width;
+	jchar height;
+	jbyte format;
+	uint8_t flags;
+	uint32_t stride;
+	uint8_t *data;
+} MICROUI_Image;
+
+typedef struct {
+	MICROUI_Image image;
+	ui_rect_t clip;
+	uint32_t foreground_color;
+	uint32_t background_color;
+	uint8_t drawer;
+	bool clip_enabled;
+} MICROUI_GraphicsContext;
+
+typedef struct {
+	jbyte format;
+} MICROUI_Font;
+
+typedef struct MICROUI_RenderableString MICROUI_RenderableString;
+
+typedef enum {
+	DRAWING_DONE = 0,
+	DRAWING_RUNNING = 1,
+} DRAWING_Status;
+
+typedef enum {
+	DRAWING_ENDOFLINE_NONE,
+	DRAWING_ENDOFLINE_FADED,
+	DRAWING_ENDOFLINE_ROUNDED,
+	DRAWING_ENDOFLINE_PERPENDICULAR,
+} DRAWING_Cap;
+
+typedef enum {
+	DRAWING_FLIP_NONE = 0,
+	DRAWING_FLIP_90,
+	DRAWING_FLIP_180,
+	DRAWING_FLIP_270,
+	DRAWING_FLIP_MIRROR,
+	DRAWING_FLIP_MIRROR_90,
+	DRAWING_FLIP_MIRROR_180,
+	DRAWING_FLIP_MIRROR_270,
+} DRAWING_Flip;
+
+typedef void (*SNI_callback)(void);
+
+static inline uint8_t * LLUI_DISPLAY_getBufferAddress(MICROUI_Image *image) {
+	return image->data;
+}
+
+static inline uint32_t LLUI_DISPLAY_getImageBPP(MICROUI_Image *image) {
+	uint32_t ret;
+	switch ((MICROUI_ImageFormat)image->format) {
+	case MICROUI_IMAGE_FORMAT_ARGB8888:
+	case MICROUI_IMAGE_FORMAT_ARGB8888_PRE:
+		ret = 32u;
+		break;
+	case MICROUI_IMAGE_FORMAT_RGB888:
+		ret = 24u;
+		break;
+	case MICROUI_IMAGE_FORMAT_A8:
+		ret = 8u;
+		break;
+	case MICROUI_IMAGE_FORMAT_LCD:
+		// the format of the frame buffers (see DEMO_USE_XRGB8888)
+		ret = 8u * DEMO_BUFFER_BYTE_PER_PIXEL;
+		break;
+	default:
+		ret = 16u;
+		break;
+	}
+	return ret;
+}
+
+static inline uint32_t LLUI_DISPLAY_getStrideInBytes(MICROUI_Image *image) {
+	return image->stride;
+}
+
+static inline bool LLUI_DISPLAY_isLCD(MICROUI_Image *image) {
+	return 0u != (image->flags & LLUI_DISPLAY_STUB_FLAG_LCD);
+}
+
+static inline bool LLUI_DISPLAY_isTransparent(MICROUI_Image *image) {
+	return 0u != (image->flags & LLUI_DISPLAY_STUB_FLAG_TRANSPARENT);
+}
+
+static inline bool LLUI_DISPLAY_isImageClosed(MICROUI_Image *image) {
+	return 0u != (image->flags & LLUI_DISPLAY_STUB_FLAG_CLOSED);
+}
+
+static inline bool LLUI_DISPLAY_isClipEnabled(MICROUI_GraphicsContext *gc) {
+	return gc->clip_enabled;
+}
+
+static inline void LLUI_DISPLAY_configureClip(MICROUI_GraphicsContext *gc, bool enable) {
+	gc->clip_enabled = enable;
+}
+
+/*
+ * @brief Implemented by the host test.
+ */
+MICROUI_Image * LLUI_DISPLAY_getSourceImage(MICROUI_Image *image);
+bool LLUI_DISPLAY_clipRectangle(MICROUI_GraphicsContext *gc, jint *x1, jint *y1, jint *x2, jint *y2);
+jboolean LLUI_DISPLAY_requestDrawing(MICROUI_GraphicsContext *gc, SNI_callback callback);
+void LLUI_DISPLAY_setDrawingStatus(DRAWING_Status status);
+
+#endif // LLUI_DISPLAY_H
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the Graphics Engine header (see ../README.rst).
+ */
+
+#ifndef LLUI_DISPLAY_impl_H
+#define LLUI_DISPLAY_impl_H
+
+#include "LLUI_DISPLAY.h"
+
+/*
+ * @brief Implemented by LLUI_DISPLAY_HEAP_impl.c or by the host test.
+ */
+void LLUI_DISPLAY_IMPL_imageHeapInitialize(uint8_t *heap_start, uint8_t *heap_limit);
+uint8_t * LLUI_DISPLAY_IMPL_imageHeapAllocate(uint32_t size);
+void LLUI_DISPLAY_IMPL_imageHeapFree(uint8_t *block);
+
+/*
+ * @brief Implemented by the display buffer strategies (ui_display_brs_*.c) or by the host test.
+ */
+DRAWING_Status LLUI_DISPLAY_IMPL_newDrawingRegion(MICROUI_GraphicsContext *gc, ui_rect_t *region, bool drawing_now);
+DRAWING_Status LLUI_DISPLAY_IMPL_refresh(MICROUI_GraphicsContext *gc, uint8_t flushIdentifier);
+void LLUI_DISPLAY_IMPL_flush(MICROUI_GraphicsContext *gc, uint8_t flushIdentifier, const ui_rect_t regions[],
+                             size_t length);
+
+#endif // LLUI_DISPLAY_impl_H
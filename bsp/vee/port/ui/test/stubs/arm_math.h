@@ -0,0 +1,29 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the CMSIS-DSP header: only the type and the functions used by
+ * the port (see ../README.rst).
+ */
+
+#ifndef ARM_MATH_H
+#define ARM_MATH_H
+
+#include <math.h>
+
+typedef float float32_t;
+
+#define PI 3.14159265358979f
+
+static inline float32_t arm_sin_f32(float32_t x) {
+	return sinf(x);
+}
+
+static inline float32_t arm_cos_f32(float32_t x) {
+	return cosf(x);
+}
+
+#endif // ARM_MATH_H
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the SDK header: the size and the format of the frame buffer (see
+ * ../README.rst).
+ */
+
+#ifndef DISPLAY_SUPPORT_H
+#define DISPLAY_SUPPORT_H
+
+#define DEMO_BUFFER_WIDTH (720)
+#define DEMO_BUFFER_HEIGHT (1280)
+
+#ifndef DEMO_USE_XRGB8888
+#define DEMO_USE_XRGB8888 0
+#endif
+
+#if DEMO_USE_XRGB8888
+#define DEMO_BUFFER_BYTE_PER_PIXEL 4
+#else
+#define DEMO_BUFFER_BYTE_PER_PIXEL 2
+#endif
+
+#endif // DISPLAY_SUPPORT_H
@@ -0,0 +1,18 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the SDK header: the console (see ../README.rst).
+ */
+
+#ifndef FSL_DEBUG_CONSOLE_H
+#define FSL_DEBUG_CONSOLE_H
+
+#include <stdio.h>
+
+#define PRINTF printf
+
+#endif // FSL_DEBUG_CONSOLE_H
@@ -0,0 +1,18 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the header generated by the MicroUI configuration (see ../README.rst).
+ */
+
+#ifndef MICROUI_CONSTANTS_H
+#define MICROUI_CONSTANTS_H
+
+#define MICROUI_EVENTGEN_COMMANDS (0)
+#define MICROUI_EVENTGEN_BUTTONS (1)
+#define MICROUI_EVENTGEN_TOUCH (2)
+
+#endif // MICROUI_CONSTANTS_H
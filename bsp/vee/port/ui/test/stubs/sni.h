@@ -0,0 +1,27 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the SNI header: the Java types (see ../README.rst).
+ */
+
+#ifndef SNI_H
+#define SNI_H
+
+#include <stdint.h>
+
+typedef int32_t jint;
+typedef int64_t jlong;
+typedef int8_t jbyte;
+typedef uint16_t jchar;
+typedef float jfloat;
+typedef double jdouble;
+typedef uint8_t jboolean;
+
+#define JTRUE ((jboolean)1)
+#define JFALSE ((jboolean)0)
+
+#endif // SNI_H
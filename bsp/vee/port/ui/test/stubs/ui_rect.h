@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host stand-in of the Graphics Engine header: the rectangle (see ../README.rst).
+ */
+
+#ifndef UI_RECT_H
+#define UI_RECT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+	int16_t x1;
+	int16_t y1;
+	int16_t x2;
+	int16_t y2;
+} ui_rect_t;
+
+static inline ui_rect_t UI_RECT_new_xyxy(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+	ui_rect_t rect = { (int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y2 };
+	return rect;
+}
+
+static inline int32_t UI_RECT_get_width(const ui_rect_t *rect) {
+	return rect->x2 - rect->x1 + 1;
+}
+
+static inline int32_t UI_RECT_get_height(const ui_rect_t *rect) {
+	return rect->y2 - rect->y1 + 1;
+}
+
+static inline bool UI_RECT_is_empty(const ui_rect_t *rect) {
+	return (rect->x1 > rect->x2) || (rect->y1 > rect->y2);
+}
+
+static inline void UI_RECT_mark_empty(ui_rect_t *rect) {
+	rect->x1 = 0;
+	rect->x2 = -1;
+	rect->y1 = 0;
+	rect->y2 = -1;
+}
+
+static inline bool UI_RECT_contains_rect(const ui_rect_t *rect, const ui_rect_t *other) {
+	return (rect->x1 <= other->x1) && (rect->y1 <= other->y1) && (rect->x2 >= other->x2) && (rect->y2 >= other->y2);
+}
+
+static inline bool UI_RECT_intersects_rect(const ui_rect_t *rect, const ui_rect_t *other) {
+	return (rect->x1 <= other->x2) && (rect->x2 >= other->x1) && (rect->y1 <= other->y2) && (rect->y2 >= other->y1);
+}
+
+#endif // UI_RECT_H
@@ -0,0 +1,373 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host microbenchmark of the software rotation and scaling (see
+ * UI_FEATURE_SOFTWARE_TRANSFORM): draws the same transformations with ui_drawing_transform.c
+ * and with a per-pixel reference (floating-point source coordinates, bounds check and
+ * format switch for each pixel, as the generic software algorithms do), prints the time of
+ * both and compares the destinations.
+ *
+ * The images are smooth gradients: a sample picked on the other side of a pixel boundary
+ * (fixed-point versus floating-point coordinates) differs by a few levels only. A pixel
+ * is in error when a channel differs by more than TOLERANCE (RGB565 levels).
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DUI_FEATURE_SOFTWARE_TRANSFORM -Iui/test/stubs -Iui/inc -Iutil/inc \
+ *		ui/test/transform_benchmark.c ui/src/ui_drawing_transform.c ui/src/ui_pixel_kernels.c -lm \
+ *		-o transform_benchmark
+ *	./transform_benchmark
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ui_drawing_transform.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+#define WIDTH (480)
+#define HEIGHT (272)
+#define IMAGE_SIZE (160)
+#define ITERATIONS (20)
+
+/*
+ * @brief Maximum difference of a channel (RGB565 levels).
+ */
+#define TOLERANCE (2)
+
+/*
+ * @brief Maximum part of the pixels in error (per thousand).
+ */
+#define MAX_ERRORS_PER_THOUSAND (5u)
+
+#define DEG_TO_RAD (3.14159265358979f / 180.f)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+typedef enum {
+	ROTATED_NEAREST,
+	ROTATED_BILINEAR,
+	SCALED_NEAREST,
+	SCALED_BILINEAR,
+} operation_t;
+
+typedef struct {
+	operation_t operation;
+	MICROUI_ImageFormat format;
+	float parameter; // angle or factor
+	jint alpha;
+} test_case_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static uint16_t background[WIDTH * HEIGHT];
+static uint16_t destination[WIDTH * HEIGHT];
+static uint16_t reference[WIDTH * HEIGHT];
+
+static uint16_t pixels_rgb565[IMAGE_SIZE * IMAGE_SIZE];
+static uint8_t pixels_rgb888[IMAGE_SIZE * IMAGE_SIZE * 3];
+static uint32_t pixels_argb8888[IMAGE_SIZE * IMAGE_SIZE];
+
+static const char *operation_names[] = { "rotated nearest", "rotated bilinear", "scaled nearest", "scaled bilinear" };
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static double _now(void) {
+	struct timespec now;
+	(void)clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((double)now.tv_sec * 1000.0) + ((double)now.tv_nsec / 1000000.0);
+}
+
+static void _init_images(void) {
+	for (int32_t y = 0; y < IMAGE_SIZE; y++) {
+		for (int32_t x = 0; x < IMAGE_SIZE; x++) {
+			uint32_t red = ((uint32_t)x * 255u) / (IMAGE_SIZE - 1u);
+			uint32_t green = ((uint32_t)y * 255u) / (IMAGE_SIZE - 1u);
+			uint32_t blue = 255u - ((red + green) / 2u);
+			uint32_t alpha = 64u + (((uint32_t)(x + y) * 191u) / ((IMAGE_SIZE - 1u) * 2u));
+			int32_t i = (y * IMAGE_SIZE) + x;
+			pixels_rgb565[i] = (uint16_t)(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+			pixels_rgb888[(i * 3) + 0] = (uint8_t)blue;
+			pixels_rgb888[(i * 3) + 1] = (uint8_t)green;
+			pixels_rgb888[(i * 3) + 2] = (uint8_t)red;
+			pixels_argb8888[i] = (alpha << 24) | (red << 16) | (green << 8) | blue;
+		}
+	}
+	for (int32_t i = 0; i < (WIDTH * HEIGHT); i++) {
+		uint32_t level = ((uint32_t)i % WIDTH) * 31u / WIDTH;
+		background[i] = (uint16_t)((level << 11) | (level << 6) | (31u - level));
+	}
+}
+
+static void _init_image(MICROUI_Image *img, MICROUI_ImageFormat format) {
+	img->width = IMAGE_SIZE;
+	img->height = IMAGE_SIZE;
+	img->format = (jbyte)format;
+	img->flags = 0u;
+	switch (format) {
+	case MICROUI_IMAGE_FORMAT_RGB565:
+		img->stride = IMAGE_SIZE * 2u;
+		img->data = (uint8_t *)pixels_rgb565;
+		break;
+	case MICROUI_IMAGE_FORMAT_RGB888:
+		img->stride = IMAGE_SIZE * 3u;
+		img->data = pixels_rgb888;
+		break;
+	default:
+		img->stride = IMAGE_SIZE * 4u;
+		img->data = (uint8_t *)pixels_argb8888;
+		break;
+	}
+}
+
+/*
+ * @brief Reads a source pixel in floating-point ARGB (not premultiplied, [0, 255]).
+ */
+static void _read(const MICROUI_Image *img, int32_t x, int32_t y, float argb[4]) {
+	int32_t i = (y * IMAGE_SIZE) + x;
+	switch ((MICROUI_ImageFormat)img->format) {
+	case MICROUI_IMAGE_FORMAT_RGB565: {
+		uint32_t pixel = pixels_rgb565[i];
+		uint32_t red = (pixel >> 11) & 0x1fu;
+		uint32_t green = (pixel >> 5) & 0x3fu;
+		uint32_t blue = pixel & 0x1fu;
+		argb[0] = 255.f;
+		argb[1] = (float)((red << 3) | (red >> 2));
+		argb[2] = (float)((green << 2) | (green >> 4));
+		argb[3] = (float)((blue << 3) | (blue >> 2));
+		break;
+	}
+	case MICROUI_IMAGE_FORMAT_RGB888:
+		argb[0] = 255.f;
+		argb[1] = (float)pixels_rgb888[(i * 3) + 2];
+		argb[2] = (float)pixels_rgb888[(i * 3) + 1];
+		argb[3] = (float)pixels_rgb888[(i * 3) + 0];
+		break;
+	default:
+		argb[0] = (float)(pixels_argb8888[i] >> 24);
+		argb[1] = (float)((pixels_argb8888[i] >> 16) & 0xffu);
+		argb[2] = (float)((pixels_argb8888[i] >> 8) & 0xffu);
+		argb[3] = (float)(pixels_argb8888[i] & 0xffu);
+		break;
+	}
+}
+
+/*
+ * @brief Samples the source at (u, v) (premultiplied, [0, 255]).
+ */
+static void _sample(const MICROUI_Image *img, float u, float v, bool bilinear, float out[4]) {
+	if (bilinear) {
+		float fu = u - 0.5f;
+		float fv = v - 0.5f;
+		int32_t x0 = (int32_t)floorf(fu);
+		int32_t y0 = (int32_t)floorf(fv);
+		float fx = fu - (float)x0;
+		float fy = fv - (float)y0;
+		float weights[4] = { (1.f - fx) * (1.f - fy), fx * (1.f - fy), (1.f - fx) * fy, fx * fy };
+		(void)memset(out, 0, 4u * sizeof(float));
+		for (int32_t s = 0; s < 4; s++) {
+			int32_t sx = x0 + (s & 1);
+			int32_t sy = y0 + (s >> 1);
+			sx = (sx < 0) ? 0 : ((sx >= IMAGE_SIZE) ? (IMAGE_SIZE - 1) : sx);
+			sy = (sy < 0) ? 0 : ((sy >= IMAGE_SIZE) ? (IMAGE_SIZE - 1) : sy);
+			float argb[4];
+			_read(img, sx, sy, argb);
+			out[0] += weights[s] * argb[0];
+			for (int32_t c = 1; c < 4; c++) {
+				out[c] += weights[s] * argb[c] * argb[0] / 255.f;
+			}
+		}
+	} else {
+		float argb[4];
+		_read(img, (int32_t)u, (int32_t)v, argb);
+		out[0] = argb[0];
+		for (int32_t c = 1; c < 4; c++) {
+			out[c] = argb[c] * argb[0] / 255.f;
+		}
+	}
+}
+
+/*
+ * @brief The reference: each destination pixel computes its source coordinates, checks
+ * them and blends its sample.
+ */
+static void _draw_reference(const MICROUI_Image *img, const test_case_t *test, jint x, jint y) {
+	bool bilinear = (ROTATED_BILINEAR == test->operation) || (SCALED_BILINEAR == test->operation);
+	bool rotated = (ROTATED_NEAREST == test->operation) || (ROTATED_BILINEAR == test->operation);
+	float rad = test->parameter * DEG_TO_RAD;
+	float c = cosf(rad);
+	float s = sinf(rad);
+	float rx = (float)(x + (IMAGE_SIZE / 2));
+	float ry = (float)(y + (IMAGE_SIZE / 2));
+	float opacity = (float)test->alpha / 255.f;
+
+	for (int32_t dy = 0; dy < HEIGHT; dy++) {
+		for (int32_t dx = 0; dx < WIDTH; dx++) {
+			float px = (float)dx + 0.5f;
+			float py = (float)dy + 0.5f;
+			float u;
+			float v;
+			if (rotated) {
+				u = (c * (px - rx)) - (s * (py - ry)) + rx - (float)x;
+				v = (s * (px - rx)) + (c * (py - ry)) + ry - (float)y;
+			} else {
+				u = (px - (float)x) / test->parameter;
+				v = (py - (float)y) / test->parameter;
+			}
+
+			if ((0.f <= u) && (u < (float)IMAGE_SIZE) && (0.f <= v) && (v < (float)IMAGE_SIZE)) {
+				float sample[4];
+				_sample(img, u, v, bilinear, sample);
+				uint32_t pixel = reference[(dy * WIDTH) + dx];
+				float dest[4] = { 255.f, (float)(((pixel >> 11) & 0x1fu) << 3), (float)(((pixel >> 5) & 0x3fu) << 2),
+					              (float)((pixel & 0x1fu) << 3) };
+				float inverse = 1.f - ((sample[0] * opacity) / 255.f);
+				uint32_t red = (uint32_t)((sample[1] * opacity) + (dest[1] * inverse));
+				uint32_t green = (uint32_t)((sample[2] * opacity) + (dest[2] * inverse));
+				uint32_t blue = (uint32_t)((sample[3] * opacity) + (dest[3] * inverse));
+				reference[(dy * WIDTH) + dx] = (uint16_t)(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+			}
+		}
+	}
+}
+
+static void _draw_transform(MICROUI_GraphicsContext *gc, MICROUI_Image *img, const test_case_t *test, jint x, jint y) {
+	jint rotation_x = x + (IMAGE_SIZE / 2);
+	jint rotation_y = y + (IMAGE_SIZE / 2);
+	switch (test->operation) {
+	case ROTATED_NEAREST:
+		(void)UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(gc, img, x, y, rotation_x, rotation_y,
+		                                                           test->parameter, test->alpha);
+		break;
+	case ROTATED_BILINEAR:
+		(void)UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(gc, img, x, y, rotation_x, rotation_y, test->parameter,
+		                                                    test->alpha);
+		break;
+	case SCALED_NEAREST:
+		(void)UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(gc, img, x, y, test->parameter, test->parameter,
+		                                                          test->alpha);
+		break;
+	default:
+		(void)UI_DRAWING_TRANSFORM_drawScaledImageBilinear(gc, img, x, y, test->parameter, test->parameter,
+		                                                   test->alpha);
+		break;
+	}
+}
+
+static int32_t _channel_difference(uint32_t first, uint32_t second, uint32_t shift, uint32_t mask) {
+	return abs((int32_t)((first >> shift) & mask) - (int32_t)((second >> shift) & mask));
+}
+
+/*
+ * @brief Runs a test case: checks the result and prints the times.
+ *
+ * @return true when the destinations are equivalent.
+ */
+static bool _run(const test_case_t *test) {
+	MICROUI_GraphicsContext gc;
+	(void)memset(&gc, 0, sizeof(gc));
+	gc.image.width = WIDTH;
+	gc.image.height = HEIGHT;
+	gc.image.format = MICROUI_IMAGE_FORMAT_RGB565;
+	gc.image.stride = WIDTH * 2u;
+	gc.image.data = (uint8_t *)destination;
+
+	MICROUI_Image img;
+	_init_image(&img, test->format);
+
+	jint x = (WIDTH - IMAGE_SIZE) / 2;
+	jint y = (HEIGHT - IMAGE_SIZE) / 2;
+	if ((SCALED_NEAREST == test->operation) || (SCALED_BILINEAR == test->operation)) {
+		x = (WIDTH - (jint)(test->parameter * (float)IMAGE_SIZE)) / 2;
+		y = (HEIGHT - (jint)(test->parameter * (float)IMAGE_SIZE)) / 2;
+	}
+
+	double start = _now();
+	for (int32_t i = 0; i < ITERATIONS; i++) {
+		(void)memcpy(destination, background, sizeof(background));
+		_draw_transform(&gc, &img, test, x, y);
+	}
+	double transform_time = (_now() - start) / ITERATIONS;
+
+	start = _now();
+	for (int32_t i = 0; i < ITERATIONS; i++) {
+		(void)memcpy(reference, background, sizeof(background));
+		_draw_reference(&img, test, x, y);
+	}
+	double reference_time = (_now() - start) / ITERATIONS;
+
+	uint32_t drawn = 0;
+	uint32_t errors = 0;
+	for (int32_t i = 0; i < (WIDTH * HEIGHT); i++) {
+		if ((reference[i] != background[i]) || (destination[i] != background[i])) {
+			drawn++;
+			if ((TOLERANCE < _channel_difference(reference[i], destination[i], 11u, 0x1fu))
+			    || ((2 * TOLERANCE) < _channel_difference(reference[i], destination[i], 5u, 0x3fu))
+			    || (TOLERANCE < _channel_difference(reference[i], destination[i], 0u, 0x1fu))) {
+				errors++;
+			}
+		}
+	}
+
+	bool ret = (errors * 1000u) <= (drawn * MAX_ERRORS_PER_THOUSAND);
+	(void)printf("%-17s format %2d %6.1f alpha %3d: %7.3f ms (reference %7.3f ms, x%4.1f), %6u pixels, %4u errors%s\n",
+	             operation_names[test->operation], test->format, (double)test->parameter, test->alpha,
+	             transform_time, reference_time, reference_time / transform_time, drawn, errors,
+	             ret ? "" : " FAILED");
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// Main
+// --------------------------------------------------------------------------------
+
+int main(void) {
+	static const MICROUI_ImageFormat formats[] = { MICROUI_IMAGE_FORMAT_RGB565, MICROUI_IMAGE_FORMAT_RGB888,
+		                                           MICROUI_IMAGE_FORMAT_ARGB8888 };
+	static const float angles[] = { 0.f, 17.f, 45.f, 90.f, 200.f, 333.f };
+	static const float factors[] = { 0.5f, 1.f, 1.3f };
+	uint32_t failures = 0;
+
+	_init_images();
+
+	for (uint32_t f = 0; f < (sizeof(formats) / sizeof(formats[0])); f++) {
+		for (uint32_t o = ROTATED_NEAREST; o <= ROTATED_BILINEAR; o++) {
+			for (uint32_t a = 0; a < (sizeof(angles) / sizeof(angles[0])); a++) {
+				test_case_t test = { (operation_t)o, formats[f], angles[a], (0u == (a & 1u)) ? 255 : 128 };
+				failures += _run(&test) ? 0u : 1u;
+			}
+		}
+		for (uint32_t o = SCALED_NEAREST; o <= SCALED_BILINEAR; o++) {
+			for (uint32_t s = 0; s < (sizeof(factors) / sizeof(factors[0])); s++) {
+				test_case_t test = { (operation_t)o, formats[f], factors[s], (0u == (s & 1u)) ? 255 : 128 };
+				failures += _run(&test) ? 0u : 1u;
+			}
+		}
+	}
+
+	(void)printf("failed test cases: %u\n", failures);
+	return (0u == failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
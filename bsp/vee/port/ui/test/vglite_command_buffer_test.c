@@ -0,0 +1,465 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Host test of the command buffers of the VGLite driver (vg_lite.c, single thread mode): replays
+ * sequences of GPU operations the way ui_vglite.c submits them and checks that a command buffer is never
+ * written by the CPU, nor submitted again, before the GPU has completed it (its fence has signaled), and
+ * that only one command buffer is executed at a time. It prints the number of GPU operations encoded by the
+ * CPU while the GPU was executing the other command buffer (overlap).
+ *
+ * The kernel layer (vg_lite_kernel()) is a host stand-in implemented below: a submitted command buffer is
+ * copied and stays in flight until the driver waits for it (VG_LITE_WAIT): the GPU only completes the
+ * command buffer when the driver waits for it (slowest GPU). When the GPU completes a command buffer, its
+ * content must still be the submitted one. The GPU memory is mapped in the low 2GB of the address space
+ * because the driver handles the GPU addresses as uint32_t.
+ *
+ * Build and run from bsp/vee/port (see README.rst):
+ *
+ *	gcc -O2 -DVG_DRIVER_SINGLE_THREAD -I../../sdk_overlay/middleware/vglite/inc \
+ *		-I../../sdk_overlay/middleware/vglite/VGLite -I../../sdk_overlay/middleware/vglite/VGLite/rtos \
+ *		-I../../sdk_overlay/middleware/vglite/VGLiteKernel -I../../sdk_overlay/middleware/vglite/VGLiteKernel/rtos \
+ *		ui/test/vglite_command_buffer_test.c ../../sdk_overlay/middleware/vglite/VGLite/vg_lite.c \
+ *		../../sdk_overlay/middleware/vglite/VGLite/vg_lite_flat.c -lm -o vglite_command_buffer_test
+ *	./vglite_command_buffer_test
+ *
+ * @author MicroEJ Developer Team
+ * @version 14.2.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "vg_lite.h"
+#include "vg_lite_kernel.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Size of the GPU memory (command buffers, tessellation buffer and destination).
+ */
+#define GPU_MEMORY_SIZE (4u * 1024u * 1024u)
+
+/*
+ * @brief Size of a command buffer: small enough to fill the command buffers many times.
+ */
+#define COMMAND_BUFFER_SIZE (4u * 1024u)
+
+#define TESSELLATION_SIZE (256)
+#define DESTINATION_SIZE (64)
+
+/*
+ * @brief Number of GPU operations of each scenario.
+ */
+#define OPERATIONS (5000u)
+
+/*
+ * @brief Number of batched operations submitted at once (see VGLITE_BATCH_SUBMIT_OPERATIONS).
+ */
+#define BATCH_SUBMIT_OPERATIONS (8u)
+
+/*
+ * @brief Registers read by the driver to fill its features table (GCNanoLiteV of the i.MX RT1170).
+ */
+#define REGISTER_CHIP_ID (0x20u)
+#define REGISTER_CHIP_REVISION (0x24u)
+#define REGISTER_CID (0x30u)
+
+// --------------------------------------------------------------------------------
+// Typedefs
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The ways ui_vglite.c submits the GPU operations.
+ */
+typedef enum {
+	/*
+	 * @brief Each operation is submitted and waited for (UI_VGLITE_start_operation(false)).
+	 */
+	SCENARIO_SYNCHRONOUS,
+
+	/*
+	 * @brief Each operation is submitted without waiting for its end: the Graphics Engine is notified by the
+	 * GPU interrupt and the next operation waits for the previous submission (UI_VGLITE_start_operation(true)).
+	 */
+	SCENARIO_ASYNCHRONOUS,
+
+	/*
+	 * @brief The operations are batched: the command buffers are submitted when they are full and every
+	 * BATCH_SUBMIT_OPERATIONS operations; the end of the batch is waited for (UI_VGLITE_flush_batch()).
+	 */
+	SCENARIO_BATCH,
+
+	/*
+	 * @brief The operations are batched and the command buffers are only submitted when they are full
+	 * (VGLITE_BATCH_OPERATIONS without VGLITE_BATCH_SUBMIT_OPERATIONS).
+	 */
+	SCENARIO_FULL_BUFFERS,
+
+	SCENARIO_COUNT,
+} scenario_t;
+
+/*
+ * @brief A command buffer seen by the GPU stand-in.
+ */
+typedef struct {
+	uint8_t *logical;
+	bool in_flight;
+	uint8_t *submitted;
+	uint32_t submitted_size;
+	uint32_t submitted_offset;
+} command_buffer_t;
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+static const char *scenario_names[SCENARIO_COUNT] = {
+	"synchronous operations",
+	"asynchronous operations",
+	"batched operations",
+	"full command buffers",
+};
+
+static uint8_t *gpu_memory;
+static uint32_t gpu_memory_used;
+
+static command_buffer_t command_buffers[CMDBUF_COUNT];
+static uint32_t command_buffer_size;
+
+static uint32_t errors;
+static uint32_t submissions;
+static uint32_t waits;
+static uint32_t max_in_flight;
+
+/*
+ * @brief Number of operations encoded by the test and number of operations encoded while a command buffer
+ * was in flight.
+ */
+static uint32_t operations;
+static uint32_t overlapped_operations;
+
+// --------------------------------------------------------------------------------
+// vg_lite_os.h functions
+// --------------------------------------------------------------------------------
+
+void * vg_lite_os_malloc(uint32_t size) {
+	return malloc(size);
+}
+
+void vg_lite_os_free(void *memory) {
+	free(memory);
+}
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Allocates some GPU memory (never released: the GPU memory is large enough for the test).
+ */
+static vg_lite_error_t _allocate(uint32_t size, void **logical, uint32_t *physical) {
+	uint32_t aligned = (size + 63u) & ~63u;
+	vg_lite_error_t ret = VG_LITE_OUT_OF_MEMORY;
+	if ((gpu_memory_used + aligned) <= GPU_MEMORY_SIZE) {
+		*logical = &gpu_memory[gpu_memory_used];
+		*physical = (uint32_t)(uintptr_t)*logical;
+		gpu_memory_used += aligned;
+		ret = VG_LITE_SUCCESS;
+	}
+	return ret;
+}
+
+static uint32_t _get_in_flight(void) {
+	uint32_t count = 0;
+	for (uint32_t i = 0; i < CMDBUF_COUNT; i++) {
+		count += command_buffers[i].in_flight ? 1u : 0u;
+	}
+	return count;
+}
+
+/*
+ * @brief Checks that the command buffers in flight have not been modified since their submission.
+ */
+static void _check_in_flight(const char *when) {
+	for (uint32_t i = 0; i < CMDBUF_COUNT; i++) {
+		command_buffer_t *buffer = &command_buffers[i];
+		if (buffer->in_flight && (0 != memcmp(&buffer->logical[buffer->submitted_offset], buffer->submitted,
+		                                      buffer->submitted_size))) {
+			(void)printf("%s: command buffer %u modified before its completion\n", when, i);
+			errors++;
+			// report once
+			(void)memcpy(buffer->submitted, &buffer->logical[buffer->submitted_offset], buffer->submitted_size);
+		}
+	}
+}
+
+static vg_lite_error_t _initialize(vg_lite_kernel_initialize_t *data) {
+	vg_lite_kernel_context_t *context = data->context;
+	vg_lite_error_t ret = VG_LITE_SUCCESS;
+
+	command_buffer_size = data->command_buffer_size;
+	data->capabilities.data = 0;
+
+	for (uint32_t i = 0; (VG_LITE_SUCCESS == ret) && (i < CMDBUF_COUNT); i++) {
+		ret = _allocate(command_buffer_size, &context->command_buffer_logical[i], &context->command_buffer_physical[i]);
+		context->command_buffer[i] = context->command_buffer_logical[i];
+		data->command_buffer[i] = context->command_buffer_logical[i];
+		data->command_buffer_gpu[i] = context->command_buffer_physical[i];
+		command_buffers[i].logical = (uint8_t *)context->command_buffer_logical[i];
+		command_buffers[i].submitted = (uint8_t *)malloc(command_buffer_size);
+	}
+
+	if ((VG_LITE_SUCCESS == ret) && (0 < data->tessellation_width) && (0 < data->tessellation_height)) {
+		// same layout as the kernel (vg_lite_kernel.c), without the L2 cache
+		uint32_t width = (uint32_t)data->tessellation_width;
+		uint32_t height = ((uint32_t)data->tessellation_height + 15u) & ~15u;
+		uint32_t stride = ((width * 8u) + 63u) & ~63u;
+		uint32_t size = ((stride * height) + 63u) & ~63u;
+		uint32_t l1_size = ((((size / 64u) + 63u) & ~63u) / 8u + 63u) & ~63u;
+
+		ret = _allocate(size + l1_size, &context->tessellation_buffer_logical, &context->tessellation_buffer_physical);
+		context->tessellation_buffer = context->tessellation_buffer_logical;
+		data->capabilities.cap.tiled = (0u == (width & 127u)) ? 0x3u : 0x2u;
+		data->tessellation_buffer_gpu[0] = context->tessellation_buffer_physical;
+		data->tessellation_buffer_gpu[1] = context->tessellation_buffer_physical + size;
+		data->tessellation_buffer_gpu[2] = data->tessellation_buffer_gpu[1];
+		data->tessellation_buffer_logic[0] = (uint8_t *)context->tessellation_buffer_logical;
+		data->tessellation_buffer_logic[1] = data->tessellation_buffer_logic[0] + size;
+		data->tessellation_buffer_logic[2] = data->tessellation_buffer_logic[1];
+		data->tessellation_buffer_size[0] = size;
+		data->tessellation_buffer_size[1] = l1_size;
+		data->tessellation_buffer_size[2] = 0;
+		data->tessellation_stride = stride;
+		data->tessellation_width_height = width | (height << 16);
+		data->tessellation_shift = 0;
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Starts the execution of a command buffer: the GPU executes one command buffer at a time and the
+ * command buffer must not be in flight.
+ */
+static vg_lite_error_t _submit(vg_lite_kernel_submit_t *data) {
+	command_buffer_t *buffer = &command_buffers[data->command_id];
+	uint32_t offset = (uint32_t)((uint8_t *)data->commands - buffer->logical);
+
+	_check_in_flight("submit");
+	if (0u != _get_in_flight()) {
+		(void)printf("submit: command buffer %u submitted while the GPU executes another one\n", data->command_id);
+		errors++;
+	}
+	if ((offset + data->command_size) > command_buffer_size) {
+		(void)printf("submit: command buffer %u overflow\n", data->command_id);
+		errors++;
+	}
+
+	buffer->in_flight = true;
+	buffer->submitted_offset = offset;
+	buffer->submitted_size = data->command_size;
+	(void)memcpy(buffer->submitted, &buffer->logical[offset], data->command_size);
+	submissions++;
+
+	uint32_t in_flight = _get_in_flight();
+	max_in_flight = (in_flight > max_in_flight) ? in_flight : max_in_flight;
+	return VG_LITE_SUCCESS;
+}
+
+/*
+ * @brief Waits for the GPU: the command buffer in flight is completed (the fence signals).
+ */
+static vg_lite_error_t _wait(vg_lite_kernel_wait_t *data) {
+	_check_in_flight("wait");
+	for (uint32_t i = 0; i < CMDBUF_COUNT; i++) {
+		command_buffers[i].in_flight = false;
+	}
+	data->event_got = data->event_mask;
+	waits++;
+	return VG_LITE_SUCCESS;
+}
+
+static void _check_register(vg_lite_kernel_info_t *data) {
+	switch (data->addr) {
+	case REGISTER_CHIP_ID:
+		data->reg = 0x255u;
+		break;
+	case REGISTER_CHIP_REVISION:
+		data->reg = 0x1311u;
+		break;
+	case REGISTER_CID:
+		data->reg = 0x404u;
+		break;
+	default:
+		data->reg = 0u;
+		break;
+	}
+}
+
+// --------------------------------------------------------------------------------
+// vg_lite_kernel.h functions
+// --------------------------------------------------------------------------------
+
+vg_lite_error_t vg_lite_kernel(vg_lite_kernel_command_t command, void *data) {
+	vg_lite_error_t ret = VG_LITE_SUCCESS;
+
+	switch (command) {
+	case VG_LITE_INITIALIZE:
+		ret = _initialize((vg_lite_kernel_initialize_t *)data);
+		break;
+	case VG_LITE_ALLOCATE: {
+		vg_lite_kernel_allocate_t *allocate = (vg_lite_kernel_allocate_t *)data;
+		ret = _allocate(allocate->bytes, &allocate->memory, &allocate->memory_gpu);
+		allocate->memory_handle = allocate->memory;
+		break;
+	}
+	case VG_LITE_SUBMIT:
+		ret = _submit((vg_lite_kernel_submit_t *)data);
+		break;
+	case VG_LITE_WAIT:
+		ret = _wait((vg_lite_kernel_wait_t *)data);
+		break;
+	case VG_LITE_CHECK:
+		_check_register((vg_lite_kernel_info_t *)data);
+		break;
+	default:
+		// free, map, terminate, etc.: nothing to do
+		break;
+	}
+
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// Scenarios
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Encodes a GPU operation: a rectangle of the destination is filled.
+ */
+static void _encode_operation(vg_lite_buffer_t *destination, uint32_t index) {
+	vg_lite_rectangle_t rect;
+	rect.x = (int32_t)(index % (DESTINATION_SIZE / 2));
+	rect.y = (int32_t)((index / 7u) % (DESTINATION_SIZE / 2));
+	rect.width = 1 + (int32_t)(index % (DESTINATION_SIZE / 2));
+	rect.height = 1 + (int32_t)((index / 3u) % (DESTINATION_SIZE / 2));
+
+	// the operations encoded while a command buffer is executed
+	bool overlapped = 0u != _get_in_flight();
+
+	if (VG_LITE_SUCCESS != vg_lite_clear(destination, &rect, 0xff000000u | (index * 0x010203u))) {
+		(void)printf("operation %u: vg_lite_clear() failed\n", index);
+		errors++;
+	}
+
+	operations++;
+	overlapped_operations += overlapped ? 1u : 0u;
+}
+
+/*
+ * @brief Submits the operations the way UI_VGLITE_start_operation() does (the GPU interrupt of a previous
+ * submission must not be taken as the end of this operation).
+ */
+static void _start_operation(bool wait) {
+	if ((VG_LITE_SUCCESS != vg_lite_wait_submitted()) || (VG_LITE_SUCCESS != vg_lite_flush())) {
+		(void)printf("cannot submit the operation\n");
+		errors++;
+	}
+	if (wait && (VG_LITE_SUCCESS != vg_lite_finish())) {
+		(void)printf("cannot wait for the operation\n");
+		errors++;
+	}
+}
+
+static void _run(scenario_t scenario, vg_lite_buffer_t *destination) {
+	operations = 0;
+	overlapped_operations = 0;
+	submissions = 0;
+	waits = 0;
+	max_in_flight = 0;
+
+	for (uint32_t i = 0; i < OPERATIONS; i++) {
+		_encode_operation(destination, i);
+
+		switch (scenario) {
+		case SCENARIO_SYNCHRONOUS:
+			_start_operation(true);
+			break;
+		case SCENARIO_ASYNCHRONOUS:
+			_start_operation(false);
+			break;
+		case SCENARIO_BATCH:
+			if (0u == ((i + 1u) % BATCH_SUBMIT_OPERATIONS)) {
+				// see __submit_batch_step()
+				(void)vg_lite_flush();
+			}
+			break;
+		default:
+			// submitted by the driver when a command buffer is full
+			break;
+		}
+	}
+
+	// see UI_VGLITE_flush_batch()
+	if (VG_LITE_SUCCESS != vg_lite_finish()) {
+		(void)printf("%s: cannot finish\n", scenario_names[scenario]);
+		errors++;
+	}
+	if (0u != _get_in_flight()) {
+		(void)printf("%s: a command buffer is still in flight after vg_lite_finish()\n", scenario_names[scenario]);
+		errors++;
+	}
+	if (1u < max_in_flight) {
+		(void)printf("%s: %u command buffers in flight\n", scenario_names[scenario], max_in_flight);
+		errors++;
+	}
+
+	(void)printf("%-24s %5u operations, %5u submissions, %5u waits, %5u operations encoded during the GPU "
+	             "execution (%u%%)\n", scenario_names[scenario], operations, submissions, waits, overlapped_operations,
+	             (overlapped_operations * 100u) / operations);
+}
+
+int main(void) {
+	gpu_memory = (uint8_t *)mmap(NULL, GPU_MEMORY_SIZE, PROT_READ | PROT_WRITE,
+	                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+	if (MAP_FAILED == gpu_memory) {
+		(void)printf("cannot map the GPU memory\n");
+		return 1;
+	}
+
+	if ((VG_LITE_SUCCESS != vg_lite_set_command_buffer_size(COMMAND_BUFFER_SIZE))
+	    || (VG_LITE_SUCCESS != vg_lite_init(TESSELLATION_SIZE, TESSELLATION_SIZE))) {
+		(void)printf("cannot initialize the driver\n");
+		return 1;
+	}
+
+	vg_lite_buffer_t destination;
+	(void)memset(&destination, 0, sizeof(destination));
+	destination.width = DESTINATION_SIZE;
+	destination.height = DESTINATION_SIZE;
+	destination.format = VG_LITE_RGB565;
+	if (VG_LITE_SUCCESS != vg_lite_allocate(&destination)) {
+		(void)printf("cannot allocate the destination\n");
+		return 1;
+	}
+
+	for (uint32_t scenario = 0; scenario < (uint32_t)SCENARIO_COUNT; scenario++) {
+		_run((scenario_t)scenario, &destination);
+	}
+
+	(void)printf("%u errors\n", errors);
+	return (0u == errors) ? 0 : 1;
+}
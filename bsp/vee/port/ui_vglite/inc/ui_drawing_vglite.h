@@ -74,6 +74,9 @@ extern "C" {
 #define UI_DRAWING_VGLITE_drawRotatedImageBilinear UI_DRAWING_drawRotatedImageBilinear
 #define UI_DRAWING_VGLITE_drawScaledImageNearestNeighbor UI_DRAWING_drawScaledImageNearestNeighbor
 #define UI_DRAWING_VGLITE_drawScaledImageBilinear UI_DRAWING_drawScaledImageBilinear
+#define UI_DRAWING_VGLITE_drawScaledStringBilinear UI_DRAWING_drawScaledStringBilinear
+#define UI_DRAWING_VGLITE_drawCharWithRotationBilinear UI_DRAWING_drawCharWithRotationBilinear
+#define UI_DRAWING_VGLITE_drawCharWithRotationNearestNeighbor UI_DRAWING_drawCharWithRotationNearestNeighbor
 
 #else // !defined(UI_GC_SUPPORTED_FORMATS) || (UI_GC_SUPPORTED_FORMATS <= 1)
 
@@ -117,6 +120,9 @@ extern "C" {
 #define UI_DRAWING_VGLITE_drawRotatedImageBilinear UI_DRAWING_drawRotatedImageBilinear_0
 #define UI_DRAWING_VGLITE_drawScaledImageNearestNeighbor UI_DRAWING_drawScaledImageNearestNeighbor_0
 #define UI_DRAWING_VGLITE_drawScaledImageBilinear UI_DRAWING_drawScaledImageBilinear_0
+#define UI_DRAWING_VGLITE_drawScaledStringBilinear UI_DRAWING_drawScaledStringBilinear_0
+#define UI_DRAWING_VGLITE_drawCharWithRotationBilinear UI_DRAWING_drawCharWithRotationBilinear_0
+#define UI_DRAWING_VGLITE_drawCharWithRotationNearestNeighbor UI_DRAWING_drawCharWithRotationNearestNeighbor_0
 
 #endif // !defined(UI_GC_SUPPORTED_FORMATS) || (UI_GC_SUPPORTED_FORMATS <= 1)
 
@@ -308,6 +314,31 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageNearestNeighbor(MICROUI_Graphics
 DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
                                                          jint y, jfloat factorX, jfloat factorY, jint alpha);
 
+/*
+ * @brief Implementation of drawScaledStringBilinear over VGLite (only when VGLITE_GLYPH_CACHE is enabled). See
+ * ui_drawing.h
+ */
+DRAWING_Status UI_DRAWING_VGLITE_drawScaledStringBilinear(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
+                                                          MICROUI_Font *font, jint x, jint y, jfloat xRatio,
+                                                          jfloat yRatio);
+
+/*
+ * @brief Implementation of drawCharWithRotationBilinear over VGLite (only when VGLITE_GLYPH_CACHE is enabled). See
+ * ui_drawing.h
+ */
+DRAWING_Status UI_DRAWING_VGLITE_drawCharWithRotationBilinear(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font,
+                                                              jint x, jint y, jint xRotation, jint yRotation,
+                                                              jfloat angle, jint alpha);
+
+/*
+ * @brief Implementation of drawCharWithRotationNearestNeighbor over VGLite (only when VGLITE_GLYPH_CACHE is
+ * enabled). See ui_drawing.h
+ */
+DRAWING_Status UI_DRAWING_VGLITE_drawCharWithRotationNearestNeighbor(MICROUI_GraphicsContext *gc, jchar c,
+                                                                     MICROUI_Font *font, jint x, jint y,
+                                                                     jint xRotation, jint yRotation, jfloat angle,
+                                                                     jint alpha);
+
 // --------------------------------------------------------------------------------
 // EOF
 // --------------------------------------------------------------------------------
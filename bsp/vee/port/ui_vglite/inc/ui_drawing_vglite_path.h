@@ -1,7 +1,7 @@
 /*
  * C
  *
- * Copyright 2019-2024 MicroEJ Corp. All rights reserved.
+ * Copyright 2019-2025 MicroEJ Corp. All rights reserved.
  * Use of this source code is governed by a BSD-style license that can be found with this software.
  */
 
@@ -57,25 +57,31 @@ extern "C" {
 			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))  /* end command */          \
 		)
 
+/*
+ * @brief Maximum number of cubic curves to approximate a whole ellipse: the number of sections
+ * depends on the radius (the largest ellipses use sections of 60 degrees, see ui_drawing_vglite_path.c).
+ */
+#define MEJ_VGLITE_PATH_ARC_MAX_SECTIONS            6u
+
 /*
  * @brief Length of a VGLite ellipse path
  */
-#define MEJ_VGLITE_PATH_CIRCLE_LENGTH(t)                                             \
-		(                                                                            \
-			(1u * MEJ_VGLITE_PATH_MOVE_TO_LENGTH(t))    /* move to command */        \
-			+ (4u * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t)) /* 4 sections per ellipse */ \
-			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))      /* end command */            \
+#define MEJ_VGLITE_PATH_CIRCLE_LENGTH(t)                                                                \
+		(                                                                                               \
+			(1u * MEJ_VGLITE_PATH_MOVE_TO_LENGTH(t))    /* move to command */                           \
+			+ (MEJ_VGLITE_PATH_ARC_MAX_SECTIONS * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t)) /* sections */    \
+			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))      /* end command */                               \
 		)
 
 /*
  * @brief Length of a VGLite ellipse path
  */
-#define MEJ_VGLITE_PATH_CIRCLE_ARC_OUTLINE_MAX_LENGTH(t)                             \
-		(                                                                            \
-			(1u * MEJ_VGLITE_PATH_MOVE_TO_LENGTH(t))    /* move to command */        \
-			+ (2u * MEJ_VGLITE_PATH_LINE_TO_LENGTH(t))  /* 2 ends */                 \
-			+ (8u * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t)) /* 4 sections per ellipse */ \
-			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))      /* end command */            \
+#define MEJ_VGLITE_PATH_CIRCLE_ARC_OUTLINE_MAX_LENGTH(t)                                               \
+		(                                                                                               \
+			(1u * MEJ_VGLITE_PATH_MOVE_TO_LENGTH(t))    /* move to command */                           \
+			+ (2u * MEJ_VGLITE_PATH_LINE_TO_LENGTH(t))  /* 2 ends */                                    \
+			+ (2u * MEJ_VGLITE_PATH_ARC_MAX_SECTIONS * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t)) /* in & out */ \
+			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))      /* end command */                               \
 		)
 
 /*
@@ -107,7 +113,7 @@ extern "C" {
 			(1u * MEJ_VGLITE_PATH_MOVE_TO_LENGTH(t))            /* move to command */                   \
 			+ (2u * MEJ_MAX(MEJ_VGLITE_PATH_ROUNDED_CAP_LENGTH(t),                                      \
 							MEJ_VGLITE_PATH_NO_CAP_LENGTH(t)))  /* CAPS */                              \
-			+ (8u * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t))     /* Up to 4 sections per curve in and out */ \
+			+ (2u * MEJ_VGLITE_PATH_ARC_MAX_SECTIONS * MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(t)) /* in & out */ \
 			+ (1u * MEJ_VGLITE_PATH_END_LENGTH(t))              /* end command */                       \
 		)
 
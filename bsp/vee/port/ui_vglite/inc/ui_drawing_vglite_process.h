@@ -33,7 +33,8 @@ extern "C" {
 // --------------------------------------------------------------------------------
 
 /*
- * @brief A fade higher than 1 is not compatible with VGLite
+ * @brief A fade higher than 1 cannot be rendered by the VGLite anti-aliasing only: the
+ * caller has to draw the shape in several layers (see ui_drawing_vglite.c).
  */
 #define UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(f) ((f) <= 1)
 
@@ -50,7 +50,7 @@ extern "C" {
 #error "Undefined UI_VGLITE_CONFIGURATION_VERSION, it must be defined in ui_vglite_configuration.h"
 #endif
 
-#if defined UI_VGLITE_CONFIGURATION_VERSION && UI_VGLITE_CONFIGURATION_VERSION != 1
+#if defined UI_VGLITE_CONFIGURATION_VERSION && UI_VGLITE_CONFIGURATION_VERSION != 7
 #error "Version of the configuration file ui_vglite_configuration.h is not compatible with this implementation."
 #endif
 
@@ -90,7 +90,8 @@ void UI_VGLITE_start_operation(bool wakeup_graphics_engine);
 /**
  * @brief Operation to perform after a VGLite drawing operation.
  * On success, the asynchronous drawing is launched. This function does not wait for the end
- * of the drawing.
+ * of the drawing. When the option VGLITE_BATCH_OPERATIONS is enabled, the drawing is kept in
+ * the GPU commands list (see UI_VGLITE_flush_batch()) and the drawing is considered as done.
  * On error, an error message is displayed, the error flags in the graphics context are set,
  * the drawing is considered as done (there is nothing to draw), and a call to UI_VGLITE_IMPL_notify_gpu_stop()
  * is made to request GPU deactivation (if the function is implemented).
@@ -102,6 +103,27 @@ void UI_VGLITE_start_operation(bool wakeup_graphics_engine);
  */
 DRAWING_Status UI_VGLITE_post_operation(MICROUI_GraphicsContext *gc, vg_lite_error_t vg_lite_error);
 
+/**
+ * @brief Submits the GPU operations batched by UI_VGLITE_post_operation() (if any) and waits
+ * until the GPU has performed them.
+ *
+ * This function must be called before the CPU reads or writes a buffer that may be the
+ * source or the destination of a batched GPU operation, and before releasing a GPU resource
+ * that may be used by a batched GPU operation (path, gradient, etc.). It does nothing when
+ * there is no pending operation.
+ *
+ * @see VGLITE_BATCH_OPERATIONS
+ */
+void UI_VGLITE_flush_batch(void);
+
+/**
+ * @brief Tells whether some GPU operations have been batched by UI_VGLITE_post_operation()
+ * and not performed yet (see VGLITE_BATCH_SUBMIT_OPERATIONS).
+ *
+ * @return false when there is no pending operation or when VGLITE_BATCH_OPERATIONS is disabled.
+ */
+bool UI_VGLITE_is_batch_pending(void);
+
 /**
  * @brief Enables hardware rendering
  * @see VGLITE_OPTION_TOGGLE_GPU
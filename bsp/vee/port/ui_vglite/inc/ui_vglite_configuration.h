@@ -32,7 +32,7 @@ extern "C" {
  * This value must be incremented by the implementor of the CCO when a configuration define is added, deleted or
  * modified.
  */
-#define UI_VGLITE_CONFIGURATION_VERSION (1)
+#define UI_VGLITE_CONFIGURATION_VERSION (7)
 
 // -----------------------------------------------------------------------------
 // Macros and Defines
@@ -86,6 +86,162 @@ extern "C" {
  */
 //#define VGLITE_OPTION_TOGGLE_GPU
 
+/*
+ * @brief By default, each GPU drawing is submitted to the GPU as soon as it is added to the GPU commands
+ * list and the Graphics Engine is woken up by the GPU interrupt at the end of the drawing. When drawing a lot
+ * of small shapes (rectangles, lines, etc.), the synchronization between the CPU and the GPU is longer than
+ * the drawings themselves.
+ *
+ * This define batches the consecutive GPU drawings (and their scissor and blending settings): the drawings
+ * are kept in the GPU commands list and are submitted all at once when the CPU needs the result: before a
+ * drawing performed by the software algorithms, before closing an image, before flushing the display buffer,
+ * etc. (see UI_VGLITE_flush_batch()). The GPU drawings are notified as done to the Graphics Engine
+ * as soon as they are added to the GPU commands list.
+ *
+ * Warning: the pixels read by the application (GraphicsContext.readPixel(), Image.readARGB(), etc.) may not
+ * include the latest drawings.
+ *
+ * Uncomment it to enable the option.
+ */
+//#define VGLITE_BATCH_OPERATIONS
+
+/*
+ * @brief The VGLite library uses two GPU commands lists: the CPU fills one list while the GPU performs the
+ * other one. Without intermediate submission, the batched drawings are only submitted when the CPU needs the
+ * result: the GPU waits for the CPU until then and the CPU waits for the GPU afterwards.
+ *
+ * This define submits the batched drawings every VGLITE_BATCH_SUBMIT_OPERATIONS drawings without waiting for
+ * their end: the GPU performs them while the CPU adds the next drawings in the other list. The submission
+ * only waits for the end of the previous submission (if any).
+ *
+ * Comment it to submit the batched drawings only when the CPU needs the result.
+ *
+ * @see VGLITE_BATCH_OPERATIONS
+ */
+#ifdef VGLITE_BATCH_OPERATIONS
+#define VGLITE_BATCH_SUBMIT_OPERATIONS (16)
+#endif
+
+/*
+ * @brief The GPU cannot read the RGB888 images (no 24-bit format in VGLite): by default, these images are drawn by the
+ * software algorithms. The GPU cannot read the compressed images either (see UI_IMAGE_FORMAT_COMPRESSED).
+ *
+ * This define enables the cache of the converted images: the first time an RGB888 image is drawn, its pixels are
+ * converted in a 32-bit format in the GPU memory. The next drawings of this image use the GPU and the converted
+ * pixels. The value specifies the maximum number of bytes the cache can use in the GPU memory; when the cache is
+ * full, the least recently drawn images are evicted. An image larger than the cache is never converted.
+ *
+ * Comment it to disable the option.
+ */
+#define VGLITE_FORMAT_CACHE (512 * 1024)
+
+/*
+ * @brief Configure this define to set the maximum number of images held by the cache of the converted images.
+ *
+ * @see VGLITE_FORMAT_CACHE
+ */
+#ifdef VGLITE_FORMAT_CACHE
+#define VGLITE_FORMAT_CACHE_ENTRIES (16)
+#endif
+
+/*
+ * @brief A static composition (background, icons, texts, etc.) can be captured once in a layer and blitted by the GPU
+ * on the next frames instead of being drawn again primitive by primitive (see ui_vglite_layer_cache.h). The layers
+ * are allocated in the MicroUI images heap.
+ *
+ * This define enables the cache of the layers. The value specifies the maximum number of bytes the layers can use in
+ * the MicroUI images heap; when the cache is full, the least recently drawn layers are evicted. Comment it to disable
+ * the option (the layers are never captured).
+ */
+#define VGLITE_LAYER_CACHE (512 * 1024)
+
+/*
+ * @brief Configure this define to set the maximum number of layers held by the cache of the layers.
+ *
+ * @see VGLITE_LAYER_CACHE
+ */
+#ifdef VGLITE_LAYER_CACHE
+#define VGLITE_LAYER_CACHE_ENTRIES (8)
+#endif
+
+/*
+ * @brief The Graphics Engine transforms the glyphs of the scaled strings and of the rotated characters for each
+ * drawing. When the font manager of a custom font gives its glyphs (see UI_FONT_DRAWING_getGlyph()), a glyph can be
+ * transformed once in an alpha map kept in the MicroUI images heap and blitted by the GPU on the next drawings (see
+ * ui_vglite_glyph_cache.h). Requires UI_FEATURE_FONT_CUSTOM_FORMATS.
+ *
+ * This define enables the cache of the transformed glyphs. The value specifies the maximum number of bytes the
+ * transformed glyphs can use in the MicroUI images heap; when the cache is full, the least recently drawn glyphs
+ * are evicted. Uncomment it to enable the option.
+ */
+//#define VGLITE_GLYPH_CACHE (64 * 1024)
+
+/*
+ * @brief Configure this define to set the maximum number of glyphs held by the cache of the transformed glyphs.
+ *
+ * @see VGLITE_GLYPH_CACHE
+ */
+#ifdef VGLITE_GLYPH_CACHE
+#define VGLITE_GLYPH_CACHE_ENTRIES (128)
+#endif
+
+/*
+ * @brief A compressed image (see UI_IMAGE_FORMAT_COMPRESSED) drawn several times is decoded once in the cache of the
+ * converted images (see VGLITE_FORMAT_CACHE). Otherwise the image is decoded on the fly: the rows are decoded band
+ * after band in a buffer allocated in the GPU memory (at the first use) and each band is drawn by the GPU.
+ *
+ * Configure this define to set the size in bytes of this buffer. A compressed image whose row is larger than this
+ * buffer cannot be drawn on the fly.
+ *
+ * @Warning: this impacts the VGLite allocation size
+ */
+#define VGLITE_COMPRESSED_IMAGE_STREAM_BUFFER (32 * 1024)
+
+/*
+ * @brief A region of the destination drawn onto itself with an overlap (scrolling: see UI_DRAWING_drawRegion() and
+ * UI_DRAWING_copyImage()) goes through a buffer allocated in the GPU memory (at the first use): each band of rows is
+ * copied in this buffer and then drawn at its destination (two GPU operations per band, whatever the overlap).
+ * Without this buffer (or when a row is too large), the region is cut in bands as large as the distance between the
+ * source and the destination: a small scrolling step requires a lot of GPU operations.
+ *
+ * Configure this define to set the size in bytes of this buffer. Comment it to disable the option.
+ *
+ * @Warning: this impacts the VGLite allocation size
+ */
+#define VGLITE_DRAW_REGION_BUFFER (64 * 1024)
+
+/*
+ * @brief A GPU drawing has a fixed cost (commands list submission, GPU interrupt, Graphics Engine wakeup) that
+ * dominates the small drawings. This define enables a cost model that dispatches each drawing to the GPU or to the
+ * software algorithms according to the kind of primitive, the number of pixels to draw and the destination format
+ * (see ui_vglite_cost.h). The simple drawings (lines, rectangles, etc.) are also dispatched by the cost model (see
+ * VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS).
+ *
+ * The defines VGLITE_COST_xxx are the default model (nanoseconds and picoseconds per pixel). The values below are
+ * placeholders, not measurements: they must be replaced by the values printed by the calibration of the target (see
+ * VGLITE_COST_CALIBRATION) before enabling the option.
+ *
+ * Uncomment it to enable the option.
+ */
+//#define VGLITE_COST_MODEL
+
+#ifdef VGLITE_COST_MODEL
+#define VGLITE_COST_GPU_SETUP_NS (30000u)
+#define VGLITE_COST_GPU_BATCHED_SETUP_NS (3000u)
+#define VGLITE_COST_GPU_PIXEL_PS { 2500u, 5000u, 4000u, 6000u } // fill, shape, image, image with opacity
+#define VGLITE_COST_CPU_PIXEL_PS { 4000u, 20000u, 6000u, 15000u } // fill, shape, image, image with opacity
+#define VGLITE_COST_CPU_32BPP_PERCENT (150u)
+#endif
+
+/*
+ * @brief Enables the calibration of the cost model (see UI_VGLITE_COST_calibrate()): the application calls a native
+ * that measures the GPU and the software drawings on the target and prints the defines VGLITE_COST_xxx to copy above.
+ * The calibration does not require VGLITE_COST_MODEL.
+ *
+ * Uncomment it to enable the option.
+ */
+//#define VGLITE_COST_CALIBRATION
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
@@ -0,0 +1,221 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Cost model used to dispatch a drawing to the GPU or to the software algorithms
+ * (see VGLITE_COST_MODEL).
+ *
+ * A GPU drawing costs a fixed setup time (configuration, submission of the commands list,
+ * GPU interrupt and Graphics Engine wakeup) plus a time per pixel; a software drawing only
+ * costs a time per pixel (higher than the GPU one). The small drawings (a one-pixel line,
+ * a small icon, etc.) are faster with the software algorithms.
+ *
+ * The costs are linear functions of the number of drawn pixels and are derived from a
+ * benchmark on the target (see UI_VGLITE_COST_calibrate()): the same primitive is drawn
+ * with several sizes with the GPU and then with the software algorithms; for each
+ * renderer, the slope of the duration according to the number of pixels is the time per
+ * pixel and the GPU's intercept is the setup time. The calibration prints the default
+ * model to copy in ui_vglite_configuration.h; the model can also be replaced at runtime
+ * (see UI_VGLITE_COST_set_model()).
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+#if !defined UI_VGLITE_COST_H
+#define UI_VGLITE_COST_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <LLUI_DISPLAY.h>
+
+#include "ui_vglite_configuration.h"
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The kinds of primitives the cost model distinguishes.
+ */
+typedef enum {
+	/*
+	 * @brief Lines, rectangles and outlines of the shapes (aliased drawings).
+	 */
+	UI_VGLITE_COST_FILL,
+
+	/*
+	 * @brief Filled shapes (circles, ellipses, arcs, rounded rectangles) and thick shapes.
+	 */
+	UI_VGLITE_COST_SHAPE,
+
+	/*
+	 * @brief Opaque image drawings (global opacity is 0xff).
+	 */
+	UI_VGLITE_COST_IMAGE,
+
+	/*
+	 * @brief Image drawings with a global opacity.
+	 */
+	UI_VGLITE_COST_IMAGE_BLEND,
+
+	/*
+	 * @brief Number of primitives.
+	 */
+	UI_VGLITE_COST_PRIMITIVES,
+} UI_VGLITE_COST_primitive_t;
+
+/*
+ * @brief The cost model (in nanoseconds and picoseconds to only use integers).
+ */
+typedef struct {
+	/*
+	 * @brief The fixed cost of a GPU drawing submitted alone, in nanoseconds.
+	 */
+	uint32_t gpu_setup_ns;
+
+	/*
+	 * @brief The fixed cost of a GPU drawing added to a batch (see VGLITE_BATCH_OPERATIONS),
+	 * in nanoseconds.
+	 */
+	uint32_t gpu_batched_setup_ns;
+
+	/*
+	 * @brief The cost of a pixel drawn by the GPU, in picoseconds.
+	 */
+	uint32_t gpu_pixel_ps[UI_VGLITE_COST_PRIMITIVES];
+
+	/*
+	 * @brief The cost of a pixel drawn by the software algorithms in a 16-bit buffer, in
+	 * picoseconds.
+	 */
+	uint32_t cpu_pixel_ps[UI_VGLITE_COST_PRIMITIVES];
+
+	/*
+	 * @brief The cost of a pixel in a 32-bit buffer relatively to a 16-bit buffer, in
+	 * percent.
+	 */
+	uint32_t cpu_32bpp_percent;
+} UI_VGLITE_COST_model_t;
+
+/*
+ * @brief The dispatch statistics (since the startup or the last model update).
+ */
+typedef struct {
+	uint32_t gpu_drawings[UI_VGLITE_COST_PRIMITIVES];
+	uint32_t cpu_drawings[UI_VGLITE_COST_PRIMITIVES];
+} UI_VGLITE_COST_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+#if defined(VGLITE_COST_MODEL)
+
+/*
+ * @brief Tells whether the software algorithms draw the primitive faster than the GPU.
+ * When true, the pending GPU drawings have been performed (see UI_VGLITE_flush_batch()):
+ * the caller can use the software algorithm immediately.
+ *
+ * @param[in] gc: the destination.
+ * @param[in] primitive: the kind of primitive.
+ * @param[in] pixels: the estimated number of pixels to draw.
+ *
+ * @return true when the primitive must be drawn by the software algorithms.
+ */
+bool UI_VGLITE_COST_use_software(MICROUI_GraphicsContext *gc, UI_VGLITE_COST_primitive_t primitive, uint32_t pixels);
+
+/*
+ * @brief Replaces the cost model (the default model is defined in ui_vglite_configuration.h).
+ * The statistics are reset.
+ *
+ * @param[in] model: the new model.
+ */
+void UI_VGLITE_COST_set_model(const UI_VGLITE_COST_model_t *model);
+
+/*
+ * @brief Gets the current cost model.
+ *
+ * @param[out] model: the model to fill.
+ */
+void UI_VGLITE_COST_get_model(UI_VGLITE_COST_model_t *model);
+
+/*
+ * @brief Gets the dispatch statistics.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void UI_VGLITE_COST_get_statistics(UI_VGLITE_COST_statistics_t *statistics);
+
+#else // VGLITE_COST_MODEL
+
+#define UI_VGLITE_COST_use_software(gc, primitive, pixels) ((void)(gc), (void)(primitive), (void)(pixels), false)
+
+#endif // VGLITE_COST_MODEL
+
+#if defined(VGLITE_COST_CALIBRATION)
+
+/*
+ * @brief Measures the cost model of the target and prints it (the defines VGLITE_COST_xxx
+ * of ui_vglite_configuration.h). Each primitive is drawn in squares from 1x1 to 128x128
+ * pixels at the top-left corner of the destinations (their content is lost): a filled
+ * rectangle, a filled circle and the image (opaque and with an opacity). Each drawing is
+ * performed by the GPU alone (submission and wait for its end), by the GPU in a batch and
+ * by the software algorithms.
+ *
+ * The function must be called by a native in the Graphics Engine task, like a drawing
+ * (between LLUI_DISPLAY_requestDrawing() and LLUI_DISPLAY_setDrawingStatus()). The
+ * durations are measured with the framerate ticks (see framerate_impl_get_ticks()).
+ *
+ * @param[in] gc: the 16-bit destination (RGB565).
+ * @param[in] gc_32bpp: a 32-bit destination to measure cpu_32bpp_percent, or NULL (the
+ * ratio is then 100 percent).
+ * @param[in] image: the image to draw, in a format drawn by the GPU (the squares are
+ * limited to the sizes of the destinations and of the image).
+ * @param[out] model: the measured model (see UI_VGLITE_COST_set_model()).
+ *
+ * @return false when a destination or the image is not supported or when a GPU drawing
+ * has failed: the model is not filled.
+ */
+bool UI_VGLITE_COST_calibrate(MICROUI_GraphicsContext *gc, MICROUI_GraphicsContext *gc_32bpp, MICROUI_Image *image,
+                              UI_VGLITE_COST_model_t *model);
+
+#endif // VGLITE_COST_CALIBRATION
+
+/*
+ * @brief Java native: measures the cost model (see UI_VGLITE_COST_calibrate()) and, when
+ * VGLITE_COST_MODEL is set, replaces the current model. The native is declared in the
+ * class com.nxp.ui.CostModel (project vee-port/natives; the simulator implementation is
+ * in vee-port/mock):
+ *
+ *	private static native boolean calibrate(byte[] gc, byte[] gc32bpp, byte[] image);
+ *
+ * @param[in] gc: the 16-bit destination.
+ * @param[in] gc_32bpp: the 32-bit destination or NULL.
+ * @param[in] image: the image to draw.
+ *
+ * @return false when VGLITE_COST_CALIBRATION is not set or when the calibration has failed.
+ */
+jboolean Java_com_nxp_ui_CostModel_calibrate(MICROUI_GraphicsContext *gc, MICROUI_GraphicsContext *gc_32bpp,
+                                             MICROUI_Image *image);
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined UI_VGLITE_COST_H
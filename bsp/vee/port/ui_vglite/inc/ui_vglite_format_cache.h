@@ -0,0 +1,185 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Cache of the MicroUI images converted in a format the GPU can read.
+ *
+ * Some MicroUI image formats are not supported by VGLite (RGB888, custom formats). The cache
+ * converts the pixels of such an image in a VGLite format the first time the image
+ * is drawn; the converted pixels are held in the GPU memory and used by the next
+ * drawings of the same image.
+ *
+ * The compressed images (see UI_IMAGE_FORMAT_COMPRESSED) are decoded in the same way
+ * but only on demand (see UI_VGLITE_FORMAT_CACHE_load_image()): an image drawn only
+ * once is better decoded on the fly.
+ *
+ * Only the immutable images are converted (no drawer can target an RGB888 or a
+ * compressed image): an image is identified by the address of its pixels. The converted pixels are
+ * released when the image is closed (see UI_VGLITE_FORMAT_CACHE_free_image()) or
+ * when the cache is full (the least recently drawn images are evicted).
+ *
+ * The images in an indexed format (A1, A2, C1, C2, C4) are not converted: the GPU reads
+ * them with a CLUT (see UI_VGLITE_FORMAT_CACHE_get_clut()).
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ * @see VGLITE_FORMAT_CACHE
+ */
+
+#if !defined UI_VGLITE_FORMAT_CACHE_H
+#define UI_VGLITE_FORMAT_CACHE_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <LLUI_DISPLAY.h>
+
+#include "vg_lite.h"
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Maximum number of colors of a CLUT (INDEX_4).
+ */
+#define UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS (16u)
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of the cache of the converted images.
+ */
+typedef struct {
+	/*
+	 * @brief Number of drawings that have reused converted pixels.
+	 */
+	uint32_t hits;
+
+	/*
+	 * @brief Number of images converted.
+	 */
+	uint32_t conversions;
+
+	/*
+	 * @brief Number of images evicted to make room for a new image.
+	 */
+	uint32_t evictions;
+
+	/*
+	 * @brief Current number of images in the cache.
+	 */
+	uint32_t entries;
+
+	/*
+	 * @brief Current number of bytes allocated in the GPU memory.
+	 */
+	uint32_t memory_used;
+} UI_VGLITE_FORMAT_CACHE_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Tells whether the cache is able to convert the images of the given format.
+ *
+ * @param[in] image_format: the MicroUI format of the image.
+ *
+ * @return true when the images of this format can be converted.
+ */
+bool UI_VGLITE_FORMAT_CACHE_is_format_supported(MICROUI_ImageFormat image_format);
+
+/*
+ * @brief Configures a source buffer with the converted pixels of the image. The
+ * image is converted when it is not in the cache yet, except the compressed images
+ * that must have been loaded before (see UI_VGLITE_FORMAT_CACHE_load_image()).
+ *
+ * Only the buffer's address, size, stride and format are set.
+ *
+ * @param[in] buffer: the source buffer to configure.
+ * @param[in] image: the image to draw.
+ *
+ * @return false when the image cannot be converted (format not supported, image
+ * too large or GPU memory full).
+ */
+bool UI_VGLITE_FORMAT_CACHE_configure_source(vg_lite_buffer_t *buffer, MICROUI_Image *image);
+
+/*
+ * @brief Tells whether the image is already converted in the cache. The image is not
+ * converted and its "time" of last use is not updated.
+ *
+ * @param[in] image: the image to look for.
+ *
+ * @return true when the converted pixels of the image are in the cache.
+ */
+bool UI_VGLITE_FORMAT_CACHE_is_image_loaded(MICROUI_Image *image);
+
+/*
+ * @brief Converts the image in the cache (if not already done).
+ *
+ * @param[in] image: the image to convert.
+ *
+ * @return false when the image cannot be converted (format not supported, image
+ * too large, corrupted data or GPU memory full).
+ */
+bool UI_VGLITE_FORMAT_CACHE_load_image(MICROUI_Image *image);
+
+/*
+ * @brief Releases the converted pixels of the image (if any).
+ *
+ * The GPU must not use the converted pixels anymore.
+ *
+ * @param[in] image: the image that is closed.
+ */
+void UI_VGLITE_FORMAT_CACHE_free_image(MICROUI_Image *image);
+
+/*
+ * @brief Evicts all the images from the cache and frees the GPU memory.
+ */
+void UI_VGLITE_FORMAT_CACHE_clear(void);
+
+/*
+ * @brief Gets the statistics of the cache of the converted images.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void UI_VGLITE_FORMAT_CACHE_get_statistics(UI_VGLITE_FORMAT_CACHE_statistics_t *statistics);
+
+/*
+ * @brief Gets the CLUT the GPU uses to read an image in an indexed format (see
+ * __microui_to_vg_lite_format in ui_vglite.c): an alpha ramp for the A1 and A2 images
+ * (the foreground color is applied like for the A4 and A8 images) or a grayscale ramp
+ * for the C1, C2 and C4 images. Available even when the cache is disabled.
+ *
+ * @param[in] image_format: the MicroUI format of the image.
+ * @param[in] premultiplied: true when the GPU requires pre-multiplied colors (see
+ * UI_VGLITE_need_to_premultiply()).
+ * @param[out] clut: the colors of the CLUT (UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS at most).
+ *
+ * @return the number of colors of the CLUT (2, 4 or 16) or 0 when the format is not indexed.
+ */
+uint32_t UI_VGLITE_FORMAT_CACHE_get_clut(MICROUI_ImageFormat image_format, bool premultiplied,
+                                         uint32_t clut[UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS]);
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined UI_VGLITE_FORMAT_CACHE_H
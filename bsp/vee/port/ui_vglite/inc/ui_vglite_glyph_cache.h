@@ -0,0 +1,160 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Cache of the transformed glyphs: a glyph of a custom font drawn scaled or rotated is transformed once in
+ * an alpha map (A8) and blitted by the GPU on the next drawings.
+ *
+ * The Graphics Engine draws the scaled strings and the rotated characters by transforming each glyph for each
+ * drawing. When the font manager of a custom font gives its glyphs (see UI_FONT_DRAWING_getGlyph()), the
+ * transformed alpha map of a glyph is computed at the first drawing and kept in the cache; the next drawings of
+ * this glyph with the same transformation only blit the cached alpha map: one GPU operation per glyph.
+ *
+ * A cached glyph is identified by its alpha map (see UI_FONT_DRAWING_glyph_t), the character, the kind of
+ * transformation (scaling, bilinear rotation or nearest neighbor rotation) and the transformation's parameters.
+ * The scaling ratios are rounded to 1/64 and the angles to half a degree. The color and the opacity are not in the
+ * key: they are applied by the GPU when the alpha map is blitted (one entry serves all the colors).
+ *
+ * The transformed alpha maps are allocated in the MicroUI images heap (see LLUI_DISPLAY_HEAP_impl.c). The memory
+ * used by the cache is limited by VGLITE_GLYPH_CACHE: when the cache is full, the least recently drawn glyphs are
+ * evicted. The glyphs of the current drawing are never evicted: when they do not fit the cache, the drawing is not
+ * performed by the cache (the caller uses the Graphics Engine algorithms).
+ *
+ * The position of a rotated glyph is rounded to the nearest pixel: the rotated glyph only depends on the angle,
+ * not on the position of the rotation center.
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ * @see VGLITE_GLYPH_CACHE
+ */
+
+#if !defined UI_VGLITE_GLYPH_CACHE_H
+#define UI_VGLITE_GLYPH_CACHE_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <LLUI_DISPLAY.h>
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of the cache of the transformed glyphs.
+ */
+typedef struct {
+	/*
+	 * @brief Number of glyphs drawn from the cache.
+	 */
+	uint32_t hits;
+
+	/*
+	 * @brief Number of glyphs transformed and added in the cache.
+	 */
+	uint32_t misses;
+
+	/*
+	 * @brief Number of glyphs evicted to make room for a new glyph.
+	 */
+	uint32_t evictions;
+
+	/*
+	 * @brief Number of drawings not performed by the cache (font without glyphs, glyphs larger than the cache or
+	 * MicroUI images heap full).
+	 */
+	uint32_t fallbacks;
+
+	/*
+	 * @brief Current number of glyphs in the cache.
+	 */
+	uint32_t entries;
+
+	/*
+	 * @brief Current number of bytes allocated in the MicroUI images heap.
+	 */
+	uint32_t memory_used;
+} UI_VGLITE_GLYPH_CACHE_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Draws a string applying a scaling (bilinear interpolation) with the transformed glyphs of the cache.
+ *
+ * @param[in] gc: the destination graphics context.
+ * @param[in] chars: the characters to draw.
+ * @param[in] length: the number of characters to draw.
+ * @param[in] font: the font to use.
+ * @param[in] x: the left of the string's box.
+ * @param[in] y: the top of the string's box.
+ * @param[in] xRatio: the horizontal scaling ratio.
+ * @param[in] yRatio: the vertical scaling ratio.
+ * @param[out] status: the drawing status (only when the string has been drawn).
+ *
+ * @return false when the string cannot be drawn with the cache: nothing has been drawn.
+ *
+ * @see UI_DRAWING_drawScaledStringBilinear
+ */
+bool UI_VGLITE_GLYPH_CACHE_draw_scaled_string(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
+                                              MICROUI_Font *font, jint x, jint y, jfloat xRatio, jfloat yRatio,
+                                              DRAWING_Status *status);
+
+/*
+ * @brief Draws a character applying a rotation and an opacity with the transformed glyph of the cache.
+ *
+ * @param[in] gc: the destination graphics context.
+ * @param[in] c: the character to draw.
+ * @param[in] font: the font to use.
+ * @param[in] x: the left of the character's box.
+ * @param[in] y: the top of the character's box.
+ * @param[in] xRotation: the horizontal coordinate of the rotation center.
+ * @param[in] yRotation: the vertical coordinate of the rotation center.
+ * @param[in] angle: the rotation angle in degrees.
+ * @param[in] alpha: the opacity (0 to 255).
+ * @param[in] bilinear: true for a bilinear interpolation, false for a nearest neighbor interpolation.
+ * @param[out] status: the drawing status (only when the character has been drawn).
+ *
+ * @return false when the character cannot be drawn with the cache: nothing has been drawn.
+ *
+ * @see UI_DRAWING_drawCharWithRotationBilinear
+ * @see UI_DRAWING_drawCharWithRotationNearestNeighbor
+ */
+bool UI_VGLITE_GLYPH_CACHE_draw_rotated_char(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font, jint x,
+                                             jint y, jint xRotation, jint yRotation, jfloat angle, jint alpha,
+                                             bool bilinear, DRAWING_Status *status);
+
+/*
+ * @brief Removes all the glyphs from the cache. The font manager of a custom font must call this function before
+ * releasing the alpha maps of a font (the addresses of the alpha maps identify the glyphs). The memory is released
+ * the next time a glyph is drawn: the GPU may still read the glyphs.
+ */
+void UI_VGLITE_GLYPH_CACHE_invalidate_all(void);
+
+/*
+ * @brief Gets the statistics of the cache of the transformed glyphs.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void UI_VGLITE_GLYPH_CACHE_get_statistics(UI_VGLITE_GLYPH_CACHE_statistics_t *statistics);
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined UI_VGLITE_GLYPH_CACHE_H
@@ -0,0 +1,156 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Cache of the layers: a layer is a region of the display captured once and blitted by the GPU on the next
+ * frames.
+ *
+ * A static composition (background, gradients, icons, texts, etc.) is drawn primitive by primitive each time its
+ * region has to be drawn again. The application can render it once, capture the rendered region in a layer
+ * (Java_com_nxp_ui_LayerCache_capture()) and then draw the layer instead of the composition
+ * (Java_com_nxp_ui_LayerCache_draw()): one GPU copy replaces all the drawings. The application invalidates the
+ * layer when the composition changes (Java_com_nxp_ui_LayerCache_invalidate()).
+ *
+ * The Java natives are declared in the class com.nxp.ui.LayerCache (project vee-port/natives; the simulator
+ * implementation is in vee-port/mock):
+ *
+ *	private static native boolean capture(byte[] gc, int layer, int x, int y, int width, int height);
+ *	private static native boolean draw(byte[] gc, int layer, int x, int y);
+ *	public static native void invalidate(int layer);
+ *	public static native void invalidateAll();
+ *
+ * The pixels of the layers are allocated in the MicroUI images heap (see LLUI_DISPLAY_HEAP_impl.c). The memory used
+ * by the layers is limited by VGLITE_LAYER_CACHE: when the cache is full, the least recently drawn layers are
+ * evicted. A layer is drawn only when it is in the cache: draw() returns false when the layer has been evicted (or
+ * never captured), the application has to render the composition and to capture it again.
+ *
+ * A layer holds the pixels of the display: it is opaque and is drawn without blending. It must be captured after
+ * the composition is rendered and before anything else is drawn over it.
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ * @see VGLITE_LAYER_CACHE
+ */
+
+#if !defined UI_VGLITE_LAYER_CACHE_H
+#define UI_VGLITE_LAYER_CACHE_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <LLUI_DISPLAY.h>
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of the cache of the layers.
+ */
+typedef struct {
+	/*
+	 * @brief Number of layers drawn.
+	 */
+	uint32_t hits;
+
+	/*
+	 * @brief Number of layers not drawn because they are not in the cache.
+	 */
+	uint32_t misses;
+
+	/*
+	 * @brief Number of layers captured.
+	 */
+	uint32_t captures;
+
+	/*
+	 * @brief Number of layers evicted to make room for a new layer.
+	 */
+	uint32_t evictions;
+
+	/*
+	 * @brief Current number of layers in the cache.
+	 */
+	uint32_t entries;
+
+	/*
+	 * @brief Current number of bytes allocated in the MicroUI images heap.
+	 */
+	uint32_t memory_used;
+} UI_VGLITE_LAYER_CACHE_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Java native: captures a region of the graphics context in a layer. The previous content of the layer (if
+ * any) is replaced. The region must fit the graphics context.
+ *
+ * @param[in] gc: the graphics context that holds the rendered composition.
+ * @param[in] layer: the identifier of the layer (chosen by the application).
+ * @param[in] x: the left of the region.
+ * @param[in] y: the top of the region.
+ * @param[in] width: the width of the region.
+ * @param[in] height: the height of the region.
+ *
+ * @return false when the region cannot be captured (region out of the graphics context, format not supported by the
+ * GPU, region larger than the cache or MicroUI images heap full).
+ */
+jboolean Java_com_nxp_ui_LayerCache_capture(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y, jint width,
+                                            jint height);
+
+/*
+ * @brief Java native: draws a layer in the graphics context (the clip is respected).
+ *
+ * @param[in] gc: the destination graphics context.
+ * @param[in] layer: the identifier of the layer.
+ * @param[in] x: the left of the layer in the graphics context.
+ * @param[in] y: the top of the layer in the graphics context.
+ *
+ * @return false when the layer is not in the cache: nothing has been drawn, the application has to render the
+ * composition (and can capture it again).
+ */
+jboolean Java_com_nxp_ui_LayerCache_draw(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y);
+
+/*
+ * @brief Java native: removes a layer from the cache (if any). The memory is released the next time a layer is
+ * captured or drawn: the GPU may still read the layer.
+ *
+ * @param[in] layer: the identifier of the layer.
+ */
+void Java_com_nxp_ui_LayerCache_invalidate(jint layer);
+
+/*
+ * @brief Java native: removes all the layers from the cache.
+ *
+ * @see Java_com_nxp_ui_LayerCache_invalidate()
+ */
+void Java_com_nxp_ui_LayerCache_invalidateAll(void);
+
+/*
+ * @brief Gets the statistics of the cache of the layers.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void UI_VGLITE_LAYER_CACHE_get_statistics(UI_VGLITE_LAYER_CACHE_statistics_t *statistics);
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined UI_VGLITE_LAYER_CACHE_H
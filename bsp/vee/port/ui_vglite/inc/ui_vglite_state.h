@@ -0,0 +1,163 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Shadow of the VGLite states that are programmed before the drawings: scissor,
+ * pre-multiplication and color look-up tables.
+ *
+ * The consecutive drawings often use the same states (same clip, same kind of image, etc.).
+ * Each function compares the requested state with the last programmed one and only calls
+ * the vg_lite function when the state changes. An unchanged scissor is worth skipping: the
+ * driver waits for the end of the pending GPU operations (vg_lite_finish()) before
+ * programming a modified scissor, which breaks the batched operations (see
+ * VGLITE_BATCH_OPERATIONS). An unchanged color look-up table is worth skipping too: the
+ * driver copies the colors in the GPU commands list on each call.
+ *
+ * The other states do not need a shadow: the blending, the quality, the matrix and the
+ * color are arguments of each drawing function and the driver already compares the target
+ * buffer with the previous one.
+ *
+ * All the calls to the functions vg_lite_enable_scissor(), vg_lite_disable_scissor(),
+ * vg_lite_set_scissor(), vg_lite_enable_premultiply(), vg_lite_disable_premultiply() and
+ * vg_lite_set_CLUT() must be replaced by the functions of this file (otherwise the shadow
+ * must be invalidated: see UI_VGLITE_STATE_invalidate()).
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+#if !defined UI_VGLITE_STATE_H
+#define UI_VGLITE_STATE_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdint.h>
+
+#include "vg_lite.h"
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The states tracked by the shadow.
+ */
+typedef enum {
+	/*
+	 * @brief The scissor (enabled or not and its rectangle).
+	 */
+	UI_VGLITE_STATE_SCISSOR,
+
+	/*
+	 * @brief The GPU pre-multiplication (enabled or not).
+	 */
+	UI_VGLITE_STATE_PREMULTIPLY,
+
+	/*
+	 * @brief The color look-up tables (one per size).
+	 */
+	UI_VGLITE_STATE_CLUT,
+
+	/*
+	 * @brief Number of states.
+	 */
+	UI_VGLITE_STATE_STATES,
+} UI_VGLITE_STATE_state_t;
+
+/*
+ * @brief The numbers of state changes (since the startup or the last reset).
+ */
+typedef struct {
+	/*
+	 * @brief The state changes given to the driver.
+	 */
+	uint32_t issued[UI_VGLITE_STATE_STATES];
+
+	/*
+	 * @brief The unchanged states the driver has not been called for.
+	 */
+	uint32_t elided[UI_VGLITE_STATE_STATES];
+} UI_VGLITE_STATE_statistics_t;
+
+// -----------------------------------------------------------------------------
+// API
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Enables the scissor and sets its rectangle.
+ *
+ * @param[in] x: the left of the scissor.
+ * @param[in] y: the top of the scissor.
+ * @param[in] width: the width of the scissor.
+ * @param[in] height: the height of the scissor.
+ */
+void UI_VGLITE_STATE_enable_scissor(int32_t x, int32_t y, int32_t width, int32_t height);
+
+/*
+ * @brief Disables the scissor.
+ */
+void UI_VGLITE_STATE_disable_scissor(void);
+
+/*
+ * @brief Enables the GPU pre-multiplication.
+ *
+ * @return the vg_lite error (the shadow is not updated on error).
+ */
+vg_lite_error_t UI_VGLITE_STATE_enable_premultiply(void);
+
+/*
+ * @brief Disables the GPU pre-multiplication.
+ *
+ * @return the vg_lite error (the shadow is not updated on error).
+ */
+vg_lite_error_t UI_VGLITE_STATE_disable_premultiply(void);
+
+/*
+ * @brief Sets a color look-up table. Only the tables of 2, 4 and 16 colors are tracked;
+ * the table of 256 colors is always given to the driver.
+ *
+ * @param[in] count: the number of colors.
+ * @param[in] colors: the colors.
+ *
+ * @return the vg_lite error (the shadow is not updated on error).
+ */
+vg_lite_error_t UI_VGLITE_STATE_set_CLUT(uint32_t count, uint32_t *colors);
+
+/*
+ * @brief Forgets the programmed states: the next calls will be given to the driver. Must
+ * be called after a direct call to a vg_lite function that modifies a tracked state.
+ */
+void UI_VGLITE_STATE_invalidate(void);
+
+/*
+ * @brief Gets the numbers of issued and elided state changes.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void UI_VGLITE_STATE_get_statistics(UI_VGLITE_STATE_statistics_t *statistics);
+
+/*
+ * @brief Resets the numbers of issued and elided state changes.
+ */
+void UI_VGLITE_STATE_reset_statistics(void);
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined UI_VGLITE_STATE_H
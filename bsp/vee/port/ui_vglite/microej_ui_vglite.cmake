@@ -3,10 +3,18 @@ message("microej/ui_vglite component is included.")
 
 target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
     ${CMAKE_CURRENT_LIST_DIR}/src/mej_math.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_display_brs_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/ui_drawing_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/ui_drawing_vglite_path.c
     ${CMAKE_CURRENT_LIST_DIR}/src/ui_drawing_vglite_process.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_image_drawing_compressed_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_cost.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_cost_calibration.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_format_cache.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_glyph_cache.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_layer_cache.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/ui_vglite_state.c
 )
 
 target_include_directories(${MCUX_SDK_PROJECT_NAME} PRIVATE    ${CMAKE_CURRENT_LIST_DIR}/inc)
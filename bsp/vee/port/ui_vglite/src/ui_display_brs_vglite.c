@@ -0,0 +1,79 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the display buffer refresh strategy's restore over VGLite:
+ * the regions of the old back buffer are copied by the GPU.
+ *
+ * Each copy is added to the GPU commands list like any other drawing: the CPU does
+ * not wait for the end of the copy. With VGLITE_BATCH_OPERATIONS, all the copies and
+ * the first drawings of the new frame are submitted at once; the GPU performs them in
+ * order, so a drawing always sees the restored pixels it overlaps. The software
+ * drawings wait for the end of the batched copies (see UI_VGLITE_flush_batch()).
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ * @see ui_display_brs.h
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include "ui_display_brs.h"
+#include "ui_drawing.h"
+#include "ui_vglite.h"
+
+// --------------------------------------------------------------------------------
+// Private global variables
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The VGLite buffer that targets the old back buffer.
+ */
+static vg_lite_buffer_t old_back_buffer_source;
+
+// --------------------------------------------------------------------------------
+// ui_display_brs.h API
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+DRAWING_Status UI_DISPLAY_BRS_restore(MICROUI_GraphicsContext *gc, MICROUI_Image *old_back_buffer, ui_rect_t *rect) {
+	DRAWING_Status ret;
+	jint width = UI_RECT_get_width(rect);
+	jint height = UI_RECT_get_height(rect);
+
+	if (UI_VGLITE_is_hardware_rendering_enabled()
+	    && UI_VGLITE_configure_source(&old_back_buffer_source, old_back_buffer)
+	    && UI_VGLITE_enable_vg_lite_scissor_region(gc, rect->x1, rect->y1, rect->x2, rect->y2)) {
+		// raw copy: the pixels are neither blended nor multiplied by a color
+		old_back_buffer_source.image_mode = VG_LITE_NORMAL_IMAGE_MODE;
+
+		vg_lite_matrix_t matrix;
+		vg_lite_identity(&matrix);
+		matrix.m[0][2] = rect->x1;
+		matrix.m[1][2] = rect->y1;
+
+		uint32_t blit_rect[4] = { (uint32_t)rect->x1, (uint32_t)rect->y1, (uint32_t)width, (uint32_t)height };
+
+		vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+		vg_lite_error_t err = vg_lite_blit_rect(target, &old_back_buffer_source, blit_rect, &matrix,
+		                                        VG_LITE_BLEND_NONE, 0, VG_LITE_FILTER_POINT);
+		ret = UI_VGLITE_post_operation(gc, err);
+	} else {
+		// GPU disabled or buffer not compatible with the GPU: use the standard function
+		UI_VGLITE_flush_batch();
+		ret = UI_DRAWING_copyImage(gc, old_back_buffer, rect->x1, rect->y1, width, height, rect->x1, rect->y1);
+	}
+
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
@@ -29,17 +29,96 @@
 // Includes
 // --------------------------------------------------------------------------------
 
+#include <string.h>
+
 #include "ui_drawing_vglite.h"
 #include "ui_drawing_soft.h"
 #include "dw_drawing_soft.h"
 #include "ui_image_drawing.h"
+#include "ui_drawing_transform.h"
 #include "ui_configuration.h"
 #include "ui_drawing_vglite_process.h"
+#include "ui_vglite_cost.h"
+#include "ui_vglite_state.h"
+#include "ui_vglite_glyph_cache.h"
+#include "ui_font_drawing.h"
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Maximum number of layers to draw the fade of a thick shape when the fade is
+ * higher than 1 (see _prepare_fade_layer()).
+ */
+#define FADE_MAX_LAYERS (8)
+
+// --------------------------------------------------------------------------------
+// Private fields
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Opacity of the layer of a faded shape to draw (see _draw_fade_layer()).
+ */
+static uint32_t fade_layer_alpha;
+
+/*
+ * @brief Tells whether the layer of a faded shape to draw is the last one.
+ */
+static bool fade_last_layer;
+
+#ifdef VGLITE_DRAW_REGION_BUFFER
+/*
+ * @brief The buffer where the bands of an overlapping region are copied (allocated at
+ * the first use).
+ */
+static vg_lite_buffer_t region_buffer;
+#endif
 
 // --------------------------------------------------------------------------------
 // Private functions
 // --------------------------------------------------------------------------------
 
+/*
+ * @brief Gets the number of pixels of an aliased line.
+ */
+static inline uint32_t _get_line_length(jint x1, jint y1, jint x2, jint y2) {
+	uint32_t width = (uint32_t)((x2 > x1) ? (x2 - x1) : (x1 - x2));
+	uint32_t height = (uint32_t)((y2 > y1) ? (y2 - y1) : (y1 - y2));
+	return ((width > height) ? width : height) + 1u;
+}
+
+/*
+ * @brief Gets the number of pixels of an area (0 when the area is empty).
+ */
+static inline uint32_t _get_area(jint width, jint height) {
+	return ((width > 0) && (height > 0)) ? ((uint32_t)width * (uint32_t)height) : 0u;
+}
+
+/*
+ * @brief Gets the number of pixels of a thick line.
+ */
+static inline uint32_t _get_thick_line_area(jint x1, jint y1, jint x2, jint y2, jint thickness) {
+	return _get_line_length(x1, y1, x2, y2) * ((thickness > 0) ? (uint32_t)thickness : 0u);
+}
+
+/*
+ * @brief Tells whether the drawing must be performed by the software algorithms: the GPU
+ * is disabled (see VGLITE_OPTION_TOGGLE_GPU) or the software algorithm is faster (see
+ * VGLITE_COST_MODEL).
+ */
+static inline bool _is_software_drawing(MICROUI_GraphicsContext *gc, UI_VGLITE_COST_primitive_t primitive,
+                                        uint32_t pixels) {
+	return !UI_VGLITE_is_hardware_rendering_enabled() || UI_VGLITE_COST_use_software(gc, primitive, pixels);
+}
+
+/*
+ * @brief Gets the kind of image drawing according to the opacity.
+ */
+static inline UI_VGLITE_COST_primitive_t _get_image_primitive(jint alpha) {
+	return (0xff == alpha) ? UI_VGLITE_COST_IMAGE : UI_VGLITE_COST_IMAGE_BLEND;
+}
+
 static DRAWING_Status _draw_path(MICROUI_GraphicsContext *gc, vg_lite_path_t *path, vg_lite_fill_t fill_rule,
                                  vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color) {
 	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
@@ -47,7 +126,64 @@ static DRAWING_Status _draw_path(MICROUI_GraphicsContext *gc, vg_lite_path_t *pa
 	return UI_VGLITE_post_operation(gc, err);
 }
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+/*
+ * @brief Gets the number of layers to draw a fade higher than 1: the bands of the fade
+ * are at least one pixel wide.
+ */
+static inline jint _get_fade_layers(jint fade) {
+	return (fade < FADE_MAX_LAYERS) ? fade : FADE_MAX_LAYERS;
+}
+
+/*
+ * @brief Prepares the drawing of a layer of a faded shape and gets the thickness of the
+ * layer.
+ *
+ * The fade is split in bands. The layers are drawn from the outermost one (index 0) to
+ * the innermost one: the layer "n" covers the bands "n" to "layers - 1" and the core of
+ * the shape, and its opacity is 1 / (layers - n). Once blended, the opacity of the band
+ * "n" is (n + 1) / layers: the fade is linear, like the software algorithm. The edge of
+ * each layer is in the middle of its outermost band and the anti-aliasing smooths it.
+ */
+static jint _prepare_fade_layer(jint thickness, jint fade, jint layers, jint layer) {
+	fade_layer_alpha = (uint32_t)0xff / (uint32_t)(layers - layer);
+	fade_last_layer = (layers - 1) == layer;
+	return thickness + ((((2 * fade) * (layers - layer)) - fade + (layers / 2)) / layers);
+}
+
+/*
+ * @brief Draws a layer of a faded shape: same as _draw_path() with the layer's opacity.
+ * Without the batched operations, the GPU is only started asynchronously for the last
+ * layer.
+ */
+static DRAWING_Status _draw_fade_layer(MICROUI_GraphicsContext *gc, vg_lite_path_t *path, vg_lite_fill_t fill_rule,
+                                       vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color) {
+	DRAWING_Status ret;
+	vg_lite_color_t layer_color;
+
+	if (UI_VGLITE_need_to_premultiply()) {
+		layer_color = UI_VGLITE_premultiply_alpha(color, (uint8_t)fade_layer_alpha);
+	} else {
+		layer_color = (fade_layer_alpha << 24) | (color & 0xffffffu);
+	}
+
+	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+	vg_lite_error_t err = vg_lite_draw(target, path, fill_rule, matrix, blend, layer_color);
+
+#ifndef VGLITE_BATCH_OPERATIONS
+	if (!fade_last_layer && (VG_LITE_SUCCESS == err)) {
+		// waits the end of the layer before drawing the next one
+		UI_VGLITE_start_operation(false);
+		ret = DRAWING_DONE;
+	} else
+#endif // VGLITE_BATCH_OPERATIONS
+	{
+		ret = UI_VGLITE_post_operation(gc, err);
+	}
+
+	return ret;
+}
+
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 static DRAWING_Status _clear(MICROUI_GraphicsContext *gc, vg_lite_rectangle_t *rect, vg_lite_color_t color) {
 	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
@@ -55,7 +191,7 @@ static DRAWING_Status _clear(MICROUI_GraphicsContext *gc, vg_lite_rectangle_t *r
 	return UI_VGLITE_post_operation(gc, err);
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
 static DRAWING_Status _blit_rect(MICROUI_GraphicsContext *gc, vg_lite_buffer_t *source, uint32_t *rect,
                                  vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color,
@@ -107,222 +243,322 @@ static DRAWING_Status _draw_region(MICROUI_GraphicsContext *gc, vg_lite_buffer_t
 	return ret;
 }
 
+#ifdef VGLITE_DRAW_REGION_BUFFER
+
+/*
+ * @brief Configures the region buffer to hold some full rows of a region of the
+ * destination (same format as the destination).
+ *
+ * @return the number of rows the buffer can hold (0 when the buffer cannot be
+ * allocated or when a row is too large).
+ */
+static uint32_t _configure_region_buffer(MICROUI_GraphicsContext *gc, const vg_lite_buffer_t *source, jint width) {
+	if (NULL == region_buffer.memory) {
+		// allocates VGLITE_DRAW_REGION_BUFFER bytes: the buffer is reconfigured for each drawing
+		(void)memset(&region_buffer, 0, sizeof(vg_lite_buffer_t));
+		region_buffer.width = 16;
+		region_buffer.height = (int32_t)(VGLITE_DRAW_REGION_BUFFER) / (16 * 4);
+		region_buffer.format = VG_LITE_RGBA8888;
+		if (VG_LITE_SUCCESS != vg_lite_allocate(&region_buffer)) {
+			region_buffer.memory = NULL;
+		}
+	}
+
+	uint32_t rows = 0;
+	uint32_t bpp = LLUI_DISPLAY_getImageBPP(&gc->image) / 8u;
+	if ((NULL != region_buffer.memory) && ((2u == bpp) || (4u == bpp))) {
+		// VGLite alignment: stride aligned on 16 pixels
+		uint32_t stride = (((uint32_t)width + 15u) & ~(uint32_t)15u) * bpp;
+		rows = (uint32_t)(VGLITE_DRAW_REGION_BUFFER) / stride;
+
+		region_buffer.width = width;
+		region_buffer.height = (int32_t)rows;
+		region_buffer.stride = (int32_t)stride;
+		region_buffer.format = source->format;
+		region_buffer.tiled = VG_LITE_LINEAR;
+		region_buffer.image_mode = source->image_mode;
+		region_buffer.transparency_mode = source->transparency_mode;
+	}
+	return rows;
+}
+
+/*
+ * @brief Draws a region of the destination onto itself through the region buffer: each
+ * band of rows is copied in the buffer and then drawn at its destination. The bands
+ * are drawn from the bottom to the top when the region moves down (the rows still to
+ * copy are above the drawn rows) and from the top to the bottom otherwise.
+ *
+ * @param[in] rows: the number of rows of a band (see _configure_region_buffer()).
+ */
+static DRAWING_Status _draw_region_buffered(MICROUI_GraphicsContext *gc, vg_lite_buffer_t *source, jint regionX,
+                                            jint regionY, jint width, jint height, jint x, jint y,
+                                            vg_lite_color_t color, uint32_t rows) {
+	DRAWING_Status ret = DRAWING_DONE;
+
+	if (!LLUI_DISPLAY_isClipEnabled(gc)
+	    || LLUI_DISPLAY_clipRegion(gc, &regionX, &regionY, &width, &height, &x, &y)) {
+		// the region is clipped: the scissor is useless and would crop the copies in the buffer
+		UI_VGLITE_STATE_disable_scissor();
+		vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+
+		vg_lite_matrix_t buffer_matrix;
+		vg_lite_matrix_t matrix;
+		vg_lite_identity(&buffer_matrix);
+		vg_lite_identity(&matrix);
+		matrix.m[0][2] = x;
+
+		bool bottom_up = y > regionY;
+		jint drawn = 0;
+		while (drawn < height) {
+			jint band = ((height - drawn) < (jint)rows) ? (height - drawn) : (jint)rows;
+			jint offset = bottom_up ? (height - drawn - band) : drawn;
+			uint32_t source_rect[4] = { (uint32_t)regionX, (uint32_t)(regionY + offset), (uint32_t)width,
+				                        (uint32_t)band };
+			uint32_t buffer_rect[4] = { 0u, 0u, (uint32_t)width, (uint32_t)band };
+			matrix.m[1][2] = y + offset;
+			drawn += band;
+
+			// copy the band in the buffer (opaque copy) and wait for the end of the copy
+			if (VG_LITE_SUCCESS != vg_lite_blit_rect(&region_buffer, source, source_rect, &buffer_matrix,
+			                                         VG_LITE_BLEND_NONE, 0xffffffffu, VG_LITE_FILTER_POINT)) {
+				LLUI_DISPLAY_reportError(gc, DRAWING_LOG_LIBRARY_INCIDENT);
+				break;
+			}
+			UI_VGLITE_start_operation(false);
+
+			// draw the band: wakeup task only for the last band, otherwise waits the end of the drawing before
+			// copying the next band in the buffer
+			if (VG_LITE_SUCCESS != vg_lite_blit_rect(target, &region_buffer, buffer_rect, &matrix,
+			                                         VG_LITE_BLEND_SRC_OVER, color, VG_LITE_FILTER_POINT)) {
+				LLUI_DISPLAY_reportError(gc, DRAWING_LOG_LIBRARY_INCIDENT);
+				break;
+			}
+			UI_VGLITE_start_operation(drawn >= height);
+			ret = (drawn >= height) ? DRAWING_RUNNING : DRAWING_DONE;
+		}
+	}
+
+	return ret;
+}
+
+#endif // VGLITE_DRAW_REGION_BUFFER
+
 // --------------------------------------------------------------------------------
 // ui_drawing.h / ui_drawing_vglite.h functions
 // (the function names differ according to the available number of destination formats)
 // --------------------------------------------------------------------------------
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawLine(MICROUI_GraphicsContext *gc, jint startX, jint startY, jint endX, jint endY) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_line_length(startX, startY, endX, endY))) {
 		status = UI_DRAWING_SOFT_drawLine(gc, startX, startY, endX, endY);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawLine(&_draw_path, gc, startX, startY, endX, endY);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawHorizontalLine(MICROUI_GraphicsContext *gc, jint x1, jint x2, jint y) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_line_length(x1, y, x2, y))) {
 		status = UI_DRAWING_SOFT_drawHorizontalLine(gc, x1, x2, y);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawHorizontalLine(&_draw_path, gc, x1, x2, y);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawVerticalLine(MICROUI_GraphicsContext *gc, jint x, jint y1, jint y2) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_line_length(x, y1, x, y2))) {
 		status = UI_DRAWING_SOFT_drawVerticalLine(gc, x, y1, y2);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawVerticalLine(&_draw_path, gc, x, y1, y2);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_fillRectangle(MICROUI_GraphicsContext *gc, jint x1, jint y1, jint x2, jint y2) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area((x2 - x1) + 1, (y2 - y1) + 1))) {
 		status = UI_DRAWING_SOFT_fillRectangle(gc, x1, y1, x2, y2);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillRectangle(&_clear, gc, x1, y1, x2, y2);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawRoundedRectangle(MICROUI_GraphicsContext *gc, jint x, jint y, jint width,
                                                       jint height, jint cornerEllipseWidth, jint cornerEllipseHeight) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area(2, width + height))) {
 		status = UI_DRAWING_SOFT_drawRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawRoundedRectangle(&_draw_path, gc, x, y, width, height, cornerEllipseWidth,
 	                                                        cornerEllipseHeight);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_fillRoundedRectangle(MICROUI_GraphicsContext *gc, jint x, jint y, jint width,
                                                       jint height, jint cornerEllipseWidth, jint cornerEllipseHeight) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(width, height))) {
 		status = UI_DRAWING_SOFT_fillRoundedRectangle(gc, x, y, width, height, cornerEllipseWidth, cornerEllipseHeight);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillRoundedRectangle(&_draw_path, gc, x, y, width, height, cornerEllipseWidth,
 	                                                        cornerEllipseHeight);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter,
                                                jfloat startAngle, jfloat arcAngle) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area(3, diameter))) {
 		status = UI_DRAWING_SOFT_drawCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawCircleArc(&_draw_path, gc, x, y, diameter, startAngle, arcAngle);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawEllipseArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height,
                                                 jfloat startAngle, jfloat arcAngle) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area(2, width + height))) {
 		status = UI_DRAWING_SOFT_drawEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawEllipseArc(&_draw_path, gc, x, y, width, height, startAngle, arcAngle);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_fillCircleArc(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter,
                                                jfloat startAngle, jfloat arcAngle) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(diameter, diameter))) {
 		status = UI_DRAWING_SOFT_fillCircleArc(gc, x, y, diameter, startAngle, arcAngle);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillCircleArc(&_draw_path, gc, x, y, diameter, startAngle, arcAngle);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -332,106 +568,106 @@ DRAWING_Status UI_DRAWING_VGLITE_fillEllipseArc(MICROUI_GraphicsContext *gc, jin
                                                 jfloat startAngle, jfloat arcAngle) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(width, height))) {
 		status = UI_DRAWING_SOFT_fillEllipseArc(gc, x, y, width, height, startAngle, arcAngle);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillEllipseArc(&_draw_path, gc, x, y, width, height, startAngle, arcAngle);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area(2, width + height))) {
 		status = UI_DRAWING_SOFT_drawEllipse(gc, x, y, width, height);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawEllipse(&_draw_path, gc, x, y, width, height);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_fillEllipse(MICROUI_GraphicsContext *gc, jint x, jint y, jint width, jint height) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(width, height))) {
 		status = UI_DRAWING_SOFT_fillEllipse(gc, x, y, width, height);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillEllipse(&_draw_path, gc, x, y, width, height);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#ifdef VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#if defined(VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS) || defined(VGLITE_COST_MODEL)
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_drawCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_FILL, _get_area(3, diameter))) {
 		status = UI_DRAWING_SOFT_drawCircle(gc, x, y, diameter);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawCircle(&_draw_path, gc, x, y, diameter);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
 
-#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS
+#endif // VGLITE_USE_GPU_FOR_SIMPLE_DRAWINGS || VGLITE_COST_MODEL
 
 // See the header file for the function documentation
 DRAWING_Status UI_DRAWING_VGLITE_fillCircle(MICROUI_GraphicsContext *gc, jint x, jint y, jint diameter) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(diameter, diameter))) {
 		status = UI_DRAWING_SOFT_fillCircle(gc, x, y, diameter);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_fillCircle(&_draw_path, gc, x, y, diameter);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -441,15 +677,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawImage(MICROUI_GraphicsContext *gc, MICROUI_
                                            jint width, jint height, jint x, jint y, jint alpha) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, _get_image_primitive(alpha), _get_area(width, height))) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = UI_DRAWING_SOFT_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
 #else
 		status = UI_IMAGE_DRAWING_draw(gc, img, regionX, regionY, width, height, x, y, alpha);
 #endif
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	vg_lite_color_t color;
 	vg_lite_matrix_t matrix;
@@ -462,6 +698,7 @@ DRAWING_Status UI_DRAWING_VGLITE_drawImage(MICROUI_GraphicsContext *gc, MICROUI_
 	if (NULL != source_buffer) {
 		status = _blit_rect(gc, source_buffer, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER, color, VG_LITE_FILTER_POINT);
 	} else {
+		UI_VGLITE_flush_batch();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = UI_DRAWING_SOFT_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
 #else
@@ -469,10 +706,10 @@ DRAWING_Status UI_DRAWING_VGLITE_drawImage(MICROUI_GraphicsContext *gc, MICROUI_
 #endif
 	}
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -515,15 +752,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRegion(MICROUI_GraphicsContext *gc, jint re
                                             jint height, jint x, jint y, jint alpha) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, _get_image_primitive(alpha), _get_area(width, height))) {
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = UI_DRAWING_SOFT_drawRegion(gc, regionX, regionY, width, height, x, y, alpha);
 #else
 		status = UI_IMAGE_DRAWING_drawRegion(gc, regionX, regionY, width, height, x, y, alpha);
 #endif
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	vg_lite_color_t color;
 	vg_lite_matrix_t matrix;
@@ -534,11 +771,21 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRegion(MICROUI_GraphicsContext *gc, jint re
 	                                                                               &matrix, blit_rect);
 
 	if (NULL != source_buffer) {
-		if ((y == regionY) && (x > regionX) && (x < (regionX + width))) {
+		bool horizontal_overlap = (y == regionY) && (x > regionX) && (x < (regionX + width));
+		bool vertical_overlap = (y > regionY) && (y < (regionY + height));
+#ifdef VGLITE_DRAW_REGION_BUFFER
+		uint32_t rows = (horizontal_overlap || vertical_overlap) ?
+		                _configure_region_buffer(gc, source_buffer, width) : 0u;
+		if (0u < rows) {
+			// draw with overlap: copy the bands of rows in the region buffer
+			status = _draw_region_buffered(gc, source_buffer, regionX, regionY, width, height, x, y, color, rows);
+		} else
+#endif // VGLITE_DRAW_REGION_BUFFER
+		if (horizontal_overlap) {
 			// draw with overlap: cut the drawings in several widths
 			status = _draw_region(gc, source_buffer, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER, color,
 			                      VG_LITE_FILTER_POINT, 0);
-		} else if ((y > regionY) && (y < (regionY + height))) {
+		} else if (vertical_overlap) {
 			// draw with overlap: cut the drawings in several heights
 			status = _draw_region(gc, source_buffer, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER, color,
 			                      VG_LITE_FILTER_POINT, 1);
@@ -548,6 +795,7 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRegion(MICROUI_GraphicsContext *gc, jint re
 			                    VG_LITE_FILTER_POINT);
 		}
 	} else {
+		UI_VGLITE_flush_batch();
 #if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = UI_DRAWING_SOFT_drawRegion(gc, regionX, regionY, width, height, x, y, alpha);
 #else
@@ -555,10 +803,10 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRegion(MICROUI_GraphicsContext *gc, jint re
 #endif
 	}
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -568,16 +816,20 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickFadedPoint(MICROUI_GraphicsContext *gc
                                                      jint fade) {
 	DRAWING_Status status;
 
-	if (!UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	    || !UI_VGLITE_is_hardware_rendering_enabled()
-#endif // VGLITE_OPTION_TOGGLE_GPU
-	    ) {
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(thickness + fade, thickness + fade))) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawThickFadedPoint(gc, x, y, thickness, fade);
 		status = DRAWING_DONE;
-	} else {
+	} else if (UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)) {
 		status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedPoint(&_draw_path, gc, x, y,
 		                                                       UI_DRAWING_VGLITE_GET_THICKNESS(thickness, fade));
+	} else {
+		status = DRAWING_DONE;
+		jint layers = _get_fade_layers(fade);
+		for (jint layer = 0; layer < layers; layer++) {
+			status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedPoint(&_draw_fade_layer, gc, x, y,
+			                                                       _prepare_fade_layer(thickness, fade, layers, layer));
+		}
 	}
 	return status;
 }
@@ -588,17 +840,23 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickFadedLine(MICROUI_GraphicsContext *gc,
                                                     DRAWING_Cap endCap) {
 	DRAWING_Status status;
 
-	if (!UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	    || !UI_VGLITE_is_hardware_rendering_enabled()
-#endif // VGLITE_OPTION_TOGGLE_GPU
-	    ) {
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE,
+	                         _get_thick_line_area(startX, startY, endX, endY, thickness + fade))) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawThickFadedLine(gc, startX, startY, endX, endY, thickness, fade, startCap, endCap);
 		status = DRAWING_DONE;
-	} else {
+	} else if (UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)) {
 		status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedLine(&_draw_path, gc, startX, startY, endX, endY,
 		                                                      UI_DRAWING_VGLITE_GET_THICKNESS(thickness, fade),
 		                                                      startCap, endCap);
+	} else {
+		status = DRAWING_DONE;
+		jint layers = _get_fade_layers(fade);
+		for (jint layer = 0; layer < layers; layer++) {
+			status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedLine(&_draw_fade_layer, gc, startX, startY, endX, endY,
+			                                                      _prepare_fade_layer(thickness, fade, layers, layer),
+			                                                      startCap, endCap);
+		}
 	}
 
 	return status;
@@ -609,16 +867,21 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickFadedCircle(MICROUI_GraphicsContext *g
                                                       jint thickness, jint fade) {
 	DRAWING_Status status;
 
-	if (!UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	    || !UI_VGLITE_is_hardware_rendering_enabled()
-#endif // VGLITE_OPTION_TOGGLE_GPU
-	    ) {
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(3 * diameter, thickness + fade))) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawThickFadedCircle(gc, x, y, diameter, thickness, fade);
 		status = DRAWING_DONE;
-	} else {
+	} else if (UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)) {
 		status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedCircle(&_draw_path, gc, x, y, diameter,
 		                                                        UI_DRAWING_VGLITE_GET_THICKNESS(thickness, fade));
+	} else {
+		status = DRAWING_DONE;
+		jint layers = _get_fade_layers(fade);
+		for (jint layer = 0; layer < layers; layer++) {
+			status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedCircle(&_draw_fade_layer, gc, x, y, diameter,
+			                                                        _prepare_fade_layer(thickness, fade, layers,
+			                                                                            layer));
+		}
 	}
 
 	return status;
@@ -630,18 +893,25 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickFadedCircleArc(MICROUI_GraphicsContext
                                                          DRAWING_Cap start, DRAWING_Cap end) {
 	DRAWING_Status status;
 
-	if (!UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	    || !UI_VGLITE_is_hardware_rendering_enabled()
-#endif // VGLITE_OPTION_TOGGLE_GPU
-	    ) {
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(3 * diameter, thickness + fade))) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawThickFadedCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness, fade, start, end);
 		status = DRAWING_DONE;
-	} else {
+	} else if (UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)) {
 		status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedCircleArc(&_draw_path, gc, x, y, diameter, startAngle,
 		                                                           arcAngle,
 		                                                           UI_DRAWING_VGLITE_GET_THICKNESS(thickness, fade),
 		                                                           start, end);
+	} else {
+		status = DRAWING_DONE;
+		jint layers = _get_fade_layers(fade);
+		for (jint layer = 0; layer < layers; layer++) {
+			status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedCircleArc(&_draw_fade_layer, gc, x, y, diameter,
+			                                                           startAngle, arcAngle,
+			                                                           _prepare_fade_layer(thickness, fade, layers,
+			                                                                               layer),
+			                                                           start, end);
+		}
 	}
 
 	return status;
@@ -652,16 +922,21 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickFadedEllipse(MICROUI_GraphicsContext *
                                                        jint height, jint thickness, jint fade) {
 	DRAWING_Status status;
 
-	if (!UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	    || !UI_VGLITE_is_hardware_rendering_enabled()
-#endif // VGLITE_OPTION_TOGGLE_GPU
-	    ) {
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(2 * (width + height), thickness + fade))) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawThickFadedEllipse(gc, x, y, width, height, thickness, fade);
 		status = DRAWING_DONE;
-	} else {
+	} else if (UI_DRAWING_VGLITE_IS_COMPATIBLE_FADE(fade)) {
 		status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedEllipse(&_draw_path, gc, x, y, width, height,
 		                                                         UI_DRAWING_VGLITE_GET_THICKNESS(thickness, fade));
+	} else {
+		status = DRAWING_DONE;
+		jint layers = _get_fade_layers(fade);
+		for (jint layer = 0; layer < layers; layer++) {
+			status = UI_DRAWING_VGLITE_PROCESS_drawThickFadedEllipse(&_draw_fade_layer, gc, x, y, width, height,
+			                                                         _prepare_fade_layer(thickness, fade, layers,
+			                                                                             layer));
+		}
 	}
 
 	return status;
@@ -672,18 +947,18 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickLine(MICROUI_GraphicsContext *gc, jint
                                                jint endY, jint thickness) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_thick_line_area(startX, startY, endX, endY, thickness))) {
 		status = DW_DRAWING_SOFT_drawThickLine(gc, startX, startY, endX, endY, thickness);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawThickLine(&_draw_path, gc, startX, startY, endX, endY, thickness);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -693,18 +968,18 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickCircle(MICROUI_GraphicsContext *gc, ji
                                                  jint thickness) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(3 * diameter, thickness))) {
 		status = DW_DRAWING_SOFT_drawThickCircle(gc, x, y, diameter, thickness);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawThickCircle(&_draw_path, gc, x, y, diameter, thickness);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -714,18 +989,18 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickEllipse(MICROUI_GraphicsContext *gc, j
                                                   jint thickness) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(2 * (width + height), thickness))) {
 		status = DW_DRAWING_SOFT_drawThickEllipse(gc, x, y, width, height, thickness);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawThickEllipse(&_draw_path, gc, x, y, width, height, thickness);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -735,19 +1010,19 @@ DRAWING_Status UI_DRAWING_VGLITE_drawThickCircleArc(MICROUI_GraphicsContext *gc,
                                                     jfloat startAngle, jfloat arcAngle, jint thickness) {
 	DRAWING_Status status;
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
-	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
+	if (_is_software_drawing(gc, UI_VGLITE_COST_SHAPE, _get_area(3 * diameter, thickness))) {
 		status = DW_DRAWING_SOFT_drawThickCircleArc(gc, x, y, diameter, startAngle, arcAngle, thickness);
 	} else {
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	status = UI_DRAWING_VGLITE_PROCESS_drawThickCircleArc(&_draw_path, gc, x, y, diameter, startAngle, arcAngle,
 	                                                      thickness);
 
-#ifdef VGLITE_OPTION_TOGGLE_GPU
+#if defined(VGLITE_OPTION_TOGGLE_GPU) || defined(VGLITE_COST_MODEL)
 }
 
-#endif // VGLITE_OPTION_TOGGLE_GPU
+#endif // VGLITE_OPTION_TOGGLE_GPU || VGLITE_COST_MODEL
 
 	return status;
 }
@@ -760,14 +1035,19 @@ DRAWING_Status UI_DRAWING_VGLITE_drawFlippedImage(MICROUI_GraphicsContext *gc, M
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
 	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = DW_DRAWING_SOFT_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation,
 		                                          alpha);
+#else
+		status = UI_IMAGE_DRAWING_drawFlipped(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
+#endif
 	} else {
 #endif // VGLITE_OPTION_TOGGLE_GPU
 
 #ifndef VGLITE_USE_GPU_FOR_RGB565_IMAGES
 	// CPU (memcpy) is faster than GPU
 	if ((MICROUI_IMAGE_FORMAT_RGB565 == img->format) && (DRAWING_FLIP_NONE == transformation) && (0xff == alpha)) {
+		UI_VGLITE_flush_batch();
 		DW_DRAWING_SOFT_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
 		status = DRAWING_DONE;
 	} else {
@@ -778,8 +1058,13 @@ DRAWING_Status UI_DRAWING_VGLITE_drawFlippedImage(MICROUI_GraphicsContext *gc, M
 	                                                    transformation, alpha, &is_gpu_compatible);
 
 	if (!is_gpu_compatible) {
+		UI_VGLITE_flush_batch();
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		DW_DRAWING_SOFT_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
 		status = DRAWING_DONE;
+#else
+		status = UI_IMAGE_DRAWING_drawFlipped(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
+#endif
 	}
 
 #ifndef VGLITE_USE_GPU_FOR_RGB565_IMAGES
@@ -802,7 +1087,11 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRotatedImageNearestNeighbor(MICROUI_Graphic
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
 	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#else
+		status = UI_IMAGE_DRAWING_drawRotatedNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#endif
 	} else {
 #endif // VGLITE_OPTION_TOGGLE_GPU
 
@@ -811,8 +1100,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRotatedImageNearestNeighbor(MICROUI_Graphic
 	                                                                   angle, alpha, &is_gpu_compatible);
 
 	if (!is_gpu_compatible) {
-		DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		UI_VGLITE_flush_batch();
 		status = DRAWING_DONE;
+		if (!UI_DRAWING_TRANSFORM_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha)) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
+			DW_DRAWING_SOFT_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#else
+			status = UI_IMAGE_DRAWING_drawRotatedNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#endif
+		}
 	}
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
@@ -831,7 +1127,11 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRotatedImageBilinear(MICROUI_GraphicsContex
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
 	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#else
+		status = UI_IMAGE_DRAWING_drawRotatedBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#endif
 	} else {
 #endif // VGLITE_OPTION_TOGGLE_GPU
 
@@ -840,8 +1140,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawRotatedImageBilinear(MICROUI_GraphicsContex
 	                                                            alpha, &is_gpu_compatible);
 
 	if (!is_gpu_compatible) {
-		DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+		UI_VGLITE_flush_batch();
 		status = DRAWING_DONE;
+		if (!UI_DRAWING_TRANSFORM_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha)) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
+			DW_DRAWING_SOFT_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#else
+			status = UI_IMAGE_DRAWING_drawRotatedBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+#endif
+		}
 	}
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
@@ -859,7 +1166,11 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageNearestNeighbor(MICROUI_Graphics
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
 	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+#else
+		status = UI_IMAGE_DRAWING_drawScaledNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+#endif
 	} else {
 #endif // VGLITE_OPTION_TOGGLE_GPU
 
@@ -868,8 +1179,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageNearestNeighbor(MICROUI_Graphics
 	                                                                  alpha, &is_gpu_compatible);
 
 	if (!is_gpu_compatible) {
-		DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+		UI_VGLITE_flush_batch();
 		status = DRAWING_DONE;
+		if (!UI_DRAWING_TRANSFORM_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha)) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
+			DW_DRAWING_SOFT_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+#else
+			status = UI_IMAGE_DRAWING_drawScaledNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+#endif
+		}
 	}
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
@@ -887,7 +1205,11 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageBilinear(MICROUI_GraphicsContext
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
 	if (!UI_VGLITE_is_hardware_rendering_enabled()) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
 		status = DW_DRAWING_SOFT_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
+#else
+		status = UI_IMAGE_DRAWING_drawScaledBilinear(gc, img, x, y, factorX, factorY, alpha);
+#endif
 	} else {
 #endif // VGLITE_OPTION_TOGGLE_GPU
 
@@ -896,8 +1218,15 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageBilinear(MICROUI_GraphicsContext
 	                                                           &is_gpu_compatible);
 
 	if (!is_gpu_compatible) {
-		DW_DRAWING_SOFT_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
+		UI_VGLITE_flush_batch();
 		status = DRAWING_DONE;
+		if (!UI_DRAWING_TRANSFORM_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha)) {
+#if !defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS)
+			DW_DRAWING_SOFT_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
+#else
+			status = UI_IMAGE_DRAWING_drawScaledBilinear(gc, img, x, y, factorX, factorY, alpha);
+#endif
+		}
 	}
 
 #ifdef VGLITE_OPTION_TOGGLE_GPU
@@ -908,6 +1237,70 @@ DRAWING_Status UI_DRAWING_VGLITE_drawScaledImageBilinear(MICROUI_GraphicsContext
 	return status;
 }
 
+#ifdef VGLITE_GLYPH_CACHE
+
+/*
+ * @brief Tells whether the glyphs can be drawn by the GPU (see VGLITE_OPTION_TOGGLE_GPU).
+ */
+static inline bool _is_glyph_cache_enabled(void) {
+#ifdef VGLITE_OPTION_TOGGLE_GPU
+	return UI_VGLITE_is_hardware_rendering_enabled();
+#else
+	return true;
+#endif // VGLITE_OPTION_TOGGLE_GPU
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DRAWING_VGLITE_drawScaledStringBilinear(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
+                                                          MICROUI_Font *font, jint x, jint y, jfloat xRatio,
+                                                          jfloat yRatio) {
+	DRAWING_Status status;
+
+	if (!_is_glyph_cache_enabled()
+	    || !UI_VGLITE_GLYPH_CACHE_draw_scaled_string(gc, chars, length, font, x, y, xRatio, yRatio, &status)) {
+		UI_VGLITE_flush_batch();
+		status = UI_FONT_DRAWING_drawScaledStringBilinear(gc, chars, length, font, x, y, xRatio, yRatio);
+	}
+
+	return status;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DRAWING_VGLITE_drawCharWithRotationBilinear(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font,
+                                                              jint x, jint y, jint xRotation, jint yRotation,
+                                                              jfloat angle, jint alpha) {
+	DRAWING_Status status;
+
+	if (!_is_glyph_cache_enabled()
+	    || !UI_VGLITE_GLYPH_CACHE_draw_rotated_char(gc, c, font, x, y, xRotation, yRotation, angle, alpha, true,
+	                                                &status)) {
+		UI_VGLITE_flush_batch();
+		status = UI_FONT_DRAWING_drawCharWithRotationBilinear(gc, c, font, x, y, xRotation, yRotation, angle, alpha);
+	}
+
+	return status;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_DRAWING_VGLITE_drawCharWithRotationNearestNeighbor(MICROUI_GraphicsContext *gc, jchar c,
+                                                                     MICROUI_Font *font, jint x, jint y,
+                                                                     jint xRotation, jint yRotation, jfloat angle,
+                                                                     jint alpha) {
+	DRAWING_Status status;
+
+	if (!_is_glyph_cache_enabled()
+	    || !UI_VGLITE_GLYPH_CACHE_draw_rotated_char(gc, c, font, x, y, xRotation, yRotation, angle, alpha, false,
+	                                                &status)) {
+		UI_VGLITE_flush_batch();
+		status = UI_FONT_DRAWING_drawCharWithRotationNearestNeighbor(gc, c, font, x, y, xRotation, yRotation, angle,
+		                                                             alpha);
+	}
+
+	return status;
+}
+
+#endif // VGLITE_GLYPH_CACHE
+
 // --------------------------------------------------------------------------------
 // EOF
 // --------------------------------------------------------------------------------
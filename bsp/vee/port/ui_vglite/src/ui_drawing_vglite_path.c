@@ -1,7 +1,7 @@
 /*
  * C
  *
- * Copyright 2019-2024 MicroEJ Corp. All rights reserved.
+ * Copyright 2019-2025 MicroEJ Corp. All rights reserved.
  * Use of this source code is governed by a BSD-style license that can be found with this software.
  */
 
@@ -48,7 +48,26 @@
  */
 
 #define CIRCLE_RADIUS       200     // radius
-#define CIRCLE_CP           111     // control point
+#define CIRCLE_CP           111     // control point (4 sections)
+#define CIRCLE_CP_180       267     // control point (2 sections)
+#define CIRCLE_CP_120_X     33      // control points (3 sections)
+#define CIRCLE_CP_120_Y     250
+#define CIRCLE_P_120_X      100     // points (3 sections)
+#define CIRCLE_P_120_Y      173
+#define CIRCLE_CP_120_1     154
+#define CIRCLE_CP_120_2     233
+#define CIRCLE_CP_120_3     96
+
+/*
+ * Maximum distance (in pixels) between an ellipse arc and its approximation with cubic curves. The
+ * number of cubic curves depends on the radius: the smaller the radius, the larger the angle of a cubic curve.
+ */
+#define ARC_TOLERANCE       0.125f
+
+/*
+ * Index of the quarter section in __arc_sections
+ */
+#define ARC_SECTION_QUARTER 2u
 
 #define VGLITE_END_CMD     0
 #define VGLITE_MOVE_CMD    2
@@ -75,6 +94,14 @@ typedef struct {
 	int y;
 } __quarter_curve_data_t;
 
+/*
+ * @brief data to approximate an ellipse arc section with a cubic curve
+ */
+typedef struct {
+	float32_t angle;        // angle of the section in radians
+	float32_t error;        // maximum radial error of the approximation for a radius of 1
+} __arc_section_t;
+
 /*
  * @brief drawing context
  */
@@ -121,6 +148,55 @@ static const int16_t __circle_s16[] = {
 	VGLITE_END_CMD,     // end
 };
 
+/*
+ * Circle path with three sections of 120 degrees (small circles, see __arc_sections)
+ */
+static const int16_t __circle_120_s16[] = {
+	VGLITE_MOVE_CMD,     // move to (r, 0)
+	CIRCLE_RADIUS, 0,
+
+	VGLITE_CUBIC_CMD,     // cubic to (r * cos(120), -r * sin(120))
+	CIRCLE_RADIUS, -CIRCLE_CP_120_1, CIRCLE_CP_120_X, -CIRCLE_CP_120_Y, -CIRCLE_P_120_X, -CIRCLE_P_120_Y,
+
+	VGLITE_CUBIC_CMD,     // cubic to (r * cos(240), -r * sin(240))
+	-CIRCLE_CP_120_2, -CIRCLE_CP_120_3, -CIRCLE_CP_120_2, CIRCLE_CP_120_3, -CIRCLE_P_120_X, CIRCLE_P_120_Y,
+
+	VGLITE_CUBIC_CMD,     // cubic to (r, 0)
+	CIRCLE_CP_120_X, CIRCLE_CP_120_Y, CIRCLE_RADIUS, CIRCLE_CP_120_1, CIRCLE_RADIUS, 0,
+
+	VGLITE_END_CMD,     // end
+};
+
+/*
+ * Circle path with two sections of 180 degrees (tiny circles, see __arc_sections)
+ */
+static const int16_t __circle_180_s16[] = {
+	VGLITE_MOVE_CMD,     // move to (r, 0)
+	CIRCLE_RADIUS, 0,
+
+	VGLITE_CUBIC_CMD,     // cubic to (r, -4/3 * r, -r, -4/3 * r, -r, 0)
+	CIRCLE_RADIUS, -CIRCLE_CP_180, -CIRCLE_RADIUS, -CIRCLE_CP_180, -CIRCLE_RADIUS, 0,
+
+	VGLITE_CUBIC_CMD,     // cubic to (-r, 4/3 * r, r, 4/3 * r, r, 0)
+	-CIRCLE_RADIUS, CIRCLE_CP_180, CIRCLE_RADIUS, CIRCLE_CP_180, CIRCLE_RADIUS, 0,
+
+	VGLITE_END_CMD,     // end
+};
+
+/*
+ * @brief Sections to approximate an ellipse arc with cubic curves (the control points are at
+ * 4/3 * tan(angle / 4) * radius), from the largest angle to the smallest one. The maximum radial
+ * error of a section grows with the radius: the first section whose error respects ARC_TOLERANCE
+ * is used.
+ */
+static const __arc_section_t __arc_sections[] = {
+	{ PI, 1.835e-2f, },             // 180 degrees
+	{ 2.f * PI / 3.f, 1.542e-3f, }, // 120 degrees
+	{ PI / 2.f, 2.725e-4f, },       // 90 degrees (ARC_SECTION_QUARTER)
+	{ 2.f * PI / 5.f, 7.131e-5f, }, // 72 degrees
+	{ PI / 3.f, 2.386e-5f, },       // 60 degrees
+};
+
 /*
  * @brief data to draw all the quarter curves
  */
@@ -167,6 +243,41 @@ static inline void __compute_control_point(
 	*y = __ctxt.control_y;
 }
 
+/*
+ * @brief Gets the section to use to approximate an ellipse arc according to its radius on the
+ * display (the radii are multiplied by DRAWING_SCALE_FACTOR).
+ *
+ * @param[in]: radius_w: the horizontal radius of the ellipse
+ * @param[in]: radius_h: the vertical radius of the ellipse
+ *
+ * @return: the index of the section in __arc_sections
+ */
+static uint32_t __get_arc_section(int radius_w, int radius_h) {
+	int abs_radius_w = MEJ_ABS(radius_w);
+	int abs_radius_h = MEJ_ABS(radius_h);
+	float32_t radius = (float32_t)MEJ_MAX(abs_radius_w, abs_radius_h) / DRAWING_SCALE_FACTOR;
+	uint32_t last = (sizeof(__arc_sections) / sizeof(__arc_sections[0])) - 1u;
+	uint32_t index = 0;
+
+	while ((index < last) && ((radius * __arc_sections[index].error) > ARC_TOLERANCE)) {
+		index++;
+	}
+	return index;
+}
+
+/*
+ * @brief Gets the number of sections to approximate an ellipse arc.
+ *
+ * @param[in]: arc_angle: the absolute angle of the arc in radians
+ * @param[in]: section: the index of the section in __arc_sections
+ *
+ * @return: the number of sections (0 when the arc is empty)
+ */
+static inline int __get_number_of_sections(float32_t arc_angle, uint32_t section) {
+	// the small margin prevents an extra section when the arc angle is a multiple of the section angle
+	return (int)ceil((arc_angle / __arc_sections[section].angle) - 0.001f);
+}
+
 /*
  * @brief Initializes the drawing context
  *
@@ -208,6 +319,14 @@ static int __line_to(int16_t x, int16_t y);
  */
 static int __cubic_to(int16_t cx1, int16_t cy1, int16_t cx2, int16_t cy2, int16_t x, int16_t y);
 
+/*
+ * @brief Moves the end point of the last "cubic_to" VGLite command
+ *
+ * @param[in] x: new x coordinate of the destination
+ * @param[in] y: new y coordinate of the destination
+ */
+static void __close_curve(int16_t x, int16_t y);
+
 /*
  * @brief Computes an "end" VGLite command
  *
@@ -566,8 +685,8 @@ int UI_DRAWING_VGLITE_PATH_compute_ellipse_arc(
 
 	// Move to start
 	__set_center(0, 0);
-	__ctxt.x = (int)(radius_out_w * arm_sin_f32(start_angle));
-	__ctxt.y = (int)(-radius_out_h * arm_cos_f32(start_angle));
+	__ctxt.x = (int)roundf(radius_out_w * arm_sin_f32(start_angle));
+	__ctxt.y = (int)roundf(-radius_out_h * arm_cos_f32(start_angle));
 
 	(void)__move_to(__ctxt.x, __ctxt.y);
 
@@ -577,7 +696,8 @@ int UI_DRAWING_VGLITE_PATH_compute_ellipse_arc(
 	if (fill == false) {
 		// Line to inner ellipse start
 		(void)__line_to(
-			(int)(__ctxt.center_x + (__ctxt.sin * radius_in_w)), (int)(__ctxt.center_y - (__ctxt.cos * radius_in_h)));
+			(int)roundf(__ctxt.center_x + (__ctxt.sin * radius_in_w)),
+			(int)roundf(__ctxt.center_y - (__ctxt.cos * radius_in_h)));
 
 		// Draw inner ellipse
 		(void)__approximate_ellipse_arc_to(radius_in_w, radius_in_h, end_angle, start_angle);
@@ -605,7 +725,15 @@ int UI_DRAWING_VGLITE_PATH_compute_ellipse(
 	// Move to top
 	(void)__move_to(0, -radius_h);
 
-	(void)__multiple_quarter_curve_to(radius_w, radius_h, 0, 4);
+	if (ARC_SECTION_QUARTER == __get_arc_section(radius_w, radius_h)) {
+		(void)__multiple_quarter_curve_to(radius_w, radius_h, 0, 4);
+	} else {
+		__set_center(0, 0);
+		(void)__approximate_ellipse_arc_to(radius_w, radius_h, 0.f, 2.f * PI);
+
+		// the last curve must end on the first point (the rounding of the end point may differ)
+		__close_curve(0, -radius_h);
+	}
 
 	return __update_path(ellipse_shape, first_path, end_path, -radius_w, -radius_h, radius_w, radius_h);
 }
@@ -616,15 +744,27 @@ int UI_DRAWING_VGLITE_PATH_compute_filled_ellipse(
 	int radius_w,
 	int radius_h,
 	vg_lite_matrix_t *matrix) {
-	// cppcheck-suppress [misra-c2012-11.8] cast to (void *) is valid
-	point_shape->path = (void *)__circle_s16;
+	// the smaller the circle, the less sections (see __arc_sections)
+	uint32_t section = __get_arc_section(radius_w, radius_h);
+	if (0u == section) {
+		// cppcheck-suppress [misra-c2012-11.8] cast to (void *) is valid
+		point_shape->path = (void *)__circle_180_s16;
+		point_shape->path_length = sizeof(__circle_180_s16);
+	} else if (1u == section) {
+		// cppcheck-suppress [misra-c2012-11.8] cast to (void *) is valid
+		point_shape->path = (void *)__circle_120_s16;
+		point_shape->path_length = sizeof(__circle_120_s16);
+	} else {
+		// cppcheck-suppress [misra-c2012-11.8] cast to (void *) is valid
+		point_shape->path = (void *)__circle_s16;
+		point_shape->path_length = sizeof(__circle_s16);
+	}
+
 	vg_lite_float_t scale_w = (float32_t)radius_w / CIRCLE_RADIUS;
 	vg_lite_float_t scale_h = (float32_t)radius_h / CIRCLE_RADIUS;
 
 	vg_lite_scale(scale_w, scale_h, matrix);
 
-	point_shape->path_length = sizeof(__circle_s16);
-
 	return __update_path(point_shape, true, false, -CIRCLE_RADIUS, -CIRCLE_RADIUS, +CIRCLE_RADIUS, +CIRCLE_RADIUS);
 }
 
@@ -912,10 +1052,9 @@ static int __approximate_ellipse_arc(
 	float32_t arc_angle_rad,
 	int caps) {
 	// Number of sections per curve.
-	// CircleArc approximation from Bezier curves is acceptable if the arc angle is less than 90 degrees.
-	// If the caller require and arc angle bigger than 90 degrees,
-	// the curve should be splited in sections of less than 90 degrees.
-	int nb_sections = (int)ceil(arc_angle_rad / (PI / 2));
+	// The maximum angle of a section depends on the radius (see __arc_sections): the arcs with a small
+	// radius need less sections.
+	int nb_sections = __get_number_of_sections(arc_angle_rad, __get_arc_section(radius_out_w, radius_out_h));
 
 	// angle of one section
 	float32_t section_angle = arc_angle_rad / nb_sections;
@@ -928,20 +1067,20 @@ static int __approximate_ellipse_arc(
 	float32_t tangent = 4 * mej_tan_f32(section_angle / 4) / 3;
 
 	// Compute outside start point
-	int16_t out_start_x = (int16_t)(+radius_out_w * cos_start_angle);
-	int16_t out_start_y = (int16_t)(-radius_out_h * sin_start_angle);
+	int16_t out_start_x = (int16_t)roundf(+radius_out_w * cos_start_angle);
+	int16_t out_start_y = (int16_t)roundf(-radius_out_h * sin_start_angle);
 
 	// Compute inside start point
-	int16_t in_start_x = (int16_t)(+radius_in_w * cos_start_angle);
-	int16_t in_start_y = (int16_t)(-radius_in_h * sin_start_angle);
+	int16_t in_start_x = (int16_t)roundf(+radius_in_w * cos_start_angle);
+	int16_t in_start_y = (int16_t)roundf(-radius_in_h * sin_start_angle);
 
 	// Compute outside end point
-	int16_t out_end_x = (int16_t)(+radius_out_w * cos_end_angle);
-	int16_t out_end_y = (int16_t)(-radius_out_h * sin_end_angle);
+	int16_t out_end_x = (int16_t)roundf(+radius_out_w * cos_end_angle);
+	int16_t out_end_y = (int16_t)roundf(-radius_out_h * sin_end_angle);
 
 	// Compute inside end point
-	int16_t in_end_x = (int16_t)(+radius_in_w * cos_end_angle);
-	int16_t in_end_y = (int16_t)(-radius_in_h * sin_end_angle);
+	int16_t in_end_x = (int16_t)roundf(+radius_in_w * cos_end_angle);
+	int16_t in_end_y = (int16_t)roundf(-radius_in_h * sin_end_angle);
 
 	// Move to beginning
 	(void)__move_to(out_start_x, out_start_y);
@@ -1035,31 +1174,17 @@ static int __approximate_ellipse_arc_to(
 	int radius_h,
 	float32_t start_angle,
 	float32_t end_angle) {
-	float32_t start_angle_temp;
-	float32_t end_angle_temp;
-	float32_t arc_angle;
-	float32_t arc_angle_temp;
-	float32_t arc_angle_abs;
-
-	arc_angle = end_angle - start_angle;
-
-	start_angle_temp = start_angle;
+	float32_t arc_angle = end_angle - start_angle;
+	float32_t arc_angle_abs = MEJ_ABS(arc_angle);
 
-	arc_angle_abs = MEJ_ABS(arc_angle);
-
-	while (arc_angle_abs > 0) {
-		arc_angle_temp = end_angle - start_angle_temp;
-		arc_angle_temp = MEJ_BOUNDS(arc_angle_temp, -(PI / 2), +(PI / 2));
-		end_angle_temp = start_angle_temp + arc_angle_temp;
+	// the arc is split in sections of same angle (see __arc_sections)
+	int nb_sections = __get_number_of_sections(arc_angle_abs, __get_arc_section(radius_w, radius_h));
 
+	for (int i = 0; i < nb_sections; i++) {
 		(void)__approximate_ellipse_arc_fragment_to(
 			radius_w, radius_h,
-			start_angle_temp,
-			end_angle_temp);
-
-		start_angle_temp += arc_angle_temp;
-
-		arc_angle_abs -= PI / 2;
+			start_angle + ((arc_angle * i) / nb_sections),
+			start_angle + ((arc_angle * (i + 1)) / nb_sections));
 	}
 
 	return __ctxt.offset;
@@ -1076,6 +1201,12 @@ static int __approximate_ellipse_arc_fragment_to(
 	float32_t temp_x;
 	float32_t temp_y;
 
+	// Exact start and end point coordinates
+	float32_t start_x;
+	float32_t start_y;
+	float32_t exact_end_x;
+	float32_t exact_end_y;
+
 	// End point coordinates
 	int end_x;
 	int end_y;
@@ -1096,23 +1227,28 @@ static int __approximate_ellipse_arc_fragment_to(
 		start_angle,
 		section_angle);
 
-	c1_x = __ctxt.x + (int)(temp_x * radius_w);
-	c1_y = __ctxt.y + (int)(temp_y * radius_h);
+	// the control points are computed from the exact points (and not from the rounded ones): only one rounding
+	start_x = __ctxt.center_x + (radius_w * arm_sin_f32(start_angle));
+	start_y = __ctxt.center_y + (radius_h * -arm_cos_f32(start_angle));
+	c1_x = (int)roundf(start_x + (temp_x * radius_w));
+	c1_y = (int)roundf(start_y + (temp_y * radius_h));
 
 	// Compute end point
 	__ctxt.sin = arm_sin_f32(end_angle);
 	__ctxt.cos = arm_cos_f32(end_angle);
 
-	end_x = (int)(__ctxt.center_x + (radius_w * __ctxt.sin));
-	end_y = (int)(__ctxt.center_y + (radius_h * -__ctxt.cos));
+	exact_end_x = __ctxt.center_x + (radius_w * __ctxt.sin);
+	exact_end_y = __ctxt.center_y + (radius_h * -__ctxt.cos);
+	end_x = (int)roundf(exact_end_x);
+	end_y = (int)roundf(exact_end_y);
 
 	__compute_control_point(
 		&temp_x, &temp_y,
 		end_angle,
 		-section_angle);
 
-	c2_x = end_x + (int)(temp_x * radius_w);
-	c2_y = end_y + (int)(temp_y * radius_h);
+	c2_x = (int)roundf(exact_end_x + (temp_x * radius_w));
+	c2_y = (int)roundf(exact_end_y + (temp_y * radius_h));
 
 	return __cubic_to(c1_x, c1_y, c2_x, c2_y, end_x, end_y);
 }
@@ -1129,27 +1265,30 @@ static int __approximate_ellipse_arc_fragment(
 	float32_t ty;
 
 	// Compute start point A1 & A2
-	int16_t Ax = (int16_t)(radius_w * arm_cos_f32(start_angle_rad));
-	int16_t Ay = (int16_t)(radius_h * -arm_sin_f32(start_angle_rad));  // minus because y axis is inverted (0,0 is top
-	                                                                   // left)
+	float32_t ax = radius_w * arm_cos_f32(start_angle_rad);
+	float32_t ay = radius_h * -arm_sin_f32(start_angle_rad);  // minus because y axis is inverted (0,0 is top left)
+	int16_t Ax = (int16_t)roundf(ax);
+	int16_t Ay = (int16_t)roundf(ay);
 
 	// Compute end point B1 & B2
-	int16_t Bx = (int16_t)(radius_w * arm_cos_f32(end_angle_rad));
-	int16_t By = (int16_t)(radius_h * -arm_sin_f32(end_angle_rad));
+	float32_t bx = radius_w * arm_cos_f32(end_angle_rad);
+	float32_t by = radius_h * -arm_sin_f32(end_angle_rad);
+	int16_t Bx = (int16_t)roundf(bx);
+	int16_t By = (int16_t)roundf(by);
 
-	// Compute control point C
+	// Compute control point C (from the exact start point: only one rounding)
 	tx = tangent * arm_cos_f32(start_angle_rad + (PI / 2));
 	ty = tangent * -arm_sin_f32(start_angle_rad + (PI / 2));
 
-	int16_t Cx = (int16_t)(Ax + (radius_w * tx));
-	int16_t Cy = (int16_t)(Ay + (radius_h * ty));
+	int16_t Cx = (int16_t)roundf(ax + (radius_w * tx));
+	int16_t Cy = (int16_t)roundf(ay + (radius_h * ty));
 
-	// Compute control point D
+	// Compute control point D (from the exact end point)
 	tx = tangent * arm_cos_f32(end_angle_rad - (PI / 2));
 	ty = tangent * -arm_sin_f32(end_angle_rad - (PI / 2));
 
-	int16_t Dx = (int16_t)(Bx + (radius_w * tx));
-	int16_t Dy = (int16_t)(By + (radius_h * ty));
+	int16_t Dx = (int16_t)roundf(bx + (radius_w * tx));
+	int16_t Dy = (int16_t)roundf(by + (radius_h * ty));
 
 	Ax += (int16_t)center_x;
 	Ay += (int16_t)center_y;
@@ -1192,6 +1331,19 @@ static int __cubic_to(
 	return __ctxt.offset;
 }
 
+// See the section 'Internal function definitions' for the function documentation
+static void __close_curve(int16_t x, int16_t y) {
+	int offset = __ctxt.offset - (int)MEJ_VGLITE_PATH_CUBIC_TO_LENGTH(s16_t);
+	// cppcheck-suppress [misra-c2012-11.3] cast to (path_cubic_to_s16_t *) is valid
+	path_cubic_to_s16_t *cubic_to = (path_cubic_to_s16_t *)&__ctxt.path[offset];
+
+	cubic_to->x = x;
+	cubic_to->y = y;
+
+	__ctxt.x = x;
+	__ctxt.y = y;
+}
+
 // See the section 'Internal function definitions' for the function documentation
 static int __end(void) {
 	// cppcheck-suppress [misra-c2012-11.3] cast to (path_end_s16_t *) is valid
@@ -0,0 +1,440 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Image manager of the compressed images (see UI_IMAGE_FORMAT_COMPRESSED):
+ * implementation of the ui_image_drawing.c's custom functions over VGLite.
+ *
+ * An image drawn several times is decoded once in the GPU memory (see
+ * ui_vglite_format_cache.h) and then drawn like the standard images. The first
+ * drawing of an image (and all the drawings when the image cannot be held by the
+ * cache) decodes the rows band after band in a buffer allocated in the GPU memory:
+ * each band is drawn as soon as it is decoded (see VGLITE_COMPRESSED_IMAGE_STREAM_BUFFER).
+ * The transformations (flip, rotation, scaling) require the whole decoded image: they
+ * follow the same policy and are drawn by the stub implementation until the image is
+ * decoded in the cache.
+ *
+ * When the GPU cannot draw in the destination (GPU disabled, destination not in the
+ * display's format), the CPU draws the bands in a RGB565 destination (see
+ * ui_pixel_kernels.h); the stub implementation is called otherwise.
+ *
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_image_drawing.h"
+#include "ui_drawing_stub.h"
+#include "ui_drawing_vglite_process.h"
+#include "ui_image_compressed.h"
+#include "ui_pixel_kernels.h"
+#include "ui_vglite_format_cache.h"
+#include "ui_vglite_state.h"
+#include "ui_configuration.h"
+
+#if defined(UI_FEATURE_IMAGE_CUSTOM_FORMATS) && defined(UI_IMAGE_FORMAT_COMPRESSED)
+
+// --------------------------------------------------------------------------------
+// Defines
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Redirects the ui_image_drawing.c's custom functions of the compressed
+ * format to this file.
+ */
+#define UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX GET_CUSTOM_IMAGE_FUNCTIONS_SUFFIX(UI_IMAGE_FORMAT_COMPRESSED)
+#define UI_IMAGE_DRAWING_COMPRESSED_draw CONCAT(UI_IMAGE_DRAWING_draw_custom, \
+												UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+#define UI_IMAGE_DRAWING_COMPRESSED_drawFlipped CONCAT(UI_IMAGE_DRAWING_drawFlipped_custom, \
+													   UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+#define UI_IMAGE_DRAWING_COMPRESSED_drawRotatedNearestNeighbor CONCAT( \
+			UI_IMAGE_DRAWING_drawRotatedNearestNeighbor_custom, UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+#define UI_IMAGE_DRAWING_COMPRESSED_drawRotatedBilinear CONCAT(UI_IMAGE_DRAWING_drawRotatedBilinear_custom, \
+															   UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+#define UI_IMAGE_DRAWING_COMPRESSED_drawScaledNearestNeighbor CONCAT( \
+			UI_IMAGE_DRAWING_drawScaledNearestNeighbor_custom, UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+#define UI_IMAGE_DRAWING_COMPRESSED_drawScaledBilinear CONCAT(UI_IMAGE_DRAWING_drawScaledBilinear_custom, \
+															  UI_IMAGE_DRAWING_COMPRESSED_FUNCTIONS_SUFFIX)
+
+#ifdef VGLITE_FORMAT_CACHE
+/*
+ * @brief Number of images drawn once that are remembered to decide whether an image
+ * has to be decoded in the cache or not.
+ */
+#define COMPRESSED_IMAGE_CANDIDATES (2 * VGLITE_FORMAT_CACHE_ENTRIES)
+#endif
+
+// --------------------------------------------------------------------------------
+// Private global variables
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief The buffer where the bands are decoded (allocated at the first use).
+ */
+static vg_lite_buffer_t stream_buffer;
+
+#ifdef VGLITE_FORMAT_CACHE
+/*
+ * @brief Addresses of the last images drawn on the fly (ring buffer).
+ */
+static const uint8_t *cache_candidates[COMPRESSED_IMAGE_CANDIDATES];
+static uint32_t cache_candidates_index;
+#endif
+
+// --------------------------------------------------------------------------------
+// Private functions
+// --------------------------------------------------------------------------------
+
+static DRAWING_Status _blit_rect(MICROUI_GraphicsContext *gc, vg_lite_buffer_t *source, uint32_t *rect,
+                                 vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color,
+                                 vg_lite_filter_t filter) {
+	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+	vg_lite_error_t err = vg_lite_blit_rect(target, source, rect, matrix, blend, color, filter);
+	return UI_VGLITE_post_operation(gc, err);
+}
+
+/*
+ * @brief Tells whether the GPU can draw in the Graphics Context.
+ */
+static inline bool _is_gpu_destination(const MICROUI_GraphicsContext *gc) {
+	return UI_VGLITE_is_hardware_rendering_enabled() && LLUI_DISPLAY_isDisplayFormat(gc->image.format);
+}
+
+/*
+ * @brief Checks whether the image has already been drawn recently. If not, the image
+ * is remembered as a candidate for the next drawing.
+ */
+static bool _is_candidate(MICROUI_Image *img) {
+	bool ret = false;
+#ifdef VGLITE_FORMAT_CACHE
+	const uint8_t *source = LLUI_DISPLAY_getBufferAddress(img);
+	for (uint32_t i = 0; i < (uint32_t)COMPRESSED_IMAGE_CANDIDATES; i++) {
+		if (source == cache_candidates[i]) {
+			cache_candidates[i] = NULL;
+			ret = true;
+			break;
+		}
+	}
+
+	if (!ret) {
+		cache_candidates[cache_candidates_index] = source;
+		cache_candidates_index = (cache_candidates_index + 1u) % (uint32_t)COMPRESSED_IMAGE_CANDIDATES;
+	}
+#else
+	(void)img;
+#endif
+	return ret;
+}
+
+/*
+ * @brief Gets the decoded image from the cache. An image not in the cache yet is
+ * decoded in the cache only when it has already been drawn recently (see
+ * _is_candidate()): an image drawn only once is better decoded on the fly.
+ *
+ * @return true when the image is decoded in the cache.
+ */
+static bool _is_image_cached(MICROUI_Image *img) {
+	return UI_VGLITE_FORMAT_CACHE_is_image_loaded(img)
+	       || (_is_candidate(img) && UI_VGLITE_FORMAT_CACHE_load_image(img));
+}
+
+/*
+ * @brief Configures the stream buffer to hold some full rows of the image.
+ *
+ * @return the number of rows the buffer can hold (0 when the buffer cannot be
+ * allocated or when a row is too large).
+ */
+static uint32_t _configure_stream_buffer(const UI_IMAGE_COMPRESSED_header_t *header) {
+	if (NULL == stream_buffer.memory) {
+		// allocates VGLITE_COMPRESSED_IMAGE_STREAM_BUFFER bytes: the buffer is reconfigured for each image
+		(void)memset(&stream_buffer, 0, sizeof(vg_lite_buffer_t));
+		stream_buffer.width = 16;
+		stream_buffer.height = (int32_t)(VGLITE_COMPRESSED_IMAGE_STREAM_BUFFER) / (16 * 4);
+		stream_buffer.format = VG_LITE_RGBA8888;
+		if (VG_LITE_SUCCESS != vg_lite_allocate(&stream_buffer)) {
+			stream_buffer.memory = NULL;
+		}
+	}
+
+	uint32_t rows = 0;
+	if (NULL != stream_buffer.memory) {
+		// VGLite alignment: stride aligned on 16 pixels
+		uint32_t bpp = UI_IMAGE_COMPRESSED_get_bytes_per_pixel(header);
+		uint32_t stride = (((uint32_t)header->width + 15u) & ~(uint32_t)15u) * bpp;
+		rows = (uint32_t)(VGLITE_COMPRESSED_IMAGE_STREAM_BUFFER) / stride;
+
+		stream_buffer.width = (int32_t)header->width;
+		stream_buffer.stride = (int32_t)stride;
+		stream_buffer.format = (2u == bpp) ? VG_LITE_RGB565 : VG_LITE_RGBA8888;
+		stream_buffer.tiled = VG_LITE_LINEAR;
+		stream_buffer.image_mode = VG_LITE_MULTIPLY_IMAGE_MODE;
+		stream_buffer.transparency_mode = (2u == bpp) ? VG_LITE_IMAGE_OPAQUE : VG_LITE_IMAGE_TRANSPARENT;
+	}
+	return rows;
+}
+
+/*
+ * @brief Tells whether the CPU can draw in the Graphics Context.
+ */
+static inline bool _is_software_destination(MICROUI_GraphicsContext *gc) {
+	return (MICROUI_IMAGE_FORMAT_RGB565 == (MICROUI_ImageFormat)gc->image.format)
+	       || (LLUI_DISPLAY_isLCD(&gc->image) && (16u == LLUI_DISPLAY_getImageBPP(&gc->image)));
+}
+
+/*
+ * @brief Draws a region of the image in a RGB565 destination with the CPU: decodes the
+ * rows band after band in the stream buffer and blends each row.
+ */
+static DRAWING_Status _draw_software(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX, jint regionY,
+                                     jint width, jint height, jint x, jint y, jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	const UI_IMAGE_COMPRESSED_header_t *header = (const UI_IMAGE_COMPRESSED_header_t *)LLUI_DISPLAY_getBufferAddress(
+		img);
+
+	// the stream buffer may be used by a batched drawing and the destination may be drawn by the GPU
+	UI_VGLITE_flush_batch();
+
+	uint32_t band_rows = UI_IMAGE_COMPRESSED_check_header(header, (uint32_t)img->width, (uint32_t)img->height) ?
+	                     _configure_stream_buffer(header) : 0u;
+
+	if (0u == band_rows) {
+		// invalid image or GPU memory full
+		ret = UI_DRAWING_STUB_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
+	} else if (!LLUI_DISPLAY_isClipEnabled(gc)
+	           || LLUI_DISPLAY_clipRegion(gc, &regionX, &regionY, &width, &height, &x, &y)) {
+		uint32_t bpp = UI_IMAGE_COMPRESSED_get_bytes_per_pixel(header);
+		uint32_t dest_stride = LLUI_DISPLAY_getStrideInBytes(&gc->image);
+		uint8_t *dest = &LLUI_DISPLAY_getBufferAddress(&gc->image)[((uint32_t)y * dest_stride) + ((uint32_t)x * 2u)];
+		uint32_t row = (uint32_t)regionY;
+		uint32_t remaining_rows = (uint32_t)height;
+
+		while (remaining_rows > 0u) {
+			uint32_t rows = (remaining_rows < band_rows) ? remaining_rows : band_rows;
+
+			if (UI_IMAGE_COMPRESSED_decode_rows(header, row, rows, (uint8_t *)stream_buffer.memory,
+			                                    (uint32_t)stream_buffer.stride)) {
+				for (uint32_t i = 0; i < rows; i++) {
+					const uint8_t *src = &((uint8_t *)stream_buffer.memory)[(i * (uint32_t)stream_buffer.stride)
+					                                                          + ((uint32_t)regionX * bpp)];
+					if (2u == bpp) {
+						UI_PIXEL_KERNELS_blend_rgb565_on_rgb565((uint16_t *)dest, (const uint16_t *)src,
+						                                        (uint32_t)alpha, (uint32_t)width);
+					} else {
+						UI_PIXEL_KERNELS_blend_argb8888_pre_on_rgb565((uint16_t *)dest, (const uint32_t *)src,
+						                                              (uint32_t)alpha, (uint32_t)width);
+					}
+					dest += dest_stride;
+				}
+
+				row += rows;
+				remaining_rows -= rows;
+			} else {
+				UI_VGLITE_IMPL_error(false, "cannot decode a compressed image: corrupted data");
+				remaining_rows = 0;
+			}
+		}
+	} else {
+		// nothing to draw
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Draws a region of the image: decodes the rows band after band in the stream
+ * buffer and draws each band.
+ */
+static DRAWING_Status _stream_image(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX, jint regionY,
+                                    jint width, jint height, jint x, jint y, jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	const UI_IMAGE_COMPRESSED_header_t *header = (const UI_IMAGE_COMPRESSED_header_t *)LLUI_DISPLAY_getBufferAddress(
+		img);
+
+	// the stream buffer may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+
+	uint32_t band_rows = UI_IMAGE_COMPRESSED_check_header(header, (uint32_t)img->width, (uint32_t)img->height) ?
+	                     _configure_stream_buffer(header) : 0u;
+
+	if (0u == band_rows) {
+		// invalid image or GPU memory full
+		ret = UI_DRAWING_STUB_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
+	} else if (UI_VGLITE_enable_vg_lite_scissor_region(gc, x, y, x + width - 1, y + height - 1)) {
+		vg_lite_color_t color = UI_VGLITE_get_vglite_color(gc, img, alpha);
+
+		// the decoded pixels are already pre-multiplied (the premultiplication is restored by
+		// UI_VGLITE_post_operation())
+		if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != UI_VGLITE_STATE_disable_premultiply())) {
+			UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot disable the pre multiplication");
+		}
+
+		vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+		uint32_t row = (uint32_t)regionY;
+		uint32_t remaining_rows = (uint32_t)height;
+
+		while (remaining_rows > 0u) {
+			uint32_t rows = (remaining_rows < band_rows) ? remaining_rows : band_rows;
+			vg_lite_error_t err;
+
+			if (UI_IMAGE_COMPRESSED_decode_rows(header, row, rows, (uint8_t *)stream_buffer.memory,
+			                                    (uint32_t)stream_buffer.stride)) {
+				stream_buffer.height = (int32_t)rows;
+
+				vg_lite_matrix_t matrix;
+				vg_lite_identity(&matrix);
+				matrix.m[0][2] = x;
+				matrix.m[1][2] = y + (jint)(row - (uint32_t)regionY);
+
+				uint32_t blit_rect[4] = { (uint32_t)regionX, 0, (uint32_t)width, rows };
+				err = vg_lite_blit_rect(target, &stream_buffer, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER, color,
+				                        VG_LITE_FILTER_POINT);
+			} else {
+				UI_VGLITE_IMPL_error(false, "cannot decode a compressed image: corrupted data");
+				err = VG_LITE_INVALID_ARGUMENT;
+			}
+
+			row += rows;
+			remaining_rows -= rows;
+
+			if ((VG_LITE_SUCCESS != err) || (0u == remaining_rows)) {
+				// last band (or error): wakeup the Graphics Engine at the end of the drawing
+				ret = UI_VGLITE_post_operation(gc, err);
+				remaining_rows = 0;
+			} else {
+				// waits the end of the drawing before decoding the next band
+				UI_VGLITE_start_operation(false);
+			}
+		}
+	} else {
+		// nothing to draw
+	}
+
+	return ret;
+}
+
+// --------------------------------------------------------------------------------
+// ui_image_drawing.c's custom functions
+// --------------------------------------------------------------------------------
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_draw(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX,
+                                                jint regionY, jint width, jint height, jint x, jint y, jint alpha) {
+	DRAWING_Status ret;
+
+	if (!_is_gpu_destination(gc)) {
+		ret = _is_software_destination(gc) ? _draw_software(gc, img, regionX, regionY, width, height, x, y, alpha) :
+		      UI_DRAWING_STUB_drawImage(gc, img, regionX, regionY, width, height, x, y, alpha);
+	} else if (_is_image_cached(img)) {
+		// the image has been decoded in the cache
+		vg_lite_color_t color;
+		vg_lite_matrix_t matrix;
+		uint32_t blit_rect[4];
+
+		vg_lite_buffer_t *source_buffer = UI_DRAWING_VGLITE_PROCESS_prepare_draw_image(gc, img, regionX, regionY,
+		                                                                               width, height, x, y, alpha,
+		                                                                               &color, &matrix, blit_rect);
+		ret = (NULL != source_buffer) ?
+		      _blit_rect(gc, source_buffer, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER, color, VG_LITE_FILTER_POINT)
+		      // nothing to draw
+		      : DRAWING_DONE;
+	} else {
+		ret = _stream_image(gc, img, regionX, regionY, width, height, x, y, alpha);
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_drawFlipped(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint regionX,
+                                                       jint regionY, jint width, jint height, jint x, jint y,
+                                                       DRAWING_Flip transformation, jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	bool is_gpu_compatible = false;
+	if (_is_gpu_destination(gc) && _is_image_cached(img)) {
+		ret = UI_DRAWING_VGLITE_PROCESS_drawFlippedImage(&_blit_rect, gc, img, regionX, regionY, width, height, x, y,
+		                                                 transformation, alpha, &is_gpu_compatible);
+	}
+	if (!is_gpu_compatible) {
+		ret = UI_DRAWING_STUB_drawFlippedImage(gc, img, regionX, regionY, width, height, x, y, transformation, alpha);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_drawRotatedNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img,
+                                                                      jint x, jint y, jint rotationX, jint rotationY,
+                                                                      jfloat angle, jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	bool is_gpu_compatible = false;
+	if (_is_gpu_destination(gc) && _is_image_cached(img)) {
+		ret = UI_DRAWING_VGLITE_PROCESS_drawRotatedImageNearestNeighbor(&_blit_rect, gc, img, x, y, rotationX,
+		                                                                rotationY, angle, alpha, &is_gpu_compatible);
+	}
+	if (!is_gpu_compatible) {
+		ret = UI_DRAWING_STUB_drawRotatedImageNearestNeighbor(gc, img, x, y, rotationX, rotationY, angle, alpha);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_drawRotatedBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                               jint y, jint rotationX, jint rotationY, jfloat angle,
+                                                               jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	bool is_gpu_compatible = false;
+	if (_is_gpu_destination(gc) && _is_image_cached(img)) {
+		ret = UI_DRAWING_VGLITE_PROCESS_drawRotatedImageBilinear(&_blit_rect, gc, img, x, y, rotationX, rotationY,
+		                                                         angle, alpha, &is_gpu_compatible);
+	}
+	if (!is_gpu_compatible) {
+		ret = UI_DRAWING_STUB_drawRotatedImageBilinear(gc, img, x, y, rotationX, rotationY, angle, alpha);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_drawScaledNearestNeighbor(MICROUI_GraphicsContext *gc, MICROUI_Image *img,
+                                                                     jint x, jint y, jfloat factorX, jfloat factorY,
+                                                                     jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	bool is_gpu_compatible = false;
+	if (_is_gpu_destination(gc) && _is_image_cached(img)) {
+		ret = UI_DRAWING_VGLITE_PROCESS_drawScaledImageNearestNeighbor(&_blit_rect, gc, img, x, y, factorX, factorY,
+		                                                               alpha, &is_gpu_compatible);
+	}
+	if (!is_gpu_compatible) {
+		ret = UI_DRAWING_STUB_drawScaledImageNearestNeighbor(gc, img, x, y, factorX, factorY, alpha);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+DRAWING_Status UI_IMAGE_DRAWING_COMPRESSED_drawScaledBilinear(MICROUI_GraphicsContext *gc, MICROUI_Image *img, jint x,
+                                                              jint y, jfloat factorX, jfloat factorY, jint alpha) {
+	DRAWING_Status ret = DRAWING_DONE;
+	bool is_gpu_compatible = false;
+	if (_is_gpu_destination(gc) && _is_image_cached(img)) {
+		ret = UI_DRAWING_VGLITE_PROCESS_drawScaledImageBilinear(&_blit_rect, gc, img, x, y, factorX, factorY, alpha,
+		                                                        &is_gpu_compatible);
+	}
+	if (!is_gpu_compatible) {
+		ret = UI_DRAWING_STUB_drawScaledImageBilinear(gc, img, x, y, factorX, factorY, alpha);
+	}
+	return ret;
+}
+
+#endif // UI_FEATURE_IMAGE_CUSTOM_FORMATS && UI_IMAGE_FORMAT_COMPRESSED
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
@@ -19,13 +19,19 @@
 #include <LLUI_DISPLAY_impl.h>
 
 #include "ui_vglite.h"
+#include "ui_vglite_format_cache.h"
+#include "ui_vglite_state.h"
+#include "ui_drawing.h"
+#include "ui_display_list.h"
 #include "ui_color.h"
+#include "framerate.h"
 #include "mej_math.h"
 #include "bsp_util.h"
 #include "interrupts.h"
 
 #include "vg_lite_hal.h"
 #include "vglite_support.h"
+#include "display_configuration.h"
 
 // -----------------------------------------------------------------------------
 // Macros and Defines
@@ -46,6 +52,19 @@
  */
 #define ALIGN(value, align) (((value) + (align) - 1u) & ~((align) - 1u))
 
+/*
+ * @brief VGLite format and number of bits per pixel of the frame buffers (MicroUI format
+ * LCD, see FRAME_BUFFER_BYTE_PER_PIXEL in display_configuration.h). The XRGB8888 frame
+ * buffers are opaque: the GPU ignores the alpha channel when they are used as source.
+ */
+#if (4 == FRAME_BUFFER_BYTE_PER_PIXEL)
+#define DISPLAY_VG_LITE_FORMAT      VG_LITE_RGBX8888
+#define DISPLAY_BPP                 (4 * 8)
+#else
+#define DISPLAY_VG_LITE_FORMAT      VG_LITE_RGB565
+#define DISPLAY_BPP                 (5 + 6 + 5)
+#endif
+
 // -----------------------------------------------------------------------------
 // Typedef
 // -----------------------------------------------------------------------------
@@ -96,6 +115,29 @@ static volatile vglite_irq_post_operation_t vg_lite_irq_operation;
  */
 static void *vg_lite_operation_semaphore;
 
+#ifdef VGLITE_BATCH_OPERATIONS
+/*
+ * @brief true when some GPU operations are in the GPU commands list but have not been
+ * submitted yet
+ */
+static bool batch_pending;
+#endif
+
+#ifdef VGLITE_BATCH_SUBMIT_OPERATIONS
+/*
+ * @brief Number of batched operations since the last submission
+ */
+static uint32_t batch_operations;
+#endif
+
+#if defined(UI_FEATURE_DISPLAY_LIST) && !defined(VGLITE_BATCH_OPERATIONS)
+/*
+ * @brief true when the drawings must be fully performed before returning (see
+ * UI_DISPLAY_LIST_IMPL_set_synchronous_drawings())
+ */
+static bool synchronous_operations;
+#endif
+
 // -----------------------------------------------------------------------------
 // Static Constants
 // -----------------------------------------------------------------------------
@@ -104,10 +146,10 @@ static void *vg_lite_operation_semaphore;
  * @brief LUT to convert MicroUI image format to VGLite image format
  */
 const vg_lite_buffer_format_t __microui_to_vg_lite_format[] = {
-	VG_LITE_RGB565,             // MICROUI_IMAGE_FORMAT_LCD = 0,
+	DISPLAY_VG_LITE_FORMAT,     // MICROUI_IMAGE_FORMAT_LCD = 0,
 	VG_LITE_UNKNOWN_FORMAT,     // UNKNOWN = 1,
 	VG_LITE_RGBA8888,           // MICROUI_IMAGE_FORMAT_ARGB8888 = 2,
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_RGB888 = 3, unsupported
+	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_RGB888 = 3, see ui_vglite_format_cache.h
 	VG_LITE_RGB565,             // MICROUI_IMAGE_FORMAT_RGB565 = 4,
 	VG_LITE_RGBA5551,           // MICROUI_IMAGE_FORMAT_ARGB1555 = 5
 	VG_LITE_RGBA4444,           // MICROUI_IMAGE_FORMAT_ARGB4444 = 6,
@@ -115,11 +157,11 @@ const vg_lite_buffer_format_t __microui_to_vg_lite_format[] = {
 	VG_LITE_A8,                 // MICROUI_IMAGE_FORMAT_A8 = 8,
 	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_LRGB888
 	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_LARGB8888
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_A2
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_A1
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C4
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C2
-	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C1
+	VG_LITE_INDEX_2,            // MICROUI_IMAGE_FORMAT_A2, alpha ramp CLUT
+	VG_LITE_INDEX_1,            // MICROUI_IMAGE_FORMAT_A1, alpha ramp CLUT
+	VG_LITE_INDEX_4,            // MICROUI_IMAGE_FORMAT_C4, grayscale CLUT
+	VG_LITE_INDEX_2,            // MICROUI_IMAGE_FORMAT_C2, grayscale CLUT
+	VG_LITE_INDEX_1,            // MICROUI_IMAGE_FORMAT_C1, grayscale CLUT
 	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC44
 	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC22
 	VG_LITE_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC11
@@ -138,7 +180,7 @@ const vg_lite_buffer_format_t __microui_to_vg_lite_format[] = {
  * @brief Look Up Table to translate MicroUI image to BPP
  */
 static const int __microui_to_bpp[] = {
-	(5 + 6 + 5),                // MICROUI_IMAGE_FORMAT_LCD = 0 = RGB565,
+	DISPLAY_BPP,                // MICROUI_IMAGE_FORMAT_LCD = 0,
 	DISPLAY_UNKNOWN_FORMAT,     // UNKNOWN = 1,
 	(4 * 8),                    // MICROUI_IMAGE_FORMAT_ARGB8888 = 2,
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_RGB888 = 3, unsupported
@@ -149,11 +191,11 @@ static const int __microui_to_bpp[] = {
 	8,                          // MICROUI_IMAGE_FORMAT_A8 = 8,
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_LRGB888
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_LARGB8888
-	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_A2
-	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_A1
-	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C4
-	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C2
-	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_C1
+	2,                          // MICROUI_IMAGE_FORMAT_A2
+	1,                          // MICROUI_IMAGE_FORMAT_A1
+	4,                          // MICROUI_IMAGE_FORMAT_C4
+	2,                          // MICROUI_IMAGE_FORMAT_C2
+	1,                          // MICROUI_IMAGE_FORMAT_C1
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC44
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC22
 	DISPLAY_UNKNOWN_FORMAT,     // MICROUI_IMAGE_FORMAT_AC11
@@ -172,7 +214,7 @@ static const int __microui_to_bpp[] = {
  * @brief Look Up Table to enable the premultiplication according to MicroUI image format
  */
 static const bool __microui_to_premul[] = {
-	false,      // MICROUI_IMAGE_FORMAT_LCD = 0 = RGB565,
+	false,      // MICROUI_IMAGE_FORMAT_LCD = 0 (opaque),
 	false,      // UNKNOWN = 1,
 	true,       // MICROUI_IMAGE_FORMAT_ARGB8888 = 2,
 	false,      // MICROUI_IMAGE_FORMAT_RGB888 = 3, unsupported
@@ -235,40 +277,127 @@ static vg_lite_buffer_format_t __convert_format(MICROUI_ImageFormat microui_form
 	return vg_lite_format;
 }
 
-static vg_lite_buffer_format_t __convert_input_format(MICROUI_Image *image) {
+/*
+ * @brief Sets the VGLite CLUT to draw an image in an indexed format (see
+ * UI_VGLITE_FORMAT_CACHE_get_clut()).
+ *
+ * @param[in] microui_format: MicroUI image format
+ *
+ * @return false if the GPU does not support the indexed formats
+ */
+static bool __configure_clut(MICROUI_ImageFormat microui_format) {
+	// the colors are copied in the GPU commands list: the array can be local
+	uint32_t clut[UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS];
+	uint32_t count = UI_VGLITE_FORMAT_CACHE_get_clut(microui_format, UI_VGLITE_need_to_premultiply(), clut);
+
+	// fails when the GPU does not support the indexed formats
+	return (0u != count) && (VG_LITE_SUCCESS == UI_VGLITE_STATE_set_CLUT(count, clut));
+}
+
+/*
+ * @brief Enables or disables the GPU pre-multiplication according to the image to draw.
+ *
+ * @param[in] image: source image
+ *
+ * @return false if the image cannot be drawn by the GPU
+ */
+static bool __configure_premultiplication(MICROUI_Image *image) {
 	MICROUI_ImageFormat microui_format = (MICROUI_ImageFormat)image->format;
-	vg_lite_buffer_format_t vg_lite_format = __convert_format(microui_format);
+	bool ret = true;
 
-	if (VG_LITE_UNKNOWN_FORMAT != vg_lite_format) {
-		// check if the image pixels must be pre-multiplied with the opacity
-		bool premul_required;
-		if (LLUI_DISPLAY_isTransparent(image) &&
-		    (microui_format < (sizeof(__microui_to_premul) / sizeof(__microui_to_premul[0])))) {
-			premul_required = __microui_to_premul[microui_format];
-		} else {
-			premul_required = false;
-		}
+	// check if the image pixels must be pre-multiplied with the opacity
+	bool premul_required;
+	if (LLUI_DISPLAY_isTransparent(image) &&
+	    (microui_format < (sizeof(__microui_to_premul) / sizeof(__microui_to_premul[0])))) {
+		premul_required = __microui_to_premul[microui_format];
+	} else {
+		premul_required = false;
+	}
 
-		if (premul_required) {
-			if (VG_LITE_SUCCESS != vg_lite_enable_premultiply()) {
-				// pre-multiplication cannot be enabled or unsupported
+	if (premul_required) {
+		if (VG_LITE_SUCCESS != UI_VGLITE_STATE_enable_premultiply()) {
+			// pre-multiplication cannot be enabled or unsupported
 #ifndef VGLITE_USE_GPU_FOR_TRANSPARENT_IMAGES
-				// cannot draw a transparent image without applying a pre-multiplication
-				vg_lite_format = VG_LITE_UNKNOWN_FORMAT;
+			// cannot draw a transparent image without applying a pre-multiplication
+			ret = false;
 #endif // VGLITE_USE_GPU_FOR_TRANSPARENT_IMAGES
-			}
-		} else if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != vg_lite_disable_premultiply())) {
-			// have to disable the premultiplication but cannot
-			UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot disable the pre multiplication");
-		} else {
-			// premultiplication useless and nothing to disable
-			// -> nothing to do
 		}
+	} else if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != UI_VGLITE_STATE_disable_premultiply())) {
+		// have to disable the premultiplication but cannot
+		UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot disable the pre multiplication");
+	} else {
+		// premultiplication useless and nothing to disable
+		// -> nothing to do
+	}
+
+	return ret;
+}
+
+static vg_lite_buffer_format_t __convert_input_format(MICROUI_Image *image) {
+	MICROUI_ImageFormat microui_format = (MICROUI_ImageFormat)image->format;
+	vg_lite_buffer_format_t vg_lite_format = __convert_format(microui_format);
+
+	if ((vg_lite_format >= VG_LITE_INDEX_1) && (vg_lite_format <= VG_LITE_INDEX_8)
+	    && !__configure_clut(microui_format)) {
+		// indexed formats not supported by the GPU
+		vg_lite_format = VG_LITE_UNKNOWN_FORMAT;
+	}
+
+	if ((VG_LITE_UNKNOWN_FORMAT != vg_lite_format) && !__configure_premultiplication(image)) {
+		vg_lite_format = VG_LITE_UNKNOWN_FORMAT;
 	}
 
 	return vg_lite_format;
 }
 
+/*
+ * @brief Tells whether some GPU operations have not been submitted yet.
+ */
+static inline bool __is_batch_pending(void) {
+#ifdef VGLITE_BATCH_OPERATIONS
+	return batch_pending;
+#else
+	return false;
+#endif
+}
+
+/*
+ * @brief Submits the batched operations without waiting for their end every VGLITE_BATCH_SUBMIT_OPERATIONS
+ * operations: the GPU performs them while the next operations are added to the other GPU commands list.
+ */
+static inline void __submit_batch_step(void) {
+#ifdef VGLITE_BATCH_SUBMIT_OPERATIONS
+	batch_operations++;
+	if (VGLITE_BATCH_SUBMIT_OPERATIONS <= batch_operations) {
+		batch_operations = 0;
+		// the batch stays pending until the end of its last operation (see UI_VGLITE_flush_batch())
+		if (VG_LITE_SUCCESS != vg_lite_flush()) {
+			UI_VGLITE_IMPL_error(false, "vg_lite engine error: cannot submit the batched operations");
+		}
+	}
+#endif
+}
+
+/*
+ * @brief Resets the number of batched operations since the last submission.
+ */
+static inline void __reset_batch_step(void) {
+#ifdef VGLITE_BATCH_SUBMIT_OPERATIONS
+	batch_operations = 0;
+#endif
+}
+
+/*
+ * @brief Tells whether the GPU operations must be fully performed before returning.
+ */
+static inline bool __is_synchronous(void) {
+#if defined(UI_FEATURE_DISPLAY_LIST) && !defined(VGLITE_BATCH_OPERATIONS)
+	return synchronous_operations;
+#else
+	return false;
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // Low Level API [optional]: weak functions
 // -----------------------------------------------------------------------------
@@ -332,6 +461,8 @@ void UI_VGLITE_enable_hardware_rendering(void) {
 // See the header file for the function documentation
 void UI_VGLITE_disable_hardware_rendering(void) {
 #ifdef VGLITE_OPTION_TOGGLE_GPU
+	// the next drawings are performed by the software algorithms
+	UI_VGLITE_flush_batch();
 	hardware_rendering = false;
 #endif
 }
@@ -339,7 +470,11 @@ void UI_VGLITE_disable_hardware_rendering(void) {
 // See the header file for the function documentation
 void UI_VGLITE_toggle_hardware_rendering(void) {
 #ifdef VGLITE_OPTION_TOGGLE_GPU
-	hardware_rendering = !hardware_rendering;
+	if (hardware_rendering) {
+		UI_VGLITE_disable_hardware_rendering();
+	} else {
+		UI_VGLITE_enable_hardware_rendering();
+	}
 #endif
 }
 
@@ -376,7 +511,20 @@ bool UI_VGLITE_configure_source(vg_lite_buffer_t *buffer, MICROUI_Image *image)
 
 	uint32_t stride = LLUI_DISPLAY_getStrideInBytes(image);
 
-	if (LLUI_DISPLAY_IMPL_getNewImageStrideInBytes(image->format, image->width, image->height, stride) == stride) {
+	// the custom formats (compressed images) are negative in the signed field
+	if (UI_VGLITE_FORMAT_CACHE_is_format_supported((MICROUI_ImageFormat)(uint8_t)image->format)) {
+		// the GPU cannot read the image's pixels: use the converted pixels
+		__buffer_default_configuration(buffer);
+		if (UI_VGLITE_FORMAT_CACHE_configure_source(buffer, image) && __configure_premultiplication(image)) {
+			buffer->image_mode = VG_LITE_MULTIPLY_IMAGE_MODE; // image only
+			if (VG_LITE_RGBA8888 == buffer->format) {
+				// decoded compressed image (pre-multiplied pixels)
+				buffer->transparency_mode = VG_LITE_IMAGE_TRANSPARENT;
+			}
+			ret = true;
+		}
+	} else if (LLUI_DISPLAY_IMPL_getNewImageStrideInBytes(image->format, image->width, image->height, stride) ==
+	           stride) {
 		vg_lite_buffer_format_t format = __convert_input_format(image);
 
 		if (VG_LITE_UNKNOWN_FORMAT != format) {
@@ -397,14 +545,30 @@ bool UI_VGLITE_configure_source(vg_lite_buffer_t *buffer, MICROUI_Image *image)
 
 // See the header file for the function documentation
 void UI_VGLITE_start_operation(bool wakeup_graphics_engine) {
+	// the GPU interrupt of a previous GPU commands list (full list or intermediate submission of the batched
+	// operations) must not be considered as the end of this operation
+	framerate_stage_t previous_stage = framerate_stage_enter(FRAMERATE_STAGE_GPU_WAIT);
+	if (VG_LITE_SUCCESS != vg_lite_wait_submitted()) {
+		UI_VGLITE_IMPL_error(false, "vg_lite engine error: cannot wait for the submitted operations");
+	}
+	framerate_stage_leave(previous_stage);
+
 	vg_lite_irq_operation = wakeup_graphics_engine ? IRQ_WAKEUP_GRAPHICS_ENGINE : IRQ_WAKEUP_TASK;
 
+#ifdef VGLITE_BATCH_OPERATIONS
+	// the batched operations are submitted with this operation
+	batch_pending = false;
+	__reset_batch_step();
+#endif
+
 	// VG drawing has been added to the GPU commands list: ask to submit VG operation
 	vg_lite_flush();
 
 	if (!wakeup_graphics_engine) {
 		// active waiting until the GPU interrupt is thrown
+		previous_stage = framerate_stage_enter(FRAMERATE_STAGE_GPU_WAIT);
 		LLUI_DISPLAY_IMPL_binarySemaphoreTake(vg_lite_operation_semaphore);
+		framerate_stage_leave(previous_stage);
 	}
 }
 
@@ -412,16 +576,33 @@ void UI_VGLITE_start_operation(bool wakeup_graphics_engine) {
 DRAWING_Status UI_VGLITE_post_operation(MICROUI_GraphicsContext *gc, vg_lite_error_t vg_lite_error) {
 	DRAWING_Status ret;
 	if (VG_LITE_SUCCESS != vg_lite_error) {
-		// GPU is useless now, can be disabled. No GPU access should be done after this line
-		UI_VGLITE_IMPL_notify_gpu_stop(gc);
+		if (!__is_batch_pending()) {
+			// GPU is useless now, can be disabled. No GPU access should be done after this line
+			UI_VGLITE_IMPL_notify_gpu_stop(gc);
+		}
+		// else: the GPU will be stopped after the submission of the batched operations
 		ret = UI_VGLITE_report_vglite_error(gc, vg_lite_error);
 	} else {
-		// start GPU operation and do not wait for it to end
-		UI_VGLITE_start_operation(true);
-		ret = DRAWING_RUNNING;
+#ifdef VGLITE_BATCH_OPERATIONS
+		// keep the operation in the GPU commands list: it will be submitted with the next operations
+		batch_pending = true;
+		__submit_batch_step();
+		ret = DRAWING_DONE;
+#else
+		if (__is_synchronous()) {
+			// start GPU operation and wait for it to end (the Graphics Engine is not notified)
+			UI_VGLITE_start_operation(false);
+			UI_VGLITE_IMPL_notify_gpu_stop(gc);
+			ret = DRAWING_DONE;
+		} else {
+			// start GPU operation and do not wait for it to end
+			UI_VGLITE_start_operation(true);
+			ret = DRAWING_RUNNING;
+		}
+#endif
 	}
 
-	if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != vg_lite_enable_premultiply())) {
+	if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != UI_VGLITE_STATE_enable_premultiply())) {
 		// cannot restore premultiplication
 		UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot restore the pre multiplication");
 	}
@@ -429,6 +610,32 @@ DRAWING_Status UI_VGLITE_post_operation(MICROUI_GraphicsContext *gc, vg_lite_err
 	return ret;
 }
 
+// See the header file for the function documentation
+void UI_VGLITE_flush_batch(void) {
+#ifdef VGLITE_BATCH_OPERATIONS
+	if (batch_pending) {
+		batch_pending = false;
+		__reset_batch_step();
+
+		// submit all the batched operations at once and wait for the end of the last one
+		// (the GPU interrupt has nothing to do: see IRQ_BYPASS)
+		framerate_stage_t previous_stage = framerate_stage_enter(FRAMERATE_STAGE_GPU_WAIT);
+		if (VG_LITE_SUCCESS != vg_lite_finish()) {
+			UI_VGLITE_IMPL_error(false, "vg_lite engine error: cannot submit the batched operations");
+		}
+		framerate_stage_leave(previous_stage);
+
+		// GPU is useless now, can be disabled. No GPU access should be done after this line
+		UI_VGLITE_IMPL_notify_gpu_stop(NULL);
+	}
+#endif // VGLITE_BATCH_OPERATIONS
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_is_batch_pending(void) {
+	return __is_batch_pending();
+}
+
 // See the header file for the function documentation
 uint32_t UI_VGLITE_premultiply_alpha(uint32_t color, uint8_t alpha) {
 	uint32_t ret;
@@ -468,6 +675,8 @@ vg_lite_color_t UI_VGLITE_get_vglite_color(const MICROUI_GraphicsContext *gc, co
 	jint fc;
 
 	switch (img->format) {
+	case MICROUI_IMAGE_FORMAT_A1:
+	case MICROUI_IMAGE_FORMAT_A2:
 	case MICROUI_IMAGE_FORMAT_A4:
 	case MICROUI_IMAGE_FORMAT_A8:
 		if (UI_VGLITE_need_to_premultiply()) {
@@ -509,9 +718,9 @@ void UI_VGLITE_IRQHandler(void) {
 	default: // should not occur
 	case IRQ_BYPASS:
 	{
-		// Nothing to do: an automatic flush() has been made by the vg_lite engine to free the command buffer.
-		// After this interrupt, the vg_lite engine is waked-up (see vg_lite_os_wait_interrupt()) and fills the
-		// command buffer with the new pending command (command added by a VEE drawing).
+		// Nothing to do: a full command buffer or some batched operations have been submitted without waiting
+		// for their end (the vg_lite engine fills the other command buffer meanwhile). The vg_lite engine is
+		// waked-up (see vg_lite_os_wait_interrupt()) when it has to reuse this command buffer.
 		break;
 	}
 
@@ -553,8 +762,7 @@ bool UI_VGLITE_enable_vg_lite_scissor(MICROUI_GraphicsContext *gc) {
 			// not "empty" clip
 
 			// enable scissor for next vglite drawing
-			vg_lite_enable_scissor();
-			vg_lite_set_scissor(gc->clip.x1, gc->clip.y1, width, height);
+			UI_VGLITE_STATE_enable_scissor(gc->clip.x1, gc->clip.y1, width, height);
 
 			// perform drawing
 			ret = true;
@@ -566,7 +774,7 @@ bool UI_VGLITE_enable_vg_lite_scissor(MICROUI_GraphicsContext *gc) {
 		// clip is disabled :
 
 		// disable scissor (vglite lib already crops to the buffer bounds)
-		vg_lite_disable_scissor();
+		UI_VGLITE_STATE_disable_scissor();
 
 		// perform drawing
 		ret = true;
@@ -584,8 +792,8 @@ bool UI_VGLITE_enable_vg_lite_scissor_region(MICROUI_GraphicsContext *gc, int x1
 			// drawing fully or partially fits the clip:
 
 			// enable scissor for next vglite drawing
-			vg_lite_enable_scissor();
-			vg_lite_set_scissor(gc->clip.x1, gc->clip.y1, UI_RECT_get_width(&gc->clip), UI_RECT_get_height(&gc->clip));
+			UI_VGLITE_STATE_enable_scissor(gc->clip.x1, gc->clip.y1, UI_RECT_get_width(&gc->clip),
+			                               UI_RECT_get_height(&gc->clip));
 
 			// perform drawing
 			ret = true;
@@ -597,7 +805,7 @@ bool UI_VGLITE_enable_vg_lite_scissor_region(MICROUI_GraphicsContext *gc, int x1
 		// clip is disabled :
 
 		// disable scissor (vglite lib already crops to the buffer bounds)
-		vg_lite_disable_scissor();
+		UI_VGLITE_STATE_disable_scissor();
 
 		// perform drawing
 		ret = true;
@@ -675,8 +883,7 @@ bool UI_VGLITE_enable_vg_lite_scissor_area(MICROUI_GraphicsContext *gc, jfloat w
 		}
 
 		if ((0 < render_area_width) && (0 < render_area_height)) {
-			vg_lite_enable_scissor();
-			vg_lite_set_scissor(render_area_x, render_area_y, render_area_width, render_area_height);
+			UI_VGLITE_STATE_enable_scissor(render_area_x, render_area_y, render_area_width, render_area_height);
 
 			// perform drawing
 			ret = true;
@@ -688,7 +895,7 @@ bool UI_VGLITE_enable_vg_lite_scissor_area(MICROUI_GraphicsContext *gc, jfloat w
 		// clip is disabled :
 
 		// disable scissor (vglite lib already crops to the buffer bounds)
-		vg_lite_disable_scissor();
+		UI_VGLITE_STATE_disable_scissor();
 
 		// perform drawing
 		ret = true;
@@ -720,6 +927,17 @@ DRAWING_Status UI_VGLITE_report_vglite_error(MICROUI_GraphicsContext *gc, vg_lit
 // ui_drawing.h functions
 // -----------------------------------------------------------------------------
 
+// See the header file for the function documentation
+void UI_DRAWING_synchronizeHardwareDrawings(void) {
+	UI_VGLITE_flush_batch();
+}
+
+// See the header file for the function documentation
+void UI_DRAWING_freeImageResources(MICROUI_Image *image) {
+	// release the converted pixels of the image (if any)
+	UI_VGLITE_FORMAT_CACHE_free_image(image);
+}
+
 // See the header file for the function documentation
 uint32_t UI_DRAWING_getNewImageStrideInBytes(jbyte image_format, uint32_t image_width, uint32_t image_height,
                                              uint32_t default_stride) {
@@ -740,6 +958,24 @@ uint32_t UI_DRAWING_getNewImageStrideInBytes(jbyte image_format, uint32_t image_
 	return ret;
 }
 
+#ifdef UI_FEATURE_DISPLAY_LIST
+
+// -----------------------------------------------------------------------------
+// ui_display_list.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+void UI_DISPLAY_LIST_IMPL_set_synchronous_drawings(bool synchronous) {
+#ifdef VGLITE_BATCH_OPERATIONS
+	// the batched operations are already notified as done
+	(void)synchronous;
+#else
+	synchronous_operations = synchronous;
+#endif
+}
+
+#endif // UI_FEATURE_DISPLAY_LIST
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
@@ -0,0 +1,118 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the cost model that dispatches the drawings to the GPU or to
+ * the software algorithms.
+ *
+ * @see ui_vglite_cost.h
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_vglite_cost.h"
+#include "ui_vglite.h"
+
+#ifdef VGLITE_COST_MODEL
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The current model (see ui_vglite_configuration.h).
+ */
+static UI_VGLITE_COST_model_t cost_model = {
+	.gpu_setup_ns = VGLITE_COST_GPU_SETUP_NS,
+	.gpu_batched_setup_ns = VGLITE_COST_GPU_BATCHED_SETUP_NS,
+	.gpu_pixel_ps = VGLITE_COST_GPU_PIXEL_PS,
+	.cpu_pixel_ps = VGLITE_COST_CPU_PIXEL_PS,
+	.cpu_32bpp_percent = VGLITE_COST_CPU_32BPP_PERCENT,
+};
+
+static UI_VGLITE_COST_statistics_t cost_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Gets the fixed cost of the next GPU drawing in picoseconds.
+ */
+static uint64_t _get_gpu_setup_ps(void) {
+#ifdef VGLITE_BATCH_OPERATIONS
+	uint32_t setup_ns = cost_model.gpu_batched_setup_ns;
+#else
+	uint32_t setup_ns = cost_model.gpu_setup_ns;
+#endif
+	return (uint64_t)setup_ns * 1000u;
+}
+
+/*
+ * @brief Gets the cost of the software drawing in picoseconds. When some GPU drawings are
+ * batched, the software drawing waits for them first.
+ */
+static uint64_t _get_cpu_cost_ps(MICROUI_GraphicsContext *gc, UI_VGLITE_COST_primitive_t primitive,
+                                 uint32_t pixels) {
+	uint64_t cost = (uint64_t)pixels * cost_model.cpu_pixel_ps[primitive];
+	if (16u < LLUI_DISPLAY_getImageBPP(&gc->image)) {
+		cost = (cost * cost_model.cpu_32bpp_percent) / 100u;
+	}
+	if (UI_VGLITE_is_batch_pending()) {
+		cost += (uint64_t)cost_model.gpu_setup_ns * 1000u;
+	}
+	return cost;
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_cost.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_COST_use_software(MICROUI_GraphicsContext *gc, UI_VGLITE_COST_primitive_t primitive, uint32_t pixels) {
+	uint64_t gpu_cost = _get_gpu_setup_ps() + ((uint64_t)pixels * cost_model.gpu_pixel_ps[primitive]);
+	bool ret = _get_cpu_cost_ps(gc, primitive, pixels) < gpu_cost;
+
+	if (ret) {
+		// the software algorithm must not run concurrently with a GPU drawing
+		UI_VGLITE_flush_batch();
+		cost_statistics.cpu_drawings[primitive]++;
+	} else {
+		cost_statistics.gpu_drawings[primitive]++;
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_COST_set_model(const UI_VGLITE_COST_model_t *model) {
+	cost_model = *model;
+	(void)memset(&cost_statistics, 0, sizeof(cost_statistics));
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_COST_get_model(UI_VGLITE_COST_model_t *model) {
+	*model = cost_model;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_COST_get_statistics(UI_VGLITE_COST_statistics_t *statistics) {
+	*statistics = cost_statistics;
+}
+
+#endif // VGLITE_COST_MODEL
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
@@ -0,0 +1,390 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Calibration of the cost model: measures the GPU and the software drawings on the
+ * target and prints the model (see VGLITE_COST_CALIBRATION).
+ *
+ * @see ui_vglite_cost.h
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_vglite_cost.h"
+
+#ifdef VGLITE_COST_CALIBRATION
+
+#include "ui_vglite.h"
+#include "ui_vglite_state.h"
+#include "ui_drawing_vglite_process.h"
+#include "ui_drawing_soft.h"
+#include "ui_display_list.h"
+#include "ui_configuration.h"
+#include "ui_util.h"
+#include "framerate_impl.h"
+
+#if !defined(FRAMERATE_ENABLED)
+#error "The calibration measures the drawings with the framerate ticks: enable FRAMERATE_ENABLED"
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The side of the largest square drawn (the squares are 1x1, 2x2, 4x4, etc.).
+ */
+#define CALIBRATION_MAX_SIDE (128)
+
+/*
+ * @brief The number of drawings of each square: the duration of a drawing is the
+ * average.
+ */
+#define CALIBRATION_REPETITIONS (16)
+
+/*
+ * @brief The opacity of the images drawn with an opacity.
+ */
+#define CALIBRATION_BLEND_ALPHA (0x80)
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The renderers measured for each primitive.
+ */
+typedef enum {
+	/*
+	 * @brief The GPU: each drawing is submitted alone and waited for.
+	 */
+	CALIBRATION_GPU,
+
+	/*
+	 * @brief The GPU: the drawings of a square are submitted at once.
+	 */
+	CALIBRATION_GPU_BATCHED,
+
+	/*
+	 * @brief The software algorithms.
+	 */
+	CALIBRATION_CPU,
+} calibration_renderer_t;
+
+/*
+ * @brief Least squares fit of the duration (ns) according to the number of pixels.
+ */
+typedef struct {
+	int64_t count;
+	int64_t sum_pixels;
+	int64_t sum_ns;
+	int64_t sum_pixels2;
+	int64_t sum_pixels_ns;
+} calibration_fit_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief true when the GPU drawings are kept in the GPU commands list until the end of
+ * the square's drawings (see CALIBRATION_GPU_BATCHED).
+ */
+static bool calibration_batched;
+
+/*
+ * @brief true when a GPU drawing has failed.
+ */
+static bool calibration_error;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Waits for the end of the GPU drawings and releases the GPU.
+ */
+static void _finish_gpu(void) {
+	if (VG_LITE_SUCCESS != vg_lite_finish()) {
+		calibration_error = true;
+	}
+	UI_VGLITE_IMPL_notify_gpu_stop(NULL);
+}
+
+/*
+ * @brief Ends a GPU drawing: same as UI_VGLITE_post_operation() but the drawing is
+ * performed synchronously (without the GPU interrupt) or kept in the batch.
+ */
+static DRAWING_Status _end_gpu_operation(vg_lite_error_t error) {
+	if (VG_LITE_SUCCESS != error) {
+		calibration_error = true;
+	} else if (!calibration_batched) {
+		_finish_gpu();
+	} else {
+		// the drawing stays in the GPU commands list
+	}
+
+	if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != UI_VGLITE_STATE_enable_premultiply())) {
+		calibration_error = true;
+	}
+
+	return DRAWING_DONE;
+}
+
+static DRAWING_Status _clear(MICROUI_GraphicsContext *gc, vg_lite_rectangle_t *rect, vg_lite_color_t color) {
+	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+	return _end_gpu_operation(vg_lite_clear(target, rect, color));
+}
+
+static DRAWING_Status _draw_path(MICROUI_GraphicsContext *gc, vg_lite_path_t *path, vg_lite_fill_t fill_rule,
+                                 vg_lite_matrix_t *matrix, vg_lite_blend_t blend, vg_lite_color_t color) {
+	vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+	return _end_gpu_operation(vg_lite_draw(target, path, fill_rule, matrix, blend, color));
+}
+
+/*
+ * @brief Draws an image with the GPU (see UI_DRAWING_VGLITE_drawImage()).
+ */
+static void _draw_gpu_image(MICROUI_GraphicsContext *gc, MICROUI_Image *image, jint side, jint alpha) {
+	vg_lite_color_t color;
+	vg_lite_matrix_t matrix;
+	uint32_t blit_rect[4];
+
+	vg_lite_buffer_t *source = UI_DRAWING_VGLITE_PROCESS_prepare_draw_image(gc, image, 0, 0, side, side, 0, 0, alpha,
+	                                                                        &color, &matrix, blit_rect);
+	if (NULL != source) {
+		vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+		(void)_end_gpu_operation(vg_lite_blit_rect(target, source, blit_rect, &matrix, VG_LITE_BLEND_SRC_OVER,
+		                                           color, VG_LITE_FILTER_POINT));
+	} else {
+		// image format not supported by the GPU
+		calibration_error = true;
+	}
+}
+
+/*
+ * @brief Draws a primitive in the square at the top-left corner of the destination.
+ */
+static void _draw(MICROUI_GraphicsContext *gc, MICROUI_Image *image, UI_VGLITE_COST_primitive_t primitive,
+                  calibration_renderer_t renderer, jint side) {
+	jint alpha = (UI_VGLITE_COST_IMAGE_BLEND == primitive) ? CALIBRATION_BLEND_ALPHA : 0xff;
+
+	if (CALIBRATION_CPU == renderer) {
+		switch (primitive) {
+		case UI_VGLITE_COST_FILL:
+			(void)UI_DRAWING_SOFT_fillRectangle(gc, 0, 0, side - 1, side - 1);
+			break;
+		case UI_VGLITE_COST_SHAPE:
+			(void)UI_DRAWING_SOFT_fillCircle(gc, 0, 0, side);
+			break;
+		default:
+			(void)UI_DRAWING_SOFT_drawImage(gc, image, 0, 0, side, side, 0, 0, alpha);
+			break;
+		}
+	} else {
+		switch (primitive) {
+		case UI_VGLITE_COST_FILL:
+			(void)UI_DRAWING_VGLITE_PROCESS_fillRectangle(&_clear, gc, 0, 0, side - 1, side - 1);
+			break;
+		case UI_VGLITE_COST_SHAPE:
+			(void)UI_DRAWING_VGLITE_PROCESS_fillCircle(&_draw_path, gc, 0, 0, side);
+			break;
+		default:
+			_draw_gpu_image(gc, image, side, alpha);
+			break;
+		}
+	}
+}
+
+/*
+ * @brief Adds a sample to the fit: the duration of a drawing of a square.
+ */
+static void _add_sample(calibration_fit_t *fit, uint32_t pixels, uint32_t ns) {
+	fit->count++;
+	fit->sum_pixels += (int64_t)pixels;
+	fit->sum_ns += (int64_t)ns;
+	fit->sum_pixels2 += (int64_t)pixels * (int64_t)pixels;
+	fit->sum_pixels_ns += (int64_t)pixels * (int64_t)ns;
+}
+
+/*
+ * @brief Gets the slope of the fit in picoseconds per pixel (a negative slope is
+ * considered as null).
+ */
+static uint32_t _get_slope_ps(const calibration_fit_t *fit) {
+	int64_t numerator = (fit->count * fit->sum_pixels_ns) - (fit->sum_pixels * fit->sum_ns);
+	int64_t denominator = (fit->count * fit->sum_pixels2) - (fit->sum_pixels * fit->sum_pixels);
+	int64_t slope = (0 < denominator) ? ((numerator * 1000) / denominator) : 0;
+	return (0 < slope) ? (uint32_t)slope : 0u;
+}
+
+/*
+ * @brief Gets the intercept of the fit in nanoseconds (a negative intercept is considered
+ * as null).
+ */
+static uint32_t _get_intercept_ns(const calibration_fit_t *fit) {
+	int64_t slope = (int64_t)_get_slope_ps(fit);
+	int64_t intercept = ((fit->sum_ns * 1000) - (slope * fit->sum_pixels)) / (fit->count * 1000);
+	return (0 < intercept) ? (uint32_t)intercept : 0u;
+}
+
+/*
+ * @brief Measures a primitive drawn by a renderer in all the squares.
+ */
+static void _measure(MICROUI_GraphicsContext *gc, MICROUI_Image *image, UI_VGLITE_COST_primitive_t primitive,
+                     calibration_renderer_t renderer, jint max_side, calibration_fit_t *fit) {
+	uint32_t ticks_per_us = framerate_impl_get_ticks_per_us();
+
+	calibration_batched = CALIBRATION_GPU_BATCHED == renderer;
+	(void)memset(fit, 0, sizeof(calibration_fit_t));
+
+	for (jint side = 1; side <= max_side; side *= 2) {
+		uint32_t start = framerate_impl_get_ticks();
+		for (int32_t i = 0; i < CALIBRATION_REPETITIONS; i++) {
+			_draw(gc, image, primitive, renderer, side);
+		}
+		if (calibration_batched) {
+			_finish_gpu();
+		}
+		uint32_t ticks = framerate_impl_get_ticks() - start;
+
+		uint32_t ns = (uint32_t)(((uint64_t)ticks * 1000u) / ((uint64_t)ticks_per_us * CALIBRATION_REPETITIONS));
+		_add_sample(fit, (uint32_t)side * (uint32_t)side, ns);
+	}
+
+	calibration_batched = false;
+}
+
+/*
+ * @brief Gets the side of the largest square that fits in the image.
+ */
+static jint _get_max_side(MICROUI_Image *image, jint max_side) {
+	return MIN(max_side, MIN(image->width, image->height));
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_cost.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_COST_calibrate(MICROUI_GraphicsContext *gc, MICROUI_GraphicsContext *gc_32bpp, MICROUI_Image *image,
+                              UI_VGLITE_COST_model_t *model) {
+	calibration_fit_t fit;
+	UI_VGLITE_COST_model_t measured;
+	uint32_t sum_cpu_16bpp_ps = 0;
+	uint32_t sum_cpu_32bpp_ps = 0;
+	uint32_t sum_setup_ns = 0;
+	uint32_t sum_batched_setup_ns = 0;
+
+	jint max_side = _get_max_side(image, _get_max_side(&gc->image, CALIBRATION_MAX_SIDE));
+	bool ret = (16u == LLUI_DISPLAY_getImageBPP(&gc->image)) && (2 <= max_side);
+	if ((NULL != gc_32bpp) && (32u != LLUI_DISPLAY_getImageBPP(&gc_32bpp->image))) {
+		ret = false;
+	}
+
+	// the software algorithms must not run concurrently with a GPU drawing
+	UI_VGLITE_flush_batch();
+	calibration_error = false;
+
+	for (int32_t p = 0; ret && (p < (int32_t)UI_VGLITE_COST_PRIMITIVES); p++) {
+		UI_VGLITE_COST_primitive_t primitive = (UI_VGLITE_COST_primitive_t)p;
+
+		_measure(gc, image, primitive, CALIBRATION_GPU, max_side, &fit);
+		measured.gpu_pixel_ps[p] = _get_slope_ps(&fit);
+		sum_setup_ns += _get_intercept_ns(&fit);
+
+		_measure(gc, image, primitive, CALIBRATION_GPU_BATCHED, max_side, &fit);
+		sum_batched_setup_ns += _get_intercept_ns(&fit);
+
+		_measure(gc, image, primitive, CALIBRATION_CPU, max_side, &fit);
+		measured.cpu_pixel_ps[p] = _get_slope_ps(&fit);
+		sum_cpu_16bpp_ps += measured.cpu_pixel_ps[p];
+
+		if (NULL != gc_32bpp) {
+			jint max_side_32bpp = _get_max_side(&gc_32bpp->image, max_side);
+			_measure(gc_32bpp, image, primitive, CALIBRATION_CPU, max_side_32bpp, &fit);
+			sum_cpu_32bpp_ps += _get_slope_ps(&fit);
+		}
+
+		ret = !calibration_error;
+	}
+
+	if (ret) {
+		// the model has one setup time for all the primitives
+		measured.gpu_setup_ns = sum_setup_ns / (uint32_t)UI_VGLITE_COST_PRIMITIVES;
+		measured.gpu_batched_setup_ns = sum_batched_setup_ns / (uint32_t)UI_VGLITE_COST_PRIMITIVES;
+		measured.cpu_32bpp_percent = ((NULL != gc_32bpp) && (0u < sum_cpu_16bpp_ps))
+		                             ? ((sum_cpu_32bpp_ps * 100u) / sum_cpu_16bpp_ps) : 100u;
+		*model = measured;
+
+		UI_DEBUG_PRINT("#define VGLITE_COST_GPU_SETUP_NS (%uu)\n", (unsigned int)measured.gpu_setup_ns);
+		UI_DEBUG_PRINT("#define VGLITE_COST_GPU_BATCHED_SETUP_NS (%uu)\n",
+		               (unsigned int)measured.gpu_batched_setup_ns);
+		UI_DEBUG_PRINT("#define VGLITE_COST_GPU_PIXEL_PS { %uu, %uu, %uu, %uu }\n",
+		               (unsigned int)measured.gpu_pixel_ps[UI_VGLITE_COST_FILL],
+		               (unsigned int)measured.gpu_pixel_ps[UI_VGLITE_COST_SHAPE],
+		               (unsigned int)measured.gpu_pixel_ps[UI_VGLITE_COST_IMAGE],
+		               (unsigned int)measured.gpu_pixel_ps[UI_VGLITE_COST_IMAGE_BLEND]);
+		UI_DEBUG_PRINT("#define VGLITE_COST_CPU_PIXEL_PS { %uu, %uu, %uu, %uu }\n",
+		               (unsigned int)measured.cpu_pixel_ps[UI_VGLITE_COST_FILL],
+		               (unsigned int)measured.cpu_pixel_ps[UI_VGLITE_COST_SHAPE],
+		               (unsigned int)measured.cpu_pixel_ps[UI_VGLITE_COST_IMAGE],
+		               (unsigned int)measured.cpu_pixel_ps[UI_VGLITE_COST_IMAGE_BLEND]);
+		UI_DEBUG_PRINT("#define VGLITE_COST_CPU_32BPP_PERCENT (%uu)\n", (unsigned int)measured.cpu_32bpp_percent);
+	} else {
+		UI_VGLITE_IMPL_error(false, "cost model calibration error: unsupported destination, image or GPU drawing");
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_CostModel_calibrate(MICROUI_GraphicsContext *gc, MICROUI_GraphicsContext *gc_32bpp,
+                                             MICROUI_Image *image) {
+	jboolean ret = JFALSE;
+	// the calibration draws in the graphics contexts after the end of the previous drawings (including the drawings
+	// recorded by the display list)
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & Java_com_nxp_ui_CostModel_calibrate)) {
+		UI_VGLITE_COST_model_t model;
+		if (UI_VGLITE_COST_calibrate(gc, gc_32bpp, image, &model)) {
+#ifdef VGLITE_COST_MODEL
+			UI_VGLITE_COST_set_model(&model);
+#endif
+			ret = JTRUE;
+		}
+		LLUI_DISPLAY_setDrawingStatus(DRAWING_DONE);
+	}
+	return ret;
+}
+
+#else // VGLITE_COST_CALIBRATION
+
+// -----------------------------------------------------------------------------
+// ui_vglite_cost.h functions (calibration disabled)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_CostModel_calibrate(MICROUI_GraphicsContext *gc, MICROUI_GraphicsContext *gc_32bpp,
+                                             MICROUI_Image *image) {
+	(void)gc;
+	(void)gc_32bpp;
+	(void)image;
+	return JFALSE;
+}
+
+#endif // VGLITE_COST_CALIBRATION
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
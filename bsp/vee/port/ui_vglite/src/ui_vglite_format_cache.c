@@ -0,0 +1,433 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief MicroEJ MicroUI library low level API: implementation of ui_vglite_format_cache.h.
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "ui_vglite_format_cache.h"
+#include "ui_vglite.h"
+#include "ui_configuration.h"
+#include "ui_image_compressed.h"
+#include "ui_pixel_kernels.h"
+
+#ifdef VGLITE_FORMAT_CACHE
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief An image converted in the GPU memory.
+ */
+typedef struct {
+	/*
+	 * @brief The VGLite buffer that holds the converted pixels.
+	 */
+	vg_lite_buffer_t buffer;
+
+	/*
+	 * @brief The address of the image's pixels (NULL when the entry is free).
+	 */
+	const uint8_t *source;
+
+	/*
+	 * @brief The "time" of the last use (LRU policy).
+	 */
+	uint32_t last_use;
+} format_cache_entry_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static format_cache_entry_t cache_entries[VGLITE_FORMAT_CACHE_ENTRIES];
+
+static uint32_t cache_clock;
+
+static UI_VGLITE_FORMAT_CACHE_statistics_t cache_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+static inline uint32_t _get_buffer_size(const vg_lite_buffer_t *buffer) {
+	return (uint32_t)buffer->stride * (uint32_t)buffer->height;
+}
+
+/*
+ * @brief Gets the format of the image: the field is signed, the custom formats (see
+ * MICROUI_IMAGE_FORMAT_CUSTOM_0) are negative when not converted to uint8_t.
+ */
+static inline MICROUI_ImageFormat _get_format(const MICROUI_Image *image) {
+	return (MICROUI_ImageFormat)(uint8_t)image->format;
+}
+
+static inline bool _is_compressed(MICROUI_ImageFormat image_format) {
+#ifdef UI_IMAGE_FORMAT_COMPRESSED
+	return UI_IMAGE_FORMAT_COMPRESSED == image_format;
+#else
+	(void)image_format;
+	return false;
+#endif
+}
+
+static void _free_entry(format_cache_entry_t *entry) {
+	// the pixels may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+	cache_statistics.memory_used -= _get_buffer_size(&entry->buffer);
+	cache_statistics.entries--;
+	(void)vg_lite_free(&entry->buffer);
+	entry->source = NULL;
+}
+
+static format_cache_entry_t * _find_entry(const uint8_t *source) {
+	format_cache_entry_t *ret = NULL;
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_FORMAT_CACHE_ENTRIES; i++) {
+		format_cache_entry_t *entry = &cache_entries[i];
+		if (source == entry->source) {
+			ret = entry;
+			break;
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Gets a free entry, evicts the least recently used images until the cache
+ * can hold the given number of bytes.
+ */
+static format_cache_entry_t * _make_room(uint32_t bytes) {
+	format_cache_entry_t *free_entry = NULL;
+
+	while ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VGLITE_FORMAT_CACHE)) {
+		format_cache_entry_t *lru_entry = NULL;
+		free_entry = NULL;
+
+		for (uint32_t i = 0; i < (uint32_t)VGLITE_FORMAT_CACHE_ENTRIES; i++) {
+			format_cache_entry_t *entry = &cache_entries[i];
+			if (NULL == entry->source) {
+				free_entry = entry;
+			} else if ((NULL == lru_entry) || ((cache_clock - entry->last_use) > (cache_clock - lru_entry->last_use))) {
+				lru_entry = entry;
+			} else {
+				// entry more recent than lru_entry
+			}
+		}
+
+		if ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VGLITE_FORMAT_CACHE)) {
+			// the cache is not empty (bytes <= VGLITE_FORMAT_CACHE): lru_entry is not NULL
+			_free_entry(lru_entry);
+			cache_statistics.evictions++;
+		}
+	}
+
+	return free_entry;
+}
+
+/*
+ * @brief Converts the RGB888 pixels (B, G, R bytes) in XRGB8888 pixels.
+ */
+static void _convert_rgb888(const vg_lite_buffer_t *buffer, const uint8_t *source, uint32_t source_stride) {
+	for (int32_t y = 0; y < buffer->height; y++) {
+		const uint8_t *src = &source[(uint32_t)y * source_stride];
+		uint32_t *dest = (uint32_t *)&(((uint8_t *)buffer->memory)[(uint32_t)y * (uint32_t)buffer->stride]);
+		UI_PIXEL_KERNELS_convert_rgb888_to_argb8888(dest, src, (uint32_t)buffer->width);
+	}
+}
+
+/*
+ * @brief Gets the format of the converted pixels.
+ *
+ * @return false when the image cannot be converted.
+ */
+static bool _get_converted_format(const MICROUI_Image *image, const uint8_t *source, vg_lite_buffer_format_t *format) {
+	bool ret = false;
+	MICROUI_ImageFormat image_format = _get_format(image);
+
+	if (MICROUI_IMAGE_FORMAT_RGB888 == image_format) {
+		// the GPU "RGBA" format is the MicroUI "ARGB" format (see __microui_to_vg_lite_format)
+		*format = VG_LITE_RGBX8888;
+		ret = true;
+	} else if (_is_compressed(image_format)) {
+		const UI_IMAGE_COMPRESSED_header_t *header = (const UI_IMAGE_COMPRESSED_header_t *)source;
+		if (UI_IMAGE_COMPRESSED_check_header(header, (uint32_t)image->width, (uint32_t)image->height)) {
+			*format = (UI_IMAGE_COMPRESSED_FORMAT_RGB565 == header->format) ? VG_LITE_RGB565 : VG_LITE_RGBA8888;
+			ret = true;
+		}
+		// else: invalid compressed image
+	} else {
+		// format not supported
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Allocates a buffer in the GPU memory and converts the image's pixels.
+ *
+ * @return the cache entry or NULL when the image cannot be converted.
+ */
+static format_cache_entry_t * _convert_image(MICROUI_Image *image) {
+	format_cache_entry_t *ret = NULL;
+	const uint8_t *source = LLUI_DISPLAY_getBufferAddress(image);
+
+	vg_lite_buffer_t buffer;
+	(void)memset(&buffer, 0, sizeof(vg_lite_buffer_t));
+	buffer.width = image->width;
+	buffer.height = image->height;
+	bool supported = _get_converted_format(image, source, &buffer.format);
+
+	// same computing as vg_lite_allocate() (stride aligned on 16 pixels)
+	uint32_t bpp = (VG_LITE_RGB565 == buffer.format) ? 2u : 4u;
+	uint32_t bytes = ((((uint32_t)image->width + 15u) & ~(uint32_t)15u) * bpp) * (uint32_t)image->height;
+
+	if (supported && (bytes <= (uint32_t)VGLITE_FORMAT_CACHE)) {
+		format_cache_entry_t *entry = _make_room(bytes);
+
+		if (VG_LITE_SUCCESS == vg_lite_allocate(&buffer)) {
+			bool converted = true;
+			if (MICROUI_IMAGE_FORMAT_RGB888 == image->format) {
+				_convert_rgb888(&buffer, source, LLUI_DISPLAY_getStrideInBytes(image));
+			} else {
+				// the decoded pixels are already pre-multiplied
+				converted = UI_IMAGE_COMPRESSED_decode_rows((const UI_IMAGE_COMPRESSED_header_t *)source, 0,
+				                                            (uint32_t)image->height, (uint8_t *)buffer.memory,
+				                                            (uint32_t)buffer.stride);
+			}
+
+			if (converted) {
+				entry->buffer = buffer;
+				entry->source = source;
+				entry->last_use = cache_clock;
+				cache_statistics.conversions++;
+				cache_statistics.entries++;
+				cache_statistics.memory_used += _get_buffer_size(&buffer);
+				ret = entry;
+			} else {
+				UI_VGLITE_IMPL_error(false, "cannot decode a compressed image: corrupted data");
+				(void)vg_lite_free(&buffer);
+			}
+		} else {
+			// GPU memory is full: release it for the other GPU operations
+			UI_VGLITE_FORMAT_CACHE_clear();
+		}
+	}
+	// else: image not supported or too large
+
+	return ret;
+}
+
+/*
+ * @brief Gets the cache entry of the image; the image is converted when it is not in
+ * the cache yet.
+ *
+ * @return the cache entry or NULL when the image cannot be converted.
+ */
+static format_cache_entry_t * _load_image(MICROUI_Image *image) {
+	cache_clock++;
+
+	format_cache_entry_t *ret = _find_entry(LLUI_DISPLAY_getBufferAddress(image));
+	if (NULL != ret) {
+		ret->last_use = cache_clock;
+		cache_statistics.hits++;
+	} else {
+		ret = _convert_image(image);
+	}
+
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_format_cache.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_is_format_supported(MICROUI_ImageFormat image_format) {
+	return (MICROUI_IMAGE_FORMAT_RGB888 == image_format) || _is_compressed(image_format);
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_configure_source(vg_lite_buffer_t *buffer, MICROUI_Image *image) {
+	bool ret = false;
+	MICROUI_ImageFormat image_format = _get_format(image);
+
+	if (UI_VGLITE_FORMAT_CACHE_is_format_supported(image_format)) {
+		format_cache_entry_t *entry;
+
+		if (_is_compressed(image_format)) {
+			// the compressed images are only decoded on demand (see UI_VGLITE_FORMAT_CACHE_load_image())
+			cache_clock++;
+			entry = _find_entry(LLUI_DISPLAY_getBufferAddress(image));
+			if (NULL != entry) {
+				entry->last_use = cache_clock;
+				cache_statistics.hits++;
+			}
+		} else {
+			entry = _load_image(image);
+		}
+
+		if (NULL != entry) {
+			buffer->width = entry->buffer.width;
+			buffer->height = entry->buffer.height;
+			buffer->stride = entry->buffer.stride;
+			buffer->format = entry->buffer.format;
+			buffer->memory = entry->buffer.memory;
+			buffer->address = entry->buffer.address;
+			ret = true;
+		}
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_is_image_loaded(MICROUI_Image *image) {
+	return UI_VGLITE_FORMAT_CACHE_is_format_supported(_get_format(image))
+	       && (NULL != _find_entry(LLUI_DISPLAY_getBufferAddress(image)));
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_load_image(MICROUI_Image *image) {
+	return UI_VGLITE_FORMAT_CACHE_is_format_supported(_get_format(image))
+	       && (NULL != _load_image(image));
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_free_image(MICROUI_Image *image) {
+	if (UI_VGLITE_FORMAT_CACHE_is_format_supported(_get_format(image))) {
+		format_cache_entry_t *entry = _find_entry(LLUI_DISPLAY_getBufferAddress(image));
+		if (NULL != entry) {
+			_free_entry(entry);
+		}
+	}
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_clear(void) {
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_FORMAT_CACHE_ENTRIES; i++) {
+		format_cache_entry_t *entry = &cache_entries[i];
+		if (NULL != entry->source) {
+			_free_entry(entry);
+		}
+	}
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_get_statistics(UI_VGLITE_FORMAT_CACHE_statistics_t *statistics) {
+	*statistics = cache_statistics;
+}
+
+#else // VGLITE_FORMAT_CACHE
+
+// -----------------------------------------------------------------------------
+// ui_vglite_format_cache.h functions (cache disabled)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_is_format_supported(MICROUI_ImageFormat image_format) {
+	(void)image_format;
+	return false;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_configure_source(vg_lite_buffer_t *buffer, MICROUI_Image *image) {
+	(void)buffer;
+	(void)image;
+	return false;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_is_image_loaded(MICROUI_Image *image) {
+	(void)image;
+	return false;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_FORMAT_CACHE_load_image(MICROUI_Image *image) {
+	(void)image;
+	return false;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_free_image(MICROUI_Image *image) {
+	(void)image;
+	// nothing to free
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_clear(void) {
+	// nothing to clear
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_FORMAT_CACHE_get_statistics(UI_VGLITE_FORMAT_CACHE_statistics_t *statistics) {
+	(void)memset(statistics, 0, sizeof(UI_VGLITE_FORMAT_CACHE_statistics_t));
+}
+
+#endif // VGLITE_FORMAT_CACHE
+
+// -----------------------------------------------------------------------------
+// ui_vglite_format_cache.h functions (indexed formats)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+uint32_t UI_VGLITE_FORMAT_CACHE_get_clut(MICROUI_ImageFormat image_format, bool premultiplied,
+                                         uint32_t clut[UI_VGLITE_FORMAT_CACHE_CLUT_MAX_COLORS]) {
+	uint32_t count;
+	bool alpha_ramp = false;
+
+	switch (image_format) {
+	case MICROUI_IMAGE_FORMAT_A1:
+		alpha_ramp = true;
+		count = 2u;
+		break;
+	case MICROUI_IMAGE_FORMAT_A2:
+		alpha_ramp = true;
+		count = 4u;
+		break;
+	case MICROUI_IMAGE_FORMAT_C1:
+		count = 2u;
+		break;
+	case MICROUI_IMAGE_FORMAT_C2:
+		count = 4u;
+		break;
+	case MICROUI_IMAGE_FORMAT_C4:
+		count = 16u;
+		break;
+	default:
+		// not an indexed format
+		count = 0u;
+		break;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t level = (i * (uint32_t)0xff) / (count - (uint32_t)1);
+		if (!alpha_ramp) {
+			clut[i] = (uint32_t)0xff000000 | (level * (uint32_t)0x010101);
+		} else if (premultiplied) {
+			clut[i] = (level << 24) | (level * (uint32_t)0x010101);
+		} else {
+			clut[i] = (level << 24) | (uint32_t)0xffffff;
+		}
+	}
+
+	return count;
+}
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
@@ -0,0 +1,683 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief MicroEJ MicroUI library low level API: implementation of ui_vglite_glyph_cache.h.
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <math.h>
+#include <string.h>
+
+// allocates the transformed glyphs in the MicroUI images heap
+#include <LLUI_DISPLAY_impl.h>
+
+#include "ui_vglite_glyph_cache.h"
+#include "ui_vglite.h"
+#include "ui_vglite_state.h"
+#include "ui_font_drawing.h"
+
+#ifdef VGLITE_GLYPH_CACHE
+
+#if !defined(UI_FEATURE_FONT_CUSTOM_FORMATS)
+#error "The cache of the transformed glyphs requires the custom fonts (see UI_FEATURE_FONT_CUSTOM_FORMATS)"
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Alignment of the alpha maps (the GPU requires 64-byte aligned buffers).
+ */
+#define GLYPH_ALIGNMENT (64u)
+
+/*
+ * @brief Alignment of the rows of the alpha maps in pixels (same alignment as vg_lite_allocate()).
+ */
+#define GLYPH_STRIDE_ALIGNMENT (16u)
+
+/*
+ * @brief Number of steps of a scaling ratio per unit.
+ */
+#define SCALE_STEPS (64.f)
+
+/*
+ * @brief Number of steps of an angle per degree; number of steps of a full turn.
+ */
+#define ANGLE_STEPS (2.f)
+#define ANGLE_TURN (720)
+
+/*
+ * @brief Margin of the bounds of a transformed glyph: avoids an empty row or column when a corner is transformed
+ * a little beyond a pixel's edge.
+ */
+#define BOUNDS_MARGIN (0.001f)
+
+#define DEG_TO_RAD (3.14159265358979f / 180.f)
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief The kinds of transformation.
+ */
+typedef enum {
+	GLYPH_SCALED,
+	GLYPH_ROTATED_BILINEAR,
+	GLYPH_ROTATED_NEAREST_NEIGHBOR,
+} glyph_transform_t;
+
+/*
+ * @brief A transformation of the glyphs.
+ */
+typedef struct {
+	/*
+	 * @brief The kind of transformation.
+	 */
+	glyph_transform_t transform;
+
+	/*
+	 * @brief The rounded parameters: the ratios (in SCALE_STEPS) or the angle (in ANGLE_STEPS).
+	 */
+	int32_t parameters[2];
+
+	/*
+	 * @brief The matrix that transforms a point of the character's box (relative to its top-left corner).
+	 */
+	float forward[2][2];
+
+	/*
+	 * @brief The inverse matrix: gives the point of the character's box of a transformed point.
+	 */
+	float inverse[2][2];
+} glyph_transformation_t;
+
+/*
+ * @brief A transformed glyph cached in the MicroUI images heap.
+ */
+typedef struct {
+	/*
+	 * @brief The VGLite buffer that holds the transformed alpha map.
+	 */
+	vg_lite_buffer_t buffer;
+
+	/*
+	 * @brief The block allocated in the MicroUI images heap (NULL when the entry is free).
+	 */
+	uint8_t *block;
+
+	/*
+	 * @brief The size of the block in bytes.
+	 */
+	uint32_t size;
+
+	/*
+	 * @brief The key: the alpha map of the glyph, the character and the transformation.
+	 */
+	const uint8_t *alpha_map;
+	jchar c;
+	glyph_transform_t transform;
+	int32_t parameters[2];
+
+	/*
+	 * @brief The position of the transformed alpha map relative to the transformed top-left corner of the
+	 * character's box.
+	 */
+	jint x;
+	jint y;
+
+	/*
+	 * @brief The "time" of the last use (LRU policy). The glyphs used by the current drawing have the current time
+	 * and cannot be evicted.
+	 */
+	uint32_t last_use;
+
+	/*
+	 * @brief true when the glyph has been invalidated: the block is released at the next drawing.
+	 */
+	bool invalidated;
+} glyph_cache_entry_t;
+
+/*
+ * @brief The bounds of the glyphs of a drawing (inclusive).
+ */
+typedef struct {
+	jint x1;
+	jint y1;
+	jint x2;
+	jint y2;
+} glyph_bounds_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static glyph_cache_entry_t cache_entries[VGLITE_GLYPH_CACHE_ENTRIES];
+
+static uint32_t cache_clock;
+
+static UI_VGLITE_GLYPH_CACHE_statistics_t cache_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+static void _free_entry(glyph_cache_entry_t *entry) {
+	// the alpha map may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+	cache_statistics.memory_used -= entry->size;
+	cache_statistics.entries--;
+	LLUI_DISPLAY_IMPL_imageHeapFree(entry->block);
+	entry->block = NULL;
+	entry->invalidated = false;
+}
+
+/*
+ * @brief Releases the blocks of the invalidated glyphs. Must be called during a drawing: the previous drawings
+ * (that may read the glyphs) are done.
+ */
+static void _free_invalidated_entries(void) {
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_GLYPH_CACHE_ENTRIES; i++) {
+		glyph_cache_entry_t *entry = &cache_entries[i];
+		if ((NULL != entry->block) && entry->invalidated) {
+			_free_entry(entry);
+		}
+	}
+}
+
+static glyph_cache_entry_t * _find_entry(const UI_FONT_DRAWING_glyph_t *glyph, jchar c,
+                                         const glyph_transformation_t *transformation) {
+	glyph_cache_entry_t *ret = NULL;
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_GLYPH_CACHE_ENTRIES; i++) {
+		glyph_cache_entry_t *entry = &cache_entries[i];
+		if ((NULL != entry->block) && !entry->invalidated && (glyph->alpha_map == entry->alpha_map)
+		    && (c == entry->c) && (transformation->transform == entry->transform)
+		    && (transformation->parameters[0] == entry->parameters[0])
+		    && (transformation->parameters[1] == entry->parameters[1])) {
+			ret = entry;
+			break;
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Gets a free entry, evicts the least recently drawn glyphs until the cache can hold the given number of
+ * bytes. The glyphs of the current drawing are not evicted.
+ *
+ * @return NULL when the glyphs of the current drawing fill the cache.
+ */
+static glyph_cache_entry_t * _make_room(uint32_t bytes) {
+	glyph_cache_entry_t *free_entry = NULL;
+	bool full = true;
+
+	while (full) {
+		glyph_cache_entry_t *lru_entry = NULL;
+		free_entry = NULL;
+
+		for (uint32_t i = 0; i < (uint32_t)VGLITE_GLYPH_CACHE_ENTRIES; i++) {
+			glyph_cache_entry_t *entry = &cache_entries[i];
+			if (NULL == entry->block) {
+				free_entry = entry;
+			} else if (cache_clock == entry->last_use) {
+				// glyph of the current drawing
+			} else if ((NULL == lru_entry) || ((cache_clock - entry->last_use) > (cache_clock - lru_entry->last_use))) {
+				lru_entry = entry;
+			} else {
+				// entry more recent than lru_entry
+			}
+		}
+
+		full = (NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VGLITE_GLYPH_CACHE);
+		if (full) {
+			if (NULL == lru_entry) {
+				// all the glyphs are used by the current drawing
+				free_entry = NULL;
+				break;
+			}
+			_free_entry(lru_entry);
+			cache_statistics.evictions++;
+		}
+	}
+
+	return free_entry;
+}
+
+static void _configure_scaling(glyph_transformation_t *transformation, jfloat xRatio, jfloat yRatio) {
+	transformation->transform = GLYPH_SCALED;
+	transformation->parameters[0] = (int32_t)lroundf(xRatio * SCALE_STEPS);
+	transformation->parameters[1] = (int32_t)lroundf(yRatio * SCALE_STEPS);
+
+	float x_ratio = (float)transformation->parameters[0] / SCALE_STEPS;
+	float y_ratio = (float)transformation->parameters[1] / SCALE_STEPS;
+	transformation->forward[0][0] = x_ratio;
+	transformation->forward[0][1] = 0.f;
+	transformation->forward[1][0] = 0.f;
+	transformation->forward[1][1] = y_ratio;
+	transformation->inverse[0][0] = 1.f / x_ratio;
+	transformation->inverse[0][1] = 0.f;
+	transformation->inverse[1][0] = 0.f;
+	transformation->inverse[1][1] = 1.f / y_ratio;
+}
+
+/*
+ * @brief Configures a rotation with the same convention as the rotated images (see ui_drawing_transform.h): a
+ * positive angle rotates counterclockwise.
+ */
+static void _configure_rotation(glyph_transformation_t *transformation, jfloat angle, bool bilinear) {
+	int32_t steps = (int32_t)lroundf(angle * ANGLE_STEPS) % ANGLE_TURN;
+	steps = (steps < 0) ? (steps + ANGLE_TURN) : steps;
+
+	transformation->transform = bilinear ? GLYPH_ROTATED_BILINEAR : GLYPH_ROTATED_NEAREST_NEIGHBOR;
+	transformation->parameters[0] = steps;
+	transformation->parameters[1] = 0;
+
+	float radians = ((float)steps / ANGLE_STEPS) * DEG_TO_RAD;
+	float cos_a = cosf(radians);
+	float sin_a = sinf(radians);
+	transformation->forward[0][0] = cos_a;
+	transformation->forward[0][1] = sin_a;
+	transformation->forward[1][0] = -sin_a;
+	transformation->forward[1][1] = cos_a;
+	transformation->inverse[0][0] = cos_a;
+	transformation->inverse[0][1] = -sin_a;
+	transformation->inverse[1][0] = sin_a;
+	transformation->inverse[1][1] = cos_a;
+}
+
+/*
+ * @brief Gets the alpha of a pixel of a glyph (transparent outside the alpha map).
+ */
+static inline float _get_alpha(const UI_FONT_DRAWING_glyph_t *glyph, int32_t u, int32_t v) {
+	float ret = 0.f;
+	if ((u >= 0) && (u < glyph->width) && (v >= 0) && (v < glyph->height)) {
+		ret = (float)glyph->alpha_map[((uint32_t)v * glyph->stride) + (uint32_t)u];
+	}
+	return ret;
+}
+
+/*
+ * @brief Fills the transformed alpha map: each pixel's center is transformed back in the glyph's alpha map and
+ * sampled (nearest neighbor or bilinear interpolation between the centers of the four nearest pixels).
+ */
+static void _transform_glyph(const UI_FONT_DRAWING_glyph_t *glyph, const glyph_transformation_t *transformation,
+                             const glyph_cache_entry_t *entry) {
+	const float (*m)[2] = transformation->inverse;
+	bool nearest_neighbor = GLYPH_ROTATED_NEAREST_NEIGHBOR == transformation->transform;
+	uint8_t *row = (uint8_t *)entry->buffer.memory;
+
+	for (int32_t j = 0; j < entry->buffer.height; j++) {
+		float py = (float)(entry->y + j) + 0.5f;
+		for (int32_t i = 0; i < entry->buffer.width; i++) {
+			float px = (float)(entry->x + i) + 0.5f;
+			float sx = (m[0][0] * px) + (m[0][1] * py) - (float)glyph->x;
+			float sy = (m[1][0] * px) + (m[1][1] * py) - (float)glyph->y;
+			float alpha;
+
+			if (nearest_neighbor) {
+				alpha = _get_alpha(glyph, (int32_t)floorf(sx), (int32_t)floorf(sy));
+			} else {
+				float fx = sx - 0.5f;
+				float fy = sy - 0.5f;
+				float u0 = floorf(fx);
+				float v0 = floorf(fy);
+				float wx = fx - u0;
+				float wy = fy - v0;
+				int32_t u = (int32_t)u0;
+				int32_t v = (int32_t)v0;
+				float top = (_get_alpha(glyph, u, v) * (1.f - wx)) + (_get_alpha(glyph, u + 1, v) * wx);
+				float bottom = (_get_alpha(glyph, u, v + 1) * (1.f - wx)) + (_get_alpha(glyph, u + 1, v + 1) * wx);
+				alpha = (top * (1.f - wy)) + (bottom * wy) + 0.5f;
+			}
+
+			row[i] = (alpha >= 255.f) ? 255u : (uint8_t)alpha;
+		}
+		row += entry->buffer.stride;
+	}
+}
+
+/*
+ * @brief Gets the bounds of a transformed glyph relative to the transformed top-left corner of the character's box.
+ * The bilinear interpolation blends the edges of the alpha map with the transparent pixels around it: the bounds
+ * include half a pixel around the alpha map.
+ */
+static void _get_transformed_bounds(const UI_FONT_DRAWING_glyph_t *glyph, const glyph_transformation_t *transformation,
+                                    glyph_bounds_t *bounds) {
+	const float (*m)[2] = transformation->forward;
+	float margin = (GLYPH_ROTATED_NEAREST_NEIGHBOR == transformation->transform) ? 0.f : 0.5f;
+	float min_x = 0.f;
+	float min_y = 0.f;
+	float max_x = 0.f;
+	float max_y = 0.f;
+
+	for (uint32_t corner = 0; corner < 4u; corner++) {
+		float x = (float)glyph->x - margin + ((0u != (corner & 1u)) ? ((float)glyph->width + (2.f * margin)) : 0.f);
+		float y = (float)glyph->y - margin + ((0u != (corner & 2u)) ? ((float)glyph->height + (2.f * margin)) : 0.f);
+		float tx = (m[0][0] * x) + (m[0][1] * y);
+		float ty = (m[1][0] * x) + (m[1][1] * y);
+		min_x = ((0u == corner) || (tx < min_x)) ? tx : min_x;
+		min_y = ((0u == corner) || (ty < min_y)) ? ty : min_y;
+		max_x = ((0u == corner) || (tx > max_x)) ? tx : max_x;
+		max_y = ((0u == corner) || (ty > max_y)) ? ty : max_y;
+	}
+
+	bounds->x1 = (jint)floorf(min_x + BOUNDS_MARGIN);
+	bounds->y1 = (jint)floorf(min_y + BOUNDS_MARGIN);
+	bounds->x2 = (jint)ceilf(max_x - BOUNDS_MARGIN);
+	bounds->y2 = (jint)ceilf(max_y - BOUNDS_MARGIN);
+}
+
+/*
+ * @brief Gets the transformed glyph from the cache; transforms the glyph and adds it in the cache when it is not
+ * in the cache. The glyph cannot be evicted until the end of the drawing.
+ *
+ * @param[out] entry: the cached glyph (NULL when the glyph has no pixel).
+ *
+ * @return false when the glyph does not fit the cache or when the MicroUI images heap is full.
+ */
+static bool _get_entry(const UI_FONT_DRAWING_glyph_t *glyph, jchar c, const glyph_transformation_t *transformation,
+                       glyph_cache_entry_t **entry) {
+	bool ret = true;
+	glyph_cache_entry_t *found = _find_entry(glyph, c, transformation);
+
+	if (NULL != found) {
+		found->last_use = cache_clock;
+		cache_statistics.hits++;
+	} else if ((glyph->width > 0) && (glyph->height > 0)) {
+		glyph_bounds_t bounds;
+		_get_transformed_bounds(glyph, transformation, &bounds);
+		jint width = bounds.x2 - bounds.x1;
+		jint height = bounds.y2 - bounds.y1;
+
+		if ((width > 0) && (height > 0)) {
+			// same computing as vg_lite_allocate() (stride aligned on 16 pixels)
+			uint32_t stride = ((uint32_t)width + (GLYPH_STRIDE_ALIGNMENT - 1u)) & ~(GLYPH_STRIDE_ALIGNMENT - 1u);
+			uint32_t bytes = (stride * (uint32_t)height) + (GLYPH_ALIGNMENT - 1u);
+			found = (bytes <= (uint32_t)VGLITE_GLYPH_CACHE) ? _make_room(bytes) : NULL;
+			uint8_t *block = (NULL != found) ? LLUI_DISPLAY_IMPL_imageHeapAllocate(bytes) : NULL;
+
+			if (NULL != block) {
+				vg_lite_buffer_t *buffer = &found->buffer;
+				uintptr_t address = ((uintptr_t)block + (GLYPH_ALIGNMENT - 1u)) & ~(uintptr_t)(GLYPH_ALIGNMENT - 1u);
+				(void)memset(buffer, 0, sizeof(vg_lite_buffer_t));
+				buffer->width = width;
+				buffer->height = height;
+				buffer->stride = (int32_t)stride;
+				buffer->format = VG_LITE_A8;
+				buffer->tiled = VG_LITE_LINEAR;
+				// the color is applied when the alpha map is blitted
+				buffer->image_mode = VG_LITE_MULTIPLY_IMAGE_MODE;
+				buffer->transparency_mode = VG_LITE_IMAGE_TRANSPARENT;
+				buffer->memory = (void *)address;
+				buffer->address = (uint32_t)address;
+
+				found->block = block;
+				found->size = bytes;
+				found->alpha_map = glyph->alpha_map;
+				found->c = c;
+				found->transform = transformation->transform;
+				found->parameters[0] = transformation->parameters[0];
+				found->parameters[1] = transformation->parameters[1];
+				found->x = bounds.x1;
+				found->y = bounds.y1;
+				found->last_use = cache_clock;
+				found->invalidated = false;
+				_transform_glyph(glyph, transformation, found);
+
+				cache_statistics.misses++;
+				cache_statistics.entries++;
+				cache_statistics.memory_used += bytes;
+			} else {
+				// glyph larger than the cache, glyphs of the drawing fill the cache or MicroUI images heap full
+				ret = false;
+			}
+		}
+		// else: nothing to draw
+	} else {
+		// nothing to draw (space, etc.)
+	}
+
+	*entry = found;
+	return ret;
+}
+
+static inline void _add_bounds(glyph_bounds_t *bounds, const glyph_cache_entry_t *entry, jint x, jint y) {
+	jint x2 = x + entry->buffer.width - 1;
+	jint y2 = y + entry->buffer.height - 1;
+	bool empty = bounds->x1 > bounds->x2;
+	bounds->x1 = (empty || (x < bounds->x1)) ? x : bounds->x1;
+	bounds->y1 = (empty || (y < bounds->y1)) ? y : bounds->y1;
+	bounds->x2 = (empty || (x2 > bounds->x2)) ? x2 : bounds->x2;
+	bounds->y2 = (empty || (y2 > bounds->y2)) ? y2 : bounds->y2;
+}
+
+static vg_lite_error_t _blit_glyph(vg_lite_buffer_t *target, glyph_cache_entry_t *entry, jint x, jint y,
+                                   vg_lite_color_t color) {
+	vg_lite_matrix_t matrix;
+	vg_lite_identity(&matrix);
+	matrix.m[0][2] = x;
+	matrix.m[1][2] = y;
+	uint32_t rect[4] = { 0u, 0u, (uint32_t)entry->buffer.width, (uint32_t)entry->buffer.height };
+	return vg_lite_blit_rect(target, &entry->buffer, rect, &matrix, VG_LITE_BLEND_SRC_OVER, color,
+	                         VG_LITE_FILTER_POINT);
+}
+
+/*
+ * @brief Configures the GPU to blit the alpha maps and gets the destination (see UI_VGLITE_get_vglite_color()).
+ */
+static vg_lite_buffer_t * _prepare_blit(MICROUI_GraphicsContext *gc, jint alpha, vg_lite_color_t *color) {
+	if (UI_VGLITE_need_to_premultiply()) {
+		// hardware does not manage the pre-multiplication: the src color must be pre-multiplied
+		*color = UI_VGLITE_premultiply_alpha(gc->foreground_color, (uint8_t)alpha);
+	} else {
+		*color = ((uint32_t)alpha << 24) | (gc->foreground_color & 0xFFFFFFu);
+		// the alpha maps are not pre-multiplied (restored by UI_VGLITE_post_operation())
+		if (VG_LITE_SUCCESS != UI_VGLITE_STATE_disable_premultiply()) {
+			UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot disable the pre multiplication");
+		}
+	}
+	return UI_VGLITE_configure_destination(gc);
+}
+
+/*
+ * @brief Goes through the glyphs of a scaled string. Without target, gets the glyphs (see _get_entry()) and the
+ * bounds of the string; with a target, blits the glyphs (all the glyphs are in the cache).
+ *
+ * @return false when a glyph cannot be retrieved or blitted.
+ */
+static bool _process_scaled_string(jchar *chars, jint length, MICROUI_Font *font, jint x, jint y, jfloat xRatio,
+                                   const glyph_transformation_t *transformation, vg_lite_buffer_t *target,
+                                   vg_lite_color_t color, glyph_bounds_t *bounds) {
+	bool ret = true;
+	jint pen = 0;
+
+	for (jint i = 0; ret && (i < length); i++) {
+		UI_FONT_DRAWING_glyph_t glyph;
+		glyph_cache_entry_t *entry = NULL;
+
+		if (!UI_FONT_DRAWING_getGlyph(font, chars[i], &glyph)) {
+			// the font does not give its glyphs
+			ret = false;
+		} else if (NULL == target) {
+			ret = _get_entry(&glyph, chars[i], transformation, &entry);
+		} else {
+			entry = _find_entry(&glyph, chars[i], transformation);
+		}
+
+		if (ret && (NULL != entry)) {
+			jint gx = x + (jint)lroundf((float)pen * xRatio) + entry->x;
+			jint gy = y + entry->y;
+			if (NULL == target) {
+				_add_bounds(bounds, entry, gx, gy);
+			} else {
+				ret = VG_LITE_SUCCESS == _blit_glyph(target, entry, gx, gy, color);
+			}
+		}
+		if (ret) {
+			pen += glyph.advance;
+		}
+	}
+
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_glyph_cache.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_GLYPH_CACHE_draw_scaled_string(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
+                                              MICROUI_Font *font, jint x, jint y, jfloat xRatio, jfloat yRatio,
+                                              DRAWING_Status *status) {
+	glyph_transformation_t transformation;
+	glyph_bounds_t bounds = { 0, 0, -1, -1 };
+	bool ret = false;
+
+	// the glyphs of the previous drawings can be evicted, not the glyphs of this drawing
+	cache_clock++;
+	_free_invalidated_entries();
+	_configure_scaling(&transformation, xRatio, yRatio);
+
+	// the glyphs are transformed before the first blit: an eviction submits the batched operations
+	if ((transformation.parameters[0] > 0) && (transformation.parameters[1] > 0)
+	    && _process_scaled_string(chars, length, font, x, y, xRatio, &transformation, NULL, 0u, &bounds)) {
+		*status = DRAWING_DONE;
+		ret = true;
+
+		if ((bounds.x1 <= bounds.x2) && UI_VGLITE_enable_vg_lite_scissor_region(gc, bounds.x1, bounds.y1, bounds.x2,
+		                                                                         bounds.y2)) {
+			vg_lite_color_t color;
+			vg_lite_buffer_t *target = _prepare_blit(gc, 0xff, &color);
+			vg_lite_error_t err = _process_scaled_string(chars, length, font, x, y, xRatio, &transformation, target,
+			                                             color, &bounds) ? VG_LITE_SUCCESS : VG_LITE_INVALID_ARGUMENT;
+			*status = UI_VGLITE_post_operation(gc, err);
+		}
+		// else: string out of the clip
+	} else {
+		cache_statistics.fallbacks++;
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_GLYPH_CACHE_draw_rotated_char(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font, jint x,
+                                             jint y, jint xRotation, jint yRotation, jfloat angle, jint alpha,
+                                             bool bilinear, DRAWING_Status *status) {
+	glyph_transformation_t transformation;
+	UI_FONT_DRAWING_glyph_t glyph;
+	glyph_cache_entry_t *entry = NULL;
+	bool ret = false;
+
+	cache_clock++;
+	_free_invalidated_entries();
+	_configure_rotation(&transformation, angle, bilinear);
+
+	if (UI_FONT_DRAWING_getGlyph(font, c, &glyph) && _get_entry(&glyph, c, &transformation, &entry)) {
+		*status = DRAWING_DONE;
+		ret = true;
+
+		if ((NULL != entry) && (alpha > 0)) {
+			// the top-left corner of the character's box rotated around the rotation center, rounded to the nearest
+			// pixel
+			const float (*m)[2] = transformation.forward;
+			float dx = (float)(x - xRotation);
+			float dy = (float)(y - yRotation);
+			jint gx = xRotation + (jint)floorf((m[0][0] * dx) + (m[0][1] * dy) + 0.5f) + entry->x;
+			jint gy = yRotation + (jint)floorf((m[1][0] * dx) + (m[1][1] * dy) + 0.5f) + entry->y;
+
+			if (UI_VGLITE_enable_vg_lite_scissor_region(gc, gx, gy, gx + entry->buffer.width - 1,
+			                                            gy + entry->buffer.height - 1)) {
+				vg_lite_color_t color;
+				vg_lite_buffer_t *target = _prepare_blit(gc, (alpha > 0xff) ? 0xff : alpha, &color);
+				*status = UI_VGLITE_post_operation(gc, _blit_glyph(target, entry, gx, gy, color));
+			}
+			// else: character out of the clip
+		}
+		// else: nothing to draw
+	} else {
+		cache_statistics.fallbacks++;
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_GLYPH_CACHE_invalidate_all(void) {
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_GLYPH_CACHE_ENTRIES; i++) {
+		cache_entries[i].invalidated = NULL != cache_entries[i].block;
+	}
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_GLYPH_CACHE_get_statistics(UI_VGLITE_GLYPH_CACHE_statistics_t *statistics) {
+	*statistics = cache_statistics;
+}
+
+#else // VGLITE_GLYPH_CACHE
+
+// -----------------------------------------------------------------------------
+// ui_vglite_glyph_cache.h functions (cache disabled)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+bool UI_VGLITE_GLYPH_CACHE_draw_scaled_string(MICROUI_GraphicsContext *gc, jchar *chars, jint length,
+                                              MICROUI_Font *font, jint x, jint y, jfloat xRatio, jfloat yRatio,
+                                              DRAWING_Status *status) {
+	(void)gc;
+	(void)chars;
+	(void)length;
+	(void)font;
+	(void)x;
+	(void)y;
+	(void)xRatio;
+	(void)yRatio;
+	(void)status;
+	return false;
+}
+
+// See the header file for the function documentation
+bool UI_VGLITE_GLYPH_CACHE_draw_rotated_char(MICROUI_GraphicsContext *gc, jchar c, MICROUI_Font *font, jint x,
+                                             jint y, jint xRotation, jint yRotation, jfloat angle, jint alpha,
+                                             bool bilinear, DRAWING_Status *status) {
+	(void)gc;
+	(void)c;
+	(void)font;
+	(void)x;
+	(void)y;
+	(void)xRotation;
+	(void)yRotation;
+	(void)angle;
+	(void)alpha;
+	(void)bilinear;
+	(void)status;
+	return false;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_GLYPH_CACHE_invalidate_all(void) {
+	// nothing to invalidate
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_GLYPH_CACHE_get_statistics(UI_VGLITE_GLYPH_CACHE_statistics_t *statistics) {
+	(void)memset(statistics, 0, sizeof(UI_VGLITE_GLYPH_CACHE_statistics_t));
+}
+
+#endif // VGLITE_GLYPH_CACHE
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
@@ -0,0 +1,408 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief MicroEJ MicroUI library low level API: implementation of ui_vglite_layer_cache.h.
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+// allocates the layers in the MicroUI images heap
+#include <LLUI_DISPLAY_impl.h>
+
+#include "ui_vglite_layer_cache.h"
+#include "ui_vglite.h"
+#include "ui_vglite_state.h"
+#include "ui_display_brs.h"
+#include "ui_display_list.h"
+
+#ifdef VGLITE_LAYER_CACHE
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Alignment of the layers' pixels (the GPU requires 64-byte aligned buffers).
+ */
+#define LAYER_ALIGNMENT (64u)
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief A layer captured in the MicroUI images heap.
+ */
+typedef struct {
+	/*
+	 * @brief The VGLite buffer that holds the layer's pixels.
+	 */
+	vg_lite_buffer_t buffer;
+
+	/*
+	 * @brief The block allocated in the MicroUI images heap (NULL when the entry is free).
+	 */
+	uint8_t *block;
+
+	/*
+	 * @brief The size of the block in bytes.
+	 */
+	uint32_t size;
+
+	/*
+	 * @brief The identifier of the layer.
+	 */
+	jint layer;
+
+	/*
+	 * @brief The "time" of the last use (LRU policy).
+	 */
+	uint32_t last_use;
+
+	/*
+	 * @brief true when the layer has been invalidated: the block is released at the next drawing.
+	 */
+	bool invalidated;
+} layer_cache_entry_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static layer_cache_entry_t cache_entries[VGLITE_LAYER_CACHE_ENTRIES];
+
+static uint32_t cache_clock;
+
+static UI_VGLITE_LAYER_CACHE_statistics_t cache_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+static void _free_entry(layer_cache_entry_t *entry) {
+	// the pixels may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+	cache_statistics.memory_used -= entry->size;
+	cache_statistics.entries--;
+	LLUI_DISPLAY_IMPL_imageHeapFree(entry->block);
+	entry->block = NULL;
+	entry->invalidated = false;
+}
+
+/*
+ * @brief Releases the blocks of the invalidated layers. Must be called during a drawing: the previous drawings
+ * (that may read the layers) are done.
+ */
+static void _free_invalidated_entries(void) {
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_LAYER_CACHE_ENTRIES; i++) {
+		layer_cache_entry_t *entry = &cache_entries[i];
+		if ((NULL != entry->block) && entry->invalidated) {
+			_free_entry(entry);
+		}
+	}
+}
+
+static layer_cache_entry_t * _find_entry(jint layer) {
+	layer_cache_entry_t *ret = NULL;
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_LAYER_CACHE_ENTRIES; i++) {
+		layer_cache_entry_t *entry = &cache_entries[i];
+		if ((NULL != entry->block) && !entry->invalidated && (layer == entry->layer)) {
+			ret = entry;
+			break;
+		}
+	}
+	return ret;
+}
+
+/*
+ * @brief Gets a free entry, evicts the least recently drawn layers until the cache can hold the given number of
+ * bytes.
+ */
+static layer_cache_entry_t * _make_room(uint32_t bytes) {
+	layer_cache_entry_t *free_entry = NULL;
+
+	while ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VGLITE_LAYER_CACHE)) {
+		layer_cache_entry_t *lru_entry = NULL;
+		free_entry = NULL;
+
+		for (uint32_t i = 0; i < (uint32_t)VGLITE_LAYER_CACHE_ENTRIES; i++) {
+			layer_cache_entry_t *entry = &cache_entries[i];
+			if (NULL == entry->block) {
+				free_entry = entry;
+			} else if ((NULL == lru_entry) || ((cache_clock - entry->last_use) > (cache_clock - lru_entry->last_use))) {
+				lru_entry = entry;
+			} else {
+				// entry more recent than lru_entry
+			}
+		}
+
+		if ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VGLITE_LAYER_CACHE)) {
+			// the cache is not empty (bytes <= VGLITE_LAYER_CACHE): lru_entry is not NULL
+			_free_entry(lru_entry);
+			cache_statistics.evictions++;
+		}
+	}
+
+	return free_entry;
+}
+
+/*
+ * @brief Copies a region of the graphics context in the layer's buffer and waits for the end of the copy.
+ *
+ * @return false when the GPU operation cannot be performed.
+ */
+static bool _copy_region(MICROUI_GraphicsContext *gc, vg_lite_buffer_t *source, vg_lite_buffer_t *layer_buffer,
+                         jint x, jint y) {
+	vg_lite_matrix_t matrix;
+	vg_lite_identity(&matrix);
+	uint32_t rect[4] = { (uint32_t)x, (uint32_t)y, (uint32_t)layer_buffer->width, (uint32_t)layer_buffer->height };
+
+	// the scissor of the previous drawing would crop the copy
+	UI_VGLITE_STATE_disable_scissor();
+
+	// the layer is the target of the operation: the destination is only configured to prepare the GPU
+	(void)UI_VGLITE_configure_destination(gc);
+
+	bool ret = VG_LITE_SUCCESS == vg_lite_blit_rect(layer_buffer, source, rect, &matrix, VG_LITE_BLEND_NONE,
+	                                                0xffffffffu, VG_LITE_FILTER_POINT);
+	if (ret) {
+		UI_VGLITE_start_operation(false);
+	} else {
+		LLUI_DISPLAY_reportError(gc, DRAWING_LOG_LIBRARY_INCIDENT);
+	}
+
+	if (!UI_VGLITE_is_batch_pending()) {
+		// GPU is useless now, can be disabled
+		UI_VGLITE_IMPL_notify_gpu_stop(gc);
+	}
+
+	return ret;
+}
+
+/*
+ * @brief Captures a region of the graphics context in a layer.
+ *
+ * @return false when the region cannot be captured.
+ */
+static bool _capture(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y, jint width, jint height) {
+	bool ret = false;
+	vg_lite_buffer_t source;
+
+	_free_invalidated_entries();
+
+	// the previous content of the layer is useless
+	layer_cache_entry_t *entry = _find_entry(layer);
+	if (NULL != entry) {
+		_free_entry(entry);
+	}
+
+	int32_t bpp = UI_VGLITE_get_bpp((MICROUI_ImageFormat)gc->image.format);
+	if ((width > 0) && (height > 0) && (x >= 0) && (y >= 0) && ((x + width) <= (jint)gc->image.width)
+	    && ((y + height) <= (jint)gc->image.height) && ((16 == bpp) || (32 == bpp))
+	    && UI_VGLITE_configure_source(&source, &gc->image)) {
+		// same computing as vg_lite_allocate() (stride aligned on 16 pixels)
+		uint32_t stride = ((((uint32_t)width + 15u) & ~(uint32_t)15u) * (uint32_t)bpp) / 8u;
+		uint32_t bytes = (stride * (uint32_t)height) + (LAYER_ALIGNMENT - 1u);
+
+		if (bytes <= (uint32_t)VGLITE_LAYER_CACHE) {
+			entry = _make_room(bytes);
+			uint8_t *block = LLUI_DISPLAY_IMPL_imageHeapAllocate(bytes);
+
+			if (NULL != block) {
+				vg_lite_buffer_t *buffer = &entry->buffer;
+				uintptr_t address = ((uintptr_t)block + (LAYER_ALIGNMENT - 1u)) & ~(uintptr_t)(LAYER_ALIGNMENT - 1u);
+				(void)memset(buffer, 0, sizeof(vg_lite_buffer_t));
+				buffer->width = width;
+				buffer->height = height;
+				buffer->stride = (int32_t)stride;
+				buffer->format = source.format;
+				buffer->tiled = VG_LITE_LINEAR;
+				buffer->image_mode = VG_LITE_NORMAL_IMAGE_MODE;
+				buffer->transparency_mode = VG_LITE_IMAGE_OPAQUE;
+				buffer->memory = (void *)address;
+				buffer->address = (uint32_t)address;
+
+				// copy all the pixels (the display is opaque)
+				source.transparency_mode = VG_LITE_IMAGE_OPAQUE;
+
+				if (_copy_region(gc, &source, buffer, x, y)) {
+					entry->block = block;
+					entry->size = bytes;
+					entry->layer = layer;
+					entry->last_use = cache_clock;
+					entry->invalidated = false;
+					cache_statistics.captures++;
+					cache_statistics.entries++;
+					cache_statistics.memory_used += bytes;
+					ret = true;
+				} else {
+					LLUI_DISPLAY_IMPL_imageHeapFree(block);
+				}
+			}
+			// else: MicroUI images heap is full
+		}
+		// else: layer larger than the cache
+	}
+	// else: region out of the graphics context or format not supported
+
+	return ret;
+}
+
+/*
+ * @brief Draws a layer in the graphics context.
+ */
+static DRAWING_Status _draw(MICROUI_GraphicsContext *gc, layer_cache_entry_t *entry, jint x, jint y) {
+	DRAWING_Status status = DRAWING_DONE;
+	jint region_x = 0;
+	jint region_y = 0;
+	jint width = entry->buffer.width;
+	jint height = entry->buffer.height;
+
+	if (LLUI_DISPLAY_clipRegion(gc, &region_x, &region_y, &width, &height, &x, &y)) {
+		LLUI_DISPLAY_configureClip(gc, false /* region has been clipped */);
+
+		// the region is clipped: the scissor is useless
+		UI_VGLITE_STATE_disable_scissor();
+		vg_lite_buffer_t *target = UI_VGLITE_configure_destination(gc);
+
+		vg_lite_matrix_t matrix;
+		vg_lite_identity(&matrix);
+		matrix.m[0][2] = x;
+		matrix.m[1][2] = y;
+		uint32_t rect[4] = { (uint32_t)region_x, (uint32_t)region_y, (uint32_t)width, (uint32_t)height };
+
+		// the layer is opaque: copy without blending
+		vg_lite_error_t err = vg_lite_blit_rect(target, &entry->buffer, rect, &matrix, VG_LITE_BLEND_NONE,
+		                                        0xffffffffu, VG_LITE_FILTER_POINT);
+		status = UI_VGLITE_post_operation(gc, err);
+	}
+	// else: layer out of the clip
+
+	return status;
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_layer_cache.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_LayerCache_capture(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y, jint width,
+                                            jint height) {
+	jboolean ret = JFALSE;
+	// the capture does not draw in the graphics context but has to wait for the end of the previous drawings
+	// (including the drawings recorded by the display list)
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & Java_com_nxp_ui_LayerCache_capture)) {
+		ret = _capture(gc, layer, x, y, width, height) ? JTRUE : JFALSE;
+		LLUI_DISPLAY_setDrawingStatus(DRAWING_DONE);
+	}
+	return ret;
+}
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_LayerCache_draw(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y) {
+	jboolean ret = JFALSE;
+	layer_cache_entry_t *entry = _find_entry(layer);
+
+	if (NULL != entry) {
+		// the BRS does not have to restore what the opaque layer hides
+		UI_DISPLAY_BRS_set_opaque_region(gc, x, y, x + entry->buffer.width - 1, y + entry->buffer.height - 1);
+		bool drawing = UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & Java_com_nxp_ui_LayerCache_draw);
+		UI_DISPLAY_BRS_clear_opaque_region();
+
+		if (drawing) {
+			cache_clock++;
+			entry->last_use = cache_clock;
+			cache_statistics.hits++;
+
+			// the blocks are released before the drawing: the layer (not invalidated) is kept
+			_free_invalidated_entries();
+			LLUI_DISPLAY_setDrawingStatus(_draw(gc, entry, x, y));
+			ret = JTRUE;
+		}
+	} else {
+		cache_statistics.misses++;
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+void Java_com_nxp_ui_LayerCache_invalidate(jint layer) {
+	layer_cache_entry_t *entry = _find_entry(layer);
+	if (NULL != entry) {
+		entry->invalidated = true;
+	}
+}
+
+// See the header file for the function documentation
+void Java_com_nxp_ui_LayerCache_invalidateAll(void) {
+	for (uint32_t i = 0; i < (uint32_t)VGLITE_LAYER_CACHE_ENTRIES; i++) {
+		cache_entries[i].invalidated = NULL != cache_entries[i].block;
+	}
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_LAYER_CACHE_get_statistics(UI_VGLITE_LAYER_CACHE_statistics_t *statistics) {
+	*statistics = cache_statistics;
+}
+
+#else // VGLITE_LAYER_CACHE
+
+// -----------------------------------------------------------------------------
+// ui_vglite_layer_cache.h functions (cache disabled)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_LayerCache_capture(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y, jint width,
+                                            jint height) {
+	(void)gc;
+	(void)layer;
+	(void)x;
+	(void)y;
+	(void)width;
+	(void)height;
+	return JFALSE;
+}
+
+// See the header file for the function documentation
+jboolean Java_com_nxp_ui_LayerCache_draw(MICROUI_GraphicsContext *gc, jint layer, jint x, jint y) {
+	(void)gc;
+	(void)layer;
+	(void)x;
+	(void)y;
+	return JFALSE;
+}
+
+// See the header file for the function documentation
+void Java_com_nxp_ui_LayerCache_invalidate(jint layer) {
+	(void)layer;
+	// nothing to invalidate
+}
+
+// See the header file for the function documentation
+void Java_com_nxp_ui_LayerCache_invalidateAll(void) {
+	// nothing to invalidate
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_LAYER_CACHE_get_statistics(UI_VGLITE_LAYER_CACHE_statistics_t *statistics) {
+	(void)memset(statistics, 0, sizeof(UI_VGLITE_LAYER_CACHE_statistics_t));
+}
+
+#endif // VGLITE_LAYER_CACHE
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
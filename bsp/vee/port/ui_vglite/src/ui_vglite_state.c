@@ -0,0 +1,197 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/*
+ * @file
+ * @brief Implementation of the shadow of the VGLite states.
+ *
+ * @see ui_vglite_state.h
+ * @author MicroEJ Developer Team
+ * @version 10.0.0
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "ui_vglite_state.h"
+
+// -----------------------------------------------------------------------------
+// Macros and Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Number of tracked color look-up tables (2, 4 and 16 colors).
+ */
+#define CLUT_TABLES (3u)
+
+/*
+ * @brief Maximum number of colors of a tracked color look-up table.
+ */
+#define CLUT_MAX_COLORS (16u)
+
+// -----------------------------------------------------------------------------
+// Typedefs
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief A tracked state is unknown until its first programming.
+ */
+typedef enum {
+	STATE_UNKNOWN,
+	STATE_DISABLED,
+	STATE_ENABLED,
+} state_value_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static state_value_t scissor_state;
+static int32_t scissor_rectangle[4];
+
+static state_value_t premultiply_state;
+
+static bool clut_valid[CLUT_TABLES];
+static uint32_t clut_colors[CLUT_TABLES][CLUT_MAX_COLORS];
+
+static UI_VGLITE_STATE_statistics_t state_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Updates the statistics of a state.
+ *
+ * @return the given "issue" value
+ */
+static inline bool _count(UI_VGLITE_STATE_state_t state, bool issue) {
+	if (issue) {
+		state_statistics.issued[state]++;
+	} else {
+		state_statistics.elided[state]++;
+	}
+	return issue;
+}
+
+/*
+ * @brief Gets the index of the tracked color look-up table.
+ *
+ * @return the index or CLUT_TABLES when the table is not tracked.
+ */
+static uint32_t _get_clut_index(uint32_t count) {
+	uint32_t ret;
+	switch (count) {
+	case 2u:
+		ret = 0u;
+		break;
+	case 4u:
+		ret = 1u;
+		break;
+	case 16u:
+		ret = 2u;
+		break;
+	default:
+		ret = CLUT_TABLES;
+		break;
+	}
+	return ret;
+}
+
+static vg_lite_error_t _set_premultiply(state_value_t state) {
+	vg_lite_error_t ret = VG_LITE_SUCCESS;
+	if (_count(UI_VGLITE_STATE_PREMULTIPLY, state != premultiply_state)) {
+		ret = (STATE_ENABLED == state) ? vg_lite_enable_premultiply() : vg_lite_disable_premultiply();
+		premultiply_state = (VG_LITE_SUCCESS == ret) ? state : STATE_UNKNOWN;
+	}
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+// ui_vglite_state.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+void UI_VGLITE_STATE_enable_scissor(int32_t x, int32_t y, int32_t width, int32_t height) {
+	bool same_rectangle = (x == scissor_rectangle[0]) && (y == scissor_rectangle[1]) &&
+	                      (width == scissor_rectangle[2]) && (height == scissor_rectangle[3]);
+
+	if (_count(UI_VGLITE_STATE_SCISSOR, (STATE_ENABLED != scissor_state) || !same_rectangle)) {
+		(void)vg_lite_enable_scissor();
+		(void)vg_lite_set_scissor(x, y, width, height);
+		scissor_state = STATE_ENABLED;
+		scissor_rectangle[0] = x;
+		scissor_rectangle[1] = y;
+		scissor_rectangle[2] = width;
+		scissor_rectangle[3] = height;
+	}
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_STATE_disable_scissor(void) {
+	// the rectangle is kept: the driver keeps it too
+	if (_count(UI_VGLITE_STATE_SCISSOR, STATE_DISABLED != scissor_state)) {
+		(void)vg_lite_disable_scissor();
+		scissor_state = STATE_DISABLED;
+	}
+}
+
+// See the header file for the function documentation
+vg_lite_error_t UI_VGLITE_STATE_enable_premultiply(void) {
+	return _set_premultiply(STATE_ENABLED);
+}
+
+// See the header file for the function documentation
+vg_lite_error_t UI_VGLITE_STATE_disable_premultiply(void) {
+	return _set_premultiply(STATE_DISABLED);
+}
+
+// See the header file for the function documentation
+vg_lite_error_t UI_VGLITE_STATE_set_CLUT(uint32_t count, uint32_t *colors) {
+	vg_lite_error_t ret = VG_LITE_SUCCESS;
+	uint32_t index = _get_clut_index(count);
+
+	if (CLUT_TABLES == index) {
+		// not tracked
+		(void)_count(UI_VGLITE_STATE_CLUT, true);
+		ret = vg_lite_set_CLUT(count, colors);
+	} else if (_count(UI_VGLITE_STATE_CLUT, !clut_valid[index] ||
+	                  (0 != memcmp(clut_colors[index], colors, count * sizeof(uint32_t))))) {
+		ret = vg_lite_set_CLUT(count, colors);
+		clut_valid[index] = VG_LITE_SUCCESS == ret;
+		(void)memcpy(clut_colors[index], colors, count * sizeof(uint32_t));
+	} else {
+		// same table: nothing to do
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_STATE_invalidate(void) {
+	scissor_state = STATE_UNKNOWN;
+	premultiply_state = STATE_UNKNOWN;
+	(void)memset(clut_valid, 0, sizeof(clut_valid));
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_STATE_get_statistics(UI_VGLITE_STATE_statistics_t *statistics) {
+	*statistics = state_statistics;
+}
+
+// See the header file for the function documentation
+void UI_VGLITE_STATE_reset_statistics(void) {
+	(void)memset(&state_statistics, 0, sizeof(state_statistics));
+}
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
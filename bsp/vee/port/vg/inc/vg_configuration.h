@@ -28,7 +28,7 @@ extern "C" {
  * This value must be incremented by the implementor of the CCO when a configuration define is added, deleted or
  * modified.
  */
-#define MICROVG_CONFIGURATION_VERSION (4)
+#define MICROVG_CONFIGURATION_VERSION (5)
 
 // -----------------------------------------------------------------------------
 // Includes
@@ -113,6 +113,31 @@ extern "C" {
  */
 #define VG_FEATURE_PATH VG_FEATURE_PATH_SINGLE_ARRAY
 
+/*
+ * @brief Set this define to enable the cache of the encoded paths. The paths'
+ * data is uploaded once in the GPU memory and reused by the next drawings of
+ * a path that holds the same commands, parameters and bounds (the paths are
+ * identified by their content, not by their Java array).
+ *
+ * The value specifies the maximum number of bytes the cache can use in the GPU
+ * memory. A path is only uploaded when it is drawn twice: the paths drawn only
+ * once do not pollute the cache.
+ *
+ * When not set, the paths' data is copied in the GPU command buffer for each
+ * drawing.
+ */
+#define VG_FEATURE_PATH_CACHE (64 * 1024)
+
+/*
+ * @brief Configure this define to set the maximum number of paths held by the
+ * path cache.
+ *
+ * @see VG_FEATURE_PATH_CACHE
+ */
+#ifdef VG_FEATURE_PATH_CACHE
+#define VG_FEATURE_PATH_CACHE_ENTRIES (64)
+#endif
+
 /*
  * @brief Set this define to specify the implementation of the MicroVG's
  * LinearGradient (dynamic gradient creation and drawings with gradient).
@@ -126,6 +151,20 @@ extern "C" {
  */
 #define VG_FEATURE_GRADIENT VG_FEATURE_GRADIENT_FULL
 
+/*
+ * @brief Set this define to enable the cache of the gradients' color ramps. The
+ * color ramp of a LinearGradient (an image in the GPU memory computed from the
+ * gradient's colors and positions) is kept and reused by the next drawings that
+ * use the same colors, positions and opacity (only the gradient's matrix is
+ * updated).
+ *
+ * The value specifies the maximum number of bytes the cache can use (GPU memory
+ * and cache entries). Each color ramp uses about 1.3KB.
+ *
+ * When not set, the color ramp is computed for each drawing.
+ */
+#define VG_FEATURE_GRADIENT_CACHE (16 * 1024)
+
 /*
  * @brief Set this define to specify the implementation of the MicroVG'
  * VectorFont (dynamic font loading and text rendering).
@@ -30,9 +30,9 @@ extern "C" {
 // -----------------------------------------------------------------------------
 
 /*
- * @brief Available number of events: IMAGE, FONT and DRAWING
+ * @brief Available number of events: IMAGE, FONT, DRAWING and CACHE
  */
-#define LOG_MICROVG_EVENTS 3
+#define LOG_MICROVG_EVENTS 4
 
 /*
  * Events identifiers
@@ -40,6 +40,7 @@ extern "C" {
 #define LOG_MICROVG_IMAGE_ID 0
 #define LOG_MICROVG_FONT_ID 1
 #define LOG_MICROVG_DRAWING_ID 2
+#define LOG_MICROVG_CACHE_ID 3
 
 /*
  * @brief Types of Image events
@@ -68,6 +69,16 @@ extern "C" {
 #define LOG_MICROVG_DRAW_stringOnCircleGradient 5
 #define LOG_MICROVG_DRAW_image 6
 
+/*
+ * @brief Types of Cache events
+ */
+#define LOG_MICROVG_CACHE_path_hit 0
+#define LOG_MICROVG_CACHE_path_miss 1
+#define LOG_MICROVG_CACHE_path_usage 2
+#define LOG_MICROVG_CACHE_gradient_hit 3
+#define LOG_MICROVG_CACHE_gradient_miss 4
+#define LOG_MICROVG_CACHE_gradient_usage 5
+
 /*
  * @brief Useful macros to concatenate easily some strings and defines.
  */
@@ -84,6 +95,11 @@ extern "C" {
  */
 #define LOG_MICROVG_END(event, type) LLTRACE_IMPL_record_event_end_u32(VG_TRACE_group_id, event, type);
 
+/*
+ * @brief Macro to add an event, its type and two values (statistics).
+ */
+#define LOG_MICROVG_RECORD(event, type, v1, v2) LLTRACE_IMPL_record_event_u32x3(VG_TRACE_group_id, event, type, v1, v2);
+
 /* The following lines must be added to a SYSVIEW_MicroVG.txt file
  * in the <SYSTEMVIEW instalation dir>/Description folder
  *
@@ -105,9 +121,17 @@ extern "C" {
  * NamedType VGDraw 5=DRAW_STRING_ON_CIRCLE_GRADIENT
  * NamedType VGDraw 6=DRAW_IMAGE
  *
+ * NamedType VGCache 0=PATH_HIT
+ * NamedType VGCache 1=PATH_MISS
+ * NamedType VGCache 2=PATH_USAGE
+ * NamedType VGCache 3=GRADIENT_HIT
+ * NamedType VGCache 4=GRADIENT_MISS
+ * NamedType VGCache 5=GRADIENT_USAGE
+ *
  * 0        VG_ImageEvent      (MicroVG) Execute image event %VGImage  | (MicroVG) Image event %VGImage done
  * 1        VG_FontEvent       (MicroVG) Execute font event %VGFont  | (MicroVG) Font event %VGFont done
  * 2        VG_DrawingEvent    (MicroVG) Execute drawing event %VGDraw  | (MicroVG) Drawing event %VGDraw done
+ * 3        VG_CacheEvent      (MicroVG) Cache event %VGCache (%u, %u)
  *
  */
 
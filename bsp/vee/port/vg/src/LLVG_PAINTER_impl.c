@@ -31,6 +31,9 @@
 #include "vg_helper.h"
 #include "vg_trace.h"
 
+// performs the recorded drawings (when enabled)
+#include "ui_display_list.h"
+
 // -----------------------------------------------------------------------------
 // Macros and Defines
 // -----------------------------------------------------------------------------
@@ -48,7 +51,7 @@
 // See the header file for the function documentation
 jint LLVG_PAINTER_IMPL_drawPath(MICROUI_GraphicsContext *gc, jbyte *pathData, jint x, jint y, jfloat *matrix,
                                 jint fillRule, jint blend, jint color) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawPath)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawPath)) {
 		LOG_MICROVG_DRAWING_START(path);
 		jfloat translated_matrix[LLVG_MATRIX_SIZE];
 		VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -62,7 +65,7 @@ jint LLVG_PAINTER_IMPL_drawPath(MICROUI_GraphicsContext *gc, jbyte *pathData, ji
 // See the header file for the function documentation
 jint LLVG_PAINTER_IMPL_drawGradient(MICROUI_GraphicsContext *gc, jbyte *pathData, jint x, jint y, jfloat *matrix,
                                     jint fillRule, jint alpha, jint blend, jint *gradientData, jfloat *gradientMatrix) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawGradient)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawGradient)) {
 		LOG_MICROVG_DRAWING_START(pathGradient);
 		jfloat translated_matrix[LLVG_MATRIX_SIZE];
 		VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -81,7 +84,7 @@ jint LLVG_PAINTER_IMPL_drawString(MICROUI_GraphicsContext *gc, jchar *text, jint
 	if (LLVG_FONT_UNLOADED == faceHandle) {
 		ret = (jint)LLVG_RESOURCE_CLOSED;
 	} else {
-		if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawString))) {
+		if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawString))) {
 			LOG_MICROVG_DRAWING_START(string);
 			jfloat translated_matrix[LLVG_MATRIX_SIZE];
 			VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -104,7 +107,7 @@ jint LLVG_PAINTER_IMPL_drawStringGradient(MICROUI_GraphicsContext *gc, jchar *te
 	if (LLVG_FONT_UNLOADED == faceHandle) {
 		ret = (jint)LLVG_RESOURCE_CLOSED;
 	} else {
-		if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringGradient))) {
+		if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringGradient))) {
 			LOG_MICROVG_DRAWING_START(stringGradient);
 			jfloat translated_matrix[LLVG_MATRIX_SIZE];
 			VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -129,7 +132,7 @@ jint LLVG_PAINTER_IMPL_drawStringOnCircle(MICROUI_GraphicsContext *gc, jchar *te
 	if (LLVG_FONT_UNLOADED == faceHandle) {
 		ret = (jint)LLVG_RESOURCE_CLOSED;
 	} else {
-		if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringOnCircle))) {
+		if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringOnCircle))) {
 			LOG_MICROVG_DRAWING_START(stringOnCircle);
 			jfloat translated_matrix[LLVG_MATRIX_SIZE];
 			VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -155,7 +158,7 @@ jint LLVG_PAINTER_IMPL_drawStringOnCircleGradient(MICROUI_GraphicsContext *gc, j
 	if (LLVG_FONT_UNLOADED == faceHandle) {
 		ret = (jint)LLVG_RESOURCE_CLOSED;
 	} else {
-		if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringOnCircleGradient))) {
+		if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & (LLVG_PAINTER_IMPL_drawStringOnCircleGradient))) {
 			LOG_MICROVG_DRAWING_START(stringOnCircleGradient);
 			jfloat translated_matrix[LLVG_MATRIX_SIZE];
 			VG_HELPER_prepare_matrix(translated_matrix, x, y, matrix);
@@ -177,7 +180,7 @@ jint LLVG_PAINTER_IMPL_drawImage(MICROUI_GraphicsContext *gc, MICROVG_Image *ima
                                  jint alpha, jlong elapsed, const float color_matrix[]) {
 	jint error = LLVG_SUCCESS;
 
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawImage)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLVG_PAINTER_IMPL_drawImage)) {
 		DRAWING_Status status;
 		LOG_MICROVG_DRAWING_START(image);
 		if (!VG_DRAWING_image_is_closed(image) && (alpha > (jint)0)) {
@@ -51,7 +51,7 @@
 	#error "Undefined MICROVG_CONFIGURATION_VERSION, it must be defined in vg_configuration.h"
 #endif
 
-#if defined MICROVG_CONFIGURATION_VERSION && MICROVG_CONFIGURATION_VERSION != 4
+#if defined MICROVG_CONFIGURATION_VERSION && MICROVG_CONFIGURATION_VERSION != 5
 	#error "Version of the configuration file vg_configuration.h is not compatible with this implementation."
 #endif
 
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#if !defined VG_GRADIENT_CACHE_VGLITE_H
+#define VG_GRADIENT_CACHE_VGLITE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Cache of the VGLite linear gradients (color ramps).
+ *
+ * Preparing a VGLite gradient requires to allocate an image in the GPU memory and
+ * to compute the color ramp in this image (vg_lite_update_grad()). The cache keeps
+ * the prepared gradients identified by their colors, positions, opacity and
+ * pre-multiplication. A drawing that uses the same gradient only updates the
+ * gradient's matrix.
+ *
+ * When the cache is full, the least recently used gradient is evicted. The cache
+ * must only be used when the GPU does not use the previous gradients anymore: it
+ * is the case at the beginning of a MicroVG drawing (the previous drawing is fully
+ * done).
+ *
+ * @author MicroEJ Developer Team
+ * @version 9.0.1
+ * @see VG_FEATURE_GRADIENT_CACHE
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include <sni.h>
+#include <stdbool.h>
+
+#include "vg_lite.h"
+
+// --------------------------------------------------------------------------------
+// Typedef
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of the gradient cache.
+ */
+typedef struct {
+	/*
+	 * @brief Number of drawings that have reused a color ramp.
+	 */
+	uint32_t hits;
+
+	/*
+	 * @brief Number of drawings that have computed a color ramp.
+	 */
+	uint32_t misses;
+
+	/*
+	 * @brief Number of gradients evicted to make room for a new gradient.
+	 */
+	uint32_t evictions;
+
+	/*
+	 * @brief Current number of gradients in the cache.
+	 */
+	uint32_t entries;
+
+	/*
+	 * @brief Maximum number of gradients in the cache.
+	 */
+	uint32_t capacity;
+} VG_GRADIENT_CACHE_VGLITE_statistics_t;
+
+// --------------------------------------------------------------------------------
+// API
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Gets a VGLite gradient ready to be used by vg_lite_draw_gradient(): its
+ * color ramp is up-to-date and its matrix is computed from the drawing's matrix.
+ *
+ * The returned gradient is owned by the cache: the caller must not clear it. It
+ * is valid until the next call to this function.
+ *
+ * @param[out] gradient: the VGLite gradient to use.
+ * @param[in] gradient_data: the MicroVG gradient.
+ * @param[in] gradient_matrix: the MicroVG gradient's matrix.
+ * @param[in] global_matrix: the drawing's matrix.
+ * @param[in] alpha: the drawing's opacity.
+ * @param[in] premultiply: true when the colors must be pre-multiplied by the CPU.
+ *
+ * @return a VGLite error code
+ */
+vg_lite_error_t VG_GRADIENT_CACHE_VGLITE_get_gradient(vg_lite_linear_gradient_t **gradient, const jint *gradient_data,
+                                                      const jfloat *gradient_matrix, const jfloat *global_matrix,
+                                                      jint alpha, bool premultiply);
+
+/*
+ * @brief Evicts all the gradients from the cache and frees the GPU memory.
+ *
+ * The GPU must not use the cached gradients anymore.
+ */
+void VG_GRADIENT_CACHE_VGLITE_clear(void);
+
+/*
+ * @brief Gets the statistics of the gradient cache.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void VG_GRADIENT_CACHE_VGLITE_get_statistics(VG_GRADIENT_CACHE_VGLITE_statistics_t *statistics);
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined VG_GRADIENT_CACHE_VGLITE_H
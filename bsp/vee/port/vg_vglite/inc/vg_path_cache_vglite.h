@@ -0,0 +1,117 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+#if !defined VG_PATH_CACHE_VGLITE_H
+#define VG_PATH_CACHE_VGLITE_H
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * @file
+ * @brief Cache of the MicroVG paths uploaded in the GPU memory.
+ *
+ * The Java applications often build the same paths each frame (chart axes, gauge
+ * ticks, etc.) in new Java arrays. The cache identifies the paths by their content
+ * (commands, parameters, format and bounds) and keeps a VGLite path whose data
+ * has been uploaded once in the GPU memory: the drawing does not copy the path's
+ * data in the GPU command buffer anymore, the GPU reads it from the uploaded
+ * buffer.
+ *
+ * A path is uploaded only when it is drawn for the second time. When the cache
+ * is full (number of entries or memory), the least recently used paths are
+ * evicted.
+ *
+ * The cache must only be used when the GPU does not use the previous cached paths
+ * anymore (the eviction frees the uploaded buffers): it is the case at the
+ * beginning of a MicroVG drawing (the previous drawing is fully done).
+ *
+ * @author MicroEJ Developer Team
+ * @version 9.0.1
+ * @see VG_FEATURE_PATH_CACHE
+ */
+
+// --------------------------------------------------------------------------------
+// Includes
+// --------------------------------------------------------------------------------
+
+#include "vg_path.h"
+#include "vg_lite.h"
+
+// --------------------------------------------------------------------------------
+// Typedef
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Statistics of the path cache.
+ */
+typedef struct {
+	/*
+	 * @brief Number of drawings that have reused an uploaded path.
+	 */
+	uint32_t hits;
+
+	/*
+	 * @brief Number of drawings that have not found the path in the cache.
+	 */
+	uint32_t misses;
+
+	/*
+	 * @brief Number of paths evicted to make room for a new path.
+	 */
+	uint32_t evictions;
+
+	/*
+	 * @brief Current number of paths in the cache.
+	 */
+	uint32_t entries;
+
+	/*
+	 * @brief Current number of bytes allocated in the GPU memory.
+	 */
+	uint32_t memory_used;
+} VG_PATH_CACHE_VGLITE_statistics_t;
+
+// --------------------------------------------------------------------------------
+// API
+// --------------------------------------------------------------------------------
+
+/*
+ * @brief Gets the VGLite path to draw for the given MicroVG path. The returned path
+ * is either a path of the cache (already uploaded in the GPU memory) or the shared
+ * rendering path that targets the path's data (see VG_DRAWING_VGLITE_to_vglite_path()).
+ *
+ * The returned path is valid until the next call to this function or to
+ * VG_DRAWING_VGLITE_to_vglite_path().
+ *
+ * @param[in] path: the MicroVG path.
+ *
+ * @return the VGLite path to give to vg_lite_draw() or vg_lite_draw_gradient().
+ */
+vg_lite_path_t * VG_PATH_CACHE_VGLITE_get_path(VG_PATH_HEADER_t *path);
+
+/*
+ * @brief Evicts all the paths from the cache and frees the GPU memory.
+ *
+ * The GPU must not use the cached paths anymore.
+ */
+void VG_PATH_CACHE_VGLITE_clear(void);
+
+/*
+ * @brief Gets the statistics of the path cache.
+ *
+ * @param[out] statistics: the statistics to fill.
+ */
+void VG_PATH_CACHE_VGLITE_get_statistics(VG_PATH_CACHE_VGLITE_statistics_t *statistics);
+
+// --------------------------------------------------------------------------------
+// EOF
+// --------------------------------------------------------------------------------
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !defined VG_PATH_CACHE_VGLITE_H
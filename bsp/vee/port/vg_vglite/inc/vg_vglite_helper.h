@@ -179,6 +179,18 @@ vg_lite_error_t VG_VGLITE_HELPER_to_vg_lite_gradient(vg_lite_linear_gradient_t *
                                                      const jfloat *matrix, const jfloat *globalMatrix,
                                                      jint globalAlpha);
 
+/*
+ * @brief Computes the VGLite gradient's matrix of a MicroVG LinearGradient according
+ * to the drawing parameters. Only the gradient's matrix is updated.
+ *
+ * @param[in] gradient: the gradient destination (VGLite gradient)
+ * @param[in] gradientData: the gradient source
+ * @param[in] matrix: the gradient source's matrix
+ * @param[in] globalMatrix: the drawing's matrix
+ */
+void VG_VGLITE_HELPER_to_vg_lite_gradient_matrix(vg_lite_linear_gradient_t *gradient, const jint *gradientData,
+                                                 const jfloat *matrix, const jfloat *globalMatrix);
+
 // -----------------------------------------------------------------------------
 // EOF
 // -----------------------------------------------------------------------------
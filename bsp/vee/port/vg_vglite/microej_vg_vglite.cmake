@@ -8,6 +8,8 @@ target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
     ${CMAKE_CURRENT_LIST_DIR}/src/vg_drawing_bvi.c
     ${CMAKE_CURRENT_LIST_DIR}/src/vg_drawing_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/vg_drawing_vglite_image.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/vg_gradient_cache_vglite.c
+    ${CMAKE_CURRENT_LIST_DIR}/src/vg_path_cache_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/vg_path_vglite.c
     ${CMAKE_CURRENT_LIST_DIR}/src/vg_vglite_helper.c
 )
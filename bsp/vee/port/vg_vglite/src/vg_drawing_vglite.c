@@ -25,8 +25,11 @@
 // -----------------------------------------------------------------------------
 
 #include "ui_vglite.h"
+#include "ui_vglite_state.h"
 #include "vg_path.h"
 #include "vg_drawing_vglite.h"
+#include "vg_gradient_cache_vglite.h"
+#include "vg_path_cache_vglite.h"
 #include "vg_helper.h"
 #include "vg_vglite_helper.h"
 
@@ -76,7 +79,7 @@ static inline DRAWING_Status _post_operation(MICROUI_GraphicsContext *gc, jint e
 		// GPU is useless now, can be disabled. No GPU access should be done after this line
 		UI_VGLITE_IMPL_notify_gpu_stop(gc);
 	}
-	if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != vg_lite_enable_premultiply())) {
+	if (!UI_VGLITE_need_to_premultiply() && (VG_LITE_SUCCESS != UI_VGLITE_STATE_enable_premultiply())) {
 		// cannot restore premultiplication
 		UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot restore the pre multiplication");
 	}
@@ -91,7 +94,7 @@ inline static bool _need_to_premultiply(vg_lite_blend_t blend) {
 		case VG_LITE_BLEND_SRC_IN:
 		case VG_LITE_BLEND_DST_IN:
 		case VG_LITE_BLEND_SUBTRACT:
-			if (VG_LITE_SUCCESS != vg_lite_disable_premultiply()) {
+			if (VG_LITE_SUCCESS != UI_VGLITE_STATE_disable_premultiply()) {
 				// have to disable the premultiplication but cannot
 				UI_VGLITE_IMPL_error(false, "vg_lite engine premultiply error: cannot disable the pre multiplication");
 			} else {
@@ -234,20 +237,18 @@ static DRAWING_Status _draw_string_on_circle_gradient(MICROUI_GraphicsContext *g
 	DRAWING_Status ret = DRAWING_DONE;
 
 	if (UI_VGLITE_enable_vg_lite_scissor(gc)) {
-		// parepare gradient
-		vg_lite_linear_gradient_t vglite_gradient;
-		vg_lite_error_t vglite_error = VG_DRAWING_VGLITE_prepare_gradient(&vglite_gradient, gradientData,
-		                                                                  gradientMatrix, matrix, alpha);
+		// prepare gradient (the previous drawing is done: the gradient cache can be updated)
+		vg_lite_blend_t vglite_blend = VG_VGLITE_HELPER_get_blend(blend);
+		vg_lite_linear_gradient_t *vglite_gradient;
+		vg_lite_error_t vglite_error = VG_GRADIENT_CACHE_VGLITE_get_gradient(&vglite_gradient, gradientData,
+		                                                                     gradientMatrix, matrix, alpha,
+		                                                                     _need_to_premultiply(vglite_blend));
 
 		if (VG_LITE_SUCCESS == vglite_error) {
-			// create the gradient image
-			vg_lite_blend_t vglite_blend = VG_VGLITE_HELPER_get_blend(blend);
-			_update_gradient(&vglite_gradient, vglite_blend);
-
 			// prepare draw_glyph's data
 			MICROVG_VGLITE_draw_glyph_data_t data;
 			data.blend = vglite_blend;
-			data.gradient = &vglite_gradient;
+			data.gradient = vglite_gradient;
 			data.rendered = false;
 
 			// draw
@@ -255,8 +256,6 @@ static DRAWING_Status _draw_string_on_circle_gradient(MICROUI_GraphicsContext *g
 			jint error = VG_FREETYPE_draw_string(&_draw_glyph_gradient, text, length, faceHandle, size, matrix, 0,
 			                                     letterSpacing, radius, direction, &data);
 			ret = _post_operation(gc, error, data.rendered);
-
-			VG_DRAWING_VGLITE_clear_gradient(&vglite_gradient);
 		} else {
 			ret = UI_VGLITE_report_vglite_error(gc, vglite_error);
 		}
@@ -333,8 +332,8 @@ DRAWING_Status VG_DRAWING_VGLITE_drawPath(MICROUI_GraphicsContext *gc, const jby
 	DRAWING_Status ret = DRAWING_DONE;
 
 	if (UI_VGLITE_enable_vg_lite_scissor(gc)) {
-		// prepare path
-		vg_lite_path_t *vglite_path = VG_DRAWING_VGLITE_to_vglite_path((VG_PATH_HEADER_t *)pathData);
+		// prepare path (the previous drawing is done: the path cache can be updated)
+		vg_lite_path_t *vglite_path = VG_PATH_CACHE_VGLITE_get_path((VG_PATH_HEADER_t *)pathData);
 		vg_lite_blend_t vglite_blend = VG_VGLITE_HELPER_get_blend(blend);
 		vg_lite_fill_t vglite_fill = VG_VGLITE_HELPER_get_fill_rule(fillRule);
 
@@ -362,28 +361,25 @@ DRAWING_Status VG_DRAWING_VGLITE_drawGradient(MICROUI_GraphicsContext *gc, const
 	DRAWING_Status ret = DRAWING_DONE;
 
 	if (UI_VGLITE_enable_vg_lite_scissor(gc)) {
-		// prepare path
-		vg_lite_path_t *vglite_path = VG_DRAWING_VGLITE_to_vglite_path((VG_PATH_HEADER_t *)pathData);
+		// prepare path (the previous drawing is done: the path cache can be updated)
+		vg_lite_path_t *vglite_path = VG_PATH_CACHE_VGLITE_get_path((VG_PATH_HEADER_t *)pathData);
 		vg_lite_blend_t vglite_blend = VG_VGLITE_HELPER_get_blend(blend);
 		vg_lite_fill_t vglite_fill = VG_VGLITE_HELPER_get_fill_rule(fillRule);
 
 		// prepare gradient
-		vg_lite_linear_gradient_t vglite_gradient;
-		vg_lite_error_t vglite_error = VG_DRAWING_VGLITE_prepare_gradient(&vglite_gradient, gradientData,
-		                                                                  gradientMatrix, matrix, alpha);
+		vg_lite_linear_gradient_t *vglite_gradient;
+		vg_lite_error_t vglite_error = VG_GRADIENT_CACHE_VGLITE_get_gradient(&vglite_gradient, gradientData,
+		                                                                     gradientMatrix, matrix, alpha,
+		                                                                     _need_to_premultiply(vglite_blend));
 
 		if (VG_LITE_SUCCESS == vglite_error) {
-			// create the gradient image
-			_update_gradient(&vglite_gradient, vglite_blend);
-
 			// draw
 			render_buffer = UI_VGLITE_configure_destination(gc);
 			vglite_error = vg_lite_draw_gradient(render_buffer, vglite_path, vglite_fill, (vg_lite_matrix_t *)matrix,
-			                                     &vglite_gradient, vglite_blend);
+			                                     vglite_gradient, vglite_blend);
 
 			// post operation
 			ret = UI_VGLITE_post_operation(gc, vglite_error);
-			VG_DRAWING_VGLITE_clear_gradient(&vglite_gradient);
 		} else {
 			ret = UI_VGLITE_report_vglite_error(gc, vglite_error);
 		}
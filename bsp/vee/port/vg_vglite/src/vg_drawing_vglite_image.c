@@ -31,6 +31,8 @@
 #include "vg_trace.h"
 #include "vg_drawing_vglite.h"
 #include "ui_util.h"
+#include "ui_display_list.h"
+#include "ui_vglite_state.h"
 #include "vg_vglite_helper.h"
 #include "vg_bvi_vglite.h"
 
@@ -1803,8 +1805,7 @@ static bool _bvi_apply_scissor(const int32_t *scissor, const vg_transformation_m
 		}
 
 		if ((x0 <= x1) && (y0 <= y1)) {
-			vg_lite_enable_scissor();
-			vg_lite_set_scissor(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+			UI_VGLITE_STATE_enable_scissor(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
 			*current_scissor = NULL; // have to restore the clip
 		} else {
 			// empty clip: nothing to restore and nothing to draw
@@ -1820,10 +1821,10 @@ static const int32_t * _bvi_restore_scissor(const int32_t *original_scissor, con
 	if (original_scissor != current_scissor) {
 		// the scissor has been modified: restore the original one
 		if (NULL != original_scissor) {
-			vg_lite_enable_scissor();
-			vg_lite_set_scissor(original_scissor[0], original_scissor[1], original_scissor[2], original_scissor[3]);
+			UI_VGLITE_STATE_enable_scissor(original_scissor[0], original_scissor[1], original_scissor[2],
+			                               original_scissor[3]);
 		} else {
-			vg_lite_disable_scissor();
+			UI_VGLITE_STATE_disable_scissor();
 		}
 	}
 	return original_scissor;
@@ -2669,7 +2670,7 @@ void LLVG_BVI_IMPL_map_context(MICROUI_Image *ui, MICROVG_Image *vg) {
 }
 
 void LLVG_BVI_IMPL_clear(MICROUI_GraphicsContext *gc) {
-	if (LLUI_DISPLAY_requestDrawing(gc, (SNI_callback) & LLVG_BVI_IMPL_clear)) {
+	if (UI_DISPLAY_LIST_request_drawing(gc, (SNI_callback) & LLVG_BVI_IMPL_clear)) {
 		// map a struct on graphics context's pixel area
 		vector_buffered_image_t *image = MAP_BVI_ON_GC(gc);
 
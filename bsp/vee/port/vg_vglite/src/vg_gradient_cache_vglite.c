@@ -0,0 +1,289 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief Implementation of vg_gradient_cache_vglite.h functions.
+ *
+ * @author MicroEJ Developer Team
+ * @version 9.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "vg_configuration.h"
+#include "vg_gradient_cache_vglite.h"
+#include "vg_helper.h"
+#include "vg_trace.h"
+#include "vg_vglite_helper.h"
+#include "ui_vglite.h"
+
+// -----------------------------------------------------------------------------
+// Defines
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief FNV-1a hash constants.
+ */
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+#define LOG_MICROVG_CACHE_RECORD(type, v1, v2) \
+	LOG_MICROVG_RECORD(LOG_MICROVG_CACHE_ID, CONCAT_DEFINES(LOG_MICROVG_CACHE_, type), v1, v2)
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief Identifies a color ramp: the colors (opacity applied and pre-multiplied if
+ * required) and the positions.
+ */
+typedef struct {
+	uint32_t hash;
+	uint32_t count;
+	uint32_t colors[VLC_MAX_GRAD];
+	uint32_t stops[VLC_MAX_GRAD];
+} gradient_cache_key_t;
+
+/*
+ * @brief A gradient whose color ramp is computed in the GPU memory.
+ */
+typedef struct {
+	/*
+	 * @brief The VGLite gradient.
+	 */
+	vg_lite_linear_gradient_t gradient;
+
+	/*
+	 * @brief The gradient identifier (hash is 0 when the entry is free).
+	 */
+	gradient_cache_key_t key;
+
+	/*
+	 * @brief The "time" of the last use (LRU policy).
+	 */
+	uint32_t last_use;
+} gradient_cache_entry_t;
+
+/*
+ * @brief Memory used by an entry: the entry itself and the color ramp image.
+ */
+#define GRADIENT_CACHE_ENTRY_SIZE (sizeof(gradient_cache_entry_t) + (VLC_GRADBUFFER_WIDTH * sizeof(uint32_t)))
+
+#ifdef VG_FEATURE_GRADIENT_CACHE
+#define GRADIENT_CACHE_ENTRIES ((VG_FEATURE_GRADIENT_CACHE) / GRADIENT_CACHE_ENTRY_SIZE)
+#if (VG_FEATURE_GRADIENT_CACHE) < (2 * 1400)
+#error "VG_FEATURE_GRADIENT_CACHE is too small to hold at least two gradients"
+#endif
+#else
+// no cache: the gradient is computed for each drawing
+#define GRADIENT_CACHE_ENTRIES 1u
+#endif
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static gradient_cache_entry_t cache_entries[GRADIENT_CACHE_ENTRIES];
+
+static uint32_t cache_clock;
+
+static VG_GRADIENT_CACHE_VGLITE_statistics_t cache_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+static inline uint32_t _hash(uint32_t hash, uint32_t value) {
+	return (hash ^ value) * FNV_PRIME;
+}
+
+/*
+ * @brief Fills the key from the MicroVG gradient. The hash is never 0 (reserved for
+ * the free entries).
+ */
+static void _prepare_key(gradient_cache_key_t *key, const MICROVG_GRADIENT_HEADER_t *header, jint alpha,
+                         bool premultiply) {
+	const uint32_t *colors = &(((const uint32_t *)header)[header->colors_offset]);
+	const uint32_t *stops = &(((const uint32_t *)header)[header->positions_offset]);
+	uint32_t count = header->count;
+	uint32_t hash = _hash(FNV_OFFSET_BASIS, count);
+
+	(void)memset(key, 0, sizeof(gradient_cache_key_t));
+	key->count = count;
+
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t color = (0xff != alpha) ? VG_HELPER_apply_alpha(colors[i], (uint32_t)alpha) : colors[i];
+		if (premultiply) {
+			color = UI_VGLITE_premultiply(color);
+		}
+		key->colors[i] = color;
+		key->stops[i] = stops[i];
+		hash = _hash(_hash(hash, color), stops[i]);
+	}
+
+	key->hash = (0u == hash) ? 1u : hash;
+}
+
+static void _free_entry(gradient_cache_entry_t *entry) {
+	// the color ramp may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+	(void)vg_lite_clear_grad(&entry->gradient);
+	entry->key.hash = 0;
+	cache_statistics.entries--;
+}
+
+static gradient_cache_entry_t * _find_entry(const gradient_cache_key_t *key) {
+	gradient_cache_entry_t *ret = NULL;
+#ifdef VG_FEATURE_GRADIENT_CACHE
+	for (uint32_t i = 0; i < (uint32_t)GRADIENT_CACHE_ENTRIES; i++) {
+		gradient_cache_entry_t *entry = &cache_entries[i];
+		if ((key->hash == entry->key.hash) && (0 == memcmp(key, &entry->key, sizeof(gradient_cache_key_t)))) {
+			ret = entry;
+			break;
+		}
+	}
+#else
+	(void)key;
+#endif
+	return ret;
+}
+
+/*
+ * @brief Gets a free entry; evicts the least recently used gradient if the cache is
+ * full.
+ */
+static gradient_cache_entry_t * _make_room(void) {
+	gradient_cache_entry_t *free_entry = NULL;
+	gradient_cache_entry_t *lru_entry = NULL;
+
+	for (uint32_t i = 0; i < (uint32_t)GRADIENT_CACHE_ENTRIES; i++) {
+		gradient_cache_entry_t *entry = &cache_entries[i];
+		if (0u == entry->key.hash) {
+			free_entry = entry;
+			break;
+		} else if ((NULL == lru_entry) || ((cache_clock - entry->last_use) > (cache_clock - lru_entry->last_use))) {
+			lru_entry = entry;
+		} else {
+			// entry more recent than lru_entry
+		}
+	}
+
+	if (NULL == free_entry) {
+		_free_entry(lru_entry);
+		cache_statistics.evictions++;
+		free_entry = lru_entry;
+	}
+
+	return free_entry;
+}
+
+/*
+ * @brief Allocates the color ramp in the GPU memory and computes it.
+ */
+static vg_lite_error_t _prepare_entry(gradient_cache_entry_t *entry, const gradient_cache_key_t *key) {
+	vg_lite_linear_gradient_t *gradient = &entry->gradient;
+	(void)memset(gradient, 0, sizeof(vg_lite_linear_gradient_t));
+
+	// this call allocates in VGLite buffer
+	vg_lite_error_t ret = vg_lite_init_grad(gradient);
+	if (VG_LITE_OUT_OF_MEMORY == ret) {
+		// release the other color ramps and retry
+		VG_GRADIENT_CACHE_VGLITE_clear();
+		ret = vg_lite_init_grad(gradient);
+	}
+
+	if (VG_LITE_SUCCESS == ret) {
+		// GPU displays ABGR instead of ARGB and vice versa
+		gradient->image.format = VG_LITE_RGBA8888;
+
+		// the key is not modified by vg_lite_set_grad() (parameters are not const)
+		gradient_cache_key_t *local_key = &entry->key;
+		*local_key = *key;
+		(void)vg_lite_set_grad(gradient, local_key->count, local_key->colors, local_key->stops); // always success
+
+		// update the VGLite internal image that represents the gradient
+		(void)vg_lite_update_grad(gradient); // always success
+
+		entry->last_use = cache_clock;
+		cache_statistics.entries++;
+		LOG_MICROVG_CACHE_RECORD(gradient_usage, cache_statistics.entries, (uint32_t)GRADIENT_CACHE_ENTRIES);
+	} else {
+		entry->key.hash = 0;
+	}
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+// vg_gradient_cache_vglite.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+vg_lite_error_t VG_GRADIENT_CACHE_VGLITE_get_gradient(vg_lite_linear_gradient_t **gradient, const jint *gradient_data,
+                                                      const jfloat *gradient_matrix, const jfloat *global_matrix,
+                                                      jint alpha, bool premultiply) {
+	const MICROVG_GRADIENT_HEADER_t *header = (const MICROVG_GRADIENT_HEADER_t *)gradient_data;
+	vg_lite_error_t ret;
+
+	if (header->count <= (uint32_t)VLC_MAX_GRAD) {
+		gradient_cache_key_t key;
+		_prepare_key(&key, header, alpha, premultiply);
+
+		cache_clock++;
+
+		gradient_cache_entry_t *entry = _find_entry(&key);
+		if (NULL != entry) {
+			entry->last_use = cache_clock;
+			cache_statistics.hits++;
+			LOG_MICROVG_CACHE_RECORD(gradient_hit, cache_statistics.hits, cache_statistics.misses);
+			ret = VG_LITE_SUCCESS;
+		} else {
+			cache_statistics.misses++;
+			LOG_MICROVG_CACHE_RECORD(gradient_miss, cache_statistics.hits, cache_statistics.misses);
+			entry = _make_room();
+			ret = _prepare_entry(entry, &key);
+		}
+
+		if (VG_LITE_SUCCESS == ret) {
+			// only the matrix depends on the drawing
+			VG_VGLITE_HELPER_to_vg_lite_gradient_matrix(&entry->gradient, gradient_data,
+			                                            VG_HELPER_check_matrix(gradient_matrix), global_matrix);
+			*gradient = &entry->gradient;
+		}
+	} else {
+		// too many positions
+		ret = VG_LITE_INVALID_ARGUMENT;
+	}
+
+	return ret;
+}
+
+// See the header file for the function documentation
+void VG_GRADIENT_CACHE_VGLITE_clear(void) {
+	for (uint32_t i = 0; i < (uint32_t)GRADIENT_CACHE_ENTRIES; i++) {
+		gradient_cache_entry_t *entry = &cache_entries[i];
+		if (0u != entry->key.hash) {
+			_free_entry(entry);
+		}
+	}
+	LOG_MICROVG_CACHE_RECORD(gradient_usage, cache_statistics.entries, (uint32_t)GRADIENT_CACHE_ENTRIES);
+}
+
+// See the header file for the function documentation
+void VG_GRADIENT_CACHE_VGLITE_get_statistics(VG_GRADIENT_CACHE_VGLITE_statistics_t *statistics) {
+	*statistics = cache_statistics;
+	statistics->capacity = (uint32_t)GRADIENT_CACHE_ENTRIES;
+}
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
@@ -0,0 +1,323 @@
+/*
+ * C
+ *
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+/**
+ * @file
+ * @brief Implementation of vg_path_cache_vglite.h functions.
+ *
+ * @author MicroEJ Developer Team
+ * @version 9.0.1
+ */
+
+// -----------------------------------------------------------------------------
+// Includes
+// -----------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "vg_path_cache_vglite.h"
+#include "vg_drawing_vglite.h"
+#include "vg_trace.h"
+#include "ui_vglite.h"
+
+// -----------------------------------------------------------------------------
+// Defines
+// -----------------------------------------------------------------------------
+
+#ifndef VG_FEATURE_PATH
+#error "This implementation is only compatible when VG_FEATURE_PATH is set"
+#endif
+
+#ifdef VG_FEATURE_PATH_CACHE
+
+/*
+ * @brief Number of paths drawn once that are remembered to decide whether a path
+ * has to be uploaded or not.
+ */
+#define PATH_CACHE_CANDIDATES (2 * VG_FEATURE_PATH_CACHE_ENTRIES)
+
+/*
+ * @brief A path larger than this size is never cached: it would evict too many
+ * paths.
+ */
+#define PATH_CACHE_MAX_PATH_SIZE (VG_FEATURE_PATH_CACHE / 4)
+
+/*
+ * @brief Offset of the path's data in the uploaded buffer (see vg_lite_upload_path()).
+ */
+#define PATH_CACHE_UPLOAD_HEADER_SIZE 8
+
+/*
+ * @brief FNV-1a hash constants.
+ */
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+#define LOG_MICROVG_CACHE_RECORD(type, v1, v2) \
+	LOG_MICROVG_RECORD(LOG_MICROVG_CACHE_ID, CONCAT_DEFINES(LOG_MICROVG_CACHE_, type), v1, v2)
+
+// -----------------------------------------------------------------------------
+// Typedef
+// -----------------------------------------------------------------------------
+
+/*
+ * @brief A path uploaded in the GPU memory.
+ */
+typedef struct {
+	/*
+	 * @brief The VGLite path; its data targets the uploaded buffer.
+	 */
+	vg_lite_path_t vglite_path;
+
+	/*
+	 * @brief The hash of the MicroVG path (0 when the entry is free).
+	 */
+	uint32_t hash;
+
+	/*
+	 * @brief The "time" of the last use (LRU policy).
+	 */
+	uint32_t last_use;
+} path_cache_entry_t;
+
+// -----------------------------------------------------------------------------
+// Private global variables
+// -----------------------------------------------------------------------------
+
+static path_cache_entry_t cache_entries[VG_FEATURE_PATH_CACHE_ENTRIES];
+
+/*
+ * @brief Hashes of the last paths not found in the cache (ring buffer).
+ */
+static uint32_t cache_candidates[PATH_CACHE_CANDIDATES];
+static uint32_t cache_candidates_index;
+
+static uint32_t cache_clock;
+
+static VG_PATH_CACHE_VGLITE_statistics_t cache_statistics;
+
+// -----------------------------------------------------------------------------
+// Private functions
+// -----------------------------------------------------------------------------
+
+static inline const uint8_t * _get_path_data(const VG_PATH_HEADER_t *path) {
+	return &(((const uint8_t *)path)[VG_PATH_get_path_header_size()]);
+}
+
+/*
+ * @brief Hashes the path's data, format and bounds. The hash is never 0 (reserved
+ * for the free entries).
+ */
+static uint32_t _hash_path(const VG_PATH_HEADER_t *path) {
+	uint32_t hash = FNV_OFFSET_BASIS;
+
+	// the path's data is a succession of 32-bit words
+	const uint32_t *data = (const uint32_t *)_get_path_data(path);
+	uint32_t words = path->data_size / sizeof(uint32_t);
+	for (uint32_t i = 0; i < words; i++) {
+		hash = (hash ^ data[i]) * FNV_PRIME;
+	}
+
+	// the bounds are four 32-bit words
+	const uint32_t *bounds = (const uint32_t *)&path->bounds_xmin;
+	for (uint32_t i = 0; i < 4u; i++) {
+		hash = (hash ^ bounds[i]) * FNV_PRIME;
+	}
+
+	hash = (hash ^ (uint32_t)path->format) * FNV_PRIME;
+	return (0u == hash) ? 1u : hash;
+}
+
+static bool _is_same_path(const path_cache_entry_t *entry, const VG_PATH_HEADER_t *path, uint32_t hash) {
+	const vg_lite_path_t *vglite_path = &entry->vglite_path;
+	return (hash == entry->hash)
+	       && (path->data_size == (uint32_t)vglite_path->path_length)
+	       && (path->format == (uint8_t)vglite_path->format)
+	       && (path->bounds_xmin == vglite_path->bounding_box[0])
+	       && (path->bounds_ymin == vglite_path->bounding_box[1])
+	       && (path->bounds_xmax == vglite_path->bounding_box[2])
+	       && (path->bounds_ymax == vglite_path->bounding_box[3])
+	       && (0 == memcmp(vglite_path->path, _get_path_data(path), path->data_size));
+}
+
+static void _free_entry(path_cache_entry_t *entry) {
+	// the path may be used by a batched drawing
+	UI_VGLITE_flush_batch();
+	cache_statistics.memory_used -= entry->vglite_path.uploaded.bytes;
+	cache_statistics.entries--;
+	(void)vg_lite_clear_path(&entry->vglite_path);
+	entry->hash = 0;
+}
+
+/*
+ * @brief Gets a free entry, evicts the least recently used paths until the cache
+ * can hold the given number of bytes.
+ */
+static path_cache_entry_t * _make_room(uint32_t bytes) {
+	path_cache_entry_t *free_entry = NULL;
+
+	while ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VG_FEATURE_PATH_CACHE)) {
+		path_cache_entry_t *lru_entry = NULL;
+		free_entry = NULL;
+
+		for (uint32_t i = 0; i < (uint32_t)VG_FEATURE_PATH_CACHE_ENTRIES; i++) {
+			path_cache_entry_t *entry = &cache_entries[i];
+			if (0u == entry->hash) {
+				free_entry = entry;
+			} else if ((NULL == lru_entry) || ((cache_clock - entry->last_use) > (cache_clock - lru_entry->last_use))) {
+				lru_entry = entry;
+			} else {
+				// entry more recent than lru_entry
+			}
+		}
+
+		if ((NULL == free_entry) || ((cache_statistics.memory_used + bytes) > (uint32_t)VG_FEATURE_PATH_CACHE)) {
+			// the cache is not empty (PATH_CACHE_MAX_PATH_SIZE < VG_FEATURE_PATH_CACHE): lru_entry is not NULL
+			_free_entry(lru_entry);
+			cache_statistics.evictions++;
+		}
+	}
+
+	return free_entry;
+}
+
+/*
+ * @brief Checks whether the path has already been drawn recently. If not, the path
+ * is remembered as a candidate for the next drawing.
+ */
+static bool _is_candidate(uint32_t hash) {
+	bool ret = false;
+	for (uint32_t i = 0; i < (uint32_t)PATH_CACHE_CANDIDATES; i++) {
+		if (hash == cache_candidates[i]) {
+			cache_candidates[i] = 0;
+			ret = true;
+			break;
+		}
+	}
+
+	if (!ret) {
+		cache_candidates[cache_candidates_index] = hash;
+		cache_candidates_index = (cache_candidates_index + 1u) % (uint32_t)PATH_CACHE_CANDIDATES;
+	}
+	return ret;
+}
+
+/*
+ * @brief Uploads the path in the GPU memory.
+ *
+ * @return the cached VGLite path or NULL when the path cannot be uploaded.
+ */
+static vg_lite_path_t * _upload_path(VG_PATH_HEADER_t *path, uint32_t hash) {
+	vg_lite_path_t *ret = NULL;
+
+	// same computing as vg_lite_upload_path()
+	uint32_t bytes = (PATH_CACHE_UPLOAD_HEADER_SIZE + path->data_size + 7u + 8u) & ~(uint32_t)7u;
+	path_cache_entry_t *entry = _make_room(bytes);
+
+	vg_lite_path_t *vglite_path = &entry->vglite_path;
+	(void)vg_lite_init_path(vglite_path, (vg_lite_format_t)path->format, VG_LITE_HIGH, path->data_size,
+	                        (void *)_get_path_data(path), path->bounds_xmin, path->bounds_ymin, path->bounds_xmax,
+	                        path->bounds_ymax);
+	vglite_path->path_type = VG_LITE_DRAW_FILL_PATH;
+
+	if (VG_LITE_SUCCESS == vg_lite_upload_path(vglite_path)) {
+		// the path's data is now the uploaded copy (the Java array may be moved or modified)
+		vglite_path->path = &(((uint8_t *)vglite_path->uploaded.memory)[PATH_CACHE_UPLOAD_HEADER_SIZE]);
+
+		entry->hash = hash;
+		entry->last_use = cache_clock;
+		cache_statistics.entries++;
+		cache_statistics.memory_used += vglite_path->uploaded.bytes;
+		LOG_MICROVG_CACHE_RECORD(path_usage, cache_statistics.entries, cache_statistics.memory_used);
+		ret = vglite_path;
+	} else {
+		// GPU memory is full: release it for the other GPU operations
+		VG_PATH_CACHE_VGLITE_clear();
+	}
+
+	return ret;
+}
+
+// -----------------------------------------------------------------------------
+// vg_path_cache_vglite.h functions
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+vg_lite_path_t * VG_PATH_CACHE_VGLITE_get_path(VG_PATH_HEADER_t *path) {
+	vg_lite_path_t *ret = NULL;
+
+	if (path->data_size <= (uint32_t)PATH_CACHE_MAX_PATH_SIZE) {
+		uint32_t hash = _hash_path(path);
+		cache_clock++;
+
+		for (uint32_t i = 0; i < (uint32_t)VG_FEATURE_PATH_CACHE_ENTRIES; i++) {
+			path_cache_entry_t *entry = &cache_entries[i];
+			if (_is_same_path(entry, path, hash)) {
+				entry->last_use = cache_clock;
+				ret = &entry->vglite_path;
+				break;
+			}
+		}
+
+		if (NULL != ret) {
+			cache_statistics.hits++;
+			LOG_MICROVG_CACHE_RECORD(path_hit, cache_statistics.hits, cache_statistics.misses);
+		} else {
+			cache_statistics.misses++;
+			LOG_MICROVG_CACHE_RECORD(path_miss, cache_statistics.hits, cache_statistics.misses);
+
+			if (_is_candidate(hash)) {
+				ret = _upload_path(path, hash);
+			}
+		}
+	}
+
+	return (NULL == ret) ? VG_DRAWING_VGLITE_to_vglite_path(path) : ret;
+}
+
+// See the header file for the function documentation
+void VG_PATH_CACHE_VGLITE_clear(void) {
+	for (uint32_t i = 0; i < (uint32_t)VG_FEATURE_PATH_CACHE_ENTRIES; i++) {
+		path_cache_entry_t *entry = &cache_entries[i];
+		if (0u != entry->hash) {
+			_free_entry(entry);
+		}
+	}
+	LOG_MICROVG_CACHE_RECORD(path_usage, cache_statistics.entries, cache_statistics.memory_used);
+}
+
+// See the header file for the function documentation
+void VG_PATH_CACHE_VGLITE_get_statistics(VG_PATH_CACHE_VGLITE_statistics_t *statistics) {
+	*statistics = cache_statistics;
+}
+
+#else // VG_FEATURE_PATH_CACHE
+
+// -----------------------------------------------------------------------------
+// vg_path_cache_vglite.h functions (cache disabled)
+// -----------------------------------------------------------------------------
+
+// See the header file for the function documentation
+vg_lite_path_t * VG_PATH_CACHE_VGLITE_get_path(VG_PATH_HEADER_t *path) {
+	return VG_DRAWING_VGLITE_to_vglite_path(path);
+}
+
+// See the header file for the function documentation
+void VG_PATH_CACHE_VGLITE_clear(void) {
+	// nothing to clear
+}
+
+// See the header file for the function documentation
+void VG_PATH_CACHE_VGLITE_get_statistics(VG_PATH_CACHE_VGLITE_statistics_t *statistics) {
+	(void)memset(statistics, 0, sizeof(VG_PATH_CACHE_VGLITE_statistics_t));
+}
+
+#endif // VG_FEATURE_PATH_CACHE
+
+// -----------------------------------------------------------------------------
+// EOF
+// -----------------------------------------------------------------------------
@@ -27,6 +27,21 @@
 // vg_vglite_helper.h functions
 // -----------------------------------------------------------------------------
 
+// See the header file for the function documentation
+void VG_VGLITE_HELPER_to_vg_lite_gradient_matrix(vg_lite_linear_gradient_t *gradient, const jint *gradientData,
+                                                 const jfloat *matrix, const jfloat *globalMatrix) {
+	const MICROVG_GRADIENT_HEADER_t *header = (const MICROVG_GRADIENT_HEADER_t *)gradientData;
+
+	// calculate gradient's matrix (scale must be done after the rotate, otherwise the rotation is eccentric (or put
+	// the same ratio for scale x and y)).
+	jfloat *mapped_gradient_matrix = MAP_VGLITE_GRADIENT_MATRIX(gradient);
+	LLVG_MATRIX_IMPL_copy(mapped_gradient_matrix, globalMatrix);
+	LLVG_MATRIX_IMPL_concatenate(mapped_gradient_matrix, matrix);
+	LLVG_MATRIX_IMPL_translate(mapped_gradient_matrix, header->x, header->y);
+	LLVG_MATRIX_IMPL_rotate(mapped_gradient_matrix, header->angle);
+	LLVG_MATRIX_IMPL_scale(mapped_gradient_matrix, header->length / VGLITE_GRADIENT_SIZE, 1);
+}
+
 // See the header file for the function documentation
 vg_lite_error_t VG_VGLITE_HELPER_to_vg_lite_gradient(vg_lite_linear_gradient_t *gradient, const jint *gradientData,
                                                      const jfloat *matrix, const jfloat *globalMatrix,
@@ -37,14 +52,7 @@ vg_lite_error_t VG_VGLITE_HELPER_to_vg_lite_gradient(vg_lite_linear_gradient_t *
 	if (count <= VLC_MAX_GRAD) {
 		(void)memset(gradient, 0, sizeof(vg_lite_linear_gradient_t));
 
-		// calculate gradient's matrix (scale must be done after the rotate, otherwise the rotation is eccentric (or put
-		// the same ratio for scale x and y)).
-		jfloat *mapped_gradient_matrix = MAP_VGLITE_GRADIENT_MATRIX(gradient);
-		LLVG_MATRIX_IMPL_copy(mapped_gradient_matrix, globalMatrix);
-		LLVG_MATRIX_IMPL_concatenate(mapped_gradient_matrix, matrix);
-		LLVG_MATRIX_IMPL_translate(mapped_gradient_matrix, header->x, header->y);
-		LLVG_MATRIX_IMPL_rotate(mapped_gradient_matrix, header->angle);
-		LLVG_MATRIX_IMPL_scale(mapped_gradient_matrix, header->length / VGLITE_GRADIENT_SIZE, 1);
+		VG_VGLITE_HELPER_to_vg_lite_gradient_matrix(gradient, gradientData, matrix, globalMatrix);
 
 		// update vg lite colors
 		uint32_t *colors_addr = &(((uint32_t *)header)[header->colors_offset]);
@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+'''ui_event_recorder_decode.py
+
+Decode the dump of the UI event recorder (see port/ui/inc/ui_event_recorder.h).
+
+The dump is printed on the target console by LLUI_INPUT_dump() when the BSP is built
+with UI_FEATURE_EVENT_RECORDER. Give the console log (file or standard input): the
+lines around the dump are ignored, the last dump is decoded.
+
+The ticks of the entries are unwrapped (the counter wraps at 2^32 ticks, about 4.3 s
+at 1 GHz): a gap longer than one wrap between two consecutive entries cannot be
+detected and shortens the timeline.'''
+
+import argparse
+import sys
+
+DUMP_VERSION = 1
+
+KINDS = {
+    1: 'QUEUE_EVENT',
+    2: 'QUEUE_DATA',
+    3: 'QUEUE_REPLACE',
+    4: 'QUEUE_READ',
+    5: 'QUEUE_FULL',
+    6: 'DISPLAY_FLUSH',
+    7: 'DISPLAY_SWAP',
+}
+
+# MicroUI event types (bits 24-31 of the event's first element, see microui_event_decoder.c)
+EVENT_TYPES = {
+    0x00: 'Command',
+    0x01: 'Buttons',
+    0x02: 'Pointer',
+    0x03: 'States',
+    0x05: 'callSerially',
+    0x06: 'stop',
+    0x07: 'Input',
+    0x08: 'show',
+    0x09: 'hide',
+    0x0b: 'flush',
+    0x0c: 'forceFlush',
+    0x0d: 'repaintDisplayable',
+    0x0e: 'repaintCurrent',
+    0x0f: 'KFSwitch',
+}
+
+# actions of the buttons and pointer events (bits 8-15)
+ACTIONS = {0: 'pressed', 1: 'released', 2: 'long', 3: 'repeated', 4: 'click', 5: 'double-click', 6: 'move',
+           7: 'drag'}
+
+
+def is_pointer_event(event, touch_generator):
+    event_type = (event >> 24) & 0xff
+    return 0x02 == event_type or (0x07 == event_type and touch_generator == (event >> 16) & 0xff)
+
+
+def describe_event(event):
+    event_type = (event >> 24) & 0xff
+    generator = (event >> 16) & 0xff
+    name = EVENT_TYPES.get(event_type, 'user(0x{:02x})'.format(event_type))
+    if event_type in (0x01, 0x02, 0x07):
+        action = (event >> 8) & 0xff
+        return '{} generator={} action={}'.format(name, generator, ACTIONS.get(action, action))
+    return '{} 0x{:04x}'.format(name, event & 0xffff)
+
+
+def describe_data(event, data, touch_generator):
+    if is_pointer_event(event, touch_generator):
+        x = (data >> 16) & 0xfff
+        y = data & 0xfff
+        return 'at {},{} ({})'.format(x, y, 'relative' if data & 0x80000000 else 'absolute')
+    return '0x{:08x}'.format(data)
+
+
+def parse_dump(lines):
+    dump = None
+    header = None
+    entries = []
+    for line in lines:
+        fields = line.split()
+        if len(fields) >= 2 and 'UI_EVENT_RECORDER' == fields[0]:
+            if 'END' == fields[1]:
+                if header is not None:
+                    dump = (header, entries)
+                header = None
+            else:
+                header = [int(f) for f in fields[1:5]]
+                entries = []
+        elif header is not None and 5 == len(fields):
+            try:
+                entries.append(tuple(int(f, 16) for f in fields))
+            except ValueError:
+                pass
+    if dump is None:
+        sys.exit('no complete UI_EVENT_RECORDER dump found')
+    return dump
+
+
+def decode(header, entries, touch_generator, out):
+    version, size, ticks_per_us, next_sequence = header
+    if DUMP_VERSION != version:
+        sys.exit('unsupported dump version {}'.format(version))
+
+    # keep the entries whose sequence matches their slot (the others were being written)
+    first = (next_sequence - min(next_sequence, size)) & 0xffffffff
+    valid = []
+    for i, entry in enumerate(entries):
+        if entry[0] == (first + i) & 0xffffffff:
+            valid.append(entry)
+    valid.sort(key=lambda e: (e[0] - first) & 0xffffffff)
+    out.write('{} entries ({} dropped), {} ticks/us\n'.format(len(valid), len(entries) - len(valid), ticks_per_us))
+
+    time = 0
+    previous_ticks = None
+    current_event = 0
+    for sequence, ticks, data, kind, index in valid:
+        if previous_ticks is not None:
+            time += (ticks - previous_ticks) & 0xffffffff
+        previous_ticks = ticks
+        us = time / max(ticks_per_us, 1)
+
+        name = KINDS.get(kind, 'kind({})'.format(kind))
+        if kind in (1, 3, 5):
+            current_event = data
+            text = describe_event(data)
+        elif 2 == kind:
+            text = describe_data(current_event, data, touch_generator)
+        elif 6 == kind:
+            text = 'regions={}'.format(data)
+        else:
+            text = '0x{:08x}'.format(data)
+        out.write('{:>8} {:>14.1f} us  {:<14} [{:>3}] {}\n'.format(sequence, us, name, index, text))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the dump of the UI event recorder.')
+    parser.add_argument('log', nargs='?', help='console log with the dump (default: standard input)')
+    parser.add_argument('--touch-generator', type=int, default=-1,
+                        help='identifier of the touch event generator (see microui_constants.h)')
+    args = parser.parse_args()
+
+    if args.log:
+        with open(args.log, errors='replace') as f:
+            header, entries = parse_dump(f)
+    else:
+        header, entries = parse_dump(sys.stdin)
+    decode(header, entries, args.touch_generator, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
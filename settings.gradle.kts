@@ -1,10 +1,11 @@
 rootProject.name = "nxpvee-mimxrt1170-evk"
-include("vee-port", "vee-port:front-panel", "vee-port:mock", "vee-port:image-generator")
+include("vee-port", "vee-port:front-panel", "vee-port:mock", "vee-port:image-generator", "vee-port:natives")
 include("apps:aiSample", "apps:animatedMascot", "apps:simpleGFX", "apps:HelloWorld")
 
 project(":vee-port:front-panel").projectDir = file("vee-port/extensions/front-panel")
 project(":vee-port:mock").projectDir = file("vee-port/mock")
 project(":vee-port:image-generator").projectDir = file("vee-port/extensions/image-generator")
+project(":vee-port:natives").projectDir = file("vee-port/natives")
 
 include("vee-port:validation:ai")
 include("vee-port:validation:core")
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+package com.nxp.debug;
+
+/**
+ * Simulates the frame timeline: the simulator does not measure the stages of the frames, the stages have no sample.
+ */
+public class FrameTimeline {
+
+	/**
+	 * Gets the number of samples of a stage.
+	 *
+	 * @param stage the stage.
+	 * @return always 0.
+	 */
+	public static int getStageCount(int stage) {
+		return 0;
+	}
+
+	/**
+	 * Gets a percentile of a stage.
+	 *
+	 * @param stage the stage.
+	 * @param percentile the percentile.
+	 * @return always 0.
+	 */
+	public static int getStagePercentile(int stage, int percentile) {
+		return 0;
+	}
+
+	/**
+	 * Gets the longest sample of a stage.
+	 *
+	 * @param stage the stage.
+	 * @return always 0.
+	 */
+	public static int getStageMax(int stage) {
+		return 0;
+	}
+
+	/**
+	 * Clears the histograms of all the stages.
+	 */
+	public static void resetStages() {
+		// no histogram
+	}
+
+	/**
+	 * Dumps the percentiles of all the stages.
+	 */
+	public static void dumpStages() {
+		// no histogram
+	}
+
+	private FrameTimeline() {
+		// Prevent instantiation.
+	}
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+package com.nxp.event;
+
+/**
+ * Simulates the sample times of the touch events: the Front Panel does not number its touch events, no time is known.
+ */
+public class TouchTimes {
+
+	/**
+	 * Gets the number of touch events added to the MicroUI events queue.
+	 *
+	 * @return always 0.
+	 */
+	public static int getTouchEventCount() {
+		return 0;
+	}
+
+	/**
+	 * Gets the time when a touch event has been sampled.
+	 *
+	 * @param event the number of the touch event.
+	 * @return always -1: the time is unknown.
+	 */
+	public static long getTouchEventTime(int event) {
+		return -1;
+	}
+
+	private TouchTimes() {
+		// Prevent instantiation.
+	}
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+package com.nxp.ui;
+
+/**
+ * Simulates the calibration of the cost model: the simulator has no GPU, nothing is measured.
+ */
+public class CostModel {
+
+	/**
+	 * Measures the cost model.
+	 *
+	 * @param gc the 16-bit graphics context.
+	 * @param gc32bpp the 32-bit graphics context or <code>null</code>.
+	 * @param image the image to draw.
+	 * @return always <code>false</code>.
+	 */
+	public static boolean calibrate(byte[] gc, byte[] gc32bpp, byte[] image) {
+		return false;
+	}
+
+	private CostModel() {
+		// Prevent instantiation.
+	}
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+
+package com.nxp.ui;
+
+/**
+ * Simulates the cache of the layers: the simulator has no GPU, no layer is captured and the application always renders
+ * the compositions.
+ */
+public class LayerCache {
+
+	/**
+	 * Removes a layer from the cache.
+	 *
+	 * @param layer the identifier of the layer.
+	 */
+	public static void invalidate(int layer) {
+		// no layer in the cache
+	}
+
+	/**
+	 * Removes all the layers from the cache.
+	 */
+	public static void invalidateAll() {
+		// no layer in the cache
+	}
+
+	/**
+	 * Captures a region of the graphics context in a layer.
+	 *
+	 * @param gc the graphics context.
+	 * @param layer the identifier of the layer.
+	 * @param x the left of the region.
+	 * @param y the top of the region.
+	 * @param width the width of the region.
+	 * @param height the height of the region.
+	 * @return always <code>false</code>.
+	 */
+	public static boolean capture(byte[] gc, int layer, int x, int y, int width, int height) {
+		return false;
+	}
+
+	/**
+	 * Draws a layer in the graphics context.
+	 *
+	 * @param gc the graphics context.
+	 * @param layer the identifier of the layer.
+	 * @param x the left of the layer.
+	 * @param y the top of the layer.
+	 * @return always <code>false</code>: the layer is not in the cache.
+	 */
+	public static boolean draw(byte[] gc, int layer, int x, int y) {
+		return false;
+	}
+
+	private LayerCache() {
+		// Prevent instantiation.
+	}
+}
@@ -0,0 +1,12 @@
+plugins {
+    id("com.microej.gradle.library")
+}
+
+microej {
+    skippedCheckers = "changelog,readme,license,nullanalysis"
+}
+
+dependencies {
+    implementation(libs.api.edc)
+    implementation(libs.api.microui)
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+package com.nxp.debug;
+
+/**
+ * Gives the histograms of the stages of the frames measured by the VEE Port (frame timeline).
+ * <p>
+ * The time of the Graphics Engine is charged to one stage at a time: the drawing, the restoration of the back buffer,
+ * the waits for the GPU and the flush. The whole frame is the sum of these stages. The display swap is measured in the
+ * display task and is not part of the frame.
+ * <p>
+ * The durations are in microseconds; a percentile is the upper bound of a histogram bucket (its precision is 12.5%).
+ * The frame timeline is available when the option <code>FRAMERATE_ENABLED</code> is set in the BSP. Otherwise (and in
+ * simulation), the stages have no sample.
+ */
+public class FrameTimeline {
+
+	/**
+	 * The whole frame.
+	 */
+	public static final int STAGE_FRAME = 0;
+
+	/**
+	 * The drawings of the application.
+	 */
+	public static final int STAGE_DRAWING = 1;
+
+	/**
+	 * The restoration of the back buffer.
+	 */
+	public static final int STAGE_RESTORE = 2;
+
+	/**
+	 * The waits for the end of the GPU operations.
+	 */
+	public static final int STAGE_GPU_WAIT = 3;
+
+	/**
+	 * The flush of the back buffer.
+	 */
+	public static final int STAGE_FLUSH = 4;
+
+	/**
+	 * The waits for the display swap (not part of the frame).
+	 */
+	public static final int STAGE_SWAP = 5;
+
+	/**
+	 * Gets the number of samples of a stage.
+	 *
+	 * @param stage the stage (<code>STAGE_xxx</code>).
+	 * @return the number of samples, 0 when the stage is unknown.
+	 */
+	public static native int getStageCount(int stage);
+
+	/**
+	 * Gets a percentile of a stage.
+	 *
+	 * @param stage the stage (<code>STAGE_xxx</code>).
+	 * @param percentile the percentile, from 0 to 100.
+	 * @return the percentile in microseconds, 0 when the stage is unknown.
+	 */
+	public static native int getStagePercentile(int stage, int percentile);
+
+	/**
+	 * Gets the longest sample of a stage.
+	 *
+	 * @param stage the stage (<code>STAGE_xxx</code>).
+	 * @return the longest sample in microseconds, 0 when the stage is unknown.
+	 */
+	public static native int getStageMax(int stage);
+
+	/**
+	 * Clears the histograms of all the stages.
+	 */
+	public static native void resetStages();
+
+	/**
+	 * Dumps the percentiles of all the stages over the trace channel.
+	 */
+	public static native void dumpStages();
+
+	private FrameTimeline() {
+		// Prevent instantiation.
+	}
+}
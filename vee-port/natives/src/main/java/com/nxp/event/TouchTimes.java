@@ -0,0 +1,37 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+package com.nxp.event;
+
+/**
+ * Gives the time when the touch events have been sampled.
+ * <p>
+ * The MicroUI touch events do not hold their sample time: the application only knows when it handles them. The VEE
+ * Port numbers the touch events (press, move and release) in the order they are added to the MicroUI events queue and
+ * keeps the sample times of the latest events. The application counts the touch events it handles: the n-th touch
+ * event handled has the number n. A move event that replaces a move not handled yet (MicroUI coalesces the moves)
+ * keeps its number and takes the time of the latest sample.
+ */
+public class TouchTimes {
+
+	/**
+	 * Gets the number of touch events added to the MicroUI events queue since the startup (the number of the latest
+	 * event).
+	 *
+	 * @return the number of touch events.
+	 */
+	public static native int getTouchEventCount();
+
+	/**
+	 * Gets the time when a touch event has been sampled.
+	 *
+	 * @param event the number of the touch event (from 1 to {@link #getTouchEventCount()}).
+	 * @return the platform time in milliseconds, or -1 when the event is too old.
+	 */
+	public static native long getTouchEventTime(int event);
+
+	private TouchTimes() {
+		// Prevent instantiation.
+	}
+}
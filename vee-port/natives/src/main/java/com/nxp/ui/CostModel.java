@@ -0,0 +1,55 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+package com.nxp.ui;
+
+import ej.microui.display.GraphicsContext;
+import ej.microui.display.Image;
+
+/**
+ * Calibration of the cost model that dispatches the drawings to the GPU or to the software algorithms.
+ * <p>
+ * The calibration draws filled rectangles, filled circles and an image in squares from 1x1 to 128x128 pixels at the
+ * top-left corner of the graphics contexts (their content is lost), with the GPU and with the software algorithms. It
+ * prints the measured model on the standard output (the defines <code>VGLITE_COST_xxx</code> to copy in
+ * <code>ui_vglite_configuration.h</code>) and, when the option <code>VGLITE_COST_MODEL</code> is set, the model is
+ * applied immediately.
+ * <p>
+ * The calibration is available when the option <code>VGLITE_COST_CALIBRATION</code> is set in the BSP. Otherwise
+ * (and in simulation), nothing is measured.
+ */
+public class CostModel {
+
+	/**
+	 * Measures the cost model in a 16-bit graphics context. The cost of the 32-bit destinations is not measured.
+	 *
+	 * @param gc the 16-bit (RGB565) graphics context.
+	 * @param image the image to draw, in a format drawn by the GPU.
+	 * @return <code>false</code> when the calibration is disabled or when the graphics context or the image is not
+	 *         supported.
+	 */
+	public static boolean calibrate(GraphicsContext gc, Image image) {
+		return calibrate(gc.getSNIContext(), null, image.getSNIContext());
+	}
+
+	/**
+	 * Measures the cost model in a 16-bit graphics context and the cost of the software algorithms in a 32-bit
+	 * graphics context.
+	 *
+	 * @param gc the 16-bit (RGB565) graphics context.
+	 * @param gc32bpp the 32-bit graphics context.
+	 * @param image the image to draw, in a format drawn by the GPU.
+	 * @return <code>false</code> when the calibration is disabled or when a graphics context or the image is not
+	 *         supported.
+	 */
+	public static boolean calibrate(GraphicsContext gc, GraphicsContext gc32bpp, Image image) {
+		return calibrate(gc.getSNIContext(), gc32bpp.getSNIContext(), image.getSNIContext());
+	}
+
+	private static native boolean calibrate(byte[] gc, byte[] gc32bpp, byte[] image);
+
+	private CostModel() {
+		// Prevent instantiation.
+	}
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 MicroEJ Corp. All rights reserved.
+ * Use of this source code is governed by a BSD-style license that can be found with this software.
+ */
+package com.nxp.ui;
+
+import ej.microui.display.GraphicsContext;
+
+/**
+ * Cache of the layers: a layer is a region of the display captured once and blitted by the GPU on the next frames.
+ * <p>
+ * A static composition is rendered once, captured in a layer and then drawn with the layer: one GPU copy replaces all
+ * the drawings of the composition. A layer is drawn only when it is in the cache (the cache evicts the least recently
+ * drawn layers when it is full): when {@link #draw(GraphicsContext, int, int, int)} returns <code>false</code>, the
+ * composition has to be rendered and can be captured again.
+ * <p>
+ * A layer holds the pixels of the display: it is opaque. It must be captured after the composition is rendered and
+ * before anything else is drawn over it. The layer identifiers are chosen by the application.
+ * <p>
+ * The cache is available when the option <code>VGLITE_LAYER_CACHE</code> is set in the BSP. Otherwise (and in
+ * simulation), no layer is captured and the composition is always rendered.
+ */
+public class LayerCache {
+
+	/**
+	 * Captures a region of the graphics context in a layer. The previous content of the layer (if any) is replaced.
+	 *
+	 * @param gc the graphics context that holds the rendered composition.
+	 * @param layer the identifier of the layer.
+	 * @param x the left of the region (relative to the translation of the graphics context).
+	 * @param y the top of the region (relative to the translation of the graphics context).
+	 * @param width the width of the region.
+	 * @param height the height of the region.
+	 * @return <code>false</code> when the region cannot be captured (region out of the graphics context, cache
+	 *         disabled or full).
+	 */
+	public static boolean capture(GraphicsContext gc, int layer, int x, int y, int width, int height) {
+		return capture(gc.getSNIContext(), layer, x + gc.getTranslationX(), y + gc.getTranslationY(), width, height);
+	}
+
+	/**
+	 * Draws a layer in the graphics context (the clip is respected).
+	 *
+	 * @param gc the destination graphics context.
+	 * @param layer the identifier of the layer.
+	 * @param x the left of the layer (relative to the translation of the graphics context).
+	 * @param y the top of the layer (relative to the translation of the graphics context).
+	 * @return <code>false</code> when the layer is not in the cache: nothing has been drawn, the composition has
+	 *         to be rendered.
+	 */
+	public static boolean draw(GraphicsContext gc, int layer, int x, int y) {
+		return draw(gc.getSNIContext(), layer, x + gc.getTranslationX(), y + gc.getTranslationY());
+	}
+
+	/**
+	 * Removes a layer from the cache (if any). The layer must be invalidated when its composition changes.
+	 *
+	 * @param layer the identifier of the layer.
+	 */
+	public static native void invalidate(int layer);
+
+	/**
+	 * Removes all the layers from the cache.
+	 */
+	public static native void invalidateAll();
+
+	private static native boolean capture(byte[] gc, int layer, int x, int y, int width, int height);
+
+	private static native boolean draw(byte[] gc, int layer, int x, int y);
+
+	private LayerCache() {
+		// Prevent instantiation.
+	}
+}